@@ -0,0 +1,930 @@
+#include <Inopine/Inopine.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdlib>
+
+/* Usage: InopineBench [options] [buffer size in MiB] [file to checksum] [PNG files to decode...] (configure with -DCMAKE_BUILD_TYPE=Release) */
+/*   --kernels            Only runs the kernel suite (vector, matrix, checksum & endian kernels at every SIMD level & working set)            */
+/*   --json <file>        Writes the results of the kernel suite to "file"                                                                    */
+/*   --baseline <file>    Compares the kernel suite to results saved with "--json", exits with a failure if a kernel regressed                */
+/*   --threshold <%>      Slowdown (in ns/op) past which a kernel counts as a regression, 10% by default                                      */
+/*   --runs <n>           Runs the kernel suite "n" times & keeps the best result of each kernel, which filters out noisy machines            */
+
+// Best throughput in GB/s of "function" over "repetitions" runs on "byteCount" bytes
+template <typename _F>
+static double MeasureThroughput(const std::uint64_t byteCount, const size_t repetitions, const _F& function)
+{
+    double bestSeconds = std::numeric_limits<double>::max();
+
+    for (size_t r = 0u; r < repetitions; r++) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto end = std::chrono::steady_clock::now();
+
+        bestSeconds = std::min(bestSeconds, std::chrono::duration<double>(end - start).count());
+    }
+
+    return static_cast<double>(byteCount) / bestSeconds / 1e9;
+}
+
+static void BenchmarkChecksums(const std::uint8_t* data, const std::uint64_t len)
+{
+    constexpr const size_t REPETITIONS = 5u;
+
+    volatile std::uint32_t sink = 0u; // Keeps the checksums from being optimized away
+
+    std::cout << "CRC32   Calculate      (1 thread):  " << MeasureThroughput(len, REPETITIONS, [&]() { sink = IE::CRC32::Calculate(data, len); }) << " GB/s\n";
+    std::cout << "ALDER32 Calculate      (1 thread):  " << MeasureThroughput(len, REPETITIONS, [&]() { sink = IE::ALDER32::Calculate(data, len); }) << " GB/s\n";
+
+    for (size_t threadCount = 1u; ; threadCount *= 2u) {
+        threadCount = std::min(threadCount, IE::GetHardwareThreadCount());
+
+        std::cout << "CRC32   UpdateParallel (" << threadCount << " threads): "
+                  << MeasureThroughput(len, REPETITIONS, [&]() { sink = IE::CRC32::UpdateParallel(IE::CRC32::Init(), data, len, threadCount); }) << " GB/s\n";
+        std::cout << "ALDER32 UpdateParallel (" << threadCount << " threads): "
+                  << MeasureThroughput(len, REPETITIONS, [&]() { sink = IE::ALDER32::UpdateParallel(IE::ALDER32::Init(), data, len, threadCount); }) << " GB/s\n";
+
+        if (threadCount == IE::GetHardwareThreadCount())
+            break;
+    }
+
+    // The parallel results must match the sequential ones
+    if (IE::CRC32::UpdateParallel(IE::CRC32::Init(), data, len) != IE::CRC32::Calculate(data, len) ||
+        IE::ALDER32::UpdateParallel(IE::ALDER32::Init(), data, len) != IE::ALDER32::Calculate(data, len))
+        std::cout << "Error: the parallel & sequential checksums differ\n";
+}
+
+// Best time in milliseconds of "function" over "repetitions" runs
+template <typename _F>
+static double MeasureMilliseconds(const size_t repetitions, const _F& function)
+{
+    double bestSeconds = std::numeric_limits<double>::max();
+
+    for (size_t r = 0u; r < repetitions; r++) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto end = std::chrono::steady_clock::now();
+
+        bestSeconds = std::min(bestSeconds, std::chrono::duration<double>(end - start).count());
+    }
+
+    return bestSeconds * 1e3;
+}
+
+// Draws 4 overlapping layers of a 1080p screen covered by a grid of small triangles, at every SIMD level & thread count
+// into "target" (1920x1080), which is left with the last frame
+static void BenchmarkRasterizer(IE::RenderTarget& target)
+{
+    constexpr const size_t REPETITIONS = 10u;
+    constexpr const std::uint32_t GRID_X = 192u, GRID_Y = 108u, LAYERS = 4u;
+
+    std::vector<IE::Vecf32>    positions;
+    std::vector<IE::Vecf32>    colors;
+    std::vector<std::uint32_t> indices;
+
+    for (std::uint32_t layer = 0u; layer < LAYERS; layer++) {
+        const float w = 1.0f + static_cast<float>(layer) * 0.25f;
+        const std::uint32_t firstVertex = static_cast<std::uint32_t>(positions.size());
+
+        for (std::uint32_t y = 0u; y <= GRID_Y; y++) {
+            for (std::uint32_t x = 0u; x <= GRID_X; x++) {
+                const float u = static_cast<float>(x) / GRID_X, v = static_cast<float>(y) / GRID_Y;
+
+                // Layers in the back are drawn first so that the depth test passes (worst case)
+                positions.emplace_back((u * 2.0f - 1.0f) * w, (v * 2.0f - 1.0f) * w, (0.9f - 0.2f * static_cast<float>(layer)) * w, w);
+                colors.emplace_back(u, v, static_cast<float>(layer) / LAYERS, 1.0f);
+            }
+        }
+
+        for (std::uint32_t y = 0u; y < GRID_Y; y++) {
+            for (std::uint32_t x = 0u; x < GRID_X; x++) {
+                const std::uint32_t i = firstVertex + y * (GRID_X + 1u) + x;
+
+                indices.insert(indices.end(), { i, i + 1u, i + GRID_X + 1u, i + 1u, i + GRID_X + 2u, i + GRID_X + 1u });
+            }
+        }
+    }
+
+    const IE::SIMDLevel maxLevel = IE::GetSIMDLevel();
+
+    for (int level = 0; level <= static_cast<int>(maxLevel); level++) {
+        const IE::SIMDLevel simdLevel = IE::SetSIMDLevel(static_cast<IE::SIMDLevel>(level));
+
+        for (size_t threadCount = 1u; ; threadCount *= 2u) {
+            threadCount = std::min(threadCount, IE::GetHardwareThreadCount());
+
+            IE::Rasterizer rasterizer(threadCount);
+
+            const double milliseconds = MeasureMilliseconds(REPETITIONS, [&]() {
+                target.Clear(0xFF000000u);
+                rasterizer.DrawTriangles(target, positions, colors, indices);
+            });
+
+            std::cout << "Rasterizer " << IE::GetSIMDLevelName(simdLevel) << " (" << threadCount << " threads): " << milliseconds << " ms/frame, "
+                      << static_cast<double>(indices.size() / 3u) / milliseconds / 1e3 << " Mtri/s\n";
+
+            if (threadCount == IE::GetHardwareThreadCount())
+                break;
+        }
+    }
+
+    IE::SetSIMDLevel(maxLevel);
+}
+
+// Generates the mips of a 1024x1024 image, then samples it at every SIMD level with every filter
+template <typename _COLOR>
+static void BenchmarkImage(const char* name)
+{
+    constexpr const size_t REPETITIONS = 5u;
+    constexpr const size_t SIZE = 1024u, SAMPLE_COUNT = 1u << 20u;
+    constexpr const char* FILTER_NAMES[] = { "Nearest", "Bilinear", "Trilinear" };
+
+    IE::Image<_COLOR> image(SIZE, SIZE, true);
+
+    for (size_t y = 0u; y < SIZE; y++)
+        for (size_t x = 0u; x < SIZE; x++)
+            image.SetTexel(x, y, _COLOR(static_cast<std::uint8_t>(x ^ y), static_cast<std::uint8_t>(x), static_cast<std::uint8_t>(y), 255u));
+
+    const double boxMs    = MeasureMilliseconds(REPETITIONS, [&]() { image.GenerateMipmaps(IE::MipmapFilter::BOX); });
+    const double kaiserMs = MeasureMilliseconds(REPETITIONS, [&]() { image.GenerateMipmaps(IE::MipmapFilter::KAISER); });
+
+    std::cout << "Image<" << name << "> Mipmaps: box " << boxMs << " ms, kaiser " << kaiserMs << " ms\n";
+
+    // A rotated & slightly minified grid, as a textured quad would sample it
+    std::vector<float> u(SAMPLE_COUNT), v(SAMPLE_COUNT);
+    for (size_t i = 0u; i < SAMPLE_COUNT; i++) {
+        const float x = static_cast<float>(i % SIZE) / SIZE, y = static_cast<float>(i / SIZE) / SIZE;
+
+        u[i] = 1.3f * (0.8f * x - 0.6f * y);
+        v[i] = 1.3f * (0.6f * x + 0.8f * y);
+    }
+
+    std::vector<_COLOR> out(SAMPLE_COUNT);
+    const IE::SIMDLevel maxLevel = IE::GetSIMDLevel();
+
+    for (int level = 0; level <= static_cast<int>(maxLevel); level++) {
+        const IE::SIMDLevel simdLevel = IE::SetSIMDLevel(static_cast<IE::SIMDLevel>(level));
+
+        std::cout << "Image<" << name << "> Sample " << IE::GetSIMDLevelName(simdLevel) << ':';
+
+        for (int filter = 0; filter <= static_cast<int>(IE::SamplerFilter::TRILINEAR); filter++) {
+            IE::Sampler sampler;
+            sampler.m_filter = static_cast<IE::SamplerFilter>(filter);
+
+            const double milliseconds = MeasureMilliseconds(REPETITIONS, [&]() { image.Sample(sampler, u, v, 0.4f, out); });
+
+            std::cout << ' ' << FILTER_NAMES[filter] << ' ' << static_cast<double>(SAMPLE_COUNT) / milliseconds / 1e3 << " Msamples/s";
+        }
+
+        std::cout << '\n';
+    }
+
+    IE::SetSIMDLevel(maxLevel);
+}
+
+// Encodes a 1920x1080 HDR frame with every tone map at each SIMD level, the step before presenting a frame rendered in floats
+static void BenchmarkColorConversion()
+{
+    constexpr const size_t REPETITIONS = 5u;
+    constexpr const size_t PIXEL_COUNT = 1920u * 1080u;
+    constexpr const char* TONE_MAP_NAMES[] = { "None", "Reinhard", "ACES" };
+
+    std::vector<IE::Colorf32> colors(PIXEL_COUNT);
+    for (size_t i = 0u; i < PIXEL_COUNT; i++) {
+        const float x = static_cast<float>(i % 1920u) / 1920.0f, y = static_cast<float>(i / 1920u) / 1080.0f;
+
+        colors[i] = IE::Colorf32(4.0f * x * y, x, y, 1.0f);
+    }
+
+    std::vector<std::uint32_t> pixels(PIXEL_COUNT);
+    std::vector<std::uint16_t> pixels565(PIXEL_COUNT);
+    std::vector<IE::Coloru8>   colorsU8(PIXEL_COUNT);
+
+    const IE::SIMDLevel maxLevel = IE::GetSIMDLevel();
+
+    for (int level = 0; level <= static_cast<int>(maxLevel); level++) {
+        const IE::SIMDLevel simdLevel = IE::SetSIMDLevel(static_cast<IE::SIMDLevel>(level));
+
+        std::cout << "Colors " << IE::GetSIMDLevelName(simdLevel) << ": BGRA8 sRGB";
+
+        for (int toneMap = 0; toneMap <= static_cast<int>(IE::ToneMapOperator::ACES); toneMap++) {
+            const IE::ColorEncoding encoding{ IE::ColorSpace::SRGB, static_cast<IE::ToneMapOperator>(toneMap), 1.0f };
+
+            const double milliseconds = MeasureMilliseconds(REPETITIONS, [&]() { IE::PackBGRA8(colors, pixels, encoding); });
+
+            std::cout << ' ' << TONE_MAP_NAMES[toneMap] << ' ' << milliseconds << " ms";
+        }
+
+        const double linearMs = MeasureMilliseconds(REPETITIONS, [&]() { IE::PackBGRA8(colors, pixels); });
+        const double rgb565Ms = MeasureMilliseconds(REPETITIONS, [&]() { IE::PackRGB565(colors, pixels565); });
+
+        IE::ConvertColors(colors, colorsU8, IE::ColorEncoding{ IE::ColorSpace::SRGB });
+        const double decodeMs = MeasureMilliseconds(REPETITIONS, [&]() { IE::ConvertColors(colorsU8, colors, IE::ColorSpace::SRGB); });
+
+        std::cout << ", linear " << linearMs << " ms, RGB565 " << rgb565Ms << " ms, sRGB decode " << decodeMs << " ms\n";
+    }
+
+    IE::SetSIMDLevel(maxLevel);
+}
+
+/* Scaling of the job system with 1, 2, 4... threads (the calling thread & "threadCount - 1" workers): a compute bound */
+/* "ParallelFor" over 4M floats with grains of 4096 & 64 indices, then the cost of starting & waiting for empty jobs. */
+/* The dependency case only waits for the continuations, so its counters die as soon as the continuations are done. */
+static void BenchmarkJobSystem()
+{
+    constexpr const size_t REPETITIONS = 5u;
+    constexpr const size_t ELEMENT_COUNT = 1u << 22u, JOB_COUNT = 1u << 16u;
+    constexpr const size_t DEPENDENCY_ROUNDS = 1024u, JOBS_PER_ROUND = 64u;
+
+    std::vector<float> values(ELEMENT_COUNT);
+
+    // A few dependent multiply-adds per element, so that the loop doesn't become memory bound with more threads
+    const auto iterate = [&values](const size_t first, const size_t last) noexcept {
+        for (size_t i = first; i < last; i++) {
+            float x = static_cast<float>(i & 1023u) * (1.0f / 1024.0f);
+
+            for (size_t k = 0u; k < 16u; k++)
+                x = x * x * 0.5f + 0.25f;
+
+            values[i] = x;
+        }
+    };
+
+    double baseMilliseconds = 0.0;
+
+    for (size_t threadCount = 1u; ; threadCount *= 2u) {
+        threadCount = std::min(threadCount, IE::GetHardwareThreadCount());
+
+        IE::JobSystem jobSystem(threadCount - 1u);
+
+        const double coarseMs = MeasureMilliseconds(REPETITIONS, [&]() { jobSystem.ParallelFor(0u, ELEMENT_COUNT, 4096u, iterate); });
+        const double fineMs   = MeasureMilliseconds(REPETITIONS, [&]() { jobSystem.ParallelFor(0u, ELEMENT_COUNT, 64u, iterate); });
+
+        const double jobMs = MeasureMilliseconds(REPETITIONS, [&]() {
+            IE::JobCounter counter;
+
+            for (size_t j = 0u; j < JOB_COUNT; j++)
+                jobSystem.Run(counter, []() noexcept {});
+
+            jobSystem.Wait(counter);
+        });
+
+        std::atomic<size_t> dependencyCount{ 0u };
+
+        const double dependencyMs = MeasureMilliseconds(REPETITIONS, [&]() {
+            for (size_t round = 0u; round < DEPENDENCY_ROUNDS; round++) {
+                IE::JobCounter jobs, continuation;
+
+                for (size_t j = 0u; j < JOBS_PER_ROUND; j++)
+                    jobSystem.Run(jobs, [&dependencyCount]() noexcept { dependencyCount.fetch_add(1u, std::memory_order_relaxed); });
+
+                jobSystem.Run(continuation, [&dependencyCount]() noexcept { dependencyCount.fetch_add(1u, std::memory_order_relaxed); }, &jobs);
+                jobSystem.Wait(continuation);
+            }
+        });
+
+        if (threadCount == 1u)
+            baseMilliseconds = coarseMs;
+
+        std::cout << "JobSystem (" << threadCount << " threads): ParallelFor grain 4096 " << coarseMs << " ms (x" << baseMilliseconds / coarseMs
+                  << "), grain 64 " << fineMs << " ms, " << jobMs * 1e6 / JOB_COUNT << " ns/job, "
+                  << dependencyMs * 1e6 / (DEPENDENCY_ROUNDS * (JOBS_PER_ROUND + 1u)) << " ns/job with a continuation\n";
+
+        if (dependencyCount.load() != REPETITIONS * DEPENDENCY_ROUNDS * (JOBS_PER_ROUND + 1u))
+            std::cout << "Error: jobs with a dependency were lost\n";
+
+        if (threadCount == IE::GetHardwareThreadCount())
+            break;
+    }
+}
+
+/* Transient per-frame allocations : every frame allocates 1024 arrays of 16 to 16K floats, writes their first element */
+/* & frees them all, through the heap ("AlignedAllocator") then through a "LinearArena" that is reset every frame.    */
+static void BenchmarkMemory()
+{
+    constexpr const size_t REPETITIONS = 5u;
+    constexpr const size_t FRAME_COUNT = 64u, ALLOCATION_COUNT = 1024u;
+
+    // Sizes from a fixed sequence so both allocators see the same requests
+    std::vector<size_t> sizes(ALLOCATION_COUNT);
+    for (size_t i = 0u; i < ALLOCATION_COUNT; i++)
+        sizes[i] = size_t(16) << ((i * 2654435761u >> 7u) % 11u);
+
+    volatile float sink = 0.0f;
+
+    IE::AlignedAllocator<float> allocator;
+    std::vector<float*>         arrays(ALLOCATION_COUNT);
+
+    const double heapMs = MeasureMilliseconds(REPETITIONS, [&]() {
+        for (size_t frame = 0u; frame < FRAME_COUNT; frame++) {
+            for (size_t i = 0u; i < ALLOCATION_COUNT; i++) {
+                arrays[i]    = allocator.allocate(sizes[i]);
+                arrays[i][0] = static_cast<float>(i);
+                sink         = arrays[i][0];
+            }
+
+            for (size_t i = 0u; i < ALLOCATION_COUNT; i++)
+                allocator.deallocate(arrays[i], sizes[i]);
+        }
+    });
+
+    IE::LinearArena arena(64u << 20u);
+
+    const double arenaMs = MeasureMilliseconds(REPETITIONS, [&]() {
+        for (size_t frame = 0u; frame < FRAME_COUNT; frame++) {
+            for (size_t i = 0u; i < ALLOCATION_COUNT; i++) {
+                float* const pArray = arena.AllocateArray<float>(sizes[i]);
+                pArray[0] = static_cast<float>(i);
+                sink      = pArray[0];
+            }
+
+            arena.Reset();
+        }
+    });
+
+    std::cout << "Heap (AlignedAllocator): " << heapMs * 1e6 / (FRAME_COUNT * ALLOCATION_COUNT) << " ns/allocation\n";
+    std::cout << "LinearArena:             " << arenaMs * 1e6 / (FRAME_COUNT * ALLOCATION_COUNT) << " ns/allocation (x" << heapMs / arenaMs
+              << "), peak " << (arena.GetPeakSize() >> 10u) << " KiB\n";
+}
+
+// +--------------+
+// | Kernel Suite |
+// +--------------+
+
+// From L1-resident to DRAM-bound. A working set counts every byte a pass reads & writes.
+static constexpr std::uint64_t KERNEL_WORKING_SETS[] = { 16u << 10u, 256u << 10u, 4u << 20u, 64u << 20u };
+
+// One measurement, "ns/op" is per element (a vector, a matrix, a byte...)
+struct KernelResult {
+    std::string   m_name;
+    std::string   m_simdLevel;
+    std::uint64_t m_workingSet;
+    double        m_nsPerOp;
+    double        m_gbPerSecond;
+};
+
+/* Runs "function(memory, count)" on "count = workingSet / bytesPerOp" elements for every working set, at every SIMD */
+/* level when the kernel is dispatched & once otherwise (the "Vector" operators are compiled for the build's target). */
+/* Each sample repeats the pass until it touched 8 MiB, the best of 15 samples is kept.                             */
+template <typename _F>
+static void BenchmarkKernel(std::vector<KernelResult>& results, std::uint8_t* memory, const char* name, const size_t bytesPerOp, const bool bDispatched, const _F& function)
+{
+    constexpr const size_t SAMPLES = 15u;
+    constexpr const std::uint64_t BYTES_PER_SAMPLE = 8u << 20u;
+
+    const IE::SIMDLevel maxLevel = IE::GetSIMDLevel();
+
+    for (const std::uint64_t workingSet : KERNEL_WORKING_SETS) {
+        const size_t count  = static_cast<size_t>(workingSet / bytesPerOp);
+        const size_t passes = static_cast<size_t>(std::max<std::uint64_t>(1u, BYTES_PER_SAMPLE / workingSet));
+
+        for (int level = bDispatched ? 0 : static_cast<int>(maxLevel); level <= static_cast<int>(maxLevel); level++) {
+            const IE::SIMDLevel simdLevel = IE::SetSIMDLevel(static_cast<IE::SIMDLevel>(level));
+
+            function(memory, count); // Warms the caches up
+
+            const double milliseconds = MeasureMilliseconds(SAMPLES, [&]() {
+                for (size_t pass = 0u; pass < passes; pass++)
+                    function(memory, count);
+            });
+
+            const double operations = static_cast<double>(passes) * static_cast<double>(count);
+
+            KernelResult result;
+            result.m_name        = name;
+            result.m_simdLevel   = bDispatched ? IE::GetSIMDLevelName(simdLevel) : "Compiled";
+            result.m_workingSet  = workingSet;
+            result.m_nsPerOp     = milliseconds * 1e6 / operations;
+            result.m_gbPerSecond = operations * static_cast<double>(bytesPerOp) / (milliseconds * 1e6);
+
+            std::cout << std::left << std::setw(24) << result.m_name << std::setw(9) << result.m_simdLevel << std::right << std::setw(6)
+                      << (workingSet >> 10u) << " KiB: " << std::setw(10) << result.m_nsPerOp << " ns/op " << std::setw(10) << result.m_gbPerSecond << " GB/s\n";
+
+            // Keeps the best result of the runs
+            const auto previous = std::find_if(results.begin(), results.end(), [&](const KernelResult& other) {
+                return other.m_name == result.m_name && other.m_simdLevel == result.m_simdLevel && other.m_workingSet == result.m_workingSet;
+            });
+
+            if (previous == results.end())
+                results.push_back(std::move(result));
+            else if (result.m_nsPerOp < previous->m_nsPerOp)
+                *previous = std::move(result);
+        }
+    }
+
+    IE::SetSIMDLevel(maxLevel);
+}
+
+static void BenchmarkKernels(std::vector<KernelResult>& results)
+{
+    constexpr const std::uint64_t MEMORY_SIZE = KERNEL_WORKING_SETS[std::size(KERNEL_WORKING_SETS) - 1u];
+
+    // Floats in [1, 2) keep denormals & NaNs out of the arithmetic kernels
+    std::vector<IE::Vecf32> memoryVectors(MEMORY_SIZE / sizeof(IE::Vecf32) + 4u);
+    std::uint8_t* const memory = reinterpret_cast<std::uint8_t*>((reinterpret_cast<std::uintptr_t>(memoryVectors.data()) + 63u) & ~std::uintptr_t(63u));
+
+    for (size_t i = 0u; i < MEMORY_SIZE / sizeof(float); i++)
+        reinterpret_cast<float*>(memory)[i] = 1.0f + static_cast<float>(i % 1021u) / 1021.0f;
+
+    const IE::Matf32 matrix = IE::Matf32::MakePerspective(0.1f, 100.0f, 1.0f, 16.0f / 9.0f);
+
+    volatile std::uint32_t sink = 0u; // Keeps the checksums from being optimized away
+
+    BenchmarkKernel(results, memory, "Vector.Add", 3u * sizeof(IE::Vecf32), false, [](std::uint8_t* memory, const size_t count) {
+        const IE::Vecf32* a = reinterpret_cast<const IE::Vecf32*>(memory);
+        const IE::Vecf32* b = a + count;
+        IE::Vecf32*     out = reinterpret_cast<IE::Vecf32*>(memory) + 2u * count;
+
+        for (size_t i = 0u; i < count; i++)
+            out[i] = a[i] + b[i];
+    });
+
+    BenchmarkKernel(results, memory, "Vector.DotProduct", 2u * sizeof(IE::Vecf32) + sizeof(float), false, [](std::uint8_t* memory, const size_t count) {
+        const IE::Vecf32* a = reinterpret_cast<const IE::Vecf32*>(memory);
+        const IE::Vecf32* b = a + count;
+        float*          out = reinterpret_cast<float*>(reinterpret_cast<IE::Vecf32*>(memory) + 2u * count);
+
+        for (size_t i = 0u; i < count; i++)
+            out[i] = IE::Vecf32::DotProduct(a[i], b[i]);
+    });
+
+    // The kernels behind "VectorArray<float>::Add" & "VectorArray<float>::DotProduct", on 4 component arrays
+    BenchmarkKernel(results, memory, "VectorArray.Add", 3u * sizeof(IE::Vecf32), true, [](std::uint8_t* memory, const size_t count) {
+        const float* a = reinterpret_cast<const float*>(memory);
+
+        IE::Internal::GetSIMDKernels().m_pSoAAddF32(a, a + 4u * count, reinterpret_cast<float*>(memory) + 8u * count, 4u * count);
+    });
+
+    BenchmarkKernel(results, memory, "VectorArray.DotProduct", 2u * sizeof(IE::Vecf32) + sizeof(float), true, [](std::uint8_t* memory, const size_t count) {
+        float* const floats = reinterpret_cast<float*>(memory);
+
+        const IE::Internal::SoAStream<const float> a{ floats, floats + count, floats + 2u * count, floats + 3u * count };
+        const IE::Internal::SoAStream<const float> b{ floats + 4u * count, floats + 5u * count, floats + 6u * count, floats + 7u * count };
+
+        IE::Internal::GetSIMDKernels().m_pSoADotProductF32(a, b, floats + 8u * count, count);
+    });
+
+    BenchmarkKernel(results, memory, "Matrix.Multiply", 3u * sizeof(IE::Matf32), true, [](std::uint8_t* memory, const size_t count) {
+        const IE::Matf32* a = reinterpret_cast<const IE::Matf32*>(memory);
+        const IE::Matf32* b = a + count;
+        IE::Matf32*     out = reinterpret_cast<IE::Matf32*>(memory) + 2u * count;
+
+        for (size_t i = 0u; i < count; i++)
+            out[i] = a[i] * b[i];
+    });
+
+    BenchmarkKernel(results, memory, "Vector*Matrix", 2u * sizeof(IE::Vecf32), true, [&matrix](std::uint8_t* memory, const size_t count) {
+        const IE::Vecf32* in = reinterpret_cast<const IE::Vecf32*>(memory);
+        IE::Vecf32*      out = reinterpret_cast<IE::Vecf32*>(memory) + count;
+
+        for (size_t i = 0u; i < count; i++)
+            out[i] = in[i] * matrix;
+    });
+
+    BenchmarkKernel(results, memory, "TransformBatch", 2u * sizeof(IE::Vecf32), true, [&matrix](std::uint8_t* memory, const size_t count) {
+        const IE::Vecf32* in = reinterpret_cast<const IE::Vecf32*>(memory);
+
+        IE::TransformBatch(matrix, std::span(in, count), std::span(reinterpret_cast<IE::Vecf32*>(memory) + count, count));
+    });
+
+    // Eager operators vs expression templates ("IE::Lazy") on the same chains
+    static constexpr const float DT = 1.0f / 1024.0f;
+
+    BenchmarkKernel(results, memory, "Vector.Integrate", 5u * sizeof(IE::Vecf32), false, [](std::uint8_t* memory, const size_t count) {
+        IE::Vecf32*           positions = reinterpret_cast<IE::Vecf32*>(memory);
+        IE::Vecf32*          velocities = positions + count;
+        const IE::Vecf32* accelerations = positions + 2u * count;
+
+        for (size_t i = 0u; i < count; i++) {
+            positions[i]  += (velocities[i] + accelerations[i] * DT) * DT;
+            velocities[i] += accelerations[i] * DT;
+        }
+    });
+
+    BenchmarkKernel(results, memory, "Vector.Integrate.Lazy", 5u * sizeof(IE::Vecf32), false, [](std::uint8_t* memory, const size_t count) {
+        IE::Vecf32*           positions = reinterpret_cast<IE::Vecf32*>(memory);
+        IE::Vecf32*          velocities = positions + count;
+        const IE::Vecf32* accelerations = positions + 2u * count;
+
+        for (size_t i = 0u; i < count; i++) {
+            positions[i]  += (IE::Lazy(velocities[i]) + IE::Lazy(accelerations[i]) * DT) * DT;
+            velocities[i] += IE::Lazy(accelerations[i]) * DT;
+        }
+    });
+
+    BenchmarkKernel(results, memory, "Matrix.Chain3", 4u * sizeof(IE::Matf32), true, [](std::uint8_t* memory, const size_t count) {
+        const IE::Matf32* a = reinterpret_cast<const IE::Matf32*>(memory);
+        const IE::Matf32* b = a + count;
+        const IE::Matf32* c = a + 2u * count;
+        IE::Matf32*     out = reinterpret_cast<IE::Matf32*>(memory) + 3u * count;
+
+        for (size_t i = 0u; i < count; i++)
+            out[i] = a[i] * b[i] * c[i];
+    });
+
+    BenchmarkKernel(results, memory, "Matrix.Chain3.Lazy", 4u * sizeof(IE::Matf32), false, [](std::uint8_t* memory, const size_t count) {
+        const IE::Matf32* a = reinterpret_cast<const IE::Matf32*>(memory);
+        const IE::Matf32* b = a + count;
+        const IE::Matf32* c = a + 2u * count;
+        IE::Matf32*     out = reinterpret_cast<IE::Matf32*>(memory) + 3u * count;
+
+        for (size_t i = 0u; i < count; i++)
+            out[i] = IE::Lazy(a[i]) * b[i] * c[i];
+    });
+
+    // 8 bit channels, 32 per register with AVX2 (2 SSE registers otherwise)
+    BenchmarkKernel(results, memory, "Packed.AddSaturate", 3u, false, [](std::uint8_t* memory, const size_t count) {
+        for (size_t i = 0u; i + IE::Packedu8x32::LANE_COUNT <= count; i += IE::Packedu8x32::LANE_COUNT)
+            IE::AddSaturate(IE::Packedu8x32::Load(memory + i), IE::Packedu8x32::Load(memory + count + i)).Store(memory + 2u * count + i);
+    });
+
+    // 8 bit channels scaled by 1.25 : widened to 16 bits, multiplied in fixed point & packed back with saturation
+    BenchmarkKernel(results, memory, "Packed.Scale", 2u, false, [](std::uint8_t* memory, const size_t count) {
+        const IE::Packedi16x16 factor(640); // 1.25 * 2^16 / 2^7
+
+        for (size_t i = 0u; i + IE::Packedu8x32::LANE_COUNT <= count; i += IE::Packedu8x32::LANE_COUNT) {
+            const IE::Packedu8x32 channels = IE::Packedu8x32::Load(memory + i);
+
+            const IE::Packedi16x16 low  = IE::MulHigh(IE::UnpackLow<std::int16_t>(channels)  << 7, factor);
+            const IE::Packedi16x16 high = IE::MulHigh(IE::UnpackHigh<std::int16_t>(channels) << 7, factor);
+
+            IE::PackSaturate<std::uint8_t>(low, high).Store(memory + count + i);
+        }
+    });
+
+    BenchmarkKernel(results, memory, "Quaternion.SlerpBatch", 3u * sizeof(IE::Quatf32) + sizeof(float), true, [](std::uint8_t* memory, const size_t count) {
+        const IE::Quatf32* from = reinterpret_cast<const IE::Quatf32*>(memory);
+        const IE::Quatf32* to   = from + count;
+        IE::Quatf32*       out  = reinterpret_cast<IE::Quatf32*>(memory) + 2u * count;
+        const float*       t    = reinterpret_cast<const float*>(out + count);
+
+        IE::SlerpBatch(std::span(from, count), std::span(to, count), std::span(t, count), std::span(out, count));
+    });
+
+    // A 64 joint palette shared by every vertex, the influences are kept apart since their joints have to be valid
+    constexpr const size_t PALETTE_SIZE = 64u;
+
+    std::vector<IE::Matf32> palette(PALETTE_SIZE);
+    std::vector<IE::SkinInfluences> influences(MEMORY_SIZE / (2u * sizeof(IE::Vecf32) + sizeof(IE::SkinInfluences)));
+
+    for (size_t j = 0u; j < PALETTE_SIZE; j++)
+        palette[j] = IE::Matf32::MakeRotation(static_cast<float>(j), 0.5f, 0.25f) * IE::Matf32::MakeTranslation(1.0f, 2.0f, static_cast<float>(j));
+
+    for (size_t i = 0u; i < influences.size(); i++)
+        influences[i] = { { static_cast<std::uint16_t>(i % PALETTE_SIZE), static_cast<std::uint16_t>((i * 7u) % PALETTE_SIZE),
+                            static_cast<std::uint16_t>((i * 13u) % PALETTE_SIZE), static_cast<std::uint16_t>((i * 31u) % PALETTE_SIZE) },
+                          { 0.4f, 0.3f, 0.2f, 0.1f } };
+
+    BenchmarkKernel(results, memory, "SkinVertices", 2u * sizeof(IE::Vecf32) + sizeof(IE::SkinInfluences), true, [&](std::uint8_t* memory, const size_t count) {
+        const IE::Vecf32* in = reinterpret_cast<const IE::Vecf32*>(memory);
+
+        IE::SkinVertices(palette, std::span(in, count), std::span(influences.data(), count), std::span(reinterpret_cast<IE::Vecf32*>(memory) + count, count), 1u);
+    });
+
+    // One operation per joint (its pose read & its matrix written), for instances of a 64 joint chain
+    std::vector<std::int32_t> parents(PALETTE_SIZE);
+
+    for (size_t j = 0u; j < PALETTE_SIZE; j++)
+        parents[j] = static_cast<std::int32_t>(j) - 1;
+
+    const IE::Skeleton skeleton(parents, palette);
+
+    BenchmarkKernel(results, memory, "Skeleton.EvaluatePoses", sizeof(IE::JointPose) + sizeof(IE::Matf32), false, [&skeleton](std::uint8_t* memory, const size_t count) {
+        const size_t jointCount = count - count % PALETTE_SIZE; // Also keeps the palettes 64 bytes aligned
+
+        const IE::JointPose* poses    = reinterpret_cast<const IE::JointPose*>(memory);
+        IE::Matf32*          palettes = reinterpret_cast<IE::Matf32*>(memory + jointCount * sizeof(IE::JointPose));
+
+        skeleton.EvaluatePoses(std::span(poses, jointCount), std::span(palettes, jointCount), 1u);
+    });
+
+    // The kernels behind "CullSpheres" & "CullBoxes" on one chunk, an index is written for every volume in the worst case
+    const IE::Frustum frustum(IE::Matf32::MakeLookAt(IE::Vecf32(1.5f, 1.5f, -2.0f, 1.0f), IE::Vecf32(1.5f, 1.5f, 1.5f, 1.0f), IE::Vecf32(0.0f, 1.0f, 0.0f, 0.0f))
+                              * IE::Matf32::MakePerspective(0.1f, 100.0f, 1.0f, 16.0f / 9.0f));
+
+    BenchmarkKernel(results, memory, "Frustum.CullSpheres", sizeof(IE::Vecf32) + sizeof(std::uint32_t), true, [&frustum](std::uint8_t* memory, const size_t count) {
+        float* const floats = reinterpret_cast<float*>(memory);
+
+        const IE::Internal::SoAStream<const float> spheres{ floats, floats + count, floats + 2u * count, floats + 3u * count };
+
+        IE::Internal::GetSIMDKernels().m_pCullSpheresF32(frustum.GetPlaneData(), spheres, count, 0u, reinterpret_cast<std::uint32_t*>(floats + 4u * count));
+    });
+
+    BenchmarkKernel(results, memory, "Frustum.CullBoxes", 6u * sizeof(float) + sizeof(std::uint32_t), true, [&frustum](std::uint8_t* memory, const size_t count) {
+        float* const floats = reinterpret_cast<float*>(memory);
+
+        const IE::Internal::SoAStream<const float> centers{ floats, floats + count, floats + 2u * count, nullptr };
+        const IE::Internal::SoAStream<const float> extents{ floats + 3u * count, floats + 4u * count, floats + 5u * count, nullptr };
+
+        IE::Internal::GetSIMDKernels().m_pCullBoxesF32(frustum.GetPlaneData(), centers, extents, count, 0u, reinterpret_cast<std::uint32_t*>(floats + 6u * count));
+    });
+
+    BenchmarkKernel(results, memory, "CRC32", 1u, true, [&sink](std::uint8_t* memory, const size_t count) { sink = IE::CRC32::Calculate(memory, count); });
+    BenchmarkKernel(results, memory, "ALDER32", 1u, true, [&sink](std::uint8_t* memory, const size_t count) { sink = IE::ALDER32::Calculate(memory, count); });
+
+    BenchmarkKernel(results, memory, "SwapEndian16", 2u * sizeof(std::uint16_t), true, [](std::uint8_t* memory, const size_t count) {
+        const std::uint16_t* in = reinterpret_cast<const std::uint16_t*>(memory);
+
+        IE::SwapEndian<std::uint16_t>(std::span(in, count), std::span(reinterpret_cast<std::uint16_t*>(memory) + count, count));
+    });
+
+    BenchmarkKernel(results, memory, "SwapEndian32", 2u * sizeof(std::uint32_t), true, [](std::uint8_t* memory, const size_t count) {
+        const std::uint32_t* in = reinterpret_cast<const std::uint32_t*>(memory);
+
+        IE::SwapEndian<std::uint32_t>(std::span(in, count), std::span(reinterpret_cast<std::uint32_t*>(memory) + count, count));
+    });
+
+    BenchmarkKernel(results, memory, "SwapEndian64", 2u * sizeof(std::uint64_t), true, [](std::uint8_t* memory, const size_t count) {
+        const std::uint64_t* in = reinterpret_cast<const std::uint64_t*>(memory);
+
+        IE::SwapEndian<std::uint64_t>(std::span(in, count), std::span(reinterpret_cast<std::uint64_t*>(memory) + count, count));
+    });
+}
+
+static bool WriteKernelResults(const char* path, const std::vector<KernelResult>& results)
+{
+    std::ofstream file(path);
+
+    file << "{\n  \"simd_level\": \"" << IE::GetSIMDLevelName(IE::GetSIMDLevel()) << "\",\n  \"results\": [\n";
+
+    // One result per line, which is all "ReadKernelResults" expects
+    for (size_t i = 0u; i < results.size(); i++) {
+        const KernelResult& result = results[i];
+
+        file << "    { \"name\": \"" << result.m_name << "\", \"simd\": \"" << result.m_simdLevel << "\", \"bytes\": " << result.m_workingSet
+             << ", \"ns_per_op\": " << result.m_nsPerOp << ", \"gb_per_s\": " << result.m_gbPerSecond << " }" << ((i + 1u < results.size()) ? ",\n" : "\n");
+    }
+
+    file << "  ]\n}\n";
+
+    return static_cast<bool>(file);
+}
+
+// Value of "key" in a line written by "WriteKernelResults", empty when the line doesn't have it
+static std::string FindJSONValue(const std::string& line, const std::string& key)
+{
+    const size_t keyStart = line.find('"' + key + "\":");
+
+    if (keyStart == std::string::npos)
+        return {};
+
+    size_t start = line.find_first_not_of(' ', keyStart + key.size() + 3u);
+
+    if (start == std::string::npos)
+        return {};
+
+    if (line[start] == '"') {
+        const size_t end = line.find('"', ++start);
+        return (end == std::string::npos) ? std::string() : line.substr(start, end - start);
+    }
+
+    return line.substr(start, line.find_first_of(",}", start) - start);
+}
+
+static bool ReadKernelResults(const char* path, std::vector<KernelResult>& results)
+{
+    std::ifstream file(path);
+
+    if (!file)
+        return false;
+
+    for (std::string line; std::getline(file, line); ) {
+        KernelResult result;
+        result.m_name      = FindJSONValue(line, "name");
+        result.m_simdLevel = FindJSONValue(line, "simd");
+
+        const std::string workingSet = FindJSONValue(line, "bytes"), nsPerOp = FindJSONValue(line, "ns_per_op"), gbPerSecond = FindJSONValue(line, "gb_per_s");
+
+        if (result.m_name.empty() || workingSet.empty() || nsPerOp.empty())
+            continue;
+
+        result.m_workingSet  = std::strtoull(workingSet.c_str(), nullptr, 10);
+        result.m_nsPerOp     = std::strtod(nsPerOp.c_str(), nullptr);
+        result.m_gbPerSecond = std::strtod(gbPerSecond.c_str(), nullptr);
+
+        results.push_back(std::move(result));
+    }
+
+    return true;
+}
+
+// Prints the kernels whose time per operation changed by more than "threshold" percents, returns the number of regressions
+static size_t CompareKernelResults(const std::vector<KernelResult>& baseline, const std::vector<KernelResult>& results, const double threshold)
+{
+    size_t regressions = 0u, compared = 0u;
+
+    for (const KernelResult& result : results) {
+        const auto match = std::find_if(baseline.begin(), baseline.end(), [&](const KernelResult& saved) {
+            return saved.m_name == result.m_name && saved.m_simdLevel == result.m_simdLevel && saved.m_workingSet == result.m_workingSet;
+        });
+
+        if (match == baseline.end() || match->m_nsPerOp <= 0.0)
+            continue;
+
+        const double change = (result.m_nsPerOp / match->m_nsPerOp - 1.0) * 100.0;
+        compared++;
+
+        if (std::abs(change) <= threshold)
+            continue;
+
+        if (change > 0.0)
+            regressions++;
+
+        std::cout << std::left << std::setw(24) << result.m_name << std::setw(9) << result.m_simdLevel << std::right << std::setw(6)
+                  << (result.m_workingSet >> 10u) << " KiB: " << match->m_nsPerOp << " -> " << result.m_nsPerOp << " ns/op ("
+                  << std::showpos << change << std::noshowpos << "%)" << ((change > 0.0) ? " REGRESSION\n" : " improvement\n");
+    }
+
+    std::cout << compared << " kernels compared, " << regressions << " regression(s) past " << threshold << "%\n";
+
+    return regressions;
+}
+
+// Encodes a frame to PNG at every level with 1, 2, 4... threads
+static void BenchmarkPNGEncoder(const IE::RenderTarget& target)
+{
+    constexpr const size_t REPETITIONS = 5u;
+    constexpr const char* LEVEL_NAMES[] = { "Huffman Only", "RLE", "Fast", "Default", "Best" };
+
+    const double megabytes = 3.0 * target.GetWidth() * target.GetHeight() / 1e6;
+
+    std::vector<std::uint8_t> file;
+
+    for (int level = 0; level <= static_cast<int>(IE::DeflateLevel::BEST); level++) {
+        for (size_t threadCount = 1u; ; threadCount *= 2u) {
+            threadCount = std::min(threadCount, IE::GetHardwareThreadCount());
+
+            IE::PNGEncoder::Options options;
+            options.m_level       = static_cast<IE::DeflateLevel>(level);
+            options.m_threadCount = threadCount;
+
+            const double milliseconds = MeasureMilliseconds(REPETITIONS, [&]() { IE::PNGEncoder::Encode(target, file, options); });
+
+            std::cout << "PNG Encode " << LEVEL_NAMES[level] << " (" << threadCount << " threads): " << milliseconds << " ms (" << megabytes / milliseconds * 1e3
+                      << " MB/s), " << (file.size() >> 10u) << " KiB (" << 100.0 * static_cast<double>(file.size()) / (megabytes * 1e6) << "%)\n";
+
+            if (threadCount == IE::GetHardwareThreadCount())
+                break;
+        }
+    }
+}
+
+// Decodes a PNG file to RGBA8 at every SIMD level, whole (with & without checksum verification) & fed in 64 KiB pieces
+static void BenchmarkPNGDecoder(const std::span<const std::uint8_t> file)
+{
+    constexpr const size_t REPETITIONS = 5u;
+    constexpr const size_t PIECE_SIZE  = 64u << 10u;
+
+    IE::PNGHeader             header;
+    std::vector<std::uint8_t> pixels;
+
+    if (!IE::PNGDecoder::Decode(file, header, pixels)) {
+        std::cout << "Error: the file isn't a valid PNG file\n";
+        return;
+    }
+
+    std::cout << header.m_width << 'x' << header.m_height << ", " << static_cast<unsigned>(header.m_bitDepth) << " bit, color type "
+              << static_cast<unsigned>(header.m_colorType) << (header.m_bInterlaced ? ", interlaced" : "") << '\n';
+
+    const IE::SIMDLevel maxLevel = IE::GetSIMDLevel();
+
+    for (int level = 0; level <= static_cast<int>(maxLevel); level++) {
+        const IE::SIMDLevel simdLevel = IE::SetSIMDLevel(static_cast<IE::SIMDLevel>(level));
+
+        IE::PNGDecoder::Options unverified;
+        unverified.m_bVerifyChecksums = false;
+
+        const double verifiedMs   = MeasureMilliseconds(REPETITIONS, [&]() { IE::PNGDecoder::Decode(file, header, pixels); });
+        const double unverifiedMs = MeasureMilliseconds(REPETITIONS, [&]() { IE::PNGDecoder::Decode(file, header, pixels, unverified); });
+        const double streamedMs   = MeasureMilliseconds(REPETITIONS, [&]() {
+            IE::PNGDecoder decoder;
+
+            for (size_t offset = 0u; offset < file.size(); offset += PIECE_SIZE)
+                decoder.Feed(file.subspan(offset, std::min(PIECE_SIZE, file.size() - offset)));
+        });
+
+        const double megabytes = static_cast<double>(pixels.size()) / 1e6;
+
+        std::cout << "PNG Decode " << IE::GetSIMDLevelName(simdLevel) << ": " << verifiedMs << " ms (" << megabytes / verifiedMs * 1e3 << " MB/s), "
+                  << "unverified " << unverifiedMs << " ms (" << megabytes / unverifiedMs * 1e3 << " MB/s), "
+                  << "streamed " << streamedMs << " ms (" << megabytes / streamedMs * 1e3 << " MB/s)\n";
+    }
+
+    IE::SetSIMDLevel(maxLevel);
+}
+
+int main(int argc, char** argv)
+{
+    const char* jsonPath     = nullptr;
+    const char* baselinePath = nullptr;
+    double      threshold    = 10.0;
+    size_t      runs         = 1u;
+    bool        bKernelsOnly = false;
+
+    std::vector<const char*> arguments;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string argument = argv[i];
+
+        if (argument == "--kernels") {
+            bKernelsOnly = true;
+        } else if ((argument == "--json" || argument == "--baseline" || argument == "--threshold" || argument == "--runs") && i + 1 < argc) {
+            if (argument == "--json")      jsonPath     = argv[++i];
+            if (argument == "--baseline")  baselinePath = argv[++i];
+            if (argument == "--threshold") threshold    = std::strtod(argv[++i], nullptr);
+            if (argument == "--runs")      runs         = std::max<size_t>(1u, std::strtoull(argv[++i], nullptr, 10));
+        } else {
+            arguments.push_back(argv[i]);
+        }
+    }
+
+    std::cout << "SIMD Level: " << IE::GetSIMDLevelName(IE::GetSIMDLevel()) << '\n'
+              << "Hardware Threads: " << IE::GetHardwareThreadCount() << "\n\n";
+
+    std::vector<KernelResult> kernelResults;
+
+    for (size_t run = 0u; run < runs; run++) {
+        std::cout << "Kernels (run " << (run + 1u) << '/' << runs << ")\n";
+        BenchmarkKernels(kernelResults);
+    }
+
+    if (jsonPath != nullptr && !WriteKernelResults(jsonPath, kernelResults)) {
+        std::cout << "Error: couldn't write \"" << jsonPath << "\"\n";
+        return EXIT_FAILURE;
+    }
+
+    if (baselinePath != nullptr) {
+        std::vector<KernelResult> baseline;
+
+        if (!ReadKernelResults(baselinePath, baseline)) {
+            std::cout << "Error: couldn't read \"" << baselinePath << "\"\n";
+            return EXIT_FAILURE;
+        }
+
+        std::cout << "\nComparison with \"" << baselinePath << "\"\n";
+
+        if (CompareKernelResults(baseline, kernelResults, threshold) > 0u)
+            return EXIT_FAILURE;
+    }
+
+    if (bKernelsOnly)
+        return EXIT_SUCCESS;
+
+    const std::uint64_t bufferSize = ((arguments.size() > 0u) ? std::strtoull(arguments[0], nullptr, 10) : 256u) << 20u;
+
+    std::vector<std::uint8_t> buffer(bufferSize);
+    for (size_t i = 0u; i < buffer.size(); i++)
+        buffer[i] = static_cast<std::uint8_t>(i * 2654435761u >> 13u);
+
+    std::cout << "\nJob System\n";
+    BenchmarkJobSystem();
+
+    std::cout << "\nMemory (64 frames of 1024 transient allocations)\n";
+    BenchmarkMemory();
+
+    std::cout << "\nChecksums (" << (bufferSize >> 20u) << " MiB buffer)\n";
+    BenchmarkChecksums(buffer.data(), buffer.size());
+
+    IE::RenderTarget frame(1920u, 1080u);
+
+    std::cout << "\nRasterizer (1920x1080, " << (4u * 192u * 108u * 2u) << " triangles)\n";
+    BenchmarkRasterizer(frame);
+
+    std::cout << "\nImage (1024x1024, 1M samples)\n";
+    BenchmarkImage<IE::Coloru8>("Coloru8");
+    BenchmarkImage<IE::Colorf32>("Colorf32");
+
+    std::cout << "\nColor Conversion (1920x1080 Colorf32 frame)\n";
+    BenchmarkColorConversion();
+
+    std::cout << "\nPNG Encoder (rasterized frame, 8 bit RGB)\n";
+    BenchmarkPNGEncoder(frame);
+
+    if (arguments.size() > 1u) {
+        const IE::MappedFile file(arguments[1]);
+
+        if (!file.IsValid()) {
+            std::cout << "Error: couldn't map \"" << arguments[1] << "\"\n";
+            return EXIT_FAILURE;
+        }
+
+        std::cout << "\nChecksums (mapped file \"" << arguments[1] << "\", " << (file.GetSize() >> 20u) << " MiB)\n";
+        BenchmarkChecksums(file.GetData(), file.GetSize());
+    }
+
+    for (size_t i = 2u; i < arguments.size(); i++) {
+        const IE::MappedFile file(arguments[i]);
+
+        if (!file.IsValid()) {
+            std::cout << "Error: couldn't map \"" << arguments[i] << "\"\n";
+            return EXIT_FAILURE;
+        }
+
+        std::cout << "\nPNG Decoder (\"" << arguments[i] << "\", " << (file.GetSize() >> 10u) << " KiB)\n";
+        BenchmarkPNGDecoder(file.GetSpan());
+    }
+
+    return EXIT_SUCCESS;
+}
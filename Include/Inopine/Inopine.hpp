@@ -20,11 +20,53 @@
     |--+ SIMD Wrapper
     |--|--+ SIMD Register Wrapper
     |--|--+ SIMD Operations
+    |--|--+ CPU Features
+    |--|--+ Dispatch
+    |--+ Multi-Threading
+    |--|--+ Synchronization
+    |--|--+ Job System
+    |--|--+ SPSC Ring Buffer
+    |--+ Memory
+    |--|--+ Aligned Allocator
+    |--|--+ Linear Arena
+    |--|--+ Scratch Memory
+    |--+ Timing
+    |--+ Math Library
+    |--|--+ Vector (4D)
+    |--|--+ Packed Integers
+    |--|--+ Vector Array (SoA)
+    |--|--+ Matrix (4x4)
+    |--|--|--+ Batched Operations
+    |--|--+ Expression Templates
+    |--|--+ Quaternion
+    |--|--|--+ Slerp
+    |--|--|--+ Batched Operations
     |--+ Window System
+    |--|--+ Framebuffer
+    |--|--+ Input Events
+    |--|--+ Display Manager
+    |--|--+ Run Loop
+    |--+ Rasterizer
+    |--+ Image
+    |--+ Color Conversion
+    |--+ Skeletal Animation
+    |--|--+ Skinning
+    |--|--+ Pose Evaluation
+    |--+ Frustum Culling
+    |--+ File Mapping
     |--+ Error Checking Codes
     |--|--+ CRC
     |--|--+ ALDER-32
     |--+ Endian Conversion
+    |--|--+ Bulk Conversions
+    |--+ Compression
+    |--|--+ Inflate
+    |--|--+ Deflate
+    |--+ PNG
+    |--|--+ Unfilter
+    |--|--+ Decoder
+    |--|--+ Encoder
+    |--+ Runtime Dispatch Resolution
 
 */
 
@@ -32,17 +74,29 @@
 // | C++ Library Includes |
 // +----------------------+
 
+#include <bit>         // Since C++20
 #include <cmath>
 #include <array>       // Since C++11
+#include <bitset>
+#include <algorithm>
+#include <atomic>      // Since C++11
 #include <cassert>
 #include <limits>
+#include <new>         // std::align_val_t (Since C++17)
+#include <memory>      // std::uninitialized_value_construct_n (Since C++17)
+#include <numbers>     // Since C++20
 #include <cstdint>
 #include <cstring>
+#include <span>        // Since C++20
+#include <thread>      // Since C++11
+#include <vector>
+#include <unordered_map>
 #include <iomanip>
 #include <ostream>
 #include <iostream>
 #include <concepts>    // Since C++20
 #include <type_traits> // Since C++11 (w/ C++17 Helper Classes)
+#include <utility>
 
 // +---------+
 // | Defines |
@@ -52,10 +106,36 @@
 // | Defines | --> | SIMD |
 // +---------+     +------+
 
+// The SIMD code paths are written with x86 intrinsics
+#if !defined(__IE__DISABLE_SIMD) && !(defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+    #define __IE__DISABLE_SIMD
+#endif // #if !defined(__IE__DISABLE_SIMD) && !(...)
+
 #if !defined(__IE__DISABLE_SIMD)
     #define __IE__ENABLE_SIMD
 #endif // #if !defined(__IE__DISABLE_SIMD)
 
+// Fused multiply-adds are only emitted by the inlined code (see "SIMDMulAdd") when the compilation target guarantees them
+#if defined(__IE__ENABLE_SIMD) && (defined(__FMA__) || defined(__AVX2__))
+    #define __IE__ENABLE_FMA
+#endif // #if defined(__IE__ENABLE_SIMD) && (...)
+
+/* The "__IE__TARGET_*" macros let a single function use an instruction set that the rest of the */
+/* program isn't compiled for. Such functions must only be reached through the runtime dispatch  */
+/* table once the cpu has been checked. MSVC doesn't need them since it accepts any intrinsic.   */
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define __IE__TARGET_SSE41
+    #define __IE__TARGET_AVX2
+    #define __IE__TARGET_AVX512
+    #define __IE__TARGET_PCLMUL
+#else // end of #if defined(_MSC_VER) && !defined(__clang__)
+    #define __IE__TARGET_SSE41  __attribute__((target("sse4.1")))
+    #define __IE__TARGET_AVX2   __attribute__((target("avx2,fma")))
+    #define __IE__TARGET_AVX512 __attribute__((target("avx512f,avx512vl,avx512dq,avx512bw,avx2,fma")))
+    #define __IE__TARGET_PCLMUL __attribute__((target("sse4.1,pclmul")))
+#endif // end of #else
+
 // +---------+     +-------------+
 // | Defines | --> | OS / Target |
 // +---------+     +-------------+
@@ -100,6 +180,12 @@
 
 #if defined(__IE__ENABLE_SIMD)
     #include <immintrin.h> // Used for simd types and instructions
+
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h> // __cpuidex & _xgetbv
+    #else // end of #if defined(_MSC_VER) && !defined(__clang__)
+        #include <cpuid.h>  // __cpuid_count
+    #endif // end of #else
 #endif // #ifndef __IE__DISABLE_SIMD
 
 #if defined(__IE__OS_WINDOWS)
@@ -107,15 +193,39 @@
 
 	#include <Windows.h>
 	#pragma comment(lib, "User32.lib")
+	#pragma comment(lib, "Gdi32.lib")
+	#pragma comment(lib, "Synchronization.lib") // WaitOnAddress
 
 	#include <Windowsx.h>
 
     #undef NOMINMAX
 #elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
-    // XLIB
-    #include <X11/Xos.h>
+    // XLIB ("X11/Xos.h" isn't included since its "index" macro breaks <chrono>)
     #include <X11/Xlib.h>
     #include <X11/Xutil.h>
+    #include <X11/XKBlib.h> // XkbSetDetectableAutoRepeat
+
+    // MIT-SHM (Framebuffer Presentation)
+    #include <sys/ipc.h>
+    #include <sys/shm.h>
+    #include <X11/extensions/XShm.h>
+
+    // Run Loop & Timing
+    #include <poll.h>
+    #include <time.h>
+    #include <errno.h>
+
+    // Job System
+    #include <sched.h>
+    #include <pthread.h>
+    #include <sys/syscall.h>
+    #include <linux/futex.h>
+
+    // File Mapping
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
 #endif // end of #if defined(__IE__OS_LINUX)
 
 /* The "IE" namespace contains all of Inopine Engine's source code in order          */
@@ -141,6 +251,8 @@ namespace IE {
 
         /* The templated "using" definition "SIMDVectorRegister" is used to determine at compile- */
         /* -time the intrinsics' vector register type that corresponds to the template parameter. */
+        /* Only the instruction sets guaranteed by the compilation target are used here, the wider */
+        /* ones are reached through the runtime dispatch table ("SIMD Wrapper --> Dispatch").      */
 
 #ifdef __IE__DISABLE_SIMD
 
@@ -153,7 +265,11 @@ namespace IE {
         using SIMDVectorRegister = typename std::conditional_t<std::is_same_v<_T, float>,   __m128,
 						           typename std::conditional_t<std::is_same_v<_T, int32_t>, __m128i,
 						           typename std::conditional_t<std::is_same_v<_T, int16_t>, __m128i,
+#if defined(__AVX__)
 						           typename std::conditional_t<std::is_same_v<_T, double>,  __m256d, ::IE::Internal::SIMDNoVectorRegister>>>>;
+#else // end of #if defined(__AVX__)
+						           ::IE::Internal::SIMDNoVectorRegister>>>;
+#endif // end of #else
 
 #endif
         
@@ -166,15 +282,15 @@ namespace IE {
 
         /* The role of the function "CAN_PERFORM_SIMD_VECTOR_OPERATIONS" is the same as the concept "SIMDVectorable" */
         /* but is defined as function "contexpr" function that can be ran at compile-time with two types.           */
+        /* Both types have to match since "int16_t" and "int32_t" share the "__m128i" register with different lanes. */
 
         template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B = _T_A>
         static inline constexpr bool CAN_PERFORM_SIMD_VECTOR_OPERATIONS() noexcept
         {
             using _REGISTER_A_TYPE = ::IE::Internal::SIMDVectorRegister<_T_A>;
-            using _REGISTER_B_TYPE = ::IE::Internal::SIMDVectorRegister<_T_B>;
 
             return !std::is_same_v<_REGISTER_A_TYPE, SIMDNoVectorRegister>
-                &&  std::is_same_v<_REGISTER_A_TYPE, _REGISTER_B_TYPE>;
+                &&  std::is_same_v<_T_A, _T_B>;
         }
 
 #ifdef __IE__ENABLE_SIMD
@@ -196,6 +312,12 @@ namespace IE {
                 return _mm256_set_pd(w, z, y, x);
         }
 
+        template <::IE::Internal::SIMDVectorable _T, typename _VECTOR_REGISTER_TYPE = ::IE::Internal::SIMDVectorRegister<_T>>
+        static inline _VECTOR_REGISTER_TYPE SIMDSet1(const _T& v) noexcept
+        {
+            return ::IE::Internal::SIMDSet<_T>(v, v, v, v);
+        }
+
         template <::IE::Internal::SIMDVectorable _T, typename _VECTOR_REGISTER_TYPE = ::IE::Internal::SIMDVectorRegister<_T>>
         static inline _VECTOR_REGISTER_TYPE SIMDAdd(const _VECTOR_REGISTER_TYPE& a, const _VECTOR_REGISTER_TYPE& b) noexcept
         {
@@ -225,27 +347,88 @@ namespace IE {
         template <::IE::Internal::SIMDVectorable _T, typename _VECTOR_REGISTER_TYPE = ::IE::Internal::SIMDVectorRegister<_T>>
         static inline _VECTOR_REGISTER_TYPE SIMDMul(const _VECTOR_REGISTER_TYPE& a, const _VECTOR_REGISTER_TYPE& b) noexcept
         {
-            if constexpr (std::is_same_v<_T, float>)
+            if constexpr (std::is_same_v<_T, float>) {
                 return _mm_mul_ps(a, b);
-            else if constexpr (std::is_same_v<_T, int32_t>)
-                return _mm_mul_epi32(a, b);
-            else if constexpr (std::is_same_v<_T, int16_t>)
+            } else if constexpr (std::is_same_v<_T, int32_t>) {
+#if defined(__SSE4_1__) || defined(__AVX__)
+                return _mm_mullo_epi32(a, b);
+#else // end of #if defined(__SSE4_1__) || defined(__AVX__)
+                // SSE2 has no 32 bit low multiply : multiply the even & odd lanes separately and interleave them
+                const __m128i even = _mm_mul_epu32(a, b);
+                const __m128i odd  = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+
+                return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                          _mm_shuffle_epi32(odd,  _MM_SHUFFLE(0, 0, 2, 0)));
+#endif // end of #else
+            } else if constexpr (std::is_same_v<_T, int16_t>) {
                 return _mm_mullo_epi16(a, b);
-            else if constexpr (std::is_same_v<_T, double>)
+            } else if constexpr (std::is_same_v<_T, double>) {
                 return _mm256_mul_pd(a, b);
+            }
         }
 
         template <::IE::Internal::SIMDVectorable _T, typename _VECTOR_REGISTER_TYPE = ::IE::Internal::SIMDVectorRegister<_T>>
         static inline _VECTOR_REGISTER_TYPE SIMDDiv(const _VECTOR_REGISTER_TYPE& a, const _VECTOR_REGISTER_TYPE& b) noexcept
         {
-            if constexpr (std::is_same_v<_T, float>)
+            if constexpr (std::is_same_v<_T, float>) {
                 return _mm_div_ps(a, b);
-            else if constexpr (std::is_same_v<_T, int32_t>)
-                return _mm_div_epi32(a, b);
-            else if constexpr (std::is_same_v<_T, int16_t>)
-                return _mm_div_epi16(a, b);
-            else if constexpr (std::is_same_v<_T, double>)
+            } else if constexpr (std::is_same_v<_T, double>) {
                 return _mm256_div_pd(a, b);
+            } else {
+                // There are no integer division instructions, divide each lane separately
+                alignas(16) _T lanesA[16u / sizeof(_T)];
+                alignas(16) _T lanesB[16u / sizeof(_T)];
+
+                _mm_store_si128(reinterpret_cast<__m128i*>(lanesA), a);
+                _mm_store_si128(reinterpret_cast<__m128i*>(lanesB), b);
+
+                for (size_t i = 0u; i < 4u; i++)
+                    lanesA[i] /= lanesB[i];
+
+                return _mm_load_si128(reinterpret_cast<const __m128i*>(lanesA));
+            }
+        }
+
+        /* "a * b + c", "a * b - c" & "c - a * b". The float & double versions are rounded once when the target */
+        /* has FMA instructions ("__IE__ENABLE_FMA"), so they may differ from separate multiplies & additions. */
+
+        template <::IE::Internal::SIMDVectorable _T, typename _VECTOR_REGISTER_TYPE = ::IE::Internal::SIMDVectorRegister<_T>>
+        static inline _VECTOR_REGISTER_TYPE SIMDMulAdd(const _VECTOR_REGISTER_TYPE& a, const _VECTOR_REGISTER_TYPE& b, const _VECTOR_REGISTER_TYPE& c) noexcept
+        {
+#if defined(__IE__ENABLE_FMA)
+            if constexpr (std::is_same_v<_T, float>)
+                return _mm_fmadd_ps(a, b, c);
+            else if constexpr (std::is_same_v<_T, double>)
+                return _mm256_fmadd_pd(a, b, c);
+            else
+#endif // #if defined(__IE__ENABLE_FMA)
+                return ::IE::Internal::SIMDAdd<_T>(::IE::Internal::SIMDMul<_T>(a, b), c);
+        }
+
+        template <::IE::Internal::SIMDVectorable _T, typename _VECTOR_REGISTER_TYPE = ::IE::Internal::SIMDVectorRegister<_T>>
+        static inline _VECTOR_REGISTER_TYPE SIMDMulSub(const _VECTOR_REGISTER_TYPE& a, const _VECTOR_REGISTER_TYPE& b, const _VECTOR_REGISTER_TYPE& c) noexcept
+        {
+#if defined(__IE__ENABLE_FMA)
+            if constexpr (std::is_same_v<_T, float>)
+                return _mm_fmsub_ps(a, b, c);
+            else if constexpr (std::is_same_v<_T, double>)
+                return _mm256_fmsub_pd(a, b, c);
+            else
+#endif // #if defined(__IE__ENABLE_FMA)
+                return ::IE::Internal::SIMDSub<_T>(::IE::Internal::SIMDMul<_T>(a, b), c);
+        }
+
+        template <::IE::Internal::SIMDVectorable _T, typename _VECTOR_REGISTER_TYPE = ::IE::Internal::SIMDVectorRegister<_T>>
+        static inline _VECTOR_REGISTER_TYPE SIMDNegMulAdd(const _VECTOR_REGISTER_TYPE& a, const _VECTOR_REGISTER_TYPE& b, const _VECTOR_REGISTER_TYPE& c) noexcept
+        {
+#if defined(__IE__ENABLE_FMA)
+            if constexpr (std::is_same_v<_T, float>)
+                return _mm_fnmadd_ps(a, b, c);
+            else if constexpr (std::is_same_v<_T, double>)
+                return _mm256_fnmadd_pd(a, b, c);
+            else
+#endif // #if defined(__IE__ENABLE_FMA)
+                return ::IE::Internal::SIMDSub<_T>(c, ::IE::Internal::SIMDMul<_T>(a, b));
         }
 
         template <::IE::Internal::SIMDVectorable _T, typename _VECTOR_REGISTER_TYPE = ::IE::Internal::SIMDVectorRegister<_T>>
@@ -274,1037 +457,13896 @@ namespace IE {
         static inline _T SIMDExtractElement(const _VECTOR_REGISTER_TYPE& sseVector) noexcept
         {
             if constexpr (std::is_same_v<_T, float>) {
-                const int l = _mm_extract_ps(sseVector, INDEX);
-                return *reinterpret_cast<const _T*>(&l);
+                return _mm_cvtss_f32(_mm_shuffle_ps(sseVector, sseVector, _MM_SHUFFLE(INDEX, INDEX, INDEX, INDEX)));
             } else if constexpr (std::is_same_v<_T, int32_t>) {
-                const int l = _mm_extract_epi16(sseVector, INDEX);
-                return *reinterpret_cast<const _T*>(&l);
+                return _mm_cvtsi128_si32(_mm_shuffle_epi32(sseVector, _MM_SHUFFLE(INDEX, INDEX, INDEX, INDEX)));
             } else if constexpr (std::is_same_v<_T, int16_t>) {
-                const int l = _mm_extract_epi16(sseVector, INDEX);
-                return *reinterpret_cast<const _T*>(&l);
+                return static_cast<_T>(_mm_extract_epi16(sseVector, INDEX));
             } else if constexpr (std::is_same_v<_T, double>) {
-                if constexpr (INDEX <= 1) {
-                    return _mm256_cvtsd_f64(_mm256_shuffle_pd(sseVector, sseVector,
-                        _MM_SHUFFLE(INDEX, INDEX, INDEX, INDEX)));
-                } else {
-                    // This was hard
-                    return _mm_cvtsd_f64(_mm_shuffle_pd(_mm256_extractf128_pd(sseVector, 1),
-                                                        _mm256_extractf128_pd(sseVector, 1),
-                                                        _MM_SHUFFLE(INDEX, INDEX, INDEX, INDEX)));
-                }
+                const __m128d half = (INDEX <= 1) ? _mm256_castpd256_pd128(sseVector)
+                                                  : _mm256_extractf128_pd(sseVector, 1);
+
+                return _mm_cvtsd_f64((INDEX & 1) ? _mm_unpackhi_pd(half, half) : half);
+            }
+        }
+
+        // Copies the element "INDEX" to every lane
+        template <::IE::Internal::SIMDVectorable _T, int INDEX, typename _VECTOR_REGISTER_TYPE = ::IE::Internal::SIMDVectorRegister<_T>>
+        static inline _VECTOR_REGISTER_TYPE SIMDBroadcastElement(const _VECTOR_REGISTER_TYPE& sseVector) noexcept
+        {
+            if constexpr (std::is_same_v<_T, float>) {
+                return _mm_shuffle_ps(sseVector, sseVector, _MM_SHUFFLE(INDEX, INDEX, INDEX, INDEX));
+            } else if constexpr (std::is_same_v<_T, int32_t>) {
+                return _mm_shuffle_epi32(sseVector, _MM_SHUFFLE(INDEX, INDEX, INDEX, INDEX));
+            } else if constexpr (std::is_same_v<_T, double>) {
+                const __m256d half = _mm256_permute2f128_pd(sseVector, sseVector, (INDEX <= 1) ? 0x00 : 0x11);
+
+                return _mm256_permute_pd(half, (INDEX & 1) ? 0xF : 0x0);
+            } else {
+                return ::IE::Internal::SIMDSet1<_T>(::IE::Internal::SIMDExtractElement<_T, INDEX>(sseVector));
             }
         }
 
         template <::IE::Internal::SIMDVectorable _T, typename _VECTOR_REGISTER_TYPE = ::IE::Internal::SIMDVectorRegister<_T>>
         static inline _T SIMDDotProduct(const _VECTOR_REGISTER_TYPE& a, const _VECTOR_REGISTER_TYPE& b) noexcept
         {
-            if constexpr (std::is_same_v<_T, float>)
-                return ::IE::Internal::SIMDExtractElement<_T, 0>(_mm_dp_ps(a, b, 0xFF));
-            else if constexpr (std::is_same_v<_T, int32_t>)
-                return ::IE::Internal::SIMDExtractElement<_T, 0>(_mm_hadd_epi32(::IE::Internal::SIMDMul<_T>(a, b), _mm_setzero_si128()));
-            else if constexpr (std::is_same_v<_T, int16_t>)
-                return ::IE::Internal::SIMDExtractElement<_T, 0>(_mm_hadd_epi16(_mm_hadd_epi16(::IE::Internal::SIMDMul<_T>(a, b), _mm_setzero_si128()), _mm_setzero_si128()));
-            else if constexpr (std::is_same_v<_T, double>)
-                return ::IE::Internal::SIMDExtractElement<_T, 0>(_mm256_dp_ps(a, b, 0xFF));
+            /* The horizontal sums are done with shuffles since "dpps" & "phaddd" */
+            /* aren't part of SSE2 and are slower than two shuffle/add pairs.     */
+
+            if constexpr (std::is_same_v<_T, float>) {
+                const __m128 mul  = _mm_mul_ps(a, b);
+                const __m128 sum2 = _mm_add_ps(mul, _mm_movehl_ps(mul, mul));
+
+                return _mm_cvtss_f32(_mm_add_ss(sum2, _mm_shuffle_ps(sum2, sum2, _MM_SHUFFLE(1, 1, 1, 1))));
+            } else if constexpr (std::is_same_v<_T, int32_t>) {
+                const __m128i mul  = ::IE::Internal::SIMDMul<_T>(a, b);
+                const __m128i sum2 = _mm_add_epi32(mul, _mm_shuffle_epi32(mul, _MM_SHUFFLE(1, 0, 3, 2)));
+
+                return _mm_cvtsi128_si32(_mm_add_epi32(sum2, _mm_shuffle_epi32(sum2, _MM_SHUFFLE(2, 3, 0, 1))));
+            } else if constexpr (std::is_same_v<_T, int16_t>) {
+                const __m128i sum2 = _mm_madd_epi16(a, b); // (x0*x1 + y0*y1), (z0*z1 + w0*w1), 0, 0
+
+                return static_cast<_T>(_mm_cvtsi128_si32(_mm_add_epi32(sum2, _mm_shuffle_epi32(sum2, _MM_SHUFFLE(2, 3, 0, 1)))));
+            } else if constexpr (std::is_same_v<_T, double>) {
+                const __m256d mul  = _mm256_mul_pd(a, b);
+                const __m128d sum2 = _mm_add_pd(_mm256_castpd256_pd128(mul), _mm256_extractf128_pd(mul, 1));
+
+                return _mm_cvtsd_f64(_mm_add_sd(sum2, _mm_unpackhi_pd(sum2, sum2)));
+            }
         }
 
 #endif // #ifdef __IE__ENABLE_SIMD
 
     } // Internal
 
-    // +--------------+
-    // | Math Library |
-    // +--------------+
-
-    // +--------------+     +-------------+
-    // | Math Library | --> | Vector (4D) |
-    // +--------------+     +-------------+
-
-    /* The templated "Vector" class represents a 4 dimensional mathematical vector of arithmitic types. This     */
-    /* vector uses compile-time c++ "magic" to use SIMD intrinsics when possible and a "naive method" otherwise. */
-    /* It also overloads the common mathematical operators like "+, -, *, and /" to make it easier to use.       */
+    // +--------------+     +--------------+
+    // | SIMD Wrapper | --> | CPU Features |
+    // +--------------+     +--------------+
 
-    template <::IE::arithmetic _T = int>
-    class Vector {
-        using _VECTOR_REGISTER_TYPE = ::IE::Internal::SIMDVectorRegister<_T>;
+    /* The "SIMDLevel" enum orders the instruction set tiers the runtime dispatch layer knows about. */
+    /* A tier is only selected if the cpu AND the operating system (register state saving) allow it. */
 
-    public:
-        union {
-            struct { _T x, y, z, w; };
+    enum class SIMDLevel : std::uint8_t {
+        SCALAR = 0u,
+        SSE41,
+        AVX2,   // AVX2 + FMA3
+        AVX512  // AVX-512 F/VL/DQ/BW
+    };
 
-            _VECTOR_REGISTER_TYPE m_simdRegister;
-        };
+    struct CPUFeatures {
+        bool m_bSSE2      = false;
+        bool m_bSSSE3     = false;
+        bool m_bSSE41     = false;
+        bool m_bSSE42     = false;
+        bool m_bPCLMULQDQ = false;
+        bool m_bPOPCNT    = false;
+        bool m_bAVX       = false;
+        bool m_bAVX2      = false;
+        bool m_bFMA       = false;
+        bool m_bBMI2      = false;
+        bool m_bAVX512F   = false;
+        bool m_bAVX512VL  = false;
+        bool m_bAVX512DQ  = false;
+        bool m_bAVX512BW  = false;
+    };
 
-        // +--------------+     +-------------+     +--------------+
-        // | Math Library | --> | Vector (4D) | --> | Constructors |
-        // +--------------+     +-------------+     +--------------+
+    namespace Internal {
 
-#ifdef __OP__ENABLE_SIMD
-        template <::IE::Internal::SIMDVectorable _U = _T>
-        Vector(const ::IE::Internal::SIMDVectorRegister<_U>& other)
+        static inline void CPUID(const std::uint32_t leaf, const std::uint32_t subLeaf, std::uint32_t (&registers)[4]) noexcept
         {
-            if constexpr (std::is_same_v<_T, _U>) {
-                this->m_simdRegister = other;
-            } else {
-                this->m_simdRegister = ::IE::Internal::SIMDSet<_T>(
-                    static_cast<_T>(::IE::Internal::SIMDExtractElement<_U, 0u>(other)),
-                    static_cast<_T>(::IE::Internal::SIMDExtractElement<_U, 1u>(other)),
-                    static_cast<_T>(::IE::Internal::SIMDExtractElement<_U, 2u>(other)),
-                    static_cast<_T>(::IE::Internal::SIMDExtractElement<_U, 3u>(other))
-                );
-            }
+#if !defined(__IE__ENABLE_SIMD)
+            registers[0] = registers[1] = registers[2] = registers[3] = 0u;
+#elif defined(_MSC_VER) && !defined(__clang__)
+            int msvcRegisters[4];
+            __cpuidex(msvcRegisters, static_cast<int>(leaf), static_cast<int>(subLeaf));
+
+            for (size_t i = 0u; i < 4u; i++)
+                registers[i] = static_cast<std::uint32_t>(msvcRegisters[i]);
+#else // end of #elif defined(_MSC_VER) && !defined(__clang__)
+            __cpuid_count(leaf, subLeaf, registers[0], registers[1], registers[2], registers[3]);
+#endif // end of #else
         }
-#endif // #ifdef __OP__ENABLE_SIMD 
 
-        Vector(const _T x = 0, const _T y = 0, const _T z = 0, const _T w = 0) noexcept
+        // Reads the "XCR0" register : it tells us which register files the operating system saves on context switches
+        static inline std::uint64_t XGETBV0() noexcept
         {
-            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T>()) {
-#ifdef __OP__ENABLE_SIMD
-                this->m_simdRegister = ::IE::Internal::SIMDSet<_T>(x, y, z, w);
-#endif // #ifdef __OP__ENABLE_SIMD 
-            } else {
-                this->x = x; this->y = y; this->z = z; this->w = w;
-            }
-        }
-
-        // +--------------+     +-------------+     +---------------------------+
-        // | Math Library | --> | Vector (4D) | --> | Operators: +=, -=, *=, /= |
-        // +--------------+     +-------------+     +---------------------------+
-
-        template <::IE::arithmetic _U>
-        inline void operator+=(const Vector<_U>& other) noexcept {
-            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T, _U>()) {
-#ifdef __OP__ENABLE_SIMD
-                this->m_simdRegister = ::IE::Internal::SIMDAdd(this->m_simdRegister, other.m_simdRegister);
-#endif // #ifdef __OP__ENABLE_SIMD 
-            } else {
-                this->x += other.x; this->y += other.y; this->z += other.z; this->w += other.w;
-            }
+#if !defined(__IE__ENABLE_SIMD)
+            return 0u;
+#elif defined(_MSC_VER) && !defined(__clang__)
+            return _xgetbv(0);
+#else // end of #elif defined(_MSC_VER) && !defined(__clang__)
+            std::uint32_t eax, edx;
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+            return (static_cast<std::uint64_t>(edx) << 32u) | eax;
+#endif // end of #else
         }
 
-        template <::IE::arithmetic _U>
-        inline void operator-=(const Vector<_U>& other) noexcept {
-            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T, _U>()) {
-#ifdef __OP__ENABLE_SIMD
-                this->m_simdRegister = ::IE::Internal::SIMDSub(this->m_simdRegister, other.m_simdRegister);
-#endif // #ifdef __OP__ENABLE_SIMD 
-            } else {
-                this->x -= other.x; this->y -= other.y; this->z -= other.z; this->w -= other.w;
-            }
-        }
+        static inline ::IE::CPUFeatures DetectCPUFeatures() noexcept
+        {
+            ::IE::CPUFeatures features;
 
-        template <::IE::arithmetic _U>
-        inline void operator*=(const Vector<_U>& other) noexcept {
-            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T, _U>()) {
-#ifdef __OP__ENABLE_SIMD
-                this->m_simdRegister = ::IE::Internal::SIMDMul(this->m_simdRegister, other.m_simdRegister);
-#endif // #ifdef __OP__ENABLE_SIMD 
-            } else {
-                this->x *= other.x; this->y *= other.y; this->z *= other.z; this->w *= other.w;
-            }
-        }
+            std::uint32_t leaf0[4], leaf1[4], leaf7[4] = { 0u };
+            ::IE::Internal::CPUID(0u, 0u, leaf0);
 
-        template <::IE::arithmetic _U>
-        inline void operator/=(const Vector<_U>& other) noexcept {
-            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T, _U>()) {
-#ifdef __OP__ENABLE_SIMD
-                this->m_simdRegister = ::IE::Internal::SIMDDiv(this->m_simdRegister, other.m_simdRegister);
-#endif // #ifdef __OP__ENABLE_SIMD 
-            } else {
-                this->x /= other.x; this->y /= other.y; this->z /= other.z; this->w /= other.w;
-            }
-        }
+            if (leaf0[0] < 1u)
+                return features;
 
-        // +--------------+     +-------------+     +--------------------------------+
-        // | Math Library | --> | Vector (4D) | --> | Non Static Function Operations |
-        // +--------------+     +-------------+     +--------------------------------+
+            ::IE::Internal::CPUID(1u, 0u, leaf1);
 
-        inline float GetLength() const noexcept {
-            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T>()) {
-#ifndef __IE__DISABLE_SIMD
-                return std::sqrt(::IE::Internal::SIMDDotProduct<_T>(this->m_simdRegister, this->m_simdRegister));
-#endif // #ifndef __IE__DISABLE_SIMD
-			} else {
-				return std::sqrt(this->x * this->x + this->y * this->y + this->z * this->z + this->w * this->w);
-			}
-        }
+            if (leaf0[0] >= 7u)
+                ::IE::Internal::CPUID(7u, 0u, leaf7);
 
-        inline void Normalize() noexcept {
-            this->operator/=(this->GetLength());
-        }
+            const std::uint32_t ecx1 = leaf1[2], edx1 = leaf1[3];
+            const std::uint32_t ebx7 = leaf7[1];
 
-        // +--------------+     +-------------+     +----------------------------+
-        // | Math Library | --> | Vector (4D) | --> | Static Function Operations |
-        // +--------------+     +-------------+     +----------------------------+
+            features.m_bSSE2      = edx1 & (1u << 26u);
+            features.m_bSSSE3     = ecx1 & (1u << 9u);
+            features.m_bSSE41     = ecx1 & (1u << 19u);
+            features.m_bSSE42     = ecx1 & (1u << 20u);
+            features.m_bPCLMULQDQ = ecx1 & (1u << 1u);
+            features.m_bPOPCNT    = ecx1 & (1u << 23u);
+            features.m_bBMI2      = ebx7 & (1u << 8u);
 
-        template <::IE::arithmetic _T_A>
-		inline static ::IE::Vector<_T_A> Normalized(const ::IE::Vector<_T_A>& vec) noexcept
-		{
-			return vec / vec.GetLength();
-		}
+            // The "ymm" & "zmm" registers are only usable if the OS has enabled their state saving
+            const bool bOSXSAVE = ecx1 & (1u << 27u);
+            const std::uint64_t xcr0 = bOSXSAVE ? ::IE::Internal::XGETBV0() : 0u;
 
-		template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
-		inline static auto CrossProduct3D(const ::IE::Vector<_T_A>& vecA, const ::IE::Vector<_T_B>& vecB) noexcept
-			-> ::IE::Vector<decltype(vecA.x + vecB.x)>
-		{
-			if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T_A, _T_B>()) {
-#ifndef __IE__DISABLE_SIMD
-				const ::IE::Vector<_T_A> tempA1(vecA.y, vecA.z, vecA.x, 0);
-				const ::IE::Vector<_T_A> tempB1(vecB.z, vecB.x, vecB.y, 0);
-				const ::IE::Vector<_T_A> tempA2(vecA.z, vecA.x, vecA.y, 0);
-				const ::IE::Vector<_T_A> tempB2(vecB.y, vecB.z, vecB.x, 0);
+            const bool bOSSavesYMM = (xcr0 & 0x06u) == 0x06u; // XMM + YMM
+            const bool bOSSavesZMM = (xcr0 & 0xE6u) == 0xE6u; // XMM + YMM + OPMASK + ZMM_HI256 + HI16_ZMM
 
-				return tempA1 * tempB1 - tempA2 * tempB2;
-#endif // #ifndef __IE__DISABLE_SIMD
-			} else {
-				return ::IE::Vector<decltype(vecA.x + vecB.x)>(
-					vecA.y * vecB.z - vecA.z * vecB.y,
-					vecA.z * vecB.x - vecA.x * vecB.z,
-					vecA.x * vecB.y - vecA.y * vecB.x,
-					0
-				);
-			}
-		}
+            features.m_bAVX  = bOSSavesYMM && (ecx1 & (1u << 28u));
+            features.m_bFMA  = features.m_bAVX && (ecx1 & (1u << 12u));
+            features.m_bAVX2 = features.m_bAVX && (ebx7 & (1u << 5u));
 
-		template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
-		static inline auto DotProduct(const ::IE::Vector<_T_A>& a, const ::IE::Vector<_T_B>& b) noexcept
-			-> decltype(a.x + b.x)
-		{
-			if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T_A, _T_B>()) {
-#ifndef __IE__DISABLE_SIMD
-				return ::IE::Internal::SIMDDotProduct<_T_A>(a.m_simdRegister, b.m_simdRegister);
-#endif // #ifndef __IE__DISABLE_SIMD
-			} else {
-				return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
-			}
-		}
+            features.m_bAVX512F  = bOSSavesZMM && (ebx7 & (1u << 16u));
+            features.m_bAVX512DQ = features.m_bAVX512F && (ebx7 & (1u << 17u));
+            features.m_bAVX512BW = features.m_bAVX512F && (ebx7 & (1u << 30u));
+            features.m_bAVX512VL = features.m_bAVX512F && (ebx7 & (1u << 31u));
 
-		template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
-		static inline auto GetReflected(const ::IE::Vector<_T_A>& in, const ::IE::Vector<_T_B>& normal) noexcept
-			-> ::IE::Vector<decltype(in.x + normal.x)>
-		{
-			return in - normal * 2 * ::IE::Vector<>::DotProduct(in, normal);
-		}
-    };
+            return features;
+        }
 
-    // +--------------+     +-------------+     +--------------------------------+
-    // | Math Library | --> | Vector (4D) | --> | Operators: +, -, *, /          |
-    // +--------------+     +-------------+     +--------------------------------+
+    } // Internal
 
-    template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
-    inline auto operator+(const ::IE::Vector<_T_A>& a, const ::IE::Vector<_T_B>& b) noexcept
-        -> Vector<decltype(a.x + b.x)>
+    // The cpu is only queried once, the first time any part of the engine asks for its features
+    inline const ::IE::CPUFeatures& GetCPUFeatures() noexcept
     {
-        using _RETURN_VECTOR_TYPE = Vector<decltype(a.x + b.x)>;
+        static const ::IE::CPUFeatures features = ::IE::Internal::DetectCPUFeatures();
 
-        if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T_A, _T_B>()) {
-#ifdef __OP__ENABLE_SIMD
-            return _RETURN_VECTOR_TYPE(::IE::Internal::SIMDAdd<_T_A>(a.m_simdRegister, b.m_simdRegister));
-#endif // #ifdef __OP__ENABLE_SIMD 
-        } else {
-            return _RETURN_VECTOR_TYPE(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
-        }
+        return features;
     }
 
-    template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
-    inline auto operator-(const ::IE::Vector<_T_A>& a, const ::IE::Vector<_T_B>& b) noexcept
-        -> Vector<decltype(a.x - b.x)>
+    // Returns the widest tier that the cpu this process is running on supports
+    inline ::IE::SIMDLevel GetMaxSupportedSIMDLevel() noexcept
     {
-        using _RETURN_VECTOR_TYPE = Vector<decltype(a.x - b.x)>;
+        const ::IE::CPUFeatures& features = ::IE::GetCPUFeatures();
 
-        if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T_A, _T_B>()) {
-#ifdef __OP__ENABLE_SIMD
-            return _RETURN_VECTOR_TYPE(::IE::Internal::SIMDSub<_T_A>(a.m_simdRegister, b.m_simdRegister));
-#endif // #ifdef __OP__ENABLE_SIMD 
-        } else {
-            return _RETURN_VECTOR_TYPE(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
-        }
+        if (features.m_bAVX512F && features.m_bAVX512VL && features.m_bAVX512DQ && features.m_bAVX512BW && features.m_bFMA)
+            return ::IE::SIMDLevel::AVX512;
+        if (features.m_bAVX2 && features.m_bFMA)
+            return ::IE::SIMDLevel::AVX2;
+        if (features.m_bSSE41)
+            return ::IE::SIMDLevel::SSE41;
+
+        return ::IE::SIMDLevel::SCALAR;
     }
 
-    template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
-    inline auto operator*(const ::IE::Vector<_T_A>& a, const ::IE::Vector<_T_B>& b) noexcept
-        -> Vector<decltype(a.x * b.x)>
+    inline const char* GetSIMDLevelName(const ::IE::SIMDLevel level) noexcept
     {
-        using _RETURN_VECTOR_TYPE = Vector<decltype(a.x * b.x)>;
-
-        if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T_A, _T_B>()) {
-#ifdef __OP__ENABLE_SIMD
-            return _RETURN_VECTOR_TYPE(::IE::Internal::SIMDMul<_T_A>(a.m_simdRegister, b.m_simdRegister));
-#endif // #ifdef __OP__ENABLE_SIMD 
-        } else {
-            return _RETURN_VECTOR_TYPE(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+        switch (level) {
+        case ::IE::SIMDLevel::SSE41:  return "SSE4.1";
+        case ::IE::SIMDLevel::AVX2:   return "AVX2";
+        case ::IE::SIMDLevel::AVX512: return "AVX-512";
+        default:                      return "Scalar";
         }
     }
 
-    template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
-    inline auto operator/(const ::IE::Vector<_T_A>& a, const ::IE::Vector<_T_B>& b) noexcept
-        -> Vector<decltype(a.x / b.x)>
-    {
-        using _RETURN_VECTOR_TYPE = Vector<decltype(a.x * b.x)>;
+    // +--------------+     +----------+
+    // | SIMD Wrapper | --> | Dispatch |
+    // +--------------+     +----------+
 
-        if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T_A, _T_B>()) {
-#ifdef __OP__ENABLE_SIMD
-            return _RETURN_VECTOR_TYPE(::IE::Internal::SIMDDiv<_T_A>(a.m_simdRegister, b.m_simdRegister));
-#endif // #ifdef __OP__ENABLE_SIMD 
-        } else {
-            return _RETURN_VECTOR_TYPE(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
-        }
-    }
+    /* The "SIMDKernels" table holds one function pointer per hot operation. It is filled once */
+    /* (the first time it is needed) with the widest kernels the running cpu supports so that  */
+    /* a single binary can run on every machine while still using AVX2/AVX-512 when available. */
+    /* Kernels that only need a handful of instructions (like "Vector" arithmetic) are inlined */
+    /* with the instructions guaranteed by the compilation target instead, because calling    */
+    /* through a pointer would cost more than the operation itself.                           */
 
-    template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
-    inline bool operator==(const ::IE::Vector<_T_A>& a, const ::IE::Vector<_T_B>& b) noexcept
-    {
-        return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+    // Skeletal Animation (defined in the "Skeletal Animation" section)
+    struct SkinInfluences;
+
+    namespace Internal {
+
+        // Pointers to the 4 component arrays of a "structure of arrays" ("VectorArray")
+        template <typename _T>
+        struct SoAStream {
+            _T* m_pX;
+            _T* m_pY;
+            _T* m_pZ;
+            _T* m_pW;
+        };
+
+        enum class SoAOperation : std::uint8_t { ADD, SUB, MUL, DIV };
+
+        // Rasterizer (defined in the "Rasterizer" section)
+        struct RasterTriangle;
+        struct RasterTile;
+
+        // Image (defined in the "Image" section)
+        struct ImageSampleBatch;
+
+        // Color Conversion (defined in the "Color Conversion" section)
+        struct ColorEncodeParameters;
+
+        struct SIMDKernels {
+            ::IE::SIMDLevel m_level = ::IE::SIMDLevel::SCALAR;
+
+            // Matrix (4x4, row-major floats)
+            void (*m_pMatrixMultiplyF32)(const float* matA, const float* matB, float* matOut) noexcept = nullptr;
+            void (*m_pVectorMatrixMultiplyF32)(const float* vec, const float* mat, float* vecOut) noexcept = nullptr;
+            void (*m_pTransformBatchF32)(const float* mat, const float* in, float* out, size_t count) noexcept = nullptr;
+            float (*m_pMatrixDeterminantF32)(const float* mat) noexcept = nullptr;
+            void (*m_pMatrixInverseF32)(const float* in, float* out, size_t count) noexcept = nullptr;
+            void (*m_pMatrixAffineInverseF32)(const float* in, float* out, size_t count) noexcept = nullptr;
+
+            // Quaternion ("count" quaternions of 4 floats)
+            void (*m_pSlerpF32)(const float* from, const float* to, const float* t, float* out, size_t count) noexcept = nullptr;
+
+            // Vector Array (SoA floats)
+            void (*m_pSoAAddF32)(const float* a, const float* b, float* out, size_t count) noexcept = nullptr;
+            void (*m_pSoASubF32)(const float* a, const float* b, float* out, size_t count) noexcept = nullptr;
+            void (*m_pSoAMulF32)(const float* a, const float* b, float* out, size_t count) noexcept = nullptr;
+            void (*m_pSoADivF32)(const float* a, const float* b, float* out, size_t count) noexcept = nullptr;
+            void (*m_pSoADotProductF32)(const SoAStream<const float>& a, const SoAStream<const float>& b, float* out, size_t count) noexcept = nullptr;
+            void (*m_pSoALengthF32)(const SoAStream<const float>& a, float* out, size_t count) noexcept = nullptr;
+            void (*m_pSoANormalizeF32)(const SoAStream<const float>& a, const SoAStream<float>& out, size_t count) noexcept = nullptr;
+            void (*m_pSoACrossProduct3DF32)(const SoAStream<const float>& a, const SoAStream<const float>& b, const SoAStream<float>& out, size_t count) noexcept = nullptr;
+            void (*m_pSoAReflectF32)(const SoAStream<const float>& in, const SoAStream<const float>& normal, const SoAStream<float>& out, size_t count) noexcept = nullptr;
+            void (*m_pAoSToSoAF32)(const float* aos, const SoAStream<float>& out, size_t count) noexcept = nullptr;
+            void (*m_pSoAToAoSF32)(const SoAStream<const float>& in, float* aos, size_t count) noexcept = nullptr;
+
+            // Rasterizer
+            void (*m_pRasterizeTriangle)(const RasterTriangle& triangle, const RasterTile& tile) noexcept = nullptr;
+
+            // Image ("out" holds packed RGBA8 texels or 4 floats per sample)
+            void (*m_pSampleImageU8)(const ImageSampleBatch& batch, const float* u, const float* v, void* out, size_t count) noexcept = nullptr;
+            void (*m_pSampleImageF32)(const ImageSampleBatch& batch, const float* u, const float* v, void* out, size_t count) noexcept = nullptr;
+
+            // Color Conversion ("count" colors or values, colors are 4 floats or a packed RGBA8 "std::uint32_t")
+            void (*m_pEncodeColors)(const float* in, void* out, size_t count, const ColorEncodeParameters& params) noexcept = nullptr;
+            void (*m_pDecodeColors)(const std::uint32_t* in, float* out, size_t count, bool bSRGB) noexcept = nullptr;
+            void (*m_pSwizzleRGBA8ToBGRA8)(const std::uint32_t* in, std::uint32_t* out, size_t count) noexcept = nullptr;
+            void (*m_pPackRGBA8ToRGB565)(const std::uint32_t* in, std::uint16_t* out, size_t count) noexcept = nullptr;
+            void (*m_pFloatToUnorm8)(const float* in, std::uint8_t* out, size_t count) noexcept = nullptr;
+            void (*m_pFloatToUnorm16)(const float* in, std::uint16_t* out, size_t count) noexcept = nullptr;
+            void (*m_pUnorm8ToFloat)(const std::uint8_t* in, float* out, size_t count) noexcept = nullptr;
+            void (*m_pUnorm16ToFloat)(const std::uint16_t* in, float* out, size_t count) noexcept = nullptr;
+
+            // Skeletal Animation ("palette" holds 4x4 float matrices, "in" & "out" 4 floats per vertex)
+            void (*m_pSkinVerticesF32)(const float* palette, const float* in, const ::IE::SkinInfluences* influences, float* out, size_t count) noexcept = nullptr;
+
+            // Frustum Culling ("planes" holds 6 planes of 4 floats, "visible" gets the indices from "first" of the visible volumes)
+            size_t (*m_pCullSpheresF32)(const float* planes, const ::IE::Internal::SoAStream<const float>& spheres, size_t count, std::uint32_t first, std::uint32_t* visible) noexcept = nullptr;
+            size_t (*m_pCullBoxesF32)(const float* planes, const ::IE::Internal::SoAStream<const float>& centers, const ::IE::Internal::SoAStream<const float>& extents,
+                                      size_t count, std::uint32_t first, std::uint32_t* visible) noexcept = nullptr;
+
+            // Error Checking Codes
+            std::uint32_t (*m_pCRC32Update)(std::uint32_t crc, const std::uint8_t* data, size_t len) noexcept = nullptr;
+            std::uint32_t (*m_pALDER32Update)(std::uint32_t alder, const std::uint8_t* data, size_t len) noexcept = nullptr;
+
+            // Endian Conversion ("count" elements)
+            void (*m_pSwapEndian16)(const std::uint8_t* in, std::uint8_t* out, size_t count) noexcept = nullptr;
+            void (*m_pSwapEndian32)(const std::uint8_t* in, std::uint8_t* out, size_t count) noexcept = nullptr;
+            void (*m_pSwapEndian64)(const std::uint8_t* in, std::uint8_t* out, size_t count) noexcept = nullptr;
+            void (*m_pReverseBits8)(const std::uint8_t* in, std::uint8_t* out, size_t count) noexcept = nullptr;
+            void (*m_pReverseBits16)(const std::uint8_t* in, std::uint8_t* out, size_t count) noexcept = nullptr;
+            void (*m_pReverseBits32)(const std::uint8_t* in, std::uint8_t* out, size_t count) noexcept = nullptr;
+            void (*m_pReverseBits64)(const std::uint8_t* in, std::uint8_t* out, size_t count) noexcept = nullptr;
+
+            // PNG
+            void (*m_pUnfilterPNGRow)(std::uint8_t filter, const std::uint8_t* filtered, std::uint8_t* row, const std::uint8_t* prev, size_t length, size_t bpp) noexcept = nullptr;
+        };
+
+        // Fills a table with the kernels of the given tier (defined at the end of this file, once every kernel is known)
+        inline void ResolveSIMDKernels(::IE::Internal::SIMDKernels& kernels, const ::IE::SIMDLevel level) noexcept;
+
+        inline ::IE::Internal::SIMDKernels& GetMutableSIMDKernels() noexcept
+        {
+            static ::IE::Internal::SIMDKernels kernels = []() noexcept {
+                ::IE::Internal::SIMDKernels result;
+                ::IE::Internal::ResolveSIMDKernels(result, ::IE::GetMaxSupportedSIMDLevel());
+
+                return result;
+            }();
+
+            return kernels;
+        }
+
+        inline const ::IE::Internal::SIMDKernels& GetSIMDKernels() noexcept { return ::IE::Internal::GetMutableSIMDKernels(); }
+
+    } // Internal
+
+    // Returns the tier whose kernels are currently in use (check this in production logs)
+    inline ::IE::SIMDLevel GetSIMDLevel() noexcept { return ::IE::Internal::GetSIMDKernels().m_level; }
+
+    /* Forces the dispatch layer to use another tier (clamped to what the cpu supports), which is   */
+    /* useful to compare the scalar & simd paths. It must not be called while other threads are     */
+    /* using the engine. Returns the tier that was actually selected.                               */
+    inline ::IE::SIMDLevel SetSIMDLevel(const ::IE::SIMDLevel level) noexcept
+    {
+        const ::IE::SIMDLevel maxLevel = ::IE::GetMaxSupportedSIMDLevel();
+        const ::IE::SIMDLevel newLevel = (level > maxLevel) ? maxLevel : level;
+
+        ::IE::Internal::ResolveSIMDKernels(::IE::Internal::GetMutableSIMDKernels(), newLevel);
+
+        return newLevel;
     }
 
-    template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
-    inline bool operator!=(const ::IE::Vector<_T_A>& a, const ::IE::Vector<_T_B>& b) noexcept
+    // +-----------------+
+    // | Multi-Threading |
+    // +-----------------+
+
+    // Number of threads worth running data-parallel work on (at least 1)
+    inline size_t GetHardwareThreadCount() noexcept
     {
-        return a.x != b.x || a.y != b.y || a.z != b.z || a.w != b.w;
+        const unsigned int threadCount = std::thread::hardware_concurrency();
+
+        return (threadCount == 0u) ? 1u : static_cast<size_t>(threadCount);
     }
 
-    template <::IE::arithmetic _T>
-	inline std::ostream& operator<<(std::ostream& stream, const ::IE::Vector<_T>& vec) noexcept
-	{
-		stream << "(" << vec.x << ", " << vec.y << ", " << vec.z << ", " << vec.w << ")";
+    class JobCounter;
+    class JobSystem;
 
-		return stream;
-	}
+    namespace Internal {
 
-    // +--------------+     +-------------+     +------------------------+
-    // | Math Library | --> | Vector (4D) | --> | Useful vector Typedefs |
-    // +--------------+     +-------------+     +------------------------+
+        // +-----------------+     +-----------------+
+        // | Multi-Threading | --> | Synchronization |
+        // +-----------------+     +-----------------+
 
-    typedef ::IE::Vector<int8_t>  Veci8;
-	typedef ::IE::Vector<int16_t> Veci16;
-	typedef ::IE::Vector<int32_t> Veci32;
+        static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t) && std::atomic<std::uint32_t>::is_always_lock_free);
 
-	typedef ::IE::Vector<uint8_t>  Vecu8;
-	typedef ::IE::Vector<uint16_t> Vecu16;
-	typedef ::IE::Vector<uint32_t> Vecu32;
+        // Tells the cpu that the thread is spinning (lower power use & no memory order violation when the spin ends)
+        inline void CPUPause() noexcept
+        {
+#if defined(__IE__ENABLE_SIMD)
+            _mm_pause();
+#else // end of #if defined(__IE__ENABLE_SIMD)
+            std::this_thread::yield();
+#endif // end of #else
+        }
 
-	typedef ::IE::Vector<std::enable_if_t<std::numeric_limits<float>::is_iec559, float>>   Vecf32;
-	typedef ::IE::Vector<std::enable_if_t<std::numeric_limits<double>::is_iec559, double>> Vecd64;
+        // Blocks while "word" holds "expected" (a futex on linux, "WaitOnAddress" on windows), may return spuriously
+        inline void WaitOnWord(std::atomic<std::uint32_t>& word, std::uint32_t expected) noexcept
+        {
+#if defined(__IE__OS_LINUX)
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#elif defined(__IE__OS_WINDOWS) // end of #if defined(__IE__OS_LINUX)
+            ::WaitOnAddress(&word, &expected, sizeof(expected), INFINITE);
+#else // end of #elif defined(__IE__OS_WINDOWS)
+            word.wait(expected, std::memory_order_acquire);
+#endif // end of #else
+        }
 
-	typedef ::IE::Vecf32 Colorf32;
-	typedef ::IE::Vecu8  Coloru8;
+        // Wakes one or every thread blocked in "WaitOnWord(word)"
+        inline void WakeWord(std::atomic<std::uint32_t>& word, const bool bAll) noexcept
+        {
+#if defined(__IE__OS_LINUX)
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE_PRIVATE, bAll ? std::numeric_limits<int>::max() : 1, nullptr, nullptr, 0);
+#elif defined(__IE__OS_WINDOWS) // end of #if defined(__IE__OS_LINUX)
+            if (bAll) ::WakeByAddressAll(&word);
+            else      ::WakeByAddressSingle(&word);
+#else // end of #elif defined(__IE__OS_WINDOWS)
+            if (bAll) word.notify_all();
+            else      word.notify_one();
+#endif // end of #else
+        }
 
-    // +--------------+     +--------------+
-    // | Math Library | --> | Matrix (4x4) |
-    // +--------------+     +--------------+
+        // For the short critical sections of the job system, which never block inside of them
+        class SpinLock {
+        private:
+            std::atomic<bool> m_bLocked{ false };
 
-    /* [EN] Represents a row-major 4x4 matrix of "_T" values as shown below:
-     * [FR] Repr�sente une matrice 4x4 de valeurs de types "_T" d'ordre de rang�e principal comme:
-	 * |-------------------|-------------------|-------------------|-------------------|
-	 * | _T m00 (index 0)  | _T m01 (index 1)  | _T m02 (index 2)  | _T m03 (index 3)  |
-	 * | _T m10 (index 4)  | _T m11 (index 5)  | _T m12 (index 6)  | _T m13 (index 7)  |
-	 * | _T m20 (index 8)  | _T m21 (index 9)  | _T m22 (index 10) | _T m23 (index 11) |
-	 * | _T m30 (index 12) | _T m31 (index 13) | _T m32 (index 14) | _T m33 (index 15) |
-	 * |-------------------|-------------------|-------------------|-------------------|
-	 */
+        public:
+            inline void Lock() noexcept
+            {
+                while (this->m_bLocked.exchange(true, std::memory_order_acquire))
+                    while (this->m_bLocked.load(std::memory_order_relaxed))
+                        ::IE::Internal::CPUPause();
+            }
 
-	template <::IE::arithmetic _T>
-	class Matrix
-	{
-	private:
-		_T m[16] = { 0 };
+            inline void Unlock() noexcept { this->m_bLocked.store(false, std::memory_order_release); }
 
-	public:
-        // +--------------+     +--------------+     +--------------+
-        // | Math Library | --> | Matrix (4x4) | --> | Constructors |
-        // +--------------+     +--------------+     +--------------+
+            inline bool IsLocked() const noexcept { return this->m_bLocked.load(std::memory_order_acquire); }
+        };
 
-		Matrix() = default;
+        // +-----------------+     +------------+
+        // | Multi-Threading | --> | Job System |
+        // +-----------------+     +------------+
 
-		inline Matrix(const _T* buff)                 noexcept { std::memcpy(this->m, buff, sizeof(_T) * 16u);       }
-		inline Matrix(const std::array<_T, 16u>& arr) noexcept { std::memcpy(this->m, arr.data(), sizeof(_T) * 16u); }
-		inline Matrix(const ::IE::Matrix<_T>& other)  noexcept { std::memcpy(this->m, other.m, sizeof(_T) * 16u);    }
+        /* The part of a job that the scheduler sees. "m_pExecute" runs the job (and frees it when it was allocated), */
+        /* "m_pNext" links the job into a "JobCounter"'s continuations or the queue of the threads outside the pool.  */
+        struct Job {
+            void (*m_pExecute)(::IE::Internal::Job* pJob) noexcept = nullptr;
 
-        // +--------------+     +--------------+     +----------------------+
-        // | Math Library | --> | Matrix (4x4) | --> | Overloaded Operators |
-        // +--------------+     +--------------+     +----------------------+
+            ::IE::JobCounter* m_pCounter = nullptr;
+            ::IE::Internal::Job* m_pNext = nullptr;
+        };
 
-		inline       _T& operator[](const size_t i)       noexcept { return this->m[i]; }
-		inline const _T& operator[](const size_t i) const noexcept { return this->m[i]; }
+        /* Chase-Lev work-stealing deque (with the memory orders of "Correct and Efficient Work-Stealing for Weak      */
+        /* Memory Models", Le et al. 2013). The owning worker pushes & pops jobs at the bottom like a stack, which     */
+        /* keeps its caches warm, while the other threads steal the oldest (usually biggest) jobs from the top. The   */
+        /* capacity is fixed: "Push" fails when the deque is full, in which case the job is run right away.           */
+        class WorkStealingDeque {
+        public:
+            static constexpr const std::int64_t CAPACITY = 4096;
 
-		inline       _T& operator()(const size_t r, const size_t c)       noexcept { return this->m[r * 4u + c]; }
-		inline const _T& operator()(const size_t r, const size_t c) const noexcept { return this->m[r * 4u + c]; }
+        private:
+            static constexpr const std::int64_t INDEX_MASK = CAPACITY - 1;
 
-        // +--------------+     +--------------+     +------------------+
-        // | Math Library | --> | Matrix (4x4) | --> | Static Functions |
-        // +--------------+     +--------------+     +------------------+
+            alignas(64) std::atomic<std::int64_t> m_top{ 0 };    // Next job to steal
+            alignas(64) std::atomic<std::int64_t> m_bottom{ 0 }; // Next free slot
+            alignas(64) std::atomic<::IE::Internal::Job*> m_jobs[CAPACITY];
+
+        public:
+            // Owner only
+            bool Push(::IE::Internal::Job* pJob) noexcept
+            {
+                const std::int64_t bottom = this->m_bottom.load(std::memory_order_relaxed);
+                const std::int64_t top    = this->m_top.load(std::memory_order_acquire);
+
+                if (bottom - top >= CAPACITY)
+                    return false;
+
+                // Publishes the job (& what the job points to) to the thieves
+                this->m_jobs[bottom & INDEX_MASK].store(pJob, std::memory_order_relaxed);
+                this->m_bottom.store(bottom + 1, std::memory_order_release);
+
+                return true;
+            }
+
+            // Owner only, the newest job or nullptr
+            ::IE::Internal::Job* Pop() noexcept
+            {
+                const std::int64_t bottom = this->m_bottom.load(std::memory_order_relaxed) - 1;
+                this->m_bottom.store(bottom, std::memory_order_relaxed);
+
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                std::int64_t top = this->m_top.load(std::memory_order_relaxed);
+
+                if (top > bottom) {
+                    this->m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+
+                ::IE::Internal::Job* pJob = this->m_jobs[bottom & INDEX_MASK].load(std::memory_order_relaxed);
+
+                // The last job may be stolen at the same time, the thread that increments "m_top" gets it
+                if (top == bottom) {
+                    if (!this->m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                        pJob = nullptr;
+
+                    this->m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                }
+
+                return pJob;
+            }
+
+            // Any thread, the oldest job or nullptr (also when another thief won the race for it)
+            ::IE::Internal::Job* Steal() noexcept
+            {
+                std::int64_t top = this->m_top.load(std::memory_order_acquire);
+
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const std::int64_t bottom = this->m_bottom.load(std::memory_order_acquire);
+
+                if (top >= bottom)
+                    return nullptr;
+
+                ::IE::Internal::Job* pJob = this->m_jobs[top & INDEX_MASK].load(std::memory_order_relaxed);
+
+                if (!this->m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    return nullptr;
+
+                return pJob;
+            }
+
+            // Only a snapshot when other threads are stealing
+            inline bool IsEmpty() const noexcept
+            {
+                return this->m_bottom.load(std::memory_order_relaxed) <= this->m_top.load(std::memory_order_relaxed);
+            }
+        };
+
+        // A job owning a copy of the callable passed to "JobSystem::Run"
+        template <typename _F>
+        struct FunctionJob : ::IE::Internal::Job {
+            _F m_function;
+
+            template <typename _G>
+            explicit FunctionJob(_G&& function) noexcept
+                : m_function(std::forward<_G>(function))
+            {
+                this->m_pExecute = &FunctionJob<_F>::Execute;
+            }
+
+            static void Execute(::IE::Internal::Job* pJob) noexcept
+            {
+                FunctionJob<_F>* pSelf = static_cast<FunctionJob<_F>*>(pJob);
+
+                pSelf->m_function();
+
+                delete pSelf;
+            }
+        };
+
+        // The job system & worker index (or "EXTERNAL_THREAD") of the current thread
+        inline thread_local ::IE::JobSystem* t_pCurrentJobSystem  = nullptr;
+        inline thread_local size_t           t_currentWorkerIndex = 0u;
+
+        // Number of "JobSystem::Wait" calls running jobs on the current thread's stack
+        inline thread_local size_t t_waitDepth = 0u;
+
+    } // Internal
+
+    /* Counts the unfinished jobs started with it ("JobSystem::Run") so that a thread can wait for all of them, or    */
+    /* so that other jobs can depend on them. A counter must outlive its jobs & can be reused once "IsDone" is true.   */
+    /* Waiting for the jobs depending on a counter is enough : they only start once no thread accesses the counter. */
+    class JobCounter {
+    private:
+        friend class ::IE::JobSystem;
+
+        std::atomic<std::uint32_t> m_count{ 0u };
+        std::atomic<std::uint32_t> m_finishingCount{ 0u }; // Threads still reading the counter after decrementing it
+        std::atomic<std::uint32_t> m_waiterCount{ 0u };    // Threads blocked on "m_count"
+
+        // Jobs started once "m_count" reaches 0, the list is closed by the thread that takes it & reopened with "m_count"
+        ::IE::Internal::SpinLock m_continuationLock;
+        ::IE::Internal::Job*     m_pContinuations = nullptr;
+        bool                     m_bClosed        = true;
+
+    public:
+        JobCounter() noexcept = default;
+
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        // The last job to finish releases the lock last, after which the counter isn't accessed anymore
+        inline bool IsDone() const noexcept
+        {
+            return this->m_count.load(std::memory_order_acquire) == 0u && this->m_finishingCount.load(std::memory_order_acquire) == 0u
+                && !this->m_continuationLock.IsLocked();
+        }
+    };
+
+    /* Work-stealing thread pool. Every worker owns a Chase-Lev deque: the jobs a worker creates go to its own deque */
+    /* & idle workers steal from the others, so that the jobs spread without a shared queue. Jobs started outside of */
+    /* the pool go to a shared queue instead. Idle workers spin for a few microseconds, then sleep on a futex until  */
+    /* a job is pushed. A thread waiting for a counter runs jobs meanwhile, so jobs can safely wait for other jobs.   */
+    class JobSystem {
+    public:
+        static constexpr const size_t EXTERNAL_THREAD = std::numeric_limits<size_t>::max();
+
+    private:
+        // Tries to find a job this many times before sleeping
+        static constexpr const size_t IDLE_SPIN_COUNT = 256u;
+
+        /* Every job a waiting thread runs is nested on its stack, and a stolen job can wait (& steal) in turn. Past */
+        /* this depth, a waiting thread only runs the jobs of its own deque, which it pushed from its current stack. */
+        static constexpr const size_t MAX_STEALING_WAIT_DEPTH = 16u;
+
+        struct alignas(64) Worker {
+            ::IE::Internal::WorkStealingDeque m_deque;
+            std::thread                       m_thread;
+            std::uint32_t                     m_randomState = 0u; // Picks the victims of the steals
+        };
+
+        Worker* m_pWorkers    = nullptr;
+        size_t  m_workerCount = 0u;
+
+        // Jobs started by threads outside of the pool, first in first out
+        ::IE::Internal::SpinLock m_externalLock;
+        ::IE::Internal::Job*     m_pExternalHead = nullptr;
+        ::IE::Internal::Job*     m_pExternalTail = nullptr;
+        std::atomic<bool>        m_bHasExternalJobs{ false };
+
+        alignas(64) std::atomic<std::uint32_t> m_wakeSignal{ 0u }; // Incremented to wake the sleeping workers
+        std::atomic<std::uint32_t> m_sleeperCount{ 0u };
+        std::atomic<bool>          m_bStopping{ false };
+
+        inline size_t GetCurrentWorkerIndex() const noexcept
+        {
+            return (::IE::Internal::t_pCurrentJobSystem == this) ? ::IE::Internal::t_currentWorkerIndex : EXTERNAL_THREAD;
+        }
+
+        void WakeWorkers(const bool bAll) noexcept
+        {
+            // Pairs with the increment of "m_sleeperCount" before a worker checks the deques for the last time
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (this->m_sleeperCount.load(std::memory_order_relaxed) > 0u) {
+                this->m_wakeSignal.fetch_add(1u, std::memory_order_release);
+                ::IE::Internal::WakeWord(this->m_wakeSignal, bAll);
+            }
+        }
+
+        // Queues "pJob" on the current worker's deque (or the external queue), runs it right away when the deque is full
+        void Submit(::IE::Internal::Job* pJob) noexcept
+        {
+            const size_t workerIndex = this->GetCurrentWorkerIndex();
+
+            if (workerIndex != EXTERNAL_THREAD) {
+                if (!this->m_pWorkers[workerIndex].m_deque.Push(pJob)) {
+                    this->Execute(pJob);
+                    return;
+                }
+            } else {
+                if (this->m_workerCount == 0u) {
+                    this->Execute(pJob);
+                    return;
+                }
+
+                pJob->m_pNext = nullptr;
+
+                this->m_externalLock.Lock();
+
+                if (this->m_pExternalTail != nullptr) this->m_pExternalTail->m_pNext = pJob;
+                else                                  this->m_pExternalHead          = pJob;
+
+                this->m_pExternalTail = pJob;
+                this->m_bHasExternalJobs.store(true, std::memory_order_relaxed);
+
+                this->m_externalLock.Unlock();
+            }
+
+            this->WakeWorkers(false);
+        }
+
+        ::IE::Internal::Job* PopExternalJob() noexcept
+        {
+            if (!this->m_bHasExternalJobs.load(std::memory_order_relaxed))
+                return nullptr;
+
+            this->m_externalLock.Lock();
+
+            ::IE::Internal::Job* pJob = this->m_pExternalHead;
+
+            if (pJob != nullptr) {
+                this->m_pExternalHead = pJob->m_pNext;
+
+                if (this->m_pExternalHead == nullptr) {
+                    this->m_pExternalTail = nullptr;
+                    this->m_bHasExternalJobs.store(false, std::memory_order_relaxed);
+                }
+            }
+
+            this->m_externalLock.Unlock();
+
+            return pJob;
+        }
+
+        // The own deque first (newest job), then the external queue, then the other deques from a random one (oldest job)
+        ::IE::Internal::Job* FindJob(const size_t workerIndex, const bool bSteal = true) noexcept
+        {
+            static thread_local std::uint32_t t_externalRandomState = 0x9E3779B9u;
+
+            std::uint32_t& randomState = (workerIndex != EXTERNAL_THREAD) ? this->m_pWorkers[workerIndex].m_randomState : t_externalRandomState;
+
+            if (workerIndex != EXTERNAL_THREAD) {
+                if (::IE::Internal::Job* pJob = this->m_pWorkers[workerIndex].m_deque.Pop())
+                    return pJob;
+            }
+
+            if (!bSteal)
+                return nullptr;
+
+            if (::IE::Internal::Job* pJob = this->PopExternalJob())
+                return pJob;
+
+            if (this->m_workerCount == 0u)
+                return nullptr;
+
+            // xorshift32
+            randomState ^= randomState << 13u;
+            randomState ^= randomState >> 17u;
+            randomState ^= randomState << 5u;
+
+            const size_t first = randomState % this->m_workerCount;
+
+            for (size_t i = 0u; i < this->m_workerCount; i++) {
+                const size_t victim = (first + i) % this->m_workerCount;
+
+                if (victim != workerIndex) {
+                    if (::IE::Internal::Job* pJob = this->m_pWorkers[victim].m_deque.Steal())
+                        return pJob;
+                }
+            }
+
+            return nullptr;
+        }
+
+        // Runs "pJob", then counts it as done in its counter & starts the jobs that were waiting for the counter
+        void Execute(::IE::Internal::Job* pJob) noexcept
+        {
+            ::IE::JobCounter* pCounter = pJob->m_pCounter; // "pJob" may be freed by "m_pExecute"
+
+            pJob->m_pExecute(pJob);
+
+            if (pCounter == nullptr)
+                return;
+
+            // A counter is only done once "m_finishingCount" is 0 & its lock is free, so it stays alive until the end
+            pCounter->m_finishingCount.fetch_add(1u, std::memory_order_relaxed);
+
+            if (pCounter->m_count.fetch_sub(1u, std::memory_order_seq_cst) != 1u) {
+                pCounter->m_finishingCount.fetch_sub(1u, std::memory_order_release);
+                return;
+            }
+
+            /* The other threads that decremented "m_count" incremented "m_finishingCount" before, and their decrement of */
+            /* it is their last access : once only this thread is left, the continuations may destroy the counter.      */
+            for (size_t spinCount = 0u; pCounter->m_finishingCount.load(std::memory_order_acquire) != 1u; spinCount++) {
+                if (spinCount < IDLE_SPIN_COUNT)
+                    ::IE::Internal::CPUPause();
+                else
+                    std::this_thread::yield();
+            }
+
+            pCounter->m_continuationLock.Lock();
+
+            ::IE::Internal::Job* pContinuation = pCounter->m_pContinuations;
+            pCounter->m_pContinuations = nullptr;
+            pCounter->m_bClosed        = true;
+
+            if (pCounter->m_waiterCount.load(std::memory_order_seq_cst) > 0u)
+                ::IE::Internal::WakeWord(pCounter->m_count, true);
+
+            pCounter->m_finishingCount.fetch_sub(1u, std::memory_order_release);
+            pCounter->m_continuationLock.Unlock();
+
+            // Once the continuations run, the counter may already be gone (when only the continuations are waited for)
+            while (pContinuation != nullptr) {
+                ::IE::Internal::Job* pNext = pContinuation->m_pNext;
+
+                this->Submit(pContinuation);
+                pContinuation = pNext;
+            }
+        }
+
+        // Counts "pJob" in "counter" & submits it, or defers it until "pDependency" reaches 0
+        void Start(::IE::Internal::Job* pJob, ::IE::JobCounter& counter, ::IE::JobCounter* pDependency) noexcept
+        {
+            pJob->m_pCounter = &counter;
+
+            // The first job of the counter reopens its continuation list
+            if (counter.m_count.fetch_add(1u, std::memory_order_relaxed) == 0u) {
+                counter.m_continuationLock.Lock();
+                counter.m_bClosed = false;
+                counter.m_continuationLock.Unlock();
+            }
+
+            // A closed list means that the last job of "pDependency" is done & that its thread left the counter
+            if (pDependency != nullptr) {
+                pDependency->m_continuationLock.Lock();
+
+                if (!pDependency->m_bClosed) {
+                    pJob->m_pNext = pDependency->m_pContinuations;
+                    pDependency->m_pContinuations = pJob;
+
+                    pDependency->m_continuationLock.Unlock();
+                    return;
+                }
+
+                pDependency->m_continuationLock.Unlock();
+            }
+
+            this->Submit(pJob);
+        }
+
+        void RunWorker(const size_t workerIndex) noexcept
+        {
+            ::IE::Internal::t_pCurrentJobSystem  = this;
+            ::IE::Internal::t_currentWorkerIndex = workerIndex;
+
+            size_t idleCount = 0u;
+
+            while (!this->m_bStopping.load(std::memory_order_relaxed)) {
+                if (::IE::Internal::Job* pJob = this->FindJob(workerIndex)) {
+                    this->Execute(pJob);
+                    idleCount = 0u;
+                    continue;
+                }
+
+                if (++idleCount < IDLE_SPIN_COUNT) {
+                    ::IE::Internal::CPUPause();
+                    continue;
+                }
+
+                // The signal is read before the last look at the deques, so a job pushed after that look changes it
+                const std::uint32_t signal = this->m_wakeSignal.load(std::memory_order_acquire);
+                this->m_sleeperCount.fetch_add(1u, std::memory_order_seq_cst);
+
+                ::IE::Internal::Job* pJob = this->FindJob(workerIndex);
+
+                if (pJob == nullptr && !this->m_bStopping.load(std::memory_order_relaxed))
+                    ::IE::Internal::WaitOnWord(this->m_wakeSignal, signal);
+
+                this->m_sleeperCount.fetch_sub(1u, std::memory_order_relaxed);
+
+                if (pJob != nullptr)
+                    this->Execute(pJob);
+
+                idleCount = 0u;
+            }
+
+            ::IE::Internal::t_pCurrentJobSystem = nullptr;
+        }
+
+        static void PinThread(std::thread& thread, const size_t core) noexcept
+        {
+#if defined(__IE__OS_LINUX)
+            ::cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(static_cast<int>(core), &set);
+
+            ::pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#elif defined(__IE__OS_WINDOWS) // end of #if defined(__IE__OS_LINUX)
+            ::SetThreadAffinityMask(static_cast<::HANDLE>(thread.native_handle()), static_cast<::DWORD_PTR>(1u) << core);
+#else // end of #elif defined(__IE__OS_WINDOWS)
+            (void)thread; (void)core;
+#endif // end of #else
+        }
+
+        // The part of "ParallelFor" splitting a range, which lives on the stack of the thread that split it
+        template <typename _F>
+        struct RangeJob : ::IE::Internal::Job {
+            ::IE::JobSystem* m_pJobSystem;
+            const _F*        m_pFunction;
+            size_t           m_begin, m_end, m_grainSize;
+
+            static void Execute(::IE::Internal::Job* pJob) noexcept
+            {
+                const RangeJob<_F>* pSelf = static_cast<RangeJob<_F>*>(pJob);
+
+                pSelf->m_pJobSystem->RunRange(pSelf->m_begin, pSelf->m_end, pSelf->m_grainSize, *pSelf->m_pFunction);
+            }
+        };
+
+        /* Lazy binary splitting: the upper half of the range is offered to the other workers until the range is no */
+        /* larger than "grainSize", so a range is only split as deep as there are idle workers stealing from it.    */
+        template <typename _F>
+        void RunRange(const size_t begin, const size_t end, const size_t grainSize, const _F& function) noexcept
+        {
+            if (end - begin <= grainSize) {
+                function(begin, end);
+                return;
+            }
+
+            const size_t middle = begin + (end - begin) / 2u;
+
+            RangeJob<_F> job;
+            job.m_pExecute   = &RangeJob<_F>::Execute;
+            job.m_pJobSystem = this;
+            job.m_pFunction  = &function;
+            job.m_begin      = middle;
+            job.m_end        = end;
+            job.m_grainSize  = grainSize;
+
+            ::IE::JobCounter counter;
+            this->Start(&job, counter, nullptr);
+
+            this->RunRange(begin, middle, grainSize, function);
+
+            this->Wait(counter);
+        }
+
+    public:
+        // +-----------------+     +------------+     +--------------+
+        // | Multi-Threading | --> | Job System | --> | Constructors |
+        // +-----------------+     +------------+     +--------------+
+
+        /* Starts "workerCount" workers (by default one per hardware thread besides the calling one, which takes part */
+        /* in the work while waiting). "bPinWorkers" binds worker "i" to the core "i + 1", leaving the core 0 to the  */
+        /* main thread, which keeps the deques & the data of each worker in the caches of a single core.             */
+        explicit JobSystem(const size_t workerCount = ::IE::GetHardwareThreadCount() - 1u, const bool bPinWorkers = false) noexcept
+        {
+            if (workerCount == 0u)
+                return;
+
+            this->m_pWorkers = new (std::nothrow) Worker[workerCount];
+
+            if (this->m_pWorkers == nullptr)
+                return;
+
+            this->m_workerCount = workerCount;
+
+            for (size_t w = 0u; w < workerCount; w++)
+                this->m_pWorkers[w].m_randomState = static_cast<std::uint32_t>(w + 1u) * 0x9E3779B9u;
+
+            for (size_t w = 0u; w < workerCount; w++) {
+                this->m_pWorkers[w].m_thread = std::thread([this, w]() noexcept { this->RunWorker(w); });
+
+                if (bPinWorkers)
+                    ::IE::JobSystem::PinThread(this->m_pWorkers[w].m_thread, (w + 1u) % ::IE::GetHardwareThreadCount());
+            }
+        }
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        // The jobs must be finished (see "Wait"), the workers are stopped & joined
+        ~JobSystem() noexcept
+        {
+            this->m_bStopping.store(true, std::memory_order_relaxed);
+
+            this->m_wakeSignal.fetch_add(1u, std::memory_order_release);
+            ::IE::Internal::WakeWord(this->m_wakeSignal, true);
+
+            for (size_t w = 0u; w < this->m_workerCount; w++)
+                this->m_pWorkers[w].m_thread.join();
+
+            delete[] this->m_pWorkers;
+        }
+
+        // Threads running the jobs, not counting the threads that wait for them
+        inline size_t GetWorkerCount() const noexcept { return this->m_workerCount; }
+
+        // +-----------------+     +------------+     +------+
+        // | Multi-Threading | --> | Job System | --> | Jobs |
+        // +-----------------+     +------------+     +------+
+
+        /* Runs "function()" on one of the workers & counts it in "counter" until it returns. With "pDependency", the  */
+        /* job only starts once that counter reached 0. The function must not throw, and is run right away when the   */
+        /* job can't be allocated.                                                                                    */
+        template <typename _F>
+        void Run(::IE::JobCounter& counter, _F&& function, ::IE::JobCounter* pDependency = nullptr) noexcept
+        {
+            using Function = std::decay_t<_F>;
+
+            // "function" is only moved from once the allocation succeeded
+            ::IE::Internal::FunctionJob<Function>* pJob = new (std::nothrow) ::IE::Internal::FunctionJob<Function>(std::forward<_F>(function));
+
+            if (pJob == nullptr) {
+                if (pDependency != nullptr)
+                    this->Wait(*pDependency);
+
+                function();
+                return;
+            }
+
+            this->Start(pJob, counter, pDependency);
+        }
+
+        // Runs other jobs until every job of "counter" is finished, then sleeps once there is nothing left to run
+        void Wait(::IE::JobCounter& counter) noexcept
+        {
+            const size_t workerIndex = this->GetCurrentWorkerIndex();
+            const bool   bSteal      = ::IE::Internal::t_waitDepth < MAX_STEALING_WAIT_DEPTH;
+
+            size_t idleCount = 0u;
+
+            while (!counter.IsDone()) {
+                if (::IE::Internal::Job* pJob = this->FindJob(workerIndex, bSteal)) {
+                    ::IE::Internal::t_waitDepth++;
+                    this->Execute(pJob);
+                    ::IE::Internal::t_waitDepth--;
+
+                    idleCount = 0u;
+                    continue;
+                }
+
+                if (++idleCount < IDLE_SPIN_COUNT) {
+                    ::IE::Internal::CPUPause();
+                    continue;
+                }
+
+                // Without workers, or when the last job is finishing (see "Execute"), nothing would wake the thread up
+                const std::uint32_t count = counter.m_count.load(std::memory_order_acquire);
+
+                if (count == 0u || this->m_workerCount == 0u) {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                counter.m_waiterCount.fetch_add(1u, std::memory_order_seq_cst);
+                ::IE::Internal::WaitOnWord(counter.m_count, count);
+                counter.m_waiterCount.fetch_sub(1u, std::memory_order_relaxed);
+
+                idleCount = 0u;
+            }
+        }
+
+        /* Calls "function(first, last)" on subranges of [begin, end) of at least "grainSize" indices (the last ones */
+        /* excepted) across the workers & returns once the whole range is done. A grain should hold enough work to  */
+        /* hide the cost of a steal (around a microsecond).                                                         */
+        template <typename _F>
+        void ParallelFor(const size_t begin, const size_t end, const size_t grainSize, const _F& function) noexcept
+        {
+            if (begin >= end)
+                return;
+
+            this->RunRange(begin, end, std::max<size_t>(grainSize, 1u), function);
+        }
+    };
+
+    // The job system shared by the engine (one worker per hardware thread besides the calling one), created on first use
+    inline ::IE::JobSystem& GetJobSystem() noexcept
+    {
+        static ::IE::JobSystem jobSystem;
+
+        return jobSystem;
+    }
+
+    namespace Internal {
+
+        /* Runs "function(i)" for every "i" in [0, count) on up to "threadCount" threads of the job system, the */
+        /* calling thread being one of them, and returns once they are all done. The indices are handed out     */
+        /* through an atomic counter so that tasks of uneven cost still balance across the threads.             */
+        template <typename _F>
+        inline void ParallelFor(const size_t count, size_t threadCount, const _F& function)
+        {
+            ::IE::JobSystem& jobSystem = ::IE::GetJobSystem();
+
+            threadCount = std::min({ threadCount, count, jobSystem.GetWorkerCount() + 1u });
+
+            if (threadCount <= 1u) {
+                for (size_t i = 0u; i < count; i++)
+                    function(i);
+
+                return;
+            }
+
+            std::atomic<size_t> nextIndex{ 0u };
+
+            const auto worker = [&]() noexcept {
+                for (size_t i = nextIndex.fetch_add(1u, std::memory_order_relaxed); i < count; i = nextIndex.fetch_add(1u, std::memory_order_relaxed))
+                    function(i);
+            };
+
+            ::IE::JobCounter counter;
+
+            for (size_t t = 1u; t < threadCount; t++)
+                jobSystem.Run(counter, worker);
+
+            worker();
+
+            jobSystem.Wait(counter);
+        }
+
+    } // Internal
+
+    // +-----------------+     +------------------+
+    // | Multi-Threading | --> | SPSC Ring Buffer |
+    // +-----------------+     +------------------+
+
+    /* Bounded lock-free queue between exactly one producer thread and one consumer thread. Each side    */
+    /* keeps a copy of the other side's index and only reads the shared one (which lives on another     */
+    /* cache line) when its copy says the queue is full / empty, so the threads rarely share cache lines. */
+    template <typename _T, size_t _CAPACITY>
+        requires (std::has_single_bit(_CAPACITY) && std::is_trivially_copyable_v<_T>)
+    class SPSCRingBuffer {
+    private:
+        static constexpr size_t CACHE_LINE_SIZE = 64u;
+        static constexpr size_t INDEX_MASK      = _CAPACITY - 1u;
+
+        // Producer
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_tail{ 0u }; // Next slot to write
+        size_t m_cachedHead = 0u;
+
+        // Consumer
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_head{ 0u }; // Next slot to read
+        size_t m_cachedTail = 0u;
+
+        alignas(CACHE_LINE_SIZE) std::array<_T, _CAPACITY> m_items;
+
+    public:
+        static constexpr size_t CAPACITY = _CAPACITY;
+
+        // Producer side, returns false (and drops "item") when the queue is full
+        bool TryPush(const _T& item) noexcept
+        {
+            const size_t tail = this->m_tail.load(std::memory_order_relaxed);
+
+            if (tail - this->m_cachedHead == _CAPACITY) {
+                this->m_cachedHead = this->m_head.load(std::memory_order_acquire);
+
+                if (tail - this->m_cachedHead == _CAPACITY)
+                    return false;
+            }
+
+            this->m_items[tail & INDEX_MASK] = item;
+            this->m_tail.store(tail + 1u, std::memory_order_release);
+
+            return true;
+        }
+
+        // Consumer side, returns false when the queue is empty
+        bool TryPop(_T& item) noexcept
+        {
+            const size_t head = this->m_head.load(std::memory_order_relaxed);
+
+            if (head == this->m_cachedTail) {
+                this->m_cachedTail = this->m_tail.load(std::memory_order_acquire);
+
+                if (head == this->m_cachedTail)
+                    return false;
+            }
+
+            item = this->m_items[head & INDEX_MASK];
+            this->m_head.store(head + 1u, std::memory_order_release);
+
+            return true;
+        }
+
+        // Consumer side, pops up to "items.size()" items at once & returns how many were popped
+        size_t TryPopBulk(const std::span<_T> items) noexcept
+        {
+            const size_t head = this->m_head.load(std::memory_order_relaxed);
+
+            this->m_cachedTail = this->m_tail.load(std::memory_order_acquire);
+
+            const size_t count = std::min(this->m_cachedTail - head, items.size());
+
+            for (size_t i = 0u; i < count; i++)
+                items[i] = this->m_items[(head + i) & INDEX_MASK];
+
+            this->m_head.store(head + count, std::memory_order_release);
+
+            return count;
+        }
+
+        // Only a snapshot when the other side is running
+        inline size_t GetSize() const noexcept
+        {
+            // The head is read first since it never gets past the tail
+            const size_t head = this->m_head.load(std::memory_order_acquire);
+            const size_t tail = this->m_tail.load(std::memory_order_acquire);
+
+            return tail - head;
+        }
+
+        inline bool IsEmpty() const noexcept { return this->GetSize() == 0u; }
+    };
+
+    // +--------+
+    // | Memory |
+    // +--------+
+
+    // +--------+     +-------------------+
+    // | Memory | --> | Aligned Allocator |
+    // +--------+     +-------------------+
+
+    /* Allocator for the standard containers that aligns their storage on "_ALIGNMENT" bytes (a cache line by default), */
+    /* so that the aligned SIMD loads & stores can be used on the elements of a "std::vector<float>" as well as on its  */
+    /* "Vecf32"s, and so that no element straddles 2 cache lines. Like "std::allocator", it throws "std::bad_alloc".    */
+    template <typename _T, size_t _ALIGNMENT = 64u>
+        requires (std::has_single_bit(_ALIGNMENT))
+    class AlignedAllocator {
+    public:
+        using value_type = _T;
+
+        static constexpr const size_t ALIGNMENT = std::max(_ALIGNMENT, alignof(_T));
+
+        template <typename _U>
+        struct rebind { using other = ::IE::AlignedAllocator<_U, _ALIGNMENT>; };
+
+        AlignedAllocator() noexcept = default;
+
+        template <typename _U>
+        AlignedAllocator(const ::IE::AlignedAllocator<_U, _ALIGNMENT>&) noexcept {  }
+
+        [[nodiscard]] _T* allocate(const size_t count)
+        {
+            if (count > std::numeric_limits<size_t>::max() / sizeof(_T))
+                throw std::bad_array_new_length();
+
+            return static_cast<_T*>(::operator new(count * sizeof(_T), std::align_val_t{ ALIGNMENT }));
+        }
+
+        void deallocate(_T* const pElements, const size_t count) noexcept
+        {
+            ::operator delete(pElements, count * sizeof(_T), std::align_val_t{ ALIGNMENT });
+        }
+
+        template <typename _U>
+        inline bool operator==(const ::IE::AlignedAllocator<_U, _ALIGNMENT>&) const noexcept { return true; }
+    };
+
+    template <typename _T>
+    using AlignedVector = std::vector<_T, ::IE::AlignedAllocator<_T>>;
+
+    // +--------+     +--------------+
+    // | Memory | --> | Linear Arena |
+    // +--------+     +--------------+
+
+    /* Hands out memory from a single block by bumping an offset, so allocating costs a few instructions & "Reset" */
+    /* frees everything at once in O(1). Meant for transient data such as the geometry of a frame : reset the arena */
+    /* at the start of every frame (or keep 2 arenas when the data of a frame is read during the next one). Nothing */
+    /* is destructed, hence "AllocateArray" only accepts trivially destructible types. Allocations that don't fit   */
+    /* return nullptr. An arena isn't thread safe, each thread needs its own (see "GetScratchArena").               */
+    class LinearArena {
+    public:
+        static constexpr const size_t DEFAULT_ALIGNMENT = 64u;
+
+        // Returned by "GetMarker", "Rewind" frees everything allocated since
+        using Marker = size_t;
+
+    private:
+        std::uint8_t* m_pMemory  = nullptr;
+        size_t        m_capacity = 0u;
+        size_t        m_offset   = 0u; // Bytes in use
+        size_t        m_peakSize = 0u; // Highest "m_offset" since the arena was created, to tune its capacity
+
+        inline void Release() noexcept
+        {
+            if (this->m_pMemory != nullptr)
+                ::operator delete(this->m_pMemory, std::align_val_t{ DEFAULT_ALIGNMENT });
+
+            this->m_pMemory  = nullptr;
+            this->m_capacity = 0u;
+            this->m_offset   = 0u;
+        }
+
+    public:
+        LinearArena() noexcept = default;
+
+        // Check "IsValid" for allocation failures
+        explicit LinearArena(const size_t capacity) noexcept
+            : m_pMemory(static_cast<std::uint8_t*>(::operator new(capacity, std::align_val_t{ DEFAULT_ALIGNMENT }, std::nothrow)))
+        {
+            this->m_capacity = (this->m_pMemory != nullptr) ? capacity : 0u;
+        }
+
+        LinearArena(const ::IE::LinearArena&) = delete;
+        ::IE::LinearArena& operator=(const ::IE::LinearArena&) = delete;
+
+        LinearArena(::IE::LinearArena&& other) noexcept
+            : m_pMemory(other.m_pMemory), m_capacity(other.m_capacity), m_offset(other.m_offset), m_peakSize(other.m_peakSize)
+        {
+            other.m_pMemory  = nullptr;
+            other.m_capacity = 0u;
+            other.m_offset   = 0u;
+        }
+
+        ::IE::LinearArena& operator=(::IE::LinearArena&& other) noexcept
+        {
+            if (this != &other) {
+                this->Release();
+
+                std::swap(this->m_pMemory,  other.m_pMemory);
+                std::swap(this->m_capacity, other.m_capacity);
+                std::swap(this->m_offset,   other.m_offset);
+                this->m_peakSize = other.m_peakSize;
+            }
+
+            return *this;
+        }
+
+        ~LinearArena() noexcept { this->Release(); }
+
+        inline bool IsValid() const noexcept { return this->m_pMemory != nullptr; }
+
+        inline size_t GetCapacity() const noexcept { return this->m_capacity; }
+        inline size_t GetSize()     const noexcept { return this->m_offset;   }
+        inline size_t GetPeakSize() const noexcept { return this->m_peakSize; }
+
+        // "size" bytes aligned on "alignment" (a power of 2) bytes, or nullptr when the arena is full
+        [[nodiscard]] void* Allocate(const size_t size, const size_t alignment = DEFAULT_ALIGNMENT) noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(std::has_single_bit(alignment));
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            // The address is aligned rather than the offset, which also handles alignments above the block's
+            const std::uintptr_t base   = reinterpret_cast<std::uintptr_t>(this->m_pMemory);
+            const size_t         offset = static_cast<size_t>(((base + this->m_offset + alignment - 1u) & ~static_cast<std::uintptr_t>(alignment - 1u)) - base);
+
+            if (this->m_pMemory == nullptr || offset > this->m_capacity || size > this->m_capacity - offset)
+                return nullptr;
+
+            this->m_offset   = offset + size;
+            this->m_peakSize = std::max(this->m_peakSize, this->m_offset);
+
+            return this->m_pMemory + offset;
+        }
+
+        // "count" default initialized (so uninitialized scalars) elements aligned on at least "alignment" bytes, or nullptr
+        template <typename _T>
+            requires (std::is_trivially_destructible_v<_T>)
+        [[nodiscard]] _T* AllocateArray(const size_t count, const size_t alignment = DEFAULT_ALIGNMENT) noexcept
+        {
+            if (count > std::numeric_limits<size_t>::max() / sizeof(_T))
+                return nullptr;
+
+            _T* const pElements = static_cast<_T*>(this->Allocate(count * sizeof(_T), std::max(alignment, alignof(_T))));
+
+            if (pElements != nullptr)
+                std::uninitialized_default_construct_n(pElements, count);
+
+            return pElements;
+        }
+
+        // Only gives the memory back when it is the arena's last allocation, the rest waits for "Rewind" or "Reset"
+        void Deallocate(void* const pMemory, const size_t size) noexcept
+        {
+            if (pMemory != nullptr && static_cast<std::uint8_t*>(pMemory) + size == this->m_pMemory + this->m_offset)
+                this->m_offset = static_cast<size_t>(static_cast<std::uint8_t*>(pMemory) - this->m_pMemory);
+        }
+
+        inline Marker GetMarker() const noexcept { return this->m_offset; }
+
+        // Frees everything allocated after "marker" was taken
+        inline void Rewind(const Marker marker) noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(marker <= this->m_offset);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            this->m_offset = marker;
+        }
+
+        // Frees everything, in O(1)
+        inline void Reset() noexcept { this->m_offset = 0u; }
+    };
+
+    /* Allocator for the standard containers that takes their storage from a "LinearArena", so that the containers */
+    /* filled during a frame don't touch the heap. The storage is aligned on "LinearArena::DEFAULT_ALIGNMENT" bytes. */
+    /* "deallocate" only frees the arena's last allocation (see "LinearArena::Deallocate"), the arena must not be   */
+    /* reset while a container still uses it. Throws "std::bad_alloc" when the arena is full, as containers expect.  */
+    template <typename _T>
+    class ArenaAllocator {
+    private:
+        ::IE::LinearArena* m_pArena;
+
+    public:
+        using value_type = _T;
+
+        explicit ArenaAllocator(::IE::LinearArena& arena) noexcept
+            : m_pArena(&arena)
+        {  }
+
+        template <typename _U>
+        ArenaAllocator(const ::IE::ArenaAllocator<_U>& other) noexcept
+            : m_pArena(&other.GetArena())
+        {  }
+
+        inline ::IE::LinearArena& GetArena() const noexcept { return *this->m_pArena; }
+
+        [[nodiscard]] _T* allocate(const size_t count)
+        {
+            void* const pMemory = (count <= std::numeric_limits<size_t>::max() / sizeof(_T))
+                ? this->m_pArena->Allocate(count * sizeof(_T), std::max(::IE::LinearArena::DEFAULT_ALIGNMENT, alignof(_T)))
+                : nullptr;
+
+            if (pMemory == nullptr)
+                throw std::bad_alloc();
+
+            return static_cast<_T*>(pMemory);
+        }
+
+        void deallocate(_T* const pElements, const size_t count) noexcept
+        {
+            this->m_pArena->Deallocate(pElements, count * sizeof(_T));
+        }
+
+        template <typename _U>
+        inline bool operator==(const ::IE::ArenaAllocator<_U>& other) const noexcept { return this->m_pArena == &other.GetArena(); }
+    };
+
+    template <typename _T>
+    using ArenaVector = std::vector<_T, ::IE::ArenaAllocator<_T>>;
+
+    // +--------+     +----------------+
+    // | Memory | --> | Scratch Memory |
+    // +--------+     +----------------+
+
+    // Bytes reserved by each thread's scratch arena (the pages are only committed once touched)
+    constexpr const size_t SCRATCH_ARENA_CAPACITY = 4u << 20u;
+
+    /* The calling thread's arena for temporary allocations, created on first use. Since the jobs run by a thread */
+    /* finish before the job it interrupted resumes (see "JobSystem::Wait"), the scratch memory is used as a stack */
+    /* : everything allocated in a scope must be freed (rewound) when leaving it, which "ScratchScope" handles.   */
+    inline ::IE::LinearArena& GetScratchArena() noexcept
+    {
+        thread_local ::IE::LinearArena arena(::IE::SCRATCH_ARENA_CAPACITY);
+
+        return arena;
+    }
+
+    // Rewinds the calling thread's scratch arena to where it was when the scope was created
+    class ScratchScope {
+    private:
+        ::IE::LinearArena&        m_arena;
+        ::IE::LinearArena::Marker m_marker;
+
+    public:
+        ScratchScope() noexcept
+            : m_arena(::IE::GetScratchArena()), m_marker(m_arena.GetMarker())
+        {  }
+
+        ScratchScope(const ::IE::ScratchScope&) = delete;
+        ::IE::ScratchScope& operator=(const ::IE::ScratchScope&) = delete;
+
+        ~ScratchScope() noexcept { this->m_arena.Rewind(this->m_marker); }
+
+        inline ::IE::LinearArena& GetArena() const noexcept { return this->m_arena; }
+    };
+
+    /* Temporary array of "count" default initialized elements aligned on "LinearArena::DEFAULT_ALIGNMENT" bytes. It */
+    /* comes from the calling thread's scratch arena, or from the heap when it doesn't fit there, and is freed by the */
+    /* destructor. Scratch arrays must be destroyed in the reverse order of their creation, which scopes guarantee.   */
+    template <typename _T>
+        requires (std::is_trivially_destructible_v<_T>)
+    class ScratchArray {
+    private:
+        _T*                       m_pElements = nullptr;
+        size_t                    m_count     = 0u;
+        ::IE::LinearArena::Marker m_marker;
+        bool                      m_bHeap     = false;
+
+        static constexpr const size_t ALIGNMENT = std::max(::IE::LinearArena::DEFAULT_ALIGNMENT, alignof(_T));
+
+    public:
+        explicit ScratchArray(const size_t count) noexcept
+            : m_marker(::IE::GetScratchArena().GetMarker())
+        {
+            this->m_pElements = ::IE::GetScratchArena().AllocateArray<_T>(count, ALIGNMENT);
+
+            if (this->m_pElements == nullptr && count <= std::numeric_limits<size_t>::max() / sizeof(_T)) {
+                this->m_pElements = static_cast<_T*>(::operator new(count * sizeof(_T), std::align_val_t{ ALIGNMENT }, std::nothrow));
+                this->m_bHeap     = true;
+
+                if (this->m_pElements != nullptr)
+                    std::uninitialized_default_construct_n(this->m_pElements, count);
+            }
+
+            this->m_count = (this->m_pElements != nullptr) ? count : 0u;
+        }
+
+        ScratchArray(const ::IE::ScratchArray<_T>&) = delete;
+        ::IE::ScratchArray<_T>& operator=(const ::IE::ScratchArray<_T>&) = delete;
+
+        ~ScratchArray() noexcept
+        {
+            if (!this->m_bHeap)
+                ::IE::GetScratchArena().Rewind(this->m_marker);
+            else if (this->m_pElements != nullptr)
+                ::operator delete(this->m_pElements, std::align_val_t{ ALIGNMENT });
+        }
+
+        // False when neither the scratch arena nor the heap had room for the elements
+        inline bool IsValid() const noexcept { return this->m_pElements != nullptr; }
+
+        inline size_t GetSize() const noexcept { return this->m_count; }
+
+        inline       _T* GetData()       noexcept { return this->m_pElements; }
+        inline const _T* GetData() const noexcept { return this->m_pElements; }
+
+        inline std::span<_T>       GetSpan()       noexcept { return { this->m_pElements, this->m_count }; }
+        inline std::span<const _T> GetSpan() const noexcept { return { this->m_pElements, this->m_count }; }
+
+        inline       _T& operator[](const size_t i)       noexcept { return this->m_pElements[i]; }
+        inline const _T& operator[](const size_t i) const noexcept { return this->m_pElements[i]; }
+    };
+
+    // +--------+
+    // | Timing |
+    // +--------+
+
+    // Nanoseconds elapsed since an unspecified point in time (CLOCK_MONOTONIC on linux), never goes backwards
+    inline std::int64_t GetMonotonicTime() noexcept
+    {
+#if defined(__IE__OS_WINDOWS)
+        static const std::int64_t frequency = []() noexcept {
+            ::LARGE_INTEGER result;
+            ::QueryPerformanceFrequency(&result);
+            return static_cast<std::int64_t>(result.QuadPart);
+        }();
+
+        ::LARGE_INTEGER counter;
+        ::QueryPerformanceCounter(&counter);
+
+        // Split to avoid overflowing "counter * 10^9"
+        const std::int64_t ticks = static_cast<std::int64_t>(counter.QuadPart);
+        return (ticks / frequency) * 1'000'000'000 + ((ticks % frequency) * 1'000'000'000) / frequency;
+#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
+        ::timespec time;
+        ::clock_gettime(CLOCK_MONOTONIC, &time);
+
+        return static_cast<std::int64_t>(time.tv_sec) * 1'000'000'000 + static_cast<std::int64_t>(time.tv_nsec);
+#endif // end of #elif defined(__IE__OS_LINUX)
+    }
+
+    /* Sleeps until "GetMonotonicTime() >= deadline". On linux the deadline is absolute (TIMER_ABSTIME),    */
+    /* so neither signals nor the time spent computing the duration make the sleep drift. Windows' "Sleep" */
+    /* only has millisecond granularity.                                                                   */
+    inline void SleepUntil(const std::int64_t deadline) noexcept
+    {
+#if defined(__IE__OS_WINDOWS)
+        const std::int64_t remaining = deadline - ::IE::GetMonotonicTime();
+
+        if (remaining > 0)
+            ::Sleep(static_cast<::DWORD>(remaining / 1'000'000));
+#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
+        const ::timespec time{ static_cast<::time_t>(deadline / 1'000'000'000), static_cast<long>(deadline % 1'000'000'000) };
+
+        while (::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, nullptr) == EINTR);
+#endif // end of #elif defined(__IE__OS_LINUX)
+    }
+
+    /* Caps the rate at which "Wait" returns to "framesPerSecond" : each call sleeps until one period after */
+    /* the previous frame's deadline. A frame that ran late moves the deadlines instead of being followed  */
+    /* by a burst of frames trying to catch up.                                                            */
+    class FrameLimiter {
+    private:
+        std::int64_t m_period        = 0; // Nanoseconds
+        std::int64_t m_nextFrameTime = 0;
+
+    public:
+        FrameLimiter() noexcept = default;
+
+        explicit FrameLimiter(const std::uint32_t framesPerSecond) noexcept
+            : m_period((framesPerSecond == 0u) ? 0 : 1'000'000'000 / static_cast<std::int64_t>(framesPerSecond)),
+              m_nextFrameTime(::IE::GetMonotonicTime())
+        {  }
+
+        inline std::int64_t GetPeriod() const noexcept { return this->m_period; }
+
+        inline void Reset() noexcept { this->m_nextFrameTime = ::IE::GetMonotonicTime(); }
+
+        void Wait() noexcept
+        {
+            if (this->m_period == 0)
+                return;
+
+            this->m_nextFrameTime += this->m_period;
+
+            const std::int64_t now = ::IE::GetMonotonicTime();
+
+            if (this->m_nextFrameTime <= now) {
+                this->m_nextFrameTime = now;
+                return;
+            }
+
+            ::IE::SleepUntil(this->m_nextFrameTime);
+        }
+
+    }; // FrameLimiter
+
+    // +--------------+
+    // | Math Library |
+    // +--------------+
+
+    // +--------------+     +-------------+
+    // | Math Library | --> | Vector (4D) |
+    // +--------------+     +-------------+
+
+    /* The templated "Vector" class represents a 4 dimensional mathematical vector of arithmitic types. This     */
+    /* vector uses compile-time c++ "magic" to use SIMD intrinsics when possible and a "naive method" otherwise. */
+    /* It also overloads the common mathematical operators like "+, -, *, and /" to make it easier to use.       */
+
+    template <::IE::arithmetic _T = int>
+    class Vector {
+        using _VECTOR_REGISTER_TYPE = ::IE::Internal::SIMDVectorRegister<_T>;
+
+    public:
+        union {
+            struct { _T x, y, z, w; };
+
+            _VECTOR_REGISTER_TYPE m_simdRegister;
+        };
+
+        // +--------------+     +-------------+     +--------------+
+        // | Math Library | --> | Vector (4D) | --> | Constructors |
+        // +--------------+     +-------------+     +--------------+
+
+#ifdef __IE__ENABLE_SIMD
+        template <::IE::Internal::SIMDVectorable _U = _T>
+        Vector(const ::IE::Internal::SIMDVectorRegister<_U>& other)
+        {
+            if constexpr (std::is_same_v<_T, _U>) {
+                this->m_simdRegister = other;
+            } else {
+                this->m_simdRegister = ::IE::Internal::SIMDSet<_T>(
+                    static_cast<_T>(::IE::Internal::SIMDExtractElement<_U, 0u>(other)),
+                    static_cast<_T>(::IE::Internal::SIMDExtractElement<_U, 1u>(other)),
+                    static_cast<_T>(::IE::Internal::SIMDExtractElement<_U, 2u>(other)),
+                    static_cast<_T>(::IE::Internal::SIMDExtractElement<_U, 3u>(other))
+                );
+            }
+        }
+#endif // #ifdef __IE__ENABLE_SIMD 
+
+        Vector(const _T x = 0, const _T y = 0, const _T z = 0, const _T w = 0) noexcept
+        {
+            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T>()) {
+#ifdef __IE__ENABLE_SIMD
+                this->m_simdRegister = ::IE::Internal::SIMDSet<_T>(x, y, z, w);
+#endif // #ifdef __IE__ENABLE_SIMD 
+            } else {
+                this->x = x; this->y = y; this->z = z; this->w = w;
+            }
+        }
+
+        // Converts every component of a vector of another type
+        template <::IE::arithmetic _U> requires (!std::is_same_v<_T, _U>)
+        Vector(const ::IE::Vector<_U>& other) noexcept
+            : Vector(static_cast<_T>(other.x), static_cast<_T>(other.y), static_cast<_T>(other.z), static_cast<_T>(other.w))
+        {  }
+
+        // +--------------+     +-------------+     +---------------------------+
+        // | Math Library | --> | Vector (4D) | --> | Operators: +=, -=, *=, /= |
+        // +--------------+     +-------------+     +---------------------------+
+
+        template <::IE::arithmetic _U>
+        inline void operator+=(const Vector<_U>& other) noexcept {
+            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T, _U>()) {
+#ifdef __IE__ENABLE_SIMD
+                this->m_simdRegister = ::IE::Internal::SIMDAdd<_T>(this->m_simdRegister, other.m_simdRegister);
+#endif // #ifdef __IE__ENABLE_SIMD 
+            } else {
+                this->x += other.x; this->y += other.y; this->z += other.z; this->w += other.w;
+            }
+        }
+
+        template <::IE::arithmetic _U>
+        inline void operator-=(const Vector<_U>& other) noexcept {
+            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T, _U>()) {
+#ifdef __IE__ENABLE_SIMD
+                this->m_simdRegister = ::IE::Internal::SIMDSub<_T>(this->m_simdRegister, other.m_simdRegister);
+#endif // #ifdef __IE__ENABLE_SIMD 
+            } else {
+                this->x -= other.x; this->y -= other.y; this->z -= other.z; this->w -= other.w;
+            }
+        }
+
+        template <::IE::arithmetic _U>
+        inline void operator*=(const Vector<_U>& other) noexcept {
+            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T, _U>()) {
+#ifdef __IE__ENABLE_SIMD
+                this->m_simdRegister = ::IE::Internal::SIMDMul<_T>(this->m_simdRegister, other.m_simdRegister);
+#endif // #ifdef __IE__ENABLE_SIMD 
+            } else {
+                this->x *= other.x; this->y *= other.y; this->z *= other.z; this->w *= other.w;
+            }
+        }
+
+        template <::IE::arithmetic _U>
+        inline void operator/=(const Vector<_U>& other) noexcept {
+            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T, _U>()) {
+#ifdef __IE__ENABLE_SIMD
+                this->m_simdRegister = ::IE::Internal::SIMDDiv<_T>(this->m_simdRegister, other.m_simdRegister);
+#endif // #ifdef __IE__ENABLE_SIMD 
+            } else {
+                this->x /= other.x; this->y /= other.y; this->z /= other.z; this->w /= other.w;
+            }
+        }
+
+        // The scalar versions broadcast the scalar to every component
+
+        template <::IE::arithmetic _U>
+        inline void operator*=(const _U scalar) noexcept { this->operator*=(::IE::Vector<_T>(scalar, scalar, scalar, scalar)); }
+
+        template <::IE::arithmetic _U>
+        inline void operator/=(const _U scalar) noexcept { this->operator/=(::IE::Vector<_T>(scalar, scalar, scalar, scalar)); }
+
+        // +--------------+     +-------------+     +--------------------------------+
+        // | Math Library | --> | Vector (4D) | --> | Non Static Function Operations |
+        // +--------------+     +-------------+     +--------------------------------+
+
+        inline float GetLength() const noexcept {
+            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T>()) {
+#ifdef __IE__ENABLE_SIMD
+                return std::sqrt(::IE::Internal::SIMDDotProduct<_T>(this->m_simdRegister, this->m_simdRegister));
+#endif // #ifdef __IE__ENABLE_SIMD
+			} else {
+				return std::sqrt(this->x * this->x + this->y * this->y + this->z * this->z + this->w * this->w);
+			}
+        }
+
+        inline void Normalize() noexcept {
+            this->operator/=(this->GetLength());
+        }
+
+        // +--------------+     +-------------+     +----------------------------+
+        // | Math Library | --> | Vector (4D) | --> | Static Function Operations |
+        // +--------------+     +-------------+     +----------------------------+
+
+        template <::IE::arithmetic _T_A>
+		inline static ::IE::Vector<_T_A> Normalized(const ::IE::Vector<_T_A>& vec) noexcept
+		{
+			return vec / vec.GetLength();
+		}
+
+		template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
+		inline static auto CrossProduct3D(const ::IE::Vector<_T_A>& vecA, const ::IE::Vector<_T_B>& vecB) noexcept
+			-> ::IE::Vector<decltype(vecA.x + vecB.x)>
+		{
+			if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T_A, _T_B>()) {
+#ifdef __IE__ENABLE_SIMD
+				if constexpr (std::is_same_v<_T_A, float>) {
+					// (a * b.yzx - a.yzx * b) holds the cross product in the "zxy" order
+					const __m128 aYZX = _mm_shuffle_ps(vecA.m_simdRegister, vecA.m_simdRegister, _MM_SHUFFLE(3, 0, 2, 1));
+					const __m128 bYZX = _mm_shuffle_ps(vecB.m_simdRegister, vecB.m_simdRegister, _MM_SHUFFLE(3, 0, 2, 1));
+					const __m128 cZXY = _mm_sub_ps(_mm_mul_ps(vecA.m_simdRegister, bYZX), _mm_mul_ps(aYZX, vecB.m_simdRegister));
+
+					return ::IE::Vector<float>(_mm_shuffle_ps(cZXY, cZXY, _MM_SHUFFLE(3, 0, 2, 1)));
+				} else {
+					const ::IE::Vector<_T_A> tempA1(vecA.y, vecA.z, vecA.x, 0);
+					const ::IE::Vector<_T_A> tempB1(vecB.z, vecB.x, vecB.y, 0);
+					const ::IE::Vector<_T_A> tempA2(vecA.z, vecA.x, vecA.y, 0);
+					const ::IE::Vector<_T_A> tempB2(vecB.y, vecB.z, vecB.x, 0);
+
+					return tempA1 * tempB1 - tempA2 * tempB2;
+				}
+#endif // #ifdef __IE__ENABLE_SIMD
+			} else {
+				return ::IE::Vector<decltype(vecA.x + vecB.x)>(
+					vecA.y * vecB.z - vecA.z * vecB.y,
+					vecA.z * vecB.x - vecA.x * vecB.z,
+					vecA.x * vecB.y - vecA.y * vecB.x,
+					0
+				);
+			}
+		}
+
+		template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
+		static inline auto DotProduct(const ::IE::Vector<_T_A>& a, const ::IE::Vector<_T_B>& b) noexcept
+			-> decltype(a.x + b.x)
+		{
+			if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T_A, _T_B>()) {
+#ifdef __IE__ENABLE_SIMD
+				return ::IE::Internal::SIMDDotProduct<_T_A>(a.m_simdRegister, b.m_simdRegister);
+#endif // #ifdef __IE__ENABLE_SIMD
+			} else {
+				return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+			}
+		}
+
+		template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
+		static inline auto GetReflected(const ::IE::Vector<_T_A>& in, const ::IE::Vector<_T_B>& normal) noexcept
+			-> ::IE::Vector<decltype(in.x + normal.x)>
+		{
+			return in - normal * 2 * ::IE::Vector<>::DotProduct(in, normal);
+		}
+    };
+
+    // +--------------+     +-------------+     +--------------------------------+
+    // | Math Library | --> | Vector (4D) | --> | Operators: +, -, *, /          |
+    // +--------------+     +-------------+     +--------------------------------+
+
+    /* The SIMD results are computed in the register of "_T_A" and then converted to the promoted */
+    /* return type since, for example, "int16_t + int16_t" yields an "int" vector.                  */
+
+    template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
+    inline auto operator+(const ::IE::Vector<_T_A>& a, const ::IE::Vector<_T_B>& b) noexcept
+        -> Vector<decltype(a.x + b.x)>
+    {
+        using _RETURN_VECTOR_TYPE = Vector<decltype(a.x + b.x)>;
+
+        if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T_A, _T_B>()) {
+#ifdef __IE__ENABLE_SIMD
+            return _RETURN_VECTOR_TYPE(::IE::Vector<_T_A>(::IE::Internal::SIMDAdd<_T_A>(a.m_simdRegister, b.m_simdRegister)));
+#endif // #ifdef __IE__ENABLE_SIMD 
+        } else {
+            return _RETURN_VECTOR_TYPE(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+        }
+    }
+
+    template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
+    inline auto operator-(const ::IE::Vector<_T_A>& a, const ::IE::Vector<_T_B>& b) noexcept
+        -> Vector<decltype(a.x - b.x)>
+    {
+        using _RETURN_VECTOR_TYPE = Vector<decltype(a.x - b.x)>;
+
+        if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T_A, _T_B>()) {
+#ifdef __IE__ENABLE_SIMD
+            return _RETURN_VECTOR_TYPE(::IE::Vector<_T_A>(::IE::Internal::SIMDSub<_T_A>(a.m_simdRegister, b.m_simdRegister)));
+#endif // #ifdef __IE__ENABLE_SIMD 
+        } else {
+            return _RETURN_VECTOR_TYPE(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+        }
+    }
+
+    template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
+    inline auto operator*(const ::IE::Vector<_T_A>& a, const ::IE::Vector<_T_B>& b) noexcept
+        -> Vector<decltype(a.x * b.x)>
+    {
+        using _RETURN_VECTOR_TYPE = Vector<decltype(a.x * b.x)>;
+
+        if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T_A, _T_B>()) {
+#ifdef __IE__ENABLE_SIMD
+            return _RETURN_VECTOR_TYPE(::IE::Vector<_T_A>(::IE::Internal::SIMDMul<_T_A>(a.m_simdRegister, b.m_simdRegister)));
+#endif // #ifdef __IE__ENABLE_SIMD 
+        } else {
+            return _RETURN_VECTOR_TYPE(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+        }
+    }
+
+    template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
+    inline auto operator/(const ::IE::Vector<_T_A>& a, const ::IE::Vector<_T_B>& b) noexcept
+        -> Vector<decltype(a.x / b.x)>
+    {
+        using _RETURN_VECTOR_TYPE = Vector<decltype(a.x / b.x)>;
+
+        if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T_A, _T_B>()) {
+#ifdef __IE__ENABLE_SIMD
+            return _RETURN_VECTOR_TYPE(::IE::Vector<_T_A>(::IE::Internal::SIMDDiv<_T_A>(a.m_simdRegister, b.m_simdRegister)));
+#endif // #ifdef __IE__ENABLE_SIMD 
+        } else {
+            return _RETURN_VECTOR_TYPE(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+        }
+    }
+
+    // +--------------+     +-------------+     +--------------------------------+
+    // | Math Library | --> | Vector (4D) | --> | Operators: Vector * Scalar     |
+    // +--------------+     +-------------+     +--------------------------------+
+
+    template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
+    inline auto operator*(const ::IE::Vector<_T_A>& a, const _T_B scalar) noexcept
+        -> Vector<decltype(a.x * scalar)>
+    {
+        using _RETURN_VECTOR_TYPE = Vector<decltype(a.x * scalar)>;
+
+        return _RETURN_VECTOR_TYPE(a) * _RETURN_VECTOR_TYPE(scalar, scalar, scalar, scalar);
+    }
+
+    template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
+    inline auto operator*(const _T_A scalar, const ::IE::Vector<_T_B>& b) noexcept
+        -> Vector<decltype(scalar * b.x)>
+    {
+        return b * scalar;
+    }
+
+    template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
+    inline auto operator/(const ::IE::Vector<_T_A>& a, const _T_B scalar) noexcept
+        -> Vector<decltype(a.x / scalar)>
+    {
+        using _RETURN_VECTOR_TYPE = Vector<decltype(a.x / scalar)>;
+
+        return _RETURN_VECTOR_TYPE(a) / _RETURN_VECTOR_TYPE(scalar, scalar, scalar, scalar);
+    }
+
+    template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
+    inline bool operator==(const ::IE::Vector<_T_A>& a, const ::IE::Vector<_T_B>& b) noexcept
+    {
+        return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+    }
+
+    template <::IE::arithmetic _T_A, ::IE::arithmetic _T_B>
+    inline bool operator!=(const ::IE::Vector<_T_A>& a, const ::IE::Vector<_T_B>& b) noexcept
+    {
+        return a.x != b.x || a.y != b.y || a.z != b.z || a.w != b.w;
+    }
+
+    template <::IE::arithmetic _T>
+	inline std::ostream& operator<<(std::ostream& stream, const ::IE::Vector<_T>& vec) noexcept
+	{
+		stream << "(" << vec.x << ", " << vec.y << ", " << vec.z << ", " << vec.w << ")";
+
+		return stream;
+	}
+
+    // +--------------+     +-------------+     +------------------------+
+    // | Math Library | --> | Vector (4D) | --> | Useful vector Typedefs |
+    // +--------------+     +-------------+     +------------------------+
+
+    typedef ::IE::Vector<int8_t>  Veci8;
+	typedef ::IE::Vector<int16_t> Veci16;
+	typedef ::IE::Vector<int32_t> Veci32;
+
+	typedef ::IE::Vector<uint8_t>  Vecu8;
+	typedef ::IE::Vector<uint16_t> Vecu16;
+	typedef ::IE::Vector<uint32_t> Vecu32;
+
+	typedef ::IE::Vector<std::enable_if_t<std::numeric_limits<float>::is_iec559, float>>   Vecf32;
+	typedef ::IE::Vector<std::enable_if_t<std::numeric_limits<double>::is_iec559, double>> Vecd64;
+
+	typedef ::IE::Vecf32 Colorf32;
+	typedef ::IE::Vecu8  Coloru8;
+
+    // +--------------+     +-----------------+
+    // | Math Library | --> | Packed Integers |
+    // +--------------+     +-----------------+
+
+    // The lane types of "Packed"
+    template <typename _T>
+    concept packable = std::is_same_v<_T, int8_t>  || std::is_same_v<_T, uint8_t>  ||
+                       std::is_same_v<_T, int16_t> || std::is_same_v<_T, uint16_t> ||
+                       std::is_same_v<_T, int32_t>;
+
+    namespace Internal {
+
+#ifdef __IE__ENABLE_SIMD
+
+        /* A "Packed" of 32 bytes fills an AVX2 register when the compilation target has AVX2, otherwise it is a */
+        /* pair of SSE registers (like the 16 byte ones), every operation being done on both halves.           */
+#if defined(__AVX2__)
+        template <size_t _BYTES>
+        using PackedRegister = std::conditional_t<_BYTES == 32u, __m256i, __m128i>;
+#else // end of #if defined(__AVX2__)
+        template <size_t _BYTES>
+        using PackedRegister = __m128i;
+#endif // end of #else
+
+        template <typename _R>
+        constexpr const bool IS_AVX2_PACKED_REGISTER = std::is_same_v<_R, __m256i>;
+
+        template <::IE::packable _T, typename _R>
+        static inline _R PackedSet1(const _T value) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) {
+                if constexpr (sizeof(_T) == 1u)      return _mm256_set1_epi8(static_cast<char>(value));
+                else if constexpr (sizeof(_T) == 2u) return _mm256_set1_epi16(static_cast<short>(value));
+                else                                 return _mm256_set1_epi32(value);
+            } else {
+                if constexpr (sizeof(_T) == 1u)      return _mm_set1_epi8(static_cast<char>(value));
+                else if constexpr (sizeof(_T) == 2u) return _mm_set1_epi16(static_cast<short>(value));
+                else                                 return _mm_set1_epi32(value);
+            }
+        }
+
+        template <typename _R>
+        static inline _R PackedLoad(const void* pSource) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>)
+                return _mm256_loadu_si256(static_cast<const __m256i*>(pSource));
+            else
+                return _mm_loadu_si128(static_cast<const __m128i*>(pSource));
+        }
+
+        template <typename _R>
+        static inline void PackedStore(void* pDestination, const _R& a) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>)
+                _mm256_storeu_si256(static_cast<__m256i*>(pDestination), a);
+            else
+                _mm_storeu_si128(static_cast<__m128i*>(pDestination), a);
+        }
+
+        template <::IE::packable _T, typename _R>
+        static inline _R PackedAdd(const _R& a, const _R& b) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) {
+                if constexpr (sizeof(_T) == 1u)      return _mm256_add_epi8(a, b);
+                else if constexpr (sizeof(_T) == 2u) return _mm256_add_epi16(a, b);
+                else                                 return _mm256_add_epi32(a, b);
+            } else {
+                if constexpr (sizeof(_T) == 1u)      return _mm_add_epi8(a, b);
+                else if constexpr (sizeof(_T) == 2u) return _mm_add_epi16(a, b);
+                else                                 return _mm_add_epi32(a, b);
+            }
+        }
+
+        template <::IE::packable _T, typename _R>
+        static inline _R PackedSub(const _R& a, const _R& b) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) {
+                if constexpr (sizeof(_T) == 1u)      return _mm256_sub_epi8(a, b);
+                else if constexpr (sizeof(_T) == 2u) return _mm256_sub_epi16(a, b);
+                else                                 return _mm256_sub_epi32(a, b);
+            } else {
+                if constexpr (sizeof(_T) == 1u)      return _mm_sub_epi8(a, b);
+                else if constexpr (sizeof(_T) == 2u) return _mm_sub_epi16(a, b);
+                else                                 return _mm_sub_epi32(a, b);
+            }
+        }
+
+        // Low half of the products, 16 & 32 bit lanes only
+        template <::IE::packable _T, typename _R>
+        static inline _R PackedMulLow(const _R& a, const _R& b) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) {
+                if constexpr (sizeof(_T) == 2u) return _mm256_mullo_epi16(a, b);
+                else                            return _mm256_mullo_epi32(a, b);
+            } else {
+                if constexpr (sizeof(_T) == 2u) return _mm_mullo_epi16(a, b);
+                else                            return ::IE::Internal::SIMDMul<int32_t>(a, b);
+            }
+        }
+
+        // 8 & 16 bit lanes only
+        template <::IE::packable _T, typename _R>
+        static inline _R PackedAddSaturate(const _R& a, const _R& b) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) {
+                if constexpr (std::is_same_v<_T, int8_t>)       return _mm256_adds_epi8(a, b);
+                else if constexpr (std::is_same_v<_T, uint8_t>) return _mm256_adds_epu8(a, b);
+                else if constexpr (std::is_same_v<_T, int16_t>) return _mm256_adds_epi16(a, b);
+                else                                            return _mm256_adds_epu16(a, b);
+            } else {
+                if constexpr (std::is_same_v<_T, int8_t>)       return _mm_adds_epi8(a, b);
+                else if constexpr (std::is_same_v<_T, uint8_t>) return _mm_adds_epu8(a, b);
+                else if constexpr (std::is_same_v<_T, int16_t>) return _mm_adds_epi16(a, b);
+                else                                            return _mm_adds_epu16(a, b);
+            }
+        }
+
+        // 8 & 16 bit lanes only
+        template <::IE::packable _T, typename _R>
+        static inline _R PackedSubSaturate(const _R& a, const _R& b) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) {
+                if constexpr (std::is_same_v<_T, int8_t>)       return _mm256_subs_epi8(a, b);
+                else if constexpr (std::is_same_v<_T, uint8_t>) return _mm256_subs_epu8(a, b);
+                else if constexpr (std::is_same_v<_T, int16_t>) return _mm256_subs_epi16(a, b);
+                else                                            return _mm256_subs_epu16(a, b);
+            } else {
+                if constexpr (std::is_same_v<_T, int8_t>)       return _mm_subs_epi8(a, b);
+                else if constexpr (std::is_same_v<_T, uint8_t>) return _mm_subs_epu8(a, b);
+                else if constexpr (std::is_same_v<_T, int16_t>) return _mm_subs_epi16(a, b);
+                else                                            return _mm_subs_epu16(a, b);
+            }
+        }
+
+        // High half of the 32 bit products, 16 bit lanes only
+        template <::IE::packable _T, typename _R>
+        static inline _R PackedMulHigh(const _R& a, const _R& b) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) {
+                if constexpr (std::is_same_v<_T, int16_t>) return _mm256_mulhi_epi16(a, b);
+                else                                       return _mm256_mulhi_epu16(a, b);
+            } else {
+                if constexpr (std::is_same_v<_T, int16_t>) return _mm_mulhi_epi16(a, b);
+                else                                       return _mm_mulhi_epu16(a, b);
+            }
+        }
+
+        // "(a + b + 1) >> 1", unsigned 8 & 16 bit lanes only
+        template <::IE::packable _T, typename _R>
+        static inline _R PackedAverage(const _R& a, const _R& b) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) {
+                if constexpr (sizeof(_T) == 1u) return _mm256_avg_epu8(a, b);
+                else                            return _mm256_avg_epu16(a, b);
+            } else {
+                if constexpr (sizeof(_T) == 1u) return _mm_avg_epu8(a, b);
+                else                            return _mm_avg_epu16(a, b);
+            }
+        }
+
+        template <typename _R>
+        static inline _R PackedAnd(const _R& a, const _R& b) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) return _mm256_and_si256(a, b);
+            else                                                       return _mm_and_si128(a, b);
+        }
+
+        template <typename _R>
+        static inline _R PackedOr(const _R& a, const _R& b) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) return _mm256_or_si256(a, b);
+            else                                                       return _mm_or_si128(a, b);
+        }
+
+        template <typename _R>
+        static inline _R PackedXor(const _R& a, const _R& b) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) return _mm256_xor_si256(a, b);
+            else                                                       return _mm_xor_si128(a, b);
+        }
+
+        // Bits of "a" where "mask" is set, of "b" elsewhere
+        template <typename _R>
+        static inline _R PackedSelect(const _R& mask, const _R& a, const _R& b) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) return _mm256_or_si256(_mm256_and_si256(mask, a), _mm256_andnot_si256(mask, b));
+            else                                                       return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+        }
+
+        template <::IE::packable _T, typename _R>
+        static inline _R PackedEqual(const _R& a, const _R& b) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) {
+                if constexpr (sizeof(_T) == 1u)      return _mm256_cmpeq_epi8(a, b);
+                else if constexpr (sizeof(_T) == 2u) return _mm256_cmpeq_epi16(a, b);
+                else                                 return _mm256_cmpeq_epi32(a, b);
+            } else {
+                if constexpr (sizeof(_T) == 1u)      return _mm_cmpeq_epi8(a, b);
+                else if constexpr (sizeof(_T) == 2u) return _mm_cmpeq_epi16(a, b);
+                else                                 return _mm_cmpeq_epi32(a, b);
+            }
+        }
+
+        template <::IE::packable _T, typename _R>
+        static inline _R PackedGreater(const _R& a, const _R& b) noexcept
+        {
+            // There are only signed comparisons, flipping the sign bits maps the unsigned order onto the signed one
+            if constexpr (std::is_unsigned_v<_T>) {
+                const _R sign = ::IE::Internal::PackedSet1<_T, _R>(static_cast<_T>(_T(1) << (sizeof(_T) * 8u - 1u)));
+
+                return ::IE::Internal::PackedGreater<std::make_signed_t<_T>, _R>(::IE::Internal::PackedXor(a, sign), ::IE::Internal::PackedXor(b, sign));
+            } else if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) {
+                if constexpr (sizeof(_T) == 1u)      return _mm256_cmpgt_epi8(a, b);
+                else if constexpr (sizeof(_T) == 2u) return _mm256_cmpgt_epi16(a, b);
+                else                                 return _mm256_cmpgt_epi32(a, b);
+            } else {
+                if constexpr (sizeof(_T) == 1u)      return _mm_cmpgt_epi8(a, b);
+                else if constexpr (sizeof(_T) == 2u) return _mm_cmpgt_epi16(a, b);
+                else                                 return _mm_cmpgt_epi32(a, b);
+            }
+        }
+
+        template <::IE::packable _T, typename _R>
+        static inline _R PackedMin(const _R& a, const _R& b) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) {
+                if constexpr (std::is_same_v<_T, int8_t>)        return _mm256_min_epi8(a, b);
+                else if constexpr (std::is_same_v<_T, uint8_t>)  return _mm256_min_epu8(a, b);
+                else if constexpr (std::is_same_v<_T, int16_t>)  return _mm256_min_epi16(a, b);
+                else if constexpr (std::is_same_v<_T, uint16_t>) return _mm256_min_epu16(a, b);
+                else                                             return _mm256_min_epi32(a, b);
+            } else if constexpr (std::is_same_v<_T, uint8_t>) {
+                return _mm_min_epu8(a, b);
+            } else if constexpr (std::is_same_v<_T, int16_t>) {
+                return _mm_min_epi16(a, b);
+            } else {
+#if defined(__SSE4_1__) || defined(__AVX__)
+                if constexpr (std::is_same_v<_T, int8_t>)        return _mm_min_epi8(a, b);
+                else if constexpr (std::is_same_v<_T, uint16_t>) return _mm_min_epu16(a, b);
+                else                                             return _mm_min_epi32(a, b);
+#else // end of #if defined(__SSE4_1__) || defined(__AVX__)
+                // SSE2 only has the unsigned 8 bit & signed 16 bit versions
+                return ::IE::Internal::PackedSelect(::IE::Internal::PackedGreater<_T>(a, b), b, a);
+#endif // end of #else
+            }
+        }
+
+        template <::IE::packable _T, typename _R>
+        static inline _R PackedMax(const _R& a, const _R& b) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) {
+                if constexpr (std::is_same_v<_T, int8_t>)        return _mm256_max_epi8(a, b);
+                else if constexpr (std::is_same_v<_T, uint8_t>)  return _mm256_max_epu8(a, b);
+                else if constexpr (std::is_same_v<_T, int16_t>)  return _mm256_max_epi16(a, b);
+                else if constexpr (std::is_same_v<_T, uint16_t>) return _mm256_max_epu16(a, b);
+                else                                             return _mm256_max_epi32(a, b);
+            } else if constexpr (std::is_same_v<_T, uint8_t>) {
+                return _mm_max_epu8(a, b);
+            } else if constexpr (std::is_same_v<_T, int16_t>) {
+                return _mm_max_epi16(a, b);
+            } else {
+#if defined(__SSE4_1__) || defined(__AVX__)
+                if constexpr (std::is_same_v<_T, int8_t>)        return _mm_max_epi8(a, b);
+                else if constexpr (std::is_same_v<_T, uint16_t>) return _mm_max_epu16(a, b);
+                else                                             return _mm_max_epi32(a, b);
+#else // end of #if defined(__SSE4_1__) || defined(__AVX__)
+                return ::IE::Internal::PackedSelect(::IE::Internal::PackedGreater<_T>(a, b), a, b);
+#endif // end of #else
+            }
+        }
+
+        // 16 & 32 bit lanes only, every lane is shifted by "count"
+        template <::IE::packable _T, typename _R>
+        static inline _R PackedShiftLeft(const _R& a, const int count) noexcept
+        {
+            const __m128i shift = _mm_cvtsi32_si128(count);
+
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) {
+                if constexpr (sizeof(_T) == 2u) return _mm256_sll_epi16(a, shift);
+                else                            return _mm256_sll_epi32(a, shift);
+            } else {
+                if constexpr (sizeof(_T) == 2u) return _mm_sll_epi16(a, shift);
+                else                            return _mm_sll_epi32(a, shift);
+            }
+        }
+
+        // Arithmetic shift for the signed lanes, logical shift for the unsigned ones
+        template <::IE::packable _T, typename _R>
+        static inline _R PackedShiftRight(const _R& a, const int count) noexcept
+        {
+            const __m128i shift = _mm_cvtsi32_si128(count);
+
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) {
+                if constexpr (std::is_same_v<_T, int16_t>)       return _mm256_sra_epi16(a, shift);
+                else if constexpr (std::is_same_v<_T, uint16_t>) return _mm256_srl_epi16(a, shift);
+                else                                             return _mm256_sra_epi32(a, shift);
+            } else {
+                if constexpr (std::is_same_v<_T, int16_t>)       return _mm_sra_epi16(a, shift);
+                else if constexpr (std::is_same_v<_T, uint16_t>) return _mm_srl_epi16(a, shift);
+                else                                             return _mm_sra_epi32(a, shift);
+            }
+        }
+
+        /* Widens the low ("_HIGH" = false) or high 8 lanes of a SSE register to lanes twice as wide, */
+        /* sign extending the signed lanes & zero extending the unsigned ones.                       */
+        template <::IE::packable _T, bool _HIGH>
+        static inline __m128i PackedWidenSSE(const __m128i& a) noexcept
+        {
+            const __m128i extension = std::is_signed_v<_T> ? ::IE::Internal::PackedGreater<_T, __m128i>(_mm_setzero_si128(), a) : _mm_setzero_si128();
+
+            if constexpr (sizeof(_T) == 1u)
+                return _HIGH ? _mm_unpackhi_epi8(a, extension) : _mm_unpacklo_epi8(a, extension);
+            else
+                return _HIGH ? _mm_unpackhi_epi16(a, extension) : _mm_unpacklo_epi16(a, extension);
+        }
+
+#if defined(__AVX2__)
+        // Widens the 16 lanes of "a" to a AVX2 register
+        template <::IE::packable _T>
+        static inline __m256i PackedWidenAVX2(const __m128i& a) noexcept
+        {
+            if constexpr (std::is_same_v<_T, int8_t>)       return _mm256_cvtepi8_epi16(a);
+            else if constexpr (std::is_same_v<_T, uint8_t>) return _mm256_cvtepu8_epi16(a);
+            else if constexpr (std::is_same_v<_T, int16_t>) return _mm256_cvtepi16_epi32(a);
+            else                                            return _mm256_cvtepu16_epi32(a);
+        }
+#endif // #if defined(__AVX2__)
+
+        /* Narrows the signed lanes of "a" then "b" to lanes half as wide ("_TO"), with saturation. The */
+        /* AVX2 versions work on each 128 bit half, so the 64 bit blocks are put back in order after.  */
+        template <::IE::packable _TO, ::IE::packable _T, typename _R>
+        static inline _R PackedNarrow(const _R& a, const _R& b) noexcept
+        {
+            if constexpr (::IE::Internal::IS_AVX2_PACKED_REGISTER<_R>) {
+                _R packed;
+
+                if constexpr (std::is_same_v<_TO, int8_t>)       packed = _mm256_packs_epi16(a, b);
+                else if constexpr (std::is_same_v<_TO, uint8_t>) packed = _mm256_packus_epi16(a, b);
+                else if constexpr (std::is_same_v<_TO, int16_t>) packed = _mm256_packs_epi32(a, b);
+                else                                             packed = _mm256_packus_epi32(a, b);
+
+                return _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0));
+            } else if constexpr (std::is_same_v<_TO, int8_t>) {
+                return _mm_packs_epi16(a, b);
+            } else if constexpr (std::is_same_v<_TO, uint8_t>) {
+                return _mm_packus_epi16(a, b);
+            } else if constexpr (std::is_same_v<_TO, int16_t>) {
+                return _mm_packs_epi32(a, b);
+            } else {
+#if defined(__SSE4_1__) || defined(__AVX__)
+                return _mm_packus_epi32(a, b);
+#else // end of #if defined(__SSE4_1__) || defined(__AVX__)
+                // SSE2 has no unsigned 32 to 16 bit pack : clamp to [0, 65535], shift to the signed range & flip the sign bits back
+                const auto clampAndBias = [](const __m128i& x) noexcept {
+                    const __m128i maximum = _mm_set1_epi32(65535);
+                    const __m128i clamped = _mm_andnot_si128(_mm_srai_epi32(x, 31), ::IE::Internal::PackedSelect(_mm_cmpgt_epi32(x, maximum), maximum, x));
+
+                    return _mm_sub_epi32(clamped, _mm_set1_epi32(32768));
+                };
+
+                return _mm_xor_si128(_mm_packs_epi32(clampAndBias(a), clampAndBias(b)), _mm_set1_epi16(static_cast<short>(0x8000)));
+#endif // end of #else
+            }
+        }
+
+#endif // #ifdef __IE__ENABLE_SIMD
+
+        // Saturates "value" to the range of "_T"
+        template <::IE::packable _T>
+        static inline constexpr _T SaturatePackedLane(const std::int64_t value) noexcept
+        {
+            return static_cast<_T>(std::clamp<std::int64_t>(value, std::numeric_limits<_T>::min(), std::numeric_limits<_T>::max()));
+        }
+
+    } // Internal
+
+    /* The templated "Packed" class holds "_N" integers filling a whole SSE (16 bytes) or AVX2 (32 bytes) register,    */
+    /* unlike "Vector" which always has 4 components. The 8 & 16 bit lanes get the saturating arithmetic, averages & */
+    /* high multiplies image pipelines need, so that one instruction processes 16 or 32 color channels at once.      */
+    /* Like "Vector", the instruction sets are the compilation target's : 32 bytes are a pair of SSE registers       */
+    /* without AVX2, and plain loops over the lanes when SIMD is disabled. The lanes wrap around on overflow.        */
+
+    template <::IE::packable _T, size_t _N>
+        requires (_N * sizeof(_T) == 16u || _N * sizeof(_T) == 32u)
+    class Packed {
+    public:
+        static constexpr const size_t LANE_COUNT = _N;
+
+#ifdef __IE__ENABLE_SIMD
+        using Register = ::IE::Internal::PackedRegister<_N * sizeof(_T)>;
+
+        static constexpr const size_t REGISTER_COUNT = _N * sizeof(_T) / sizeof(Register);
+#endif // #ifdef __IE__ENABLE_SIMD
+
+        union {
+            _T m_lanes[_N];
+
+#ifdef __IE__ENABLE_SIMD
+            Register m_registers[REGISTER_COUNT];
+#endif // #ifdef __IE__ENABLE_SIMD
+        };
+
+        // +--------------+     +-----------------+     +--------------+
+        // | Math Library | --> | Packed Integers | --> | Constructors |
+        // +--------------+     +-----------------+     +--------------+
+
+        Packed() noexcept
+            : Packed(_T(0))
+        {  }
+
+        // Copies "value" to every lane
+        explicit Packed(const _T value) noexcept
+        {
+#ifdef __IE__ENABLE_SIMD
+            for (size_t r = 0u; r < REGISTER_COUNT; r++)
+                this->m_registers[r] = ::IE::Internal::PackedSet1<_T, Register>(value);
+#else // end of #ifdef __IE__ENABLE_SIMD
+            std::fill_n(this->m_lanes, _N, value);
+#endif // end of #else
+        }
+
+        // +--------------+     +-----------------+     +----------------+
+        // | Math Library | --> | Packed Integers | --> | Loads & Stores |
+        // +--------------+     +-----------------+     +----------------+
+
+        // "pLanes" needs no particular alignment
+        static inline ::IE::Packed<_T, _N> Load(const _T* pLanes) noexcept
+        {
+            ::IE::Packed<_T, _N> result;
+
+#ifdef __IE__ENABLE_SIMD
+            for (size_t r = 0u; r < REGISTER_COUNT; r++)
+                result.m_registers[r] = ::IE::Internal::PackedLoad<Register>(pLanes + r * (sizeof(Register) / sizeof(_T)));
+#else // end of #ifdef __IE__ENABLE_SIMD
+            std::memcpy(result.m_lanes, pLanes, sizeof(result.m_lanes));
+#endif // end of #else
+
+            return result;
+        }
+
+        inline void Store(_T* pLanes) const noexcept
+        {
+#ifdef __IE__ENABLE_SIMD
+            for (size_t r = 0u; r < REGISTER_COUNT; r++)
+                ::IE::Internal::PackedStore(pLanes + r * (sizeof(Register) / sizeof(_T)), this->m_registers[r]);
+#else // end of #ifdef __IE__ENABLE_SIMD
+            std::memcpy(pLanes, this->m_lanes, sizeof(this->m_lanes));
+#endif // end of #else
+        }
+
+        inline _T operator[](const size_t i) const noexcept { return this->m_lanes[i]; }
+
+        // +--------------+     +-----------------+     +-----------+
+        // | Math Library | --> | Packed Integers | --> | Operators |
+        // +--------------+     +-----------------+     +-----------+
+
+        inline void operator+=(const ::IE::Packed<_T, _N>& other) noexcept { *this = *this + other; }
+        inline void operator-=(const ::IE::Packed<_T, _N>& other) noexcept { *this = *this - other; }
+        inline void operator&=(const ::IE::Packed<_T, _N>& other) noexcept { *this = *this & other; }
+        inline void operator|=(const ::IE::Packed<_T, _N>& other) noexcept { *this = *this | other; }
+        inline void operator^=(const ::IE::Packed<_T, _N>& other) noexcept { *this = *this ^ other; }
+
+        inline void operator*=(const ::IE::Packed<_T, _N>& other) noexcept requires (sizeof(_T) > 1u) { *this = *this * other; }
+
+        inline void operator<<=(const int count) noexcept requires (sizeof(_T) > 1u) { *this = *this << count; }
+        inline void operator>>=(const int count) noexcept requires (sizeof(_T) > 1u) { *this = *this >> count; }
+    };
+
+    namespace Internal {
+
+        // "function(a, b)" on every register of "a" & "b"
+        template <::IE::packable _T, size_t _N, typename _F>
+        inline ::IE::Packed<_T, _N> MapPacked(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b, const _F& function) noexcept
+        {
+            ::IE::Packed<_T, _N> result;
+
+#ifdef __IE__ENABLE_SIMD
+            for (size_t r = 0u; r < ::IE::Packed<_T, _N>::REGISTER_COUNT; r++)
+                result.m_registers[r] = function(a.m_registers[r], b.m_registers[r]);
+#else // end of #ifdef __IE__ENABLE_SIMD
+            for (size_t i = 0u; i < _N; i++)
+                result.m_lanes[i] = function(a.m_lanes[i], b.m_lanes[i]);
+#endif // end of #else
+
+            return result;
+        }
+
+        // A lane of all ones where "bCondition" is true
+        template <::IE::packable _T>
+        static inline constexpr _T MakePackedMask(const bool bCondition) noexcept
+        {
+            return bCondition ? static_cast<_T>(~_T(0)) : _T(0);
+        }
+
+    } // Internal
+
+    // +--------------+     +-----------------+     +------------+
+    // | Math Library | --> | Packed Integers | --> | Operations |
+    // +--------------+     +-----------------+     +------------+
+
+    /* Each operation has a SIMD version working on the registers & a scalar one working on the lanes, with */
+    /* 64 bit intermediates so that the lanes wrap around the same way the registers do.                   */
+
+    template <::IE::packable _T, size_t _N>
+    inline ::IE::Packed<_T, _N> operator+(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+#ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const auto& x, const auto& y) noexcept { return ::IE::Internal::PackedAdd<_T>(x, y); });
+#else // end of #ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const _T x, const _T y) noexcept { return static_cast<_T>(std::int64_t(x) + y); });
+#endif // end of #else
+    }
+
+    template <::IE::packable _T, size_t _N>
+    inline ::IE::Packed<_T, _N> operator-(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+#ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const auto& x, const auto& y) noexcept { return ::IE::Internal::PackedSub<_T>(x, y); });
+#else // end of #ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const _T x, const _T y) noexcept { return static_cast<_T>(std::int64_t(x) - y); });
+#endif // end of #else
+    }
+
+    // Low half of the products
+    template <::IE::packable _T, size_t _N> requires (sizeof(_T) > 1u)
+    inline ::IE::Packed<_T, _N> operator*(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+#ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const auto& x, const auto& y) noexcept { return ::IE::Internal::PackedMulLow<_T>(x, y); });
+#else // end of #ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const _T x, const _T y) noexcept { return static_cast<_T>(std::int64_t(x) * y); });
+#endif // end of #else
+    }
+
+    template <::IE::packable _T, size_t _N>
+    inline ::IE::Packed<_T, _N> operator&(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+#ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const auto& x, const auto& y) noexcept { return ::IE::Internal::PackedAnd(x, y); });
+#else // end of #ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const _T x, const _T y) noexcept { return static_cast<_T>(x & y); });
+#endif // end of #else
+    }
+
+    template <::IE::packable _T, size_t _N>
+    inline ::IE::Packed<_T, _N> operator|(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+#ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const auto& x, const auto& y) noexcept { return ::IE::Internal::PackedOr(x, y); });
+#else // end of #ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const _T x, const _T y) noexcept { return static_cast<_T>(x | y); });
+#endif // end of #else
+    }
+
+    template <::IE::packable _T, size_t _N>
+    inline ::IE::Packed<_T, _N> operator^(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+#ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const auto& x, const auto& y) noexcept { return ::IE::Internal::PackedXor(x, y); });
+#else // end of #ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const _T x, const _T y) noexcept { return static_cast<_T>(x ^ y); });
+#endif // end of #else
+    }
+
+    // "a + b" clamped to the range of the lanes instead of wrapping around
+    template <::IE::packable _T, size_t _N> requires (sizeof(_T) <= 2u)
+    inline ::IE::Packed<_T, _N> AddSaturate(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+#ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const auto& x, const auto& y) noexcept { return ::IE::Internal::PackedAddSaturate<_T>(x, y); });
+#else // end of #ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const _T x, const _T y) noexcept { return static_cast<_T>(::IE::Internal::SaturatePackedLane<_T>(std::int64_t(x) + y)); });
+#endif // end of #else
+    }
+
+    // "a - b" clamped to the range of the lanes instead of wrapping around
+    template <::IE::packable _T, size_t _N> requires (sizeof(_T) <= 2u)
+    inline ::IE::Packed<_T, _N> SubSaturate(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+#ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const auto& x, const auto& y) noexcept { return ::IE::Internal::PackedSubSaturate<_T>(x, y); });
+#else // end of #ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const _T x, const _T y) noexcept { return static_cast<_T>(::IE::Internal::SaturatePackedLane<_T>(std::int64_t(x) - y)); });
+#endif // end of #else
+    }
+
+    // "(a * b) >> 16", e.g. a 8 bit channel widened to "x << 8" times a 16 bit fixed point factor
+    template <::IE::packable _T, size_t _N> requires (sizeof(_T) == 2u)
+    inline ::IE::Packed<_T, _N> MulHigh(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+#ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const auto& x, const auto& y) noexcept { return ::IE::Internal::PackedMulHigh<_T>(x, y); });
+#else // end of #ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const _T x, const _T y) noexcept { return static_cast<_T>((std::int64_t(x) * y) >> 16); });
+#endif // end of #else
+    }
+
+    // "(a + b + 1) >> 1" without overflowing
+    template <::IE::packable _T, size_t _N> requires (std::is_unsigned_v<_T>)
+    inline ::IE::Packed<_T, _N> Average(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+#ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const auto& x, const auto& y) noexcept { return ::IE::Internal::PackedAverage<_T>(x, y); });
+#else // end of #ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const _T x, const _T y) noexcept { return static_cast<_T>((std::int64_t(x) + y + 1) >> 1); });
+#endif // end of #else
+    }
+
+    template <::IE::packable _T, size_t _N>
+    inline ::IE::Packed<_T, _N> Min(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+#ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const auto& x, const auto& y) noexcept { return ::IE::Internal::PackedMin<_T>(x, y); });
+#else // end of #ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const _T x, const _T y) noexcept { return static_cast<_T>(std::min(x, y)); });
+#endif // end of #else
+    }
+
+    template <::IE::packable _T, size_t _N>
+    inline ::IE::Packed<_T, _N> Max(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+#ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const auto& x, const auto& y) noexcept { return ::IE::Internal::PackedMax<_T>(x, y); });
+#else // end of #ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const _T x, const _T y) noexcept { return static_cast<_T>(std::max(x, y)); });
+#endif // end of #else
+    }
+
+    // All the bits of a lane are set where "a == b", none elsewhere
+    template <::IE::packable _T, size_t _N>
+    inline ::IE::Packed<_T, _N> Equal(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+#ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const auto& x, const auto& y) noexcept { return ::IE::Internal::PackedEqual<_T>(x, y); });
+#else // end of #ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const _T x, const _T y) noexcept { return static_cast<_T>(::IE::Internal::MakePackedMask<_T>(x == y)); });
+#endif // end of #else
+    }
+
+    // All the bits of a lane are set where "a > b", none elsewhere
+    template <::IE::packable _T, size_t _N>
+    inline ::IE::Packed<_T, _N> Greater(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+#ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const auto& x, const auto& y) noexcept { return ::IE::Internal::PackedGreater<_T>(x, y); });
+#else // end of #ifdef __IE__ENABLE_SIMD
+        return ::IE::Internal::MapPacked(a, b, [](const _T x, const _T y) noexcept { return static_cast<_T>(::IE::Internal::MakePackedMask<_T>(x > y)); });
+#endif // end of #else
+    }
+
+    // Lanes of "a" where the lanes of "mask" (from "Equal" or "Greater") are set, of "b" elsewhere
+    template <::IE::packable _T, size_t _N>
+    inline ::IE::Packed<_T, _N> Select(const ::IE::Packed<_T, _N>& mask, const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+        ::IE::Packed<_T, _N> result;
+
+#ifdef __IE__ENABLE_SIMD
+        for (size_t r = 0u; r < ::IE::Packed<_T, _N>::REGISTER_COUNT; r++)
+            result.m_registers[r] = ::IE::Internal::PackedSelect(mask.m_registers[r], a.m_registers[r], b.m_registers[r]);
+#else // end of #ifdef __IE__ENABLE_SIMD
+        for (size_t i = 0u; i < _N; i++)
+            result.m_lanes[i] = static_cast<_T>((mask.m_lanes[i] & a.m_lanes[i]) | (~mask.m_lanes[i] & b.m_lanes[i]));
+#endif // end of #else
+
+        return result;
+    }
+
+    // Shifts every lane left by "count" bits, lanes shifted by their width or more become 0
+    template <::IE::packable _T, size_t _N> requires (sizeof(_T) > 1u)
+    inline ::IE::Packed<_T, _N> operator<<(const ::IE::Packed<_T, _N>& a, const int count) noexcept
+    {
+        ::IE::Packed<_T, _N> result;
+
+#ifdef __IE__ENABLE_SIMD
+        for (size_t r = 0u; r < ::IE::Packed<_T, _N>::REGISTER_COUNT; r++)
+            result.m_registers[r] = ::IE::Internal::PackedShiftLeft<_T>(a.m_registers[r], count);
+#else // end of #ifdef __IE__ENABLE_SIMD
+        for (size_t i = 0u; i < _N; i++)
+            result.m_lanes[i] = (count < static_cast<int>(sizeof(_T) * 8u)) ? static_cast<_T>(std::int64_t(a.m_lanes[i]) << count) : _T(0);
+#endif // end of #else
+
+        return result;
+    }
+
+    // Arithmetic shift of the signed lanes & logical shift of the unsigned ones
+    template <::IE::packable _T, size_t _N> requires (sizeof(_T) > 1u)
+    inline ::IE::Packed<_T, _N> operator>>(const ::IE::Packed<_T, _N>& a, const int count) noexcept
+    {
+        ::IE::Packed<_T, _N> result;
+
+#ifdef __IE__ENABLE_SIMD
+        for (size_t r = 0u; r < ::IE::Packed<_T, _N>::REGISTER_COUNT; r++)
+            result.m_registers[r] = ::IE::Internal::PackedShiftRight<_T>(a.m_registers[r], count);
+#else // end of #ifdef __IE__ENABLE_SIMD
+        for (size_t i = 0u; i < _N; i++)
+            result.m_lanes[i] = static_cast<_T>(std::int64_t(a.m_lanes[i]) >> std::min<int>(count, sizeof(_T) * 8u - (std::is_signed_v<_T> ? 1u : 0u)));
+#endif // end of #else
+
+        return result;
+    }
+
+    template <::IE::packable _T, size_t _N>
+    inline bool operator==(const ::IE::Packed<_T, _N>& a, const ::IE::Packed<_T, _N>& b) noexcept
+    {
+        return std::memcmp(a.m_lanes, b.m_lanes, sizeof(a.m_lanes)) == 0;
+    }
+
+    // +--------------+     +-----------------+     +---------------+
+    // | Math Library | --> | Packed Integers | --> | Pack & Unpack |
+    // +--------------+     +-----------------+     +---------------+
+
+    /* Widens the lower ("UnpackLow") or upper ("UnpackHigh") half of the lanes of "a" to "_TO" lanes twice as wide, */
+    /* sign extending signed lanes & zero extending unsigned ones. The result has the same size as "a".             */
+
+    template <::IE::packable _TO, ::IE::packable _T, size_t _N> requires (sizeof(_TO) == 2u * sizeof(_T))
+    inline ::IE::Packed<_TO, _N / 2u> UnpackLow(const ::IE::Packed<_T, _N>& a) noexcept
+    {
+        ::IE::Packed<_TO, _N / 2u> result;
+
+#ifdef __IE__ENABLE_SIMD
+        if constexpr (sizeof(typename ::IE::Packed<_T, _N>::Register) == 32u) {
+#if defined(__AVX2__)
+            result.m_registers[0u] = ::IE::Internal::PackedWidenAVX2<_T>(_mm256_castsi256_si128(a.m_registers[0u]));
+#endif // #if defined(__AVX2__)
+        } else if constexpr (::IE::Packed<_T, _N>::REGISTER_COUNT == 1u) {
+            result.m_registers[0u] = ::IE::Internal::PackedWidenSSE<_T, false>(a.m_registers[0u]);
+        } else {
+            result.m_registers[0u] = ::IE::Internal::PackedWidenSSE<_T, false>(a.m_registers[0u]);
+            result.m_registers[1u] = ::IE::Internal::PackedWidenSSE<_T, true>(a.m_registers[0u]);
+        }
+#else // end of #ifdef __IE__ENABLE_SIMD
+        for (size_t i = 0u; i < _N / 2u; i++)
+            result.m_lanes[i] = static_cast<_TO>(a.m_lanes[i]);
+#endif // end of #else
+
+        return result;
+    }
+
+    template <::IE::packable _TO, ::IE::packable _T, size_t _N> requires (sizeof(_TO) == 2u * sizeof(_T))
+    inline ::IE::Packed<_TO, _N / 2u> UnpackHigh(const ::IE::Packed<_T, _N>& a) noexcept
+    {
+        ::IE::Packed<_TO, _N / 2u> result;
+
+#ifdef __IE__ENABLE_SIMD
+        if constexpr (sizeof(typename ::IE::Packed<_T, _N>::Register) == 32u) {
+#if defined(__AVX2__)
+            result.m_registers[0u] = ::IE::Internal::PackedWidenAVX2<_T>(_mm256_extracti128_si256(a.m_registers[0u], 1));
+#endif // #if defined(__AVX2__)
+        } else if constexpr (::IE::Packed<_T, _N>::REGISTER_COUNT == 1u) {
+            result.m_registers[0u] = ::IE::Internal::PackedWidenSSE<_T, true>(a.m_registers[0u]);
+        } else {
+            result.m_registers[0u] = ::IE::Internal::PackedWidenSSE<_T, false>(a.m_registers[1u]);
+            result.m_registers[1u] = ::IE::Internal::PackedWidenSSE<_T, true>(a.m_registers[1u]);
+        }
+#else // end of #ifdef __IE__ENABLE_SIMD
+        for (size_t i = 0u; i < _N / 2u; i++)
+            result.m_lanes[i] = static_cast<_TO>(a.m_lanes[_N / 2u + i]);
+#endif // end of #else
+
+        return result;
+    }
+
+    /* Narrows the signed lanes of "low" then "high" to "_TO" lanes half as wide, clamping them to the range of "_TO" */
+    /* (e.g. 16 bit intermediates of a color computation back to 8 bit channels). Undoes "UnpackLow/UnpackHigh".     */
+    template <::IE::packable _TO, ::IE::packable _T, size_t _N> requires (sizeof(_T) == 2u * sizeof(_TO) && std::is_signed_v<_T>)
+    inline ::IE::Packed<_TO, 2u * _N> PackSaturate(const ::IE::Packed<_T, _N>& low, const ::IE::Packed<_T, _N>& high) noexcept
+    {
+        ::IE::Packed<_TO, 2u * _N> result;
+
+#ifdef __IE__ENABLE_SIMD
+        if constexpr (::IE::Packed<_T, _N>::REGISTER_COUNT == 1u) {
+            result.m_registers[0u] = ::IE::Internal::PackedNarrow<_TO, _T>(low.m_registers[0u], high.m_registers[0u]);
+        } else {
+            result.m_registers[0u] = ::IE::Internal::PackedNarrow<_TO, _T>(low.m_registers[0u],  low.m_registers[1u]);
+            result.m_registers[1u] = ::IE::Internal::PackedNarrow<_TO, _T>(high.m_registers[0u], high.m_registers[1u]);
+        }
+#else // end of #ifdef __IE__ENABLE_SIMD
+        for (size_t i = 0u; i < _N; i++) {
+            result.m_lanes[i]      = ::IE::Internal::SaturatePackedLane<_TO>(low.m_lanes[i]);
+            result.m_lanes[_N + i] = ::IE::Internal::SaturatePackedLane<_TO>(high.m_lanes[i]);
+        }
+#endif // end of #else
+
+        return result;
+    }
+
+    // +--------------+     +-----------------+     +------------------------+
+    // | Math Library | --> | Packed Integers | --> | Useful packed Typedefs |
+    // +--------------+     +-----------------+     +------------------------+
+
+    typedef ::IE::Packed<int8_t,  16> Packedi8x16;
+    typedef ::IE::Packed<int8_t,  32> Packedi8x32;
+    typedef ::IE::Packed<uint8_t, 16> Packedu8x16;
+    typedef ::IE::Packed<uint8_t, 32> Packedu8x32;
+
+    typedef ::IE::Packed<int16_t,  8>  Packedi16x8;
+    typedef ::IE::Packed<int16_t,  16> Packedi16x16;
+    typedef ::IE::Packed<uint16_t, 8>  Packedu16x8;
+    typedef ::IE::Packed<uint16_t, 16> Packedu16x16;
+
+    typedef ::IE::Packed<int32_t, 4> Packedi32x4;
+    typedef ::IE::Packed<int32_t, 8> Packedi32x8;
+
+    // +--------------+     +--------------------+
+    // | Math Library | --> | Vector Array (SoA) |
+    // +--------------+     +--------------------+
+
+    /* The float kernels below work on "structure of arrays" streams: every component is stored in  */
+    /* its own array so that a register holds the same component of 4 (SSE), 8 (AVX2) or 16 vectors */
+    /* (AVX-512) instead of the 4 components of a single vector. The AVX-512 kernels handle the      */
+    /* remaining elements with masked loads & stores, the others finish with the scalar kernels.     */
+
+    namespace Internal {
+
+        template <typename _T>
+        inline ::IE::Internal::SoAStream<_T> OffsetSoAStream(const ::IE::Internal::SoAStream<_T>& stream, const size_t offset) noexcept
+        {
+            return { stream.m_pX + offset, stream.m_pY + offset, stream.m_pZ + offset, stream.m_pW + offset };
+        }
+
+        // +--------------+     +--------------------+     +----------------+
+        // | Math Library | --> | Vector Array (SoA) | --> | Scalar Kernels |
+        // +--------------+     +--------------------+     +----------------+
+
+        template <::IE::Internal::SoAOperation _OP>
+        inline void SoAElementwiseF32Scalar(const float* a, const float* b, float* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++) {
+                if constexpr (_OP == ::IE::Internal::SoAOperation::ADD)      out[i] = a[i] + b[i];
+                else if constexpr (_OP == ::IE::Internal::SoAOperation::SUB) out[i] = a[i] - b[i];
+                else if constexpr (_OP == ::IE::Internal::SoAOperation::MUL) out[i] = a[i] * b[i];
+                else if constexpr (_OP == ::IE::Internal::SoAOperation::DIV) out[i] = a[i] / b[i];
+            }
+        }
+
+        inline void SoADotProductF32Scalar(const ::IE::Internal::SoAStream<const float>& a, const ::IE::Internal::SoAStream<const float>& b, float* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++)
+                out[i] = a.m_pX[i] * b.m_pX[i] + a.m_pY[i] * b.m_pY[i] + a.m_pZ[i] * b.m_pZ[i] + a.m_pW[i] * b.m_pW[i];
+        }
+
+        inline void SoALengthF32Scalar(const ::IE::Internal::SoAStream<const float>& a, float* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++)
+                out[i] = std::sqrt(a.m_pX[i] * a.m_pX[i] + a.m_pY[i] * a.m_pY[i] + a.m_pZ[i] * a.m_pZ[i] + a.m_pW[i] * a.m_pW[i]);
+        }
+
+        inline void SoANormalizeF32Scalar(const ::IE::Internal::SoAStream<const float>& a, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++) {
+                const float length = std::sqrt(a.m_pX[i] * a.m_pX[i] + a.m_pY[i] * a.m_pY[i] + a.m_pZ[i] * a.m_pZ[i] + a.m_pW[i] * a.m_pW[i]);
+
+                out.m_pX[i] = a.m_pX[i] / length; out.m_pY[i] = a.m_pY[i] / length;
+                out.m_pZ[i] = a.m_pZ[i] / length; out.m_pW[i] = a.m_pW[i] / length;
+            }
+        }
+
+        inline void SoACrossProduct3DF32Scalar(const ::IE::Internal::SoAStream<const float>& a, const ::IE::Internal::SoAStream<const float>& b, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++) {
+                const float x = a.m_pY[i] * b.m_pZ[i] - a.m_pZ[i] * b.m_pY[i];
+                const float y = a.m_pZ[i] * b.m_pX[i] - a.m_pX[i] * b.m_pZ[i];
+                const float z = a.m_pX[i] * b.m_pY[i] - a.m_pY[i] * b.m_pX[i];
+
+                out.m_pX[i] = x; out.m_pY[i] = y; out.m_pZ[i] = z; out.m_pW[i] = 0.f;
+            }
+        }
+
+        inline void SoAReflectF32Scalar(const ::IE::Internal::SoAStream<const float>& in, const ::IE::Internal::SoAStream<const float>& normal, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++) {
+                const float twoDot = 2.f * (in.m_pX[i] * normal.m_pX[i] + in.m_pY[i] * normal.m_pY[i] + in.m_pZ[i] * normal.m_pZ[i] + in.m_pW[i] * normal.m_pW[i]);
+
+                out.m_pX[i] = in.m_pX[i] - normal.m_pX[i] * twoDot; out.m_pY[i] = in.m_pY[i] - normal.m_pY[i] * twoDot;
+                out.m_pZ[i] = in.m_pZ[i] - normal.m_pZ[i] * twoDot; out.m_pW[i] = in.m_pW[i] - normal.m_pW[i] * twoDot;
+            }
+        }
+
+        inline void AoSToSoAF32Scalar(const float* aos, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++) {
+                out.m_pX[i] = aos[i * 4u + 0u]; out.m_pY[i] = aos[i * 4u + 1u];
+                out.m_pZ[i] = aos[i * 4u + 2u]; out.m_pW[i] = aos[i * 4u + 3u];
+            }
+        }
+
+        inline void SoAToAoSF32Scalar(const ::IE::Internal::SoAStream<const float>& in, float* aos, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++) {
+                aos[i * 4u + 0u] = in.m_pX[i]; aos[i * 4u + 1u] = in.m_pY[i];
+                aos[i * 4u + 2u] = in.m_pZ[i]; aos[i * 4u + 3u] = in.m_pW[i];
+            }
+        }
+
+#ifdef __IE__ENABLE_SIMD
+
+        // +--------------+     +--------------------+     +----------------+
+        // | Math Library | --> | Vector Array (SoA) | --> | SSE4.1 Kernels |
+        // +--------------+     +--------------------+     +----------------+
+
+        template <::IE::Internal::SoAOperation _OP>
+        __IE__TARGET_SSE41 inline void SoAElementwiseF32SSE41(const float* a, const float* b, float* out, const size_t count) noexcept
+        {
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u) {
+                const __m128 va = _mm_loadu_ps(a + i), vb = _mm_loadu_ps(b + i);
+
+                if constexpr (_OP == ::IE::Internal::SoAOperation::ADD)      _mm_storeu_ps(out + i, _mm_add_ps(va, vb));
+                else if constexpr (_OP == ::IE::Internal::SoAOperation::SUB) _mm_storeu_ps(out + i, _mm_sub_ps(va, vb));
+                else if constexpr (_OP == ::IE::Internal::SoAOperation::MUL) _mm_storeu_ps(out + i, _mm_mul_ps(va, vb));
+                else if constexpr (_OP == ::IE::Internal::SoAOperation::DIV) _mm_storeu_ps(out + i, _mm_div_ps(va, vb));
+            }
+
+            ::IE::Internal::SoAElementwiseF32Scalar<_OP>(a + i, b + i, out + i, count - i);
+        }
+
+        __IE__TARGET_SSE41 inline __m128 SoADotProductF32SSE41(const ::IE::Internal::SoAStream<const float>& a, const ::IE::Internal::SoAStream<const float>& b, const size_t i) noexcept
+        {
+            __m128 dot = _mm_mul_ps(_mm_loadu_ps(a.m_pX + i), _mm_loadu_ps(b.m_pX + i));
+            dot = _mm_add_ps(dot, _mm_mul_ps(_mm_loadu_ps(a.m_pY + i), _mm_loadu_ps(b.m_pY + i)));
+            dot = _mm_add_ps(dot, _mm_mul_ps(_mm_loadu_ps(a.m_pZ + i), _mm_loadu_ps(b.m_pZ + i)));
+
+            return _mm_add_ps(dot, _mm_mul_ps(_mm_loadu_ps(a.m_pW + i), _mm_loadu_ps(b.m_pW + i)));
+        }
+
+        __IE__TARGET_SSE41 inline void SoADotProductF32SSE41(const ::IE::Internal::SoAStream<const float>& a, const ::IE::Internal::SoAStream<const float>& b, float* out, const size_t count) noexcept
+        {
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u)
+                _mm_storeu_ps(out + i, ::IE::Internal::SoADotProductF32SSE41(a, b, i));
+
+            ::IE::Internal::SoADotProductF32Scalar(::IE::Internal::OffsetSoAStream(a, i), ::IE::Internal::OffsetSoAStream(b, i), out + i, count - i);
+        }
+
+        __IE__TARGET_SSE41 inline void SoALengthF32SSE41(const ::IE::Internal::SoAStream<const float>& a, float* out, const size_t count) noexcept
+        {
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u)
+                _mm_storeu_ps(out + i, _mm_sqrt_ps(::IE::Internal::SoADotProductF32SSE41(a, a, i)));
+
+            ::IE::Internal::SoALengthF32Scalar(::IE::Internal::OffsetSoAStream(a, i), out + i, count - i);
+        }
+
+        __IE__TARGET_SSE41 inline void SoANormalizeF32SSE41(const ::IE::Internal::SoAStream<const float>& a, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u) {
+                const __m128 length = _mm_sqrt_ps(::IE::Internal::SoADotProductF32SSE41(a, a, i));
+
+                _mm_storeu_ps(out.m_pX + i, _mm_div_ps(_mm_loadu_ps(a.m_pX + i), length));
+                _mm_storeu_ps(out.m_pY + i, _mm_div_ps(_mm_loadu_ps(a.m_pY + i), length));
+                _mm_storeu_ps(out.m_pZ + i, _mm_div_ps(_mm_loadu_ps(a.m_pZ + i), length));
+                _mm_storeu_ps(out.m_pW + i, _mm_div_ps(_mm_loadu_ps(a.m_pW + i), length));
+            }
+
+            ::IE::Internal::SoANormalizeF32Scalar(::IE::Internal::OffsetSoAStream(a, i), ::IE::Internal::OffsetSoAStream(out, i), count - i);
+        }
+
+        __IE__TARGET_SSE41 inline void SoACrossProduct3DF32SSE41(const ::IE::Internal::SoAStream<const float>& a, const ::IE::Internal::SoAStream<const float>& b, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u) {
+                const __m128 ax = _mm_loadu_ps(a.m_pX + i), ay = _mm_loadu_ps(a.m_pY + i), az = _mm_loadu_ps(a.m_pZ + i);
+                const __m128 bx = _mm_loadu_ps(b.m_pX + i), by = _mm_loadu_ps(b.m_pY + i), bz = _mm_loadu_ps(b.m_pZ + i);
+
+                _mm_storeu_ps(out.m_pX + i, _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by)));
+                _mm_storeu_ps(out.m_pY + i, _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz)));
+                _mm_storeu_ps(out.m_pZ + i, _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx)));
+                _mm_storeu_ps(out.m_pW + i, _mm_setzero_ps());
+            }
+
+            ::IE::Internal::SoACrossProduct3DF32Scalar(::IE::Internal::OffsetSoAStream(a, i), ::IE::Internal::OffsetSoAStream(b, i), ::IE::Internal::OffsetSoAStream(out, i), count - i);
+        }
+
+        __IE__TARGET_SSE41 inline void SoAReflectF32SSE41(const ::IE::Internal::SoAStream<const float>& in, const ::IE::Internal::SoAStream<const float>& normal, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u) {
+                const __m128 dot    = ::IE::Internal::SoADotProductF32SSE41(in, normal, i);
+                const __m128 twoDot = _mm_add_ps(dot, dot);
+
+                _mm_storeu_ps(out.m_pX + i, _mm_sub_ps(_mm_loadu_ps(in.m_pX + i), _mm_mul_ps(_mm_loadu_ps(normal.m_pX + i), twoDot)));
+                _mm_storeu_ps(out.m_pY + i, _mm_sub_ps(_mm_loadu_ps(in.m_pY + i), _mm_mul_ps(_mm_loadu_ps(normal.m_pY + i), twoDot)));
+                _mm_storeu_ps(out.m_pZ + i, _mm_sub_ps(_mm_loadu_ps(in.m_pZ + i), _mm_mul_ps(_mm_loadu_ps(normal.m_pZ + i), twoDot)));
+                _mm_storeu_ps(out.m_pW + i, _mm_sub_ps(_mm_loadu_ps(in.m_pW + i), _mm_mul_ps(_mm_loadu_ps(normal.m_pW + i), twoDot)));
+            }
+
+            ::IE::Internal::SoAReflectF32Scalar(::IE::Internal::OffsetSoAStream(in, i), ::IE::Internal::OffsetSoAStream(normal, i), ::IE::Internal::OffsetSoAStream(out, i), count - i);
+        }
+
+        __IE__TARGET_SSE41 inline void AoSToSoAF32SSE41(const float* aos, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u) {
+                __m128 r0 = _mm_loadu_ps(aos + i * 4u + 0u),  r1 = _mm_loadu_ps(aos + i * 4u + 4u);
+                __m128 r2 = _mm_loadu_ps(aos + i * 4u + 8u),  r3 = _mm_loadu_ps(aos + i * 4u + 12u);
+
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+                _mm_storeu_ps(out.m_pX + i, r0); _mm_storeu_ps(out.m_pY + i, r1);
+                _mm_storeu_ps(out.m_pZ + i, r2); _mm_storeu_ps(out.m_pW + i, r3);
+            }
+
+            ::IE::Internal::AoSToSoAF32Scalar(aos + i * 4u, ::IE::Internal::OffsetSoAStream(out, i), count - i);
+        }
+
+        __IE__TARGET_SSE41 inline void SoAToAoSF32SSE41(const ::IE::Internal::SoAStream<const float>& in, float* aos, const size_t count) noexcept
+        {
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u) {
+                __m128 r0 = _mm_loadu_ps(in.m_pX + i), r1 = _mm_loadu_ps(in.m_pY + i);
+                __m128 r2 = _mm_loadu_ps(in.m_pZ + i), r3 = _mm_loadu_ps(in.m_pW + i);
+
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+                _mm_storeu_ps(aos + i * 4u + 0u, r0); _mm_storeu_ps(aos + i * 4u + 4u,  r1);
+                _mm_storeu_ps(aos + i * 4u + 8u, r2); _mm_storeu_ps(aos + i * 4u + 12u, r3);
+            }
+
+            ::IE::Internal::SoAToAoSF32Scalar(::IE::Internal::OffsetSoAStream(in, i), aos + i * 4u, count - i);
+        }
+
+        // +--------------+     +--------------------+     +--------------+
+        // | Math Library | --> | Vector Array (SoA) | --> | AVX2 Kernels |
+        // +--------------+     +--------------------+     +--------------+
+
+        template <::IE::Internal::SoAOperation _OP>
+        __IE__TARGET_AVX2 inline void SoAElementwiseF32AVX2(const float* a, const float* b, float* out, const size_t count) noexcept
+        {
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m256 va = _mm256_loadu_ps(a + i), vb = _mm256_loadu_ps(b + i);
+
+                if constexpr (_OP == ::IE::Internal::SoAOperation::ADD)      _mm256_storeu_ps(out + i, _mm256_add_ps(va, vb));
+                else if constexpr (_OP == ::IE::Internal::SoAOperation::SUB) _mm256_storeu_ps(out + i, _mm256_sub_ps(va, vb));
+                else if constexpr (_OP == ::IE::Internal::SoAOperation::MUL) _mm256_storeu_ps(out + i, _mm256_mul_ps(va, vb));
+                else if constexpr (_OP == ::IE::Internal::SoAOperation::DIV) _mm256_storeu_ps(out + i, _mm256_div_ps(va, vb));
+            }
+
+            ::IE::Internal::SoAElementwiseF32Scalar<_OP>(a + i, b + i, out + i, count - i);
+        }
+
+        __IE__TARGET_AVX2 inline __m256 SoADotProductF32AVX2(const ::IE::Internal::SoAStream<const float>& a, const ::IE::Internal::SoAStream<const float>& b, const size_t i) noexcept
+        {
+            __m256 dot = _mm256_mul_ps(_mm256_loadu_ps(a.m_pX + i), _mm256_loadu_ps(b.m_pX + i));
+            dot = _mm256_fmadd_ps(_mm256_loadu_ps(a.m_pY + i), _mm256_loadu_ps(b.m_pY + i), dot);
+            dot = _mm256_fmadd_ps(_mm256_loadu_ps(a.m_pZ + i), _mm256_loadu_ps(b.m_pZ + i), dot);
+
+            return _mm256_fmadd_ps(_mm256_loadu_ps(a.m_pW + i), _mm256_loadu_ps(b.m_pW + i), dot);
+        }
+
+        __IE__TARGET_AVX2 inline void SoADotProductF32AVX2(const ::IE::Internal::SoAStream<const float>& a, const ::IE::Internal::SoAStream<const float>& b, float* out, const size_t count) noexcept
+        {
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u)
+                _mm256_storeu_ps(out + i, ::IE::Internal::SoADotProductF32AVX2(a, b, i));
+
+            ::IE::Internal::SoADotProductF32Scalar(::IE::Internal::OffsetSoAStream(a, i), ::IE::Internal::OffsetSoAStream(b, i), out + i, count - i);
+        }
+
+        __IE__TARGET_AVX2 inline void SoALengthF32AVX2(const ::IE::Internal::SoAStream<const float>& a, float* out, const size_t count) noexcept
+        {
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u)
+                _mm256_storeu_ps(out + i, _mm256_sqrt_ps(::IE::Internal::SoADotProductF32AVX2(a, a, i)));
+
+            ::IE::Internal::SoALengthF32Scalar(::IE::Internal::OffsetSoAStream(a, i), out + i, count - i);
+        }
+
+        __IE__TARGET_AVX2 inline void SoANormalizeF32AVX2(const ::IE::Internal::SoAStream<const float>& a, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m256 length = _mm256_sqrt_ps(::IE::Internal::SoADotProductF32AVX2(a, a, i));
+
+                _mm256_storeu_ps(out.m_pX + i, _mm256_div_ps(_mm256_loadu_ps(a.m_pX + i), length));
+                _mm256_storeu_ps(out.m_pY + i, _mm256_div_ps(_mm256_loadu_ps(a.m_pY + i), length));
+                _mm256_storeu_ps(out.m_pZ + i, _mm256_div_ps(_mm256_loadu_ps(a.m_pZ + i), length));
+                _mm256_storeu_ps(out.m_pW + i, _mm256_div_ps(_mm256_loadu_ps(a.m_pW + i), length));
+            }
+
+            ::IE::Internal::SoANormalizeF32Scalar(::IE::Internal::OffsetSoAStream(a, i), ::IE::Internal::OffsetSoAStream(out, i), count - i);
+        }
+
+        __IE__TARGET_AVX2 inline void SoACrossProduct3DF32AVX2(const ::IE::Internal::SoAStream<const float>& a, const ::IE::Internal::SoAStream<const float>& b, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m256 ax = _mm256_loadu_ps(a.m_pX + i), ay = _mm256_loadu_ps(a.m_pY + i), az = _mm256_loadu_ps(a.m_pZ + i);
+                const __m256 bx = _mm256_loadu_ps(b.m_pX + i), by = _mm256_loadu_ps(b.m_pY + i), bz = _mm256_loadu_ps(b.m_pZ + i);
+
+                _mm256_storeu_ps(out.m_pX + i, _mm256_fmsub_ps(ay, bz, _mm256_mul_ps(az, by)));
+                _mm256_storeu_ps(out.m_pY + i, _mm256_fmsub_ps(az, bx, _mm256_mul_ps(ax, bz)));
+                _mm256_storeu_ps(out.m_pZ + i, _mm256_fmsub_ps(ax, by, _mm256_mul_ps(ay, bx)));
+                _mm256_storeu_ps(out.m_pW + i, _mm256_setzero_ps());
+            }
+
+            ::IE::Internal::SoACrossProduct3DF32Scalar(::IE::Internal::OffsetSoAStream(a, i), ::IE::Internal::OffsetSoAStream(b, i), ::IE::Internal::OffsetSoAStream(out, i), count - i);
+        }
+
+        __IE__TARGET_AVX2 inline void SoAReflectF32AVX2(const ::IE::Internal::SoAStream<const float>& in, const ::IE::Internal::SoAStream<const float>& normal, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m256 dot          = ::IE::Internal::SoADotProductF32AVX2(in, normal, i);
+                const __m256 minusTwoDot  = _mm256_mul_ps(dot, _mm256_set1_ps(-2.f));
+
+                _mm256_storeu_ps(out.m_pX + i, _mm256_fmadd_ps(_mm256_loadu_ps(normal.m_pX + i), minusTwoDot, _mm256_loadu_ps(in.m_pX + i)));
+                _mm256_storeu_ps(out.m_pY + i, _mm256_fmadd_ps(_mm256_loadu_ps(normal.m_pY + i), minusTwoDot, _mm256_loadu_ps(in.m_pY + i)));
+                _mm256_storeu_ps(out.m_pZ + i, _mm256_fmadd_ps(_mm256_loadu_ps(normal.m_pZ + i), minusTwoDot, _mm256_loadu_ps(in.m_pZ + i)));
+                _mm256_storeu_ps(out.m_pW + i, _mm256_fmadd_ps(_mm256_loadu_ps(normal.m_pW + i), minusTwoDot, _mm256_loadu_ps(in.m_pW + i)));
+            }
+
+            ::IE::Internal::SoAReflectF32Scalar(::IE::Internal::OffsetSoAStream(in, i), ::IE::Internal::OffsetSoAStream(normal, i), ::IE::Internal::OffsetSoAStream(out, i), count - i);
+        }
+
+        /* The transpositions load 2 vectors per register and transpose every 128 bit lane as a 4x4 matrix. */
+        /* The lanes then hold the even & odd vectors, which a single "vpermps" puts back in order.        */
+
+        __IE__TARGET_AVX2 inline void AoSToSoAF32AVX2(const float* aos, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m256 r0 = _mm256_loadu_ps(aos + i * 4u + 0u),  r1 = _mm256_loadu_ps(aos + i * 4u + 8u);
+                const __m256 r2 = _mm256_loadu_ps(aos + i * 4u + 16u), r3 = _mm256_loadu_ps(aos + i * 4u + 24u);
+
+                const __m256 t0 = _mm256_unpacklo_ps(r0, r1), t1 = _mm256_unpackhi_ps(r0, r1);
+                const __m256 t2 = _mm256_unpacklo_ps(r2, r3), t3 = _mm256_unpackhi_ps(r2, r3);
+
+                _mm256_storeu_ps(out.m_pX + i, _mm256_permutevar8x32_ps(_mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)), order));
+                _mm256_storeu_ps(out.m_pY + i, _mm256_permutevar8x32_ps(_mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2)), order));
+                _mm256_storeu_ps(out.m_pZ + i, _mm256_permutevar8x32_ps(_mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)), order));
+                _mm256_storeu_ps(out.m_pW + i, _mm256_permutevar8x32_ps(_mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2)), order));
+            }
+
+            ::IE::Internal::AoSToSoAF32Scalar(aos + i * 4u, ::IE::Internal::OffsetSoAStream(out, i), count - i);
+        }
+
+        __IE__TARGET_AVX2 inline void SoAToAoSF32AVX2(const ::IE::Internal::SoAStream<const float>& in, float* aos, const size_t count) noexcept
+        {
+            const __m256i order = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m256 x = _mm256_permutevar8x32_ps(_mm256_loadu_ps(in.m_pX + i), order);
+                const __m256 y = _mm256_permutevar8x32_ps(_mm256_loadu_ps(in.m_pY + i), order);
+                const __m256 z = _mm256_permutevar8x32_ps(_mm256_loadu_ps(in.m_pZ + i), order);
+                const __m256 w = _mm256_permutevar8x32_ps(_mm256_loadu_ps(in.m_pW + i), order);
+
+                const __m256 t0 = _mm256_unpacklo_ps(x, y), t1 = _mm256_unpackhi_ps(x, y);
+                const __m256 t2 = _mm256_unpacklo_ps(z, w), t3 = _mm256_unpackhi_ps(z, w);
+
+                _mm256_storeu_ps(aos + i * 4u + 0u,  _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)));
+                _mm256_storeu_ps(aos + i * 4u + 8u,  _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2)));
+                _mm256_storeu_ps(aos + i * 4u + 16u, _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)));
+                _mm256_storeu_ps(aos + i * 4u + 24u, _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2)));
+            }
+
+            ::IE::Internal::SoAToAoSF32Scalar(::IE::Internal::OffsetSoAStream(in, i), aos + i * 4u, count - i);
+        }
+
+        // +--------------+     +--------------------+     +-----------------+
+        // | Math Library | --> | Vector Array (SoA) | --> | AVX-512 Kernels |
+        // +--------------+     +--------------------+     +-----------------+
+
+        __IE__TARGET_AVX512 inline __mmask16 SoATailMaskAVX512(const size_t remaining) noexcept
+        {
+            return (remaining >= 16u) ? static_cast<__mmask16>(0xFFFFu) : static_cast<__mmask16>((1u << remaining) - 1u);
+        }
+
+        template <::IE::Internal::SoAOperation _OP>
+        __IE__TARGET_AVX512 inline void SoAElementwiseF32AVX512(const float* a, const float* b, float* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i += 16u) {
+                const __mmask16 mask = ::IE::Internal::SoATailMaskAVX512(count - i);
+                const __m512 va = _mm512_maskz_loadu_ps(mask, a + i), vb = _mm512_maskz_loadu_ps(mask, b + i);
+
+                if constexpr (_OP == ::IE::Internal::SoAOperation::ADD)      _mm512_mask_storeu_ps(out + i, mask, _mm512_add_ps(va, vb));
+                else if constexpr (_OP == ::IE::Internal::SoAOperation::SUB) _mm512_mask_storeu_ps(out + i, mask, _mm512_sub_ps(va, vb));
+                else if constexpr (_OP == ::IE::Internal::SoAOperation::MUL) _mm512_mask_storeu_ps(out + i, mask, _mm512_mul_ps(va, vb));
+                else if constexpr (_OP == ::IE::Internal::SoAOperation::DIV) _mm512_mask_storeu_ps(out + i, mask, _mm512_div_ps(va, vb));
+            }
+        }
+
+        __IE__TARGET_AVX512 inline __m512 SoADotProductF32AVX512(const ::IE::Internal::SoAStream<const float>& a, const ::IE::Internal::SoAStream<const float>& b, const size_t i, const __mmask16 mask) noexcept
+        {
+            __m512 dot = _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, a.m_pX + i), _mm512_maskz_loadu_ps(mask, b.m_pX + i));
+            dot = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a.m_pY + i), _mm512_maskz_loadu_ps(mask, b.m_pY + i), dot);
+            dot = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a.m_pZ + i), _mm512_maskz_loadu_ps(mask, b.m_pZ + i), dot);
+
+            return _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a.m_pW + i), _mm512_maskz_loadu_ps(mask, b.m_pW + i), dot);
+        }
+
+        __IE__TARGET_AVX512 inline void SoADotProductF32AVX512(const ::IE::Internal::SoAStream<const float>& a, const ::IE::Internal::SoAStream<const float>& b, float* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i += 16u) {
+                const __mmask16 mask = ::IE::Internal::SoATailMaskAVX512(count - i);
+
+                _mm512_mask_storeu_ps(out + i, mask, ::IE::Internal::SoADotProductF32AVX512(a, b, i, mask));
+            }
+        }
+
+        __IE__TARGET_AVX512 inline void SoALengthF32AVX512(const ::IE::Internal::SoAStream<const float>& a, float* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i += 16u) {
+                const __mmask16 mask = ::IE::Internal::SoATailMaskAVX512(count - i);
+
+                _mm512_mask_storeu_ps(out + i, mask, _mm512_sqrt_ps(::IE::Internal::SoADotProductF32AVX512(a, a, i, mask)));
+            }
+        }
+
+        __IE__TARGET_AVX512 inline void SoANormalizeF32AVX512(const ::IE::Internal::SoAStream<const float>& a, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i += 16u) {
+                const __mmask16 mask   = ::IE::Internal::SoATailMaskAVX512(count - i);
+                const __m512    length = _mm512_sqrt_ps(::IE::Internal::SoADotProductF32AVX512(a, a, i, mask));
+
+                _mm512_mask_storeu_ps(out.m_pX + i, mask, _mm512_div_ps(_mm512_maskz_loadu_ps(mask, a.m_pX + i), length));
+                _mm512_mask_storeu_ps(out.m_pY + i, mask, _mm512_div_ps(_mm512_maskz_loadu_ps(mask, a.m_pY + i), length));
+                _mm512_mask_storeu_ps(out.m_pZ + i, mask, _mm512_div_ps(_mm512_maskz_loadu_ps(mask, a.m_pZ + i), length));
+                _mm512_mask_storeu_ps(out.m_pW + i, mask, _mm512_div_ps(_mm512_maskz_loadu_ps(mask, a.m_pW + i), length));
+            }
+        }
+
+        __IE__TARGET_AVX512 inline void SoACrossProduct3DF32AVX512(const ::IE::Internal::SoAStream<const float>& a, const ::IE::Internal::SoAStream<const float>& b, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i += 16u) {
+                const __mmask16 mask = ::IE::Internal::SoATailMaskAVX512(count - i);
+
+                const __m512 ax = _mm512_maskz_loadu_ps(mask, a.m_pX + i), ay = _mm512_maskz_loadu_ps(mask, a.m_pY + i), az = _mm512_maskz_loadu_ps(mask, a.m_pZ + i);
+                const __m512 bx = _mm512_maskz_loadu_ps(mask, b.m_pX + i), by = _mm512_maskz_loadu_ps(mask, b.m_pY + i), bz = _mm512_maskz_loadu_ps(mask, b.m_pZ + i);
+
+                _mm512_mask_storeu_ps(out.m_pX + i, mask, _mm512_fmsub_ps(ay, bz, _mm512_mul_ps(az, by)));
+                _mm512_mask_storeu_ps(out.m_pY + i, mask, _mm512_fmsub_ps(az, bx, _mm512_mul_ps(ax, bz)));
+                _mm512_mask_storeu_ps(out.m_pZ + i, mask, _mm512_fmsub_ps(ax, by, _mm512_mul_ps(ay, bx)));
+                _mm512_mask_storeu_ps(out.m_pW + i, mask, _mm512_setzero_ps());
+            }
+        }
+
+        __IE__TARGET_AVX512 inline void SoAReflectF32AVX512(const ::IE::Internal::SoAStream<const float>& in, const ::IE::Internal::SoAStream<const float>& normal, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i += 16u) {
+                const __mmask16 mask        = ::IE::Internal::SoATailMaskAVX512(count - i);
+                const __m512    minusTwoDot = _mm512_mul_ps(::IE::Internal::SoADotProductF32AVX512(in, normal, i, mask), _mm512_set1_ps(-2.f));
+
+                _mm512_mask_storeu_ps(out.m_pX + i, mask, _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, normal.m_pX + i), minusTwoDot, _mm512_maskz_loadu_ps(mask, in.m_pX + i)));
+                _mm512_mask_storeu_ps(out.m_pY + i, mask, _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, normal.m_pY + i), minusTwoDot, _mm512_maskz_loadu_ps(mask, in.m_pY + i)));
+                _mm512_mask_storeu_ps(out.m_pZ + i, mask, _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, normal.m_pZ + i), minusTwoDot, _mm512_maskz_loadu_ps(mask, in.m_pZ + i)));
+                _mm512_mask_storeu_ps(out.m_pW + i, mask, _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, normal.m_pW + i), minusTwoDot, _mm512_maskz_loadu_ps(mask, in.m_pW + i)));
+            }
+        }
+
+        /* Same idea as the AVX2 transpositions with 4 vectors per register. The per-lane transposes */
+        /* leave the components in the order 0, 4, 8, 12, 1, 5... which a "vpermps" undoes.        */
+
+        __IE__TARGET_AVX512 inline void AoSToSoAF32AVX512(const float* aos, const ::IE::Internal::SoAStream<float>& out, const size_t count) noexcept
+        {
+            const __m512i order = _mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+
+            size_t i = 0u;
+            for (; i + 16u <= count; i += 16u) {
+                const __m512 r0 = _mm512_loadu_ps(aos + i * 4u + 0u),  r1 = _mm512_loadu_ps(aos + i * 4u + 16u);
+                const __m512 r2 = _mm512_loadu_ps(aos + i * 4u + 32u), r3 = _mm512_loadu_ps(aos + i * 4u + 48u);
+
+                const __m512 t0 = _mm512_unpacklo_ps(r0, r1), t1 = _mm512_unpackhi_ps(r0, r1);
+                const __m512 t2 = _mm512_unpacklo_ps(r2, r3), t3 = _mm512_unpackhi_ps(r2, r3);
+
+                _mm512_storeu_ps(out.m_pX + i, _mm512_permutexvar_ps(order, _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0))));
+                _mm512_storeu_ps(out.m_pY + i, _mm512_permutexvar_ps(order, _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2))));
+                _mm512_storeu_ps(out.m_pZ + i, _mm512_permutexvar_ps(order, _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0))));
+                _mm512_storeu_ps(out.m_pW + i, _mm512_permutexvar_ps(order, _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2))));
+            }
+
+            ::IE::Internal::AoSToSoAF32AVX2(aos + i * 4u, ::IE::Internal::OffsetSoAStream(out, i), count - i);
+        }
+
+        __IE__TARGET_AVX512 inline void SoAToAoSF32AVX512(const ::IE::Internal::SoAStream<const float>& in, float* aos, const size_t count) noexcept
+        {
+            const __m512i order = _mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+
+            size_t i = 0u;
+            for (; i + 16u <= count; i += 16u) {
+                const __m512 x = _mm512_permutexvar_ps(order, _mm512_loadu_ps(in.m_pX + i));
+                const __m512 y = _mm512_permutexvar_ps(order, _mm512_loadu_ps(in.m_pY + i));
+                const __m512 z = _mm512_permutexvar_ps(order, _mm512_loadu_ps(in.m_pZ + i));
+                const __m512 w = _mm512_permutexvar_ps(order, _mm512_loadu_ps(in.m_pW + i));
+
+                const __m512 t0 = _mm512_unpacklo_ps(x, y), t1 = _mm512_unpackhi_ps(x, y);
+                const __m512 t2 = _mm512_unpacklo_ps(z, w), t3 = _mm512_unpackhi_ps(z, w);
+
+                _mm512_storeu_ps(aos + i * 4u + 0u,  _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)));
+                _mm512_storeu_ps(aos + i * 4u + 16u, _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2)));
+                _mm512_storeu_ps(aos + i * 4u + 32u, _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)));
+                _mm512_storeu_ps(aos + i * 4u + 48u, _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2)));
+            }
+
+            ::IE::Internal::SoAToAoSF32AVX2(::IE::Internal::OffsetSoAStream(in, i), aos + i * 4u, count - i);
+        }
+
+#endif // #ifdef __IE__ENABLE_SIMD
+
+    } // Internal
+
+    /* The templated "VectorArray" class stores many 4 dimensional vectors as a "structure of arrays" */
+    /* (every x, then every y, ...) in a single 64 byte aligned allocation. Its operations process    */
+    /* whole arrays at once, which for floats means 4, 8 or 16 vectors per instruction depending on   */
+    /* the tier picked by the dispatch layer. Other types use scalar loops.                          */
+    /* The output array of an operation may be one of its inputs.                                   */
+
+    template <::IE::arithmetic _T>
+    class VectorArray {
+    public:
+        static constexpr const size_t ALIGNMENT = 64u;
+
+    private:
+        // Each component array is padded so that the next one starts on a "ALIGNMENT" boundary
+        static constexpr const size_t CAPACITY_GRANULARITY = (ALIGNMENT / sizeof(_T) > 0u) ? ALIGNMENT / sizeof(_T) : 1u;
+
+        _T*    m_pData    = nullptr;
+        size_t m_size     = 0u;
+        size_t m_capacity = 0u; // Per component
+
+        inline void Allocate(const size_t capacity) noexcept
+        {
+            this->m_capacity = (capacity + CAPACITY_GRANULARITY - 1u) / CAPACITY_GRANULARITY * CAPACITY_GRANULARITY;
+            this->m_pData    = (this->m_capacity > 0u)
+                ? static_cast<_T*>(::operator new(sizeof(_T) * 4u * this->m_capacity, std::align_val_t(ALIGNMENT)))
+                : nullptr;
+        }
+
+        inline void Deallocate() noexcept
+        {
+            if (this->m_pData != nullptr)
+                ::operator delete(this->m_pData, std::align_val_t(ALIGNMENT));
+
+            this->m_pData    = nullptr;
+            this->m_capacity = 0u;
+        }
+
+        static inline void CopyComponents(::IE::VectorArray<_T>& dst, const ::IE::VectorArray<_T>& src, const size_t count) noexcept
+        {
+            if (count > 0u) {
+                for (size_t c = 0u; c < 4u; c++)
+                    std::memcpy(dst.GetComponent(c), src.GetComponent(c), sizeof(_T) * count);
+            }
+        }
+
+        inline ::IE::Internal::SoAStream<_T> GetStream() noexcept
+        {
+            return { this->GetX(), this->GetY(), this->GetZ(), this->GetW() };
+        }
+
+        inline ::IE::Internal::SoAStream<const _T> GetStream() const noexcept
+        {
+            return { this->GetX(), this->GetY(), this->GetZ(), this->GetW() };
+        }
+
+    public:
+        // +--------------+     +--------------------+     +--------------+
+        // | Math Library | --> | Vector Array (SoA) | --> | Constructors |
+        // +--------------+     +--------------------+     +--------------+
+
+        VectorArray() = default;
+
+        explicit VectorArray(const size_t size) noexcept
+            : m_size(size)
+        {
+            this->Allocate(size);
+        }
+
+        VectorArray(const ::IE::Vector<_T>* vectors, const size_t count) noexcept
+        {
+            this->FromVectors(vectors, count);
+        }
+
+        VectorArray(const ::IE::VectorArray<_T>& other) noexcept
+            : m_size(other.m_size)
+        {
+            this->Allocate(other.m_size);
+
+            ::IE::VectorArray<_T>::CopyComponents(*this, other, other.m_size);
+        }
+
+        VectorArray(::IE::VectorArray<_T>&& other) noexcept
+            : m_pData(other.m_pData), m_size(other.m_size), m_capacity(other.m_capacity)
+        {
+            other.m_pData    = nullptr;
+            other.m_size     = 0u;
+            other.m_capacity = 0u;
+        }
+
+        ::IE::VectorArray<_T>& operator=(const ::IE::VectorArray<_T>& other) noexcept
+        {
+            if (this != &other) {
+                this->Resize(other.m_size, false);
+
+                ::IE::VectorArray<_T>::CopyComponents(*this, other, other.m_size);
+            }
+
+            return *this;
+        }
+
+        ::IE::VectorArray<_T>& operator=(::IE::VectorArray<_T>&& other) noexcept
+        {
+            if (this != &other) {
+                this->Deallocate();
+
+                this->m_pData    = other.m_pData;
+                this->m_size     = other.m_size;
+                this->m_capacity = other.m_capacity;
+
+                other.m_pData    = nullptr;
+                other.m_size     = 0u;
+                other.m_capacity = 0u;
+            }
+
+            return *this;
+        }
+
+        ~VectorArray() noexcept { this->Deallocate(); }
+
+        // +--------------+     +--------------------+     +-----------------+
+        // | Math Library | --> | Vector Array (SoA) | --> | Size & Elements |
+        // +--------------+     +--------------------+     +-----------------+
+
+        inline size_t GetSize()     const noexcept { return this->m_size;     }
+        inline size_t GetCapacity() const noexcept { return this->m_capacity; }
+
+        // Changes the number of vectors (new ones are uninitialized), "bKeepContents" = false skips the copy when growing
+        void Resize(const size_t size, const bool bKeepContents = true) noexcept
+        {
+            if (size > this->m_capacity) {
+                ::IE::VectorArray<_T> grown;
+                grown.Allocate(size);
+
+                if (bKeepContents)
+                    ::IE::VectorArray<_T>::CopyComponents(grown, *this, this->m_size);
+
+                std::swap(this->m_pData,    grown.m_pData);
+                std::swap(this->m_capacity, grown.m_capacity);
+            }
+
+            this->m_size = size;
+        }
+
+        // The component arrays are "ALIGNMENT" byte aligned : (0 : x, 1 : y, 2 : z, 3 : w)
+        inline       _T* GetComponent(const size_t c)       noexcept { return this->m_pData + c * this->m_capacity; }
+        inline const _T* GetComponent(const size_t c) const noexcept { return this->m_pData + c * this->m_capacity; }
+
+        inline       _T* GetX()       noexcept { return this->GetComponent(0u); }
+        inline const _T* GetX() const noexcept { return this->GetComponent(0u); }
+        inline       _T* GetY()       noexcept { return this->GetComponent(1u); }
+        inline const _T* GetY() const noexcept { return this->GetComponent(1u); }
+        inline       _T* GetZ()       noexcept { return this->GetComponent(2u); }
+        inline const _T* GetZ() const noexcept { return this->GetComponent(2u); }
+        inline       _T* GetW()       noexcept { return this->GetComponent(3u); }
+        inline const _T* GetW() const noexcept { return this->GetComponent(3u); }
+
+        inline ::IE::Vector<_T> Get(const size_t i) const noexcept
+        {
+            return ::IE::Vector<_T>(this->GetX()[i], this->GetY()[i], this->GetZ()[i], this->GetW()[i]);
+        }
+
+        inline void Set(const size_t i, const ::IE::Vector<_T>& vec) noexcept
+        {
+            this->GetX()[i] = vec.x; this->GetY()[i] = vec.y; this->GetZ()[i] = vec.z; this->GetW()[i] = vec.w;
+        }
+
+        // +--------------+     +--------------------+     +----------------------+
+        // | Math Library | --> | Vector Array (SoA) | --> | AoS <-> SoA Boundary |
+        // +--------------+     +--------------------+     +----------------------+
+
+        void FromVectors(const ::IE::Vector<_T>* vectors, const size_t count) noexcept
+        {
+            this->Resize(count, false);
+
+            if constexpr (std::is_same_v<_T, float>) {
+                ::IE::Internal::GetSIMDKernels().m_pAoSToSoAF32(reinterpret_cast<const float*>(vectors), this->GetStream(), count);
+            } else {
+                for (size_t i = 0u; i < count; i++)
+                    this->Set(i, vectors[i]);
+            }
+        }
+
+        void ToVectors(::IE::Vector<_T>* vectors) const noexcept
+        {
+            if constexpr (std::is_same_v<_T, float>) {
+                ::IE::Internal::GetSIMDKernels().m_pSoAToAoSF32(this->GetStream(), reinterpret_cast<float*>(vectors), this->m_size);
+            } else {
+                for (size_t i = 0u; i < this->m_size; i++)
+                    vectors[i] = this->Get(i);
+            }
+        }
+
+        // +--------------+     +--------------------+     +---------------------------+
+        // | Math Library | --> | Vector Array (SoA) | --> | Operators: +=, -=, *=, /= |
+        // +--------------+     +--------------------+     +---------------------------+
+
+        inline void operator+=(const ::IE::VectorArray<_T>& other) noexcept { ::IE::VectorArray<_T>::Add(*this, other, *this); }
+        inline void operator-=(const ::IE::VectorArray<_T>& other) noexcept { ::IE::VectorArray<_T>::Sub(*this, other, *this); }
+        inline void operator*=(const ::IE::VectorArray<_T>& other) noexcept { ::IE::VectorArray<_T>::Mul(*this, other, *this); }
+        inline void operator/=(const ::IE::VectorArray<_T>& other) noexcept { ::IE::VectorArray<_T>::Div(*this, other, *this); }
+
+        inline void Normalize() noexcept { ::IE::VectorArray<_T>::Normalized(*this, *this); }
+
+        // +--------------+     +--------------------+     +----------------------------+
+        // | Math Library | --> | Vector Array (SoA) | --> | Static Function Operations |
+        // +--------------+     +--------------------+     +----------------------------+
+
+    private:
+        template <::IE::Internal::SoAOperation _OP>
+        static inline void Elementwise(const ::IE::VectorArray<_T>& a, const ::IE::VectorArray<_T>& b, ::IE::VectorArray<_T>& out) noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(a.m_size == b.m_size);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            out.Resize(a.m_size);
+
+            for (size_t c = 0u; c < 4u; c++) {
+                if constexpr (std::is_same_v<_T, float>) {
+                    const ::IE::Internal::SIMDKernels& kernels = ::IE::Internal::GetSIMDKernels();
+
+                    if constexpr (_OP == ::IE::Internal::SoAOperation::ADD)      kernels.m_pSoAAddF32(a.GetComponent(c), b.GetComponent(c), out.GetComponent(c), a.m_size);
+                    else if constexpr (_OP == ::IE::Internal::SoAOperation::SUB) kernels.m_pSoASubF32(a.GetComponent(c), b.GetComponent(c), out.GetComponent(c), a.m_size);
+                    else if constexpr (_OP == ::IE::Internal::SoAOperation::MUL) kernels.m_pSoAMulF32(a.GetComponent(c), b.GetComponent(c), out.GetComponent(c), a.m_size);
+                    else if constexpr (_OP == ::IE::Internal::SoAOperation::DIV) kernels.m_pSoADivF32(a.GetComponent(c), b.GetComponent(c), out.GetComponent(c), a.m_size);
+                } else {
+                    const _T* pA = a.GetComponent(c);
+                    const _T* pB = b.GetComponent(c);
+                    _T*     pOut = out.GetComponent(c);
+
+                    for (size_t i = 0u; i < a.m_size; i++) {
+                        if constexpr (_OP == ::IE::Internal::SoAOperation::ADD)      pOut[i] = pA[i] + pB[i];
+                        else if constexpr (_OP == ::IE::Internal::SoAOperation::SUB) pOut[i] = pA[i] - pB[i];
+                        else if constexpr (_OP == ::IE::Internal::SoAOperation::MUL) pOut[i] = pA[i] * pB[i];
+                        else if constexpr (_OP == ::IE::Internal::SoAOperation::DIV) pOut[i] = pA[i] / pB[i];
+                    }
+                }
+            }
+        }
+
+    public:
+        static inline void Add(const ::IE::VectorArray<_T>& a, const ::IE::VectorArray<_T>& b, ::IE::VectorArray<_T>& out) noexcept { Elementwise<::IE::Internal::SoAOperation::ADD>(a, b, out); }
+        static inline void Sub(const ::IE::VectorArray<_T>& a, const ::IE::VectorArray<_T>& b, ::IE::VectorArray<_T>& out) noexcept { Elementwise<::IE::Internal::SoAOperation::SUB>(a, b, out); }
+        static inline void Mul(const ::IE::VectorArray<_T>& a, const ::IE::VectorArray<_T>& b, ::IE::VectorArray<_T>& out) noexcept { Elementwise<::IE::Internal::SoAOperation::MUL>(a, b, out); }
+        static inline void Div(const ::IE::VectorArray<_T>& a, const ::IE::VectorArray<_T>& b, ::IE::VectorArray<_T>& out) noexcept { Elementwise<::IE::Internal::SoAOperation::DIV>(a, b, out); }
+
+        // Writes "a.GetSize()" dot products to "out"
+        static void DotProduct(const ::IE::VectorArray<_T>& a, const ::IE::VectorArray<_T>& b, _T* out) noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(a.m_size == b.m_size);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            if constexpr (std::is_same_v<_T, float>) {
+                ::IE::Internal::GetSIMDKernels().m_pSoADotProductF32(a.GetStream(), b.GetStream(), out, a.m_size);
+            } else {
+                for (size_t i = 0u; i < a.m_size; i++)
+                    out[i] = ::IE::Vector<_T>::DotProduct(a.Get(i), b.Get(i));
+            }
+        }
+
+        // Writes "a.GetSize()" lengths to "out"
+        static void GetLengths(const ::IE::VectorArray<_T>& a, _T* out) noexcept
+        {
+            if constexpr (std::is_same_v<_T, float>) {
+                ::IE::Internal::GetSIMDKernels().m_pSoALengthF32(a.GetStream(), out, a.m_size);
+            } else {
+                for (size_t i = 0u; i < a.m_size; i++)
+                    out[i] = static_cast<_T>(a.Get(i).GetLength());
+            }
+        }
+
+        static void Normalized(const ::IE::VectorArray<_T>& a, ::IE::VectorArray<_T>& out) noexcept
+        {
+            out.Resize(a.m_size);
+
+            if constexpr (std::is_same_v<_T, float>) {
+                ::IE::Internal::GetSIMDKernels().m_pSoANormalizeF32(a.GetStream(), out.GetStream(), a.m_size);
+            } else {
+                for (size_t i = 0u; i < a.m_size; i++)
+                    out.Set(i, ::IE::Vector<_T>::Normalized(a.Get(i)));
+            }
+        }
+
+        static void CrossProduct3D(const ::IE::VectorArray<_T>& a, const ::IE::VectorArray<_T>& b, ::IE::VectorArray<_T>& out) noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(a.m_size == b.m_size);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            out.Resize(a.m_size);
+
+            if constexpr (std::is_same_v<_T, float>) {
+                ::IE::Internal::GetSIMDKernels().m_pSoACrossProduct3DF32(a.GetStream(), b.GetStream(), out.GetStream(), a.m_size);
+            } else {
+                for (size_t i = 0u; i < a.m_size; i++)
+                    out.Set(i, ::IE::Vector<_T>::CrossProduct3D(a.Get(i), b.Get(i)));
+            }
+        }
+
+        static void GetReflected(const ::IE::VectorArray<_T>& in, const ::IE::VectorArray<_T>& normals, ::IE::VectorArray<_T>& out) noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(in.m_size == normals.m_size);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            out.Resize(in.m_size);
+
+            if constexpr (std::is_same_v<_T, float>) {
+                ::IE::Internal::GetSIMDKernels().m_pSoAReflectF32(in.GetStream(), normals.GetStream(), out.GetStream(), in.m_size);
+            } else {
+                for (size_t i = 0u; i < in.m_size; i++)
+                    out.Set(i, ::IE::Vector<_T>::GetReflected(in.Get(i), normals.Get(i)));
+            }
+        }
+    };
+
+    // +--------------+     +--------------------+     +-----------------+
+    // | Math Library | --> | Vector Array (SoA) | --> | Useful Typedefs |
+    // +--------------+     +--------------------+     +-----------------+
+
+    typedef ::IE::VectorArray<float>  VecArrayf32;
+    typedef ::IE::VectorArray<double> VecArrayd64;
+
+    // +--------------+     +--------------+
+    // | Math Library | --> | Matrix (4x4) |
+    // +--------------+     +--------------+
+
+    namespace Internal {
+
+        // Generic versions of the inverse functions (defined with the float kernels in "Matrix (4x4) --> Inverse Kernels")
+        template <std::floating_point _T> inline _T   MatrixDeterminantScalar(const _T* mat) noexcept;
+        template <std::floating_point _T> inline void MatrixInverseScalar(const _T* mat, _T* matOut) noexcept;
+        template <std::floating_point _T> inline void MatrixAffineInverseScalar(const _T* mat, _T* matOut) noexcept;
+
+    } // Internal
+
+    /* [EN] Represents a row-major 4x4 matrix of "_T" values as shown below:
+     * [FR] Repr�sente une matrice 4x4 de valeurs de types "_T" d'ordre de rang�e principal comme:
+	 * |-------------------|-------------------|-------------------|-------------------|
+	 * | _T m00 (index 0)  | _T m01 (index 1)  | _T m02 (index 2)  | _T m03 (index 3)  |
+	 * | _T m10 (index 4)  | _T m11 (index 5)  | _T m12 (index 6)  | _T m13 (index 7)  |
+	 * | _T m20 (index 8)  | _T m21 (index 9)  | _T m22 (index 10) | _T m23 (index 11) |
+	 * | _T m30 (index 12) | _T m31 (index 13) | _T m32 (index 14) | _T m33 (index 15) |
+	 * |-------------------|-------------------|-------------------|-------------------|
+	 */
+
+	template <::IE::arithmetic _T>
+	class Matrix
+	{
+	private:
+		/* The rows are aligned so that each of them can be moved in & out of a vector register with */
+		/* a single aligned load/store. For floats the whole matrix also sits in one cache line.      */
+		alignas(64) _T m[16] = { 0 };
+
+		// Whether a row maps exactly onto the vector register of "_T" (not the case of "int16_t" for instance)
+		static constexpr bool ROWS_ARE_REGISTERS = ::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T>()
+		                                        && sizeof(::IE::Internal::SIMDVectorRegister<_T>) == sizeof(_T) * 4u;
+
+	public:
+        // +--------------+     +--------------+     +--------------+
+        // | Math Library | --> | Matrix (4x4) | --> | Constructors |
+        // +--------------+     +--------------+     +--------------+
+
+		Matrix() = default;
+
+		inline Matrix(const _T* buff)                 noexcept { std::memcpy(this->m, buff, sizeof(_T) * 16u);       }
+		inline Matrix(const std::array<_T, 16u>& arr) noexcept { std::memcpy(this->m, arr.data(), sizeof(_T) * 16u); }
+		inline Matrix(const ::IE::Matrix<_T>& other)  noexcept { std::memcpy(this->m, other.m, sizeof(_T) * 16u);    }
+
+        // +--------------+     +--------------+     +----------------------+
+        // | Math Library | --> | Matrix (4x4) | --> | Overloaded Operators |
+        // +--------------+     +--------------+     +----------------------+
+
+		inline       _T& operator[](const size_t i)       noexcept { return this->m[i]; }
+		inline const _T& operator[](const size_t i) const noexcept { return this->m[i]; }
+
+		inline       _T& operator()(const size_t r, const size_t c)       noexcept { return this->m[r * 4u + c]; }
+		inline const _T& operator()(const size_t r, const size_t c) const noexcept { return this->m[r * 4u + c]; }
+
+        // +--------------+     +--------------+     +------+
+        // | Math Library | --> | Matrix (4x4) | --> | Rows |
+        // +--------------+     +--------------+     +------+
+
+		inline ::IE::Vector<_T> GetRow(const size_t r) const noexcept
+		{
+			if constexpr (ROWS_ARE_REGISTERS) {
+#ifdef __IE__ENABLE_SIMD
+				return ::IE::Vector<_T>(::IE::Internal::SIMDLoad<_T>(const_cast<_T*>(this->m + r * 4u)));
+#endif // #ifdef __IE__ENABLE_SIMD
+			} else {
+				return ::IE::Vector<_T>(this->m[r * 4u + 0u], this->m[r * 4u + 1u], this->m[r * 4u + 2u], this->m[r * 4u + 3u]);
+			}
+		}
+
+		inline void SetRow(const size_t r, const ::IE::Vector<_T>& row) noexcept
+		{
+			if constexpr (ROWS_ARE_REGISTERS) {
+#ifdef __IE__ENABLE_SIMD
+				::IE::Internal::SIMDStore<_T>(this->m + r * 4u, row.m_simdRegister);
+#endif // #ifdef __IE__ENABLE_SIMD
+			} else {
+				this->m[r * 4u + 0u] = row.x; this->m[r * 4u + 1u] = row.y;
+				this->m[r * 4u + 2u] = row.z; this->m[r * 4u + 3u] = row.w;
+			}
+		}
+
+        // +--------------+     +--------------+     +-------------+
+        // | Math Library | --> | Matrix (4x4) | --> | Determinant |
+        // +--------------+     +--------------+     +-------------+
+
+		inline _T GetDeterminant() const noexcept requires std::floating_point<_T>
+		{
+			if constexpr (std::is_same_v<_T, float>)
+				return ::IE::Internal::GetSIMDKernels().m_pMatrixDeterminantF32(this->m);
+			else
+				return ::IE::Internal::MatrixDeterminantScalar<_T>(this->m);
+		}
+
+        // +--------------+     +--------------+     +------------------+
+        // | Math Library | --> | Matrix (4x4) | --> | Static Functions |
+        // +--------------+     +--------------+     +------------------+
+
+		static inline ::IE::Matrix<_T> MakeZeros()    noexcept { return ::IE::Matrix<_T>(); }
+
+		static inline ::IE::Matrix<_T> MakeIdentity() noexcept {
+			return ::IE::Matrix<_T>(std::array<_T, 16u>{
+				1, 0, 0, 0,
+				0, 1, 0, 0,
+				0, 0, 1, 0,
+				0, 0, 0, 1
+			});
+		}
+
+		static inline ::IE::Matrix<_T> MakeRotationX(const float radX = 0) noexcept
+		{
+			const _T sinX = std::sin(radX);
+			const _T cosX = std::cos(radX);
+
+			return ::IE::Matrix<_T>(std::array<_T, 16u>{
+				1, 0,    0,     0,
+				0, cosX, -sinX, 0,
+				0, sinX, cosX,  0,
+				0, 0,    0,     1
+			});
+		}
+
+		static inline ::IE::Matrix<_T> MakeRotationY(const float radY = 0) noexcept
+		{
+			const _T sinY = std::sin(radY);
+			const _T cosY = std::cos(radY);
+
+			return ::IE::Matrix<_T>(std::array<_T, 16u>{
+				cosY,  0, sinY, 0,
+				0,     1, 0,    0,
+				-sinY, 0, cosY, 0,
+				0,     0, 0,    1
+			});
+		}
+
+		static inline ::IE::Matrix<_T> MakeRotationZ(const float radZ = 0) noexcept
+		{
+			const _T sinZ = std::sin(radZ);
+			const _T cosZ = std::cos(radZ);
+
+			return ::IE::Matrix<_T>(std::array<_T, 16u>{
+				cosZ, -sinZ, 0, 0,
+				sinZ, cosZ,  0, 0,
+				0,    0,     1, 0,
+				0,    0,     0, 1
+			});
+		}
+
+		// "MakeRotationX(radX) * MakeRotationY(radY) * MakeRotationZ(radZ)", expanded for floating point types
+		static inline ::IE::Matrix<_T> MakeRotation(const float radX = 0, const float radY = 0, const float radZ = 0) noexcept
+		{
+			if constexpr (std::is_floating_point_v<_T>) {
+				const _T sinX = std::sin(radX), cosX = std::cos(radX);
+				const _T sinY = std::sin(radY), cosY = std::cos(radY);
+				const _T sinZ = std::sin(radZ), cosZ = std::cos(radZ);
+
+				return ::IE::Matrix<_T>(std::array<_T, 16u>{
+					cosY * cosZ,                      -cosY * sinZ,                     sinY,         0,
+					cosX * sinZ + sinX * sinY * cosZ, cosX * cosZ - sinX * sinY * sinZ, -sinX * cosY, 0,
+					sinX * sinZ - cosX * sinY * cosZ, sinX * cosZ + cosX * sinY * sinZ, cosX * cosY,  0,
+					0,                                0,                                0,            1
+				});
+			} else {
+				return MakeRotationX(radX) * MakeRotationY(radY) * MakeRotationZ(radZ);
+			}
+		}
+
+		static inline ::IE::Matrix<_T> MakeRotation(const Vector<_T>& radians) noexcept
+		{
+			return Matrix<_T>::MakeRotation(radians.x, radians.y, radians.z);
+		}
+
+		static inline ::IE::Matrix<_T> MakeTranslation(const float x, const float y, const float z) noexcept
+		{
+			return Matrix<_T>(std::array<_T, 16u>{
+				1,  0,  0,  0,
+				0,  1,  0,  0,
+				0,  0,  1,  0,
+				-x, -y, -z, 1,
+			});
+		}
+
+		static inline ::IE::Matrix<_T> MakeTranslation(const Vector<_T>& translation) noexcept
+		{
+			return Matrix<_T>::MakeTranslation(translation.x, translation.y, translation.z);
+		}
+
+		static inline ::IE::Matrix<_T> MakePerspective(const float zNear, const float zFar, const float fovRad, const float aspectRatio)
+		{
+			return Matrix<_T>(std::array<_T, 16u>{
+				aspectRatio * fovRad, 0,      0,                                0,
+				0,                    fovRad, 0,                                0,
+				0,                    0,      zFar / (zFar - zNear),            1,
+				0,                    0,      (-zFar * zNear) / (zFar - zNear), 0,
+			});
+		}
+
+		static inline ::IE::Matrix<_T> MakeScaling(const float scaleX = 1.0f, const float scaleY = 1.0f, const float scaleZ = 1.0f, const float scaleW = 1.0f) noexcept
+		{
+			return Matrix<_T>(std::array<_T, 16u>{
+				scaleX, 0, 0, 0,
+				0, scaleY, 0, 0,
+				0, 0, scaleZ, 0,
+				0, 0, 0, scaleW
+			});
+		}
+
+		static inline ::IE::Matrix<_T> MakeScaling(const Vecf32& scale) noexcept
+		{
+			return Matrix<_T>::MakeScaling(scale.x, scale.y, scale.z, scale.w);
+		}
+
+		static inline ::IE::Matrix<_T> MakeTransposed(const Matrix<_T>& mat) noexcept
+		{
+			return Matrix<_T>(std::array<_T, 16u>{
+				mat(0, 0), mat(1, 0), mat(2, 0), mat(3, 0),
+				mat(0, 1), mat(1, 1), mat(2, 1), mat(3, 1),
+				mat(0, 2), mat(1, 2), mat(2, 2), mat(3, 2),
+				mat(0, 3), mat(1, 3), mat(2, 3), mat(3, 3)
+			});
+		}
+
+		// The result of inverting a singular matrix (determinant of 0) is made of infinities and NaNs
+		static inline ::IE::Matrix<_T> MakeInverse(const Matrix<_T>& mat) noexcept requires std::floating_point<_T>
+		{
+			::IE::Matrix<_T> result;
+
+			if constexpr (std::is_same_v<_T, float>)
+				::IE::Internal::GetSIMDKernels().m_pMatrixInverseF32(mat.m, result.m, 1u);
+			else
+				::IE::Internal::MatrixInverseScalar<_T>(mat.m, result.m);
+
+			return result;
+		}
+
+		/* Faster inverse for matrices made of a rotation, a scaling along the axes of the object and  */
+		/* a translation in the last row (no shear nor projection). The last column is assumed to be   */
+		/* (0, 0, 0, 1) and isn't read.                                                                 */
+		static inline ::IE::Matrix<_T> MakeAffineInverse(const Matrix<_T>& mat) noexcept requires std::floating_point<_T>
+		{
+			::IE::Matrix<_T> result;
+
+			if constexpr (std::is_same_v<_T, float>)
+				::IE::Internal::GetSIMDKernels().m_pMatrixAffineInverseF32(mat.m, result.m, 1u);
+			else
+				::IE::Internal::MatrixAffineInverseScalar<_T>(mat.m, result.m);
+
+			return result;
+		}
+
+		/* Returns the matrix that transforms the normals of a model transformed by "mat", which is   */
+		/* the inverse transpose of its upper 3x3 part. The rows of the transposed inverse are the     */
+		/* cross products of the rows of that part divided by its determinant.                         */
+		static inline ::IE::Matrix<_T> MakeNormalMatrix(const Matrix<_T>& mat) noexcept requires std::floating_point<_T>
+		{
+			const ::IE::Vector<_T> row0 = mat.GetRow(0u), row1 = mat.GetRow(1u), row2 = mat.GetRow(2u);
+
+			// The cross products ignore & zero the "w" components
+			const ::IE::Vector<_T> cofactors0 = ::IE::Vector<_T>::CrossProduct3D(row1, row2);
+			const ::IE::Vector<_T> cofactors1 = ::IE::Vector<_T>::CrossProduct3D(row2, row0);
+			const ::IE::Vector<_T> cofactors2 = ::IE::Vector<_T>::CrossProduct3D(row0, row1);
+
+			const _T rDeterminant = _T(1) / ::IE::Vector<_T>::DotProduct(row0, cofactors0);
+
+			::IE::Matrix<_T> result;
+			result.SetRow(0u, cofactors0 * rDeterminant);
+			result.SetRow(1u, cofactors1 * rDeterminant);
+			result.SetRow(2u, cofactors2 * rDeterminant);
+			result.SetRow(3u, ::IE::Vector<_T>(0, 0, 0, 1));
+
+			return result;
+		}
+
+		// Thanks to: https://stackoverflow.com/questions/349050/calculating-a-lookat-matrix
+		static inline ::IE::Matrix<_T> MakeLookAt(const ::IE::Vector<_T>& cameraPosition, const ::IE::Vector<_T>& focalPoint, const ::IE::Vector<_T>& upDirection) noexcept
+		{
+			const ::IE::Vector<_T> zaxis = ::IE::Vector<_T>::Normalized(focalPoint - cameraPosition);
+			const ::IE::Vector<_T> xaxis = ::IE::Vector<_T>::Normalized(Vector<_T>::CrossProduct3D(upDirection, zaxis));
+			const ::IE::Vector<_T> yaxis = ::IE::Vector<_T>::CrossProduct3D(zaxis, xaxis);
+
+			const _T m30 = -::IE::Vector<_T>::DotProduct(xaxis, cameraPosition);
+			const _T m31 = -::IE::Vector<_T>::DotProduct(yaxis, cameraPosition);
+			const _T m32 = -::IE::Vector<_T>::DotProduct(zaxis, cameraPosition);
+
+			return Matrix<_T>(std::array<_T, 16u>{
+				xaxis.x, yaxis.x, zaxis.x, 0,
+				xaxis.y, yaxis.y, zaxis.y, 0,
+				xaxis.z, yaxis.z, zaxis.z, 0,
+				m30,     m31,     m32,     1
+			});
+		}
+	};
+
+    // +--------------+     +--------------+     +--------------+
+    // | Math Library | --> | Matrix (4x4) | --> | SIMD Kernels |
+    // +--------------+     +--------------+     +--------------+
+
+    /* The float kernels below are selected at runtime by "Internal::ResolveSIMDKernels". They all     */
+    /* compute a row of the product as a sum of rows of the right hand side matrix scaled by the      */
+    /* components of the left hand side row, which avoids gathering the columns of the right matrix.  */
+
+    namespace Internal {
+
+        inline void MatrixMultiplyF32Scalar(const float* matA, const float* matB, float* matOut) noexcept
+        {
+            for (size_t r = 0u; r < 4u; r++) {
+                for (size_t c = 0u; c < 4u; c++) {
+                    matOut[r * 4u + c] = matA[r * 4u + 0u] * matB[0u * 4u + c] + matA[r * 4u + 1u] * matB[1u * 4u + c]
+                                       + matA[r * 4u + 2u] * matB[2u * 4u + c] + matA[r * 4u + 3u] * matB[3u * 4u + c];
+                }
+            }
+        }
+
+        inline void VectorMatrixMultiplyF32Scalar(const float* vec, const float* mat, float* vecOut) noexcept
+        {
+            float result[4];
+
+            for (size_t c = 0u; c < 4u; c++)
+                result[c] = vec[0] * mat[c] + vec[1] * mat[4u + c] + vec[2] * mat[8u + c] + vec[3] * mat[12u + c];
+
+            std::memcpy(vecOut, result, sizeof(result));
+        }
+
+#ifdef __IE__ENABLE_SIMD
+
+        __IE__TARGET_SSE41 inline void MatrixMultiplyF32SSE41(const float* matA, const float* matB, float* matOut) noexcept
+        {
+            const __m128 rowB0 = _mm_loadu_ps(matB + 0u), rowB1 = _mm_loadu_ps(matB + 4u);
+            const __m128 rowB2 = _mm_loadu_ps(matB + 8u), rowB3 = _mm_loadu_ps(matB + 12u);
+
+            for (size_t r = 0u; r < 4u; r++) {
+                const __m128 rowA = _mm_loadu_ps(matA + r * 4u);
+
+                __m128 result =                   _mm_mul_ps(_mm_shuffle_ps(rowA, rowA, _MM_SHUFFLE(0, 0, 0, 0)), rowB0);
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(rowA, rowA, _MM_SHUFFLE(1, 1, 1, 1)), rowB1));
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(rowA, rowA, _MM_SHUFFLE(2, 2, 2, 2)), rowB2));
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(rowA, rowA, _MM_SHUFFLE(3, 3, 3, 3)), rowB3));
+
+                _mm_storeu_ps(matOut + r * 4u, result);
+            }
+        }
+
+        __IE__TARGET_SSE41 inline void VectorMatrixMultiplyF32SSE41(const float* vec, const float* mat, float* vecOut) noexcept
+        {
+            const __m128 v = _mm_loadu_ps(vec);
+
+            __m128 result =                   _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)), _mm_loadu_ps(mat + 0u));
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), _mm_loadu_ps(mat + 4u)));
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), _mm_loadu_ps(mat + 8u)));
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)), _mm_loadu_ps(mat + 12u)));
+
+            _mm_storeu_ps(vecOut, result);
+        }
+
+        // Two rows of the left hand side matrix are processed per 256 bit register
+        __IE__TARGET_AVX2 inline void MatrixMultiplyF32AVX2(const float* matA, const float* matB, float* matOut) noexcept
+        {
+            const __m256 rowB0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matB + 0u));
+            const __m256 rowB1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matB + 4u));
+            const __m256 rowB2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matB + 8u));
+            const __m256 rowB3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matB + 12u));
+
+            for (size_t r = 0u; r < 4u; r += 2u) {
+                const __m256 rowsA = _mm256_loadu_ps(matA + r * 4u);
+
+                __m256 result = _mm256_mul_ps(_mm256_shuffle_ps(rowsA, rowsA, _MM_SHUFFLE(0, 0, 0, 0)), rowB0);
+                result = _mm256_fmadd_ps(_mm256_shuffle_ps(rowsA, rowsA, _MM_SHUFFLE(1, 1, 1, 1)), rowB1, result);
+                result = _mm256_fmadd_ps(_mm256_shuffle_ps(rowsA, rowsA, _MM_SHUFFLE(2, 2, 2, 2)), rowB2, result);
+                result = _mm256_fmadd_ps(_mm256_shuffle_ps(rowsA, rowsA, _MM_SHUFFLE(3, 3, 3, 3)), rowB3, result);
+
+                _mm256_storeu_ps(matOut + r * 4u, result);
+            }
+        }
+
+        __IE__TARGET_AVX2 inline void VectorMatrixMultiplyF32AVX2(const float* vec, const float* mat, float* vecOut) noexcept
+        {
+            __m128 result = _mm_mul_ps(_mm_broadcast_ss(vec + 0u), _mm_loadu_ps(mat + 0u));
+            result = _mm_fmadd_ps(_mm_broadcast_ss(vec + 1u), _mm_loadu_ps(mat + 4u),  result);
+            result = _mm_fmadd_ps(_mm_broadcast_ss(vec + 2u), _mm_loadu_ps(mat + 8u),  result);
+            result = _mm_fmadd_ps(_mm_broadcast_ss(vec + 3u), _mm_loadu_ps(mat + 12u), result);
+
+            _mm_storeu_ps(vecOut, result);
+        }
+
+        // The whole left hand side matrix fits in a single 512 bit register
+        __IE__TARGET_AVX512 inline void MatrixMultiplyF32AVX512(const float* matA, const float* matB, float* matOut) noexcept
+        {
+            const __m512 rowsA = _mm512_loadu_ps(matA);
+
+            __m512 result = _mm512_mul_ps(_mm512_permute_ps(rowsA, _MM_SHUFFLE(0, 0, 0, 0)), _mm512_broadcast_f32x4(_mm_loadu_ps(matB + 0u)));
+            result = _mm512_fmadd_ps(_mm512_permute_ps(rowsA, _MM_SHUFFLE(1, 1, 1, 1)), _mm512_broadcast_f32x4(_mm_loadu_ps(matB + 4u)),  result);
+            result = _mm512_fmadd_ps(_mm512_permute_ps(rowsA, _MM_SHUFFLE(2, 2, 2, 2)), _mm512_broadcast_f32x4(_mm_loadu_ps(matB + 8u)),  result);
+            result = _mm512_fmadd_ps(_mm512_permute_ps(rowsA, _MM_SHUFFLE(3, 3, 3, 3)), _mm512_broadcast_f32x4(_mm_loadu_ps(matB + 12u)), result);
+
+            _mm512_storeu_ps(matOut, result);
+        }
+
+#endif // #ifdef __IE__ENABLE_SIMD
+
+    } // Internal
+
+    // +--------------+     +--------------+     +-----------------+
+    // | Math Library | --> | Matrix (4x4) | --> | Inverse Kernels |
+    // +--------------+     +--------------+     +-----------------+
+
+    /* The general inverse splits the matrix into four 2x2 blocks | A B | and inverts it blockwise  */
+    /*                                                             | C D |                           */
+    /* with 2x2 adjugates, which only needs shuffles within groups of 4 floats. The AVX2 & AVX-512 */
+    /* kernels therefore run the very same steps on 2 & 4 matrices at once, one per 128 bit lane.  */
+    /* All kernels work on "count" contiguous row-major matrices; "in" may be the same as "out".   */
+
+    namespace Internal {
+
+        template <std::floating_point _T>
+        inline _T MatrixDeterminantScalar(const _T* mat) noexcept
+        {
+            // Laplace expansion over the 2x2 sub-determinants of the two top & the two bottom rows
+            const _T s0 = mat[0] * mat[5] - mat[4] * mat[1], s1 = mat[0] * mat[6] - mat[4] * mat[2];
+            const _T s2 = mat[0] * mat[7] - mat[4] * mat[3], s3 = mat[1] * mat[6] - mat[5] * mat[2];
+            const _T s4 = mat[1] * mat[7] - mat[5] * mat[3], s5 = mat[2] * mat[7] - mat[6] * mat[3];
+
+            const _T c5 = mat[10] * mat[15] - mat[14] * mat[11], c4 = mat[9] * mat[15] - mat[13] * mat[11];
+            const _T c3 = mat[9]  * mat[14] - mat[13] * mat[10], c2 = mat[8] * mat[15] - mat[12] * mat[11];
+            const _T c1 = mat[8]  * mat[14] - mat[12] * mat[10], c0 = mat[8] * mat[13] - mat[12] * mat[9];
+
+            return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        }
+
+        template <std::floating_point _T>
+        inline void MatrixInverseScalar(const _T* mat, _T* matOut) noexcept
+        {
+            const _T s0 = mat[0] * mat[5] - mat[4] * mat[1], s1 = mat[0] * mat[6] - mat[4] * mat[2];
+            const _T s2 = mat[0] * mat[7] - mat[4] * mat[3], s3 = mat[1] * mat[6] - mat[5] * mat[2];
+            const _T s4 = mat[1] * mat[7] - mat[5] * mat[3], s5 = mat[2] * mat[7] - mat[6] * mat[3];
+
+            const _T c5 = mat[10] * mat[15] - mat[14] * mat[11], c4 = mat[9] * mat[15] - mat[13] * mat[11];
+            const _T c3 = mat[9]  * mat[14] - mat[13] * mat[10], c2 = mat[8] * mat[15] - mat[12] * mat[11];
+            const _T c1 = mat[8]  * mat[14] - mat[12] * mat[10], c0 = mat[8] * mat[13] - mat[12] * mat[9];
+
+            const _T r = _T(1) / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+            // Written to a temporary since "mat" & "matOut" may overlap
+            const _T result[16] = {
+                ( mat[5]  * c5 - mat[6]  * c4 + mat[7]  * c3) * r, (-mat[1]  * c5 + mat[2]  * c4 - mat[3]  * c3) * r,
+                ( mat[13] * s5 - mat[14] * s4 + mat[15] * s3) * r, (-mat[9]  * s5 + mat[10] * s4 - mat[11] * s3) * r,
+                (-mat[4]  * c5 + mat[6]  * c2 - mat[7]  * c1) * r, ( mat[0]  * c5 - mat[2]  * c2 + mat[3]  * c1) * r,
+                (-mat[12] * s5 + mat[14] * s2 - mat[15] * s1) * r, ( mat[8]  * s5 - mat[10] * s2 + mat[11] * s1) * r,
+                ( mat[4]  * c4 - mat[5]  * c2 + mat[7]  * c0) * r, (-mat[0]  * c4 + mat[1]  * c2 - mat[3]  * c0) * r,
+                ( mat[12] * s4 - mat[13] * s2 + mat[15] * s0) * r, (-mat[8]  * s4 + mat[9]  * s2 - mat[11] * s0) * r,
+                (-mat[4]  * c3 + mat[5]  * c1 - mat[6]  * c0) * r, ( mat[0]  * c3 - mat[1]  * c1 + mat[2]  * c0) * r,
+                (-mat[12] * s3 + mat[13] * s1 - mat[14] * s0) * r, ( mat[8]  * s3 - mat[9]  * s1 + mat[10] * s0) * r
+            };
+
+            std::memcpy(matOut, result, sizeof(result));
+        }
+
+        /* The upper 3x3 part R is a rotation scaled along its rows, so its inverse is its transpose */
+        /* whose columns are divided by the squared lengths of the rows of R. The translation row    */
+        /* of the inverse is the opposite of the translation transformed by that inverse.            */
+        template <std::floating_point _T>
+        inline void MatrixAffineInverseScalar(const _T* mat, _T* matOut) noexcept
+        {
+            _T result[16] = { 0 };
+
+            for (size_t r = 0u; r < 3u; r++) {
+                const _T rLengthSq = _T(1) / (mat[r * 4u] * mat[r * 4u] + mat[r * 4u + 1u] * mat[r * 4u + 1u] + mat[r * 4u + 2u] * mat[r * 4u + 2u]);
+
+                for (size_t c = 0u; c < 3u; c++)
+                    result[c * 4u + r] = mat[r * 4u + c] * rLengthSq;
+            }
+
+            for (size_t c = 0u; c < 3u; c++)
+                result[12u + c] = -(mat[12] * result[c] + mat[13] * result[4u + c] + mat[14] * result[8u + c]);
+
+            result[15] = 1;
+
+            std::memcpy(matOut, result, sizeof(result));
+        }
+
+        inline float MatrixDeterminantF32Scalar(const float* mat) noexcept { return ::IE::Internal::MatrixDeterminantScalar<float>(mat); }
+
+        inline void MatrixInverseF32Scalar(const float* in, float* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++)
+                ::IE::Internal::MatrixInverseScalar<float>(in + i * 16u, out + i * 16u);
+        }
+
+        inline void MatrixAffineInverseF32Scalar(const float* in, float* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++)
+                ::IE::Internal::MatrixAffineInverseScalar<float>(in + i * 16u, out + i * 16u);
+        }
+
+#ifdef __IE__ENABLE_SIMD
+
+        /* 2x2 block helpers. Each group of 4 floats holds a row-major 2x2 matrix and "#" denotes */
+        /* the adjugate, which is the inverse multiplied by the determinant.                      */
+
+        // A * B
+        __IE__TARGET_SSE41 inline __m128 Mat2MulF32SSE41(const __m128 a, const __m128 b) noexcept
+        {
+            return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+                              _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        // A# * B
+        __IE__TARGET_SSE41 inline __m128 Mat2AdjMulF32SSE41(const __m128 a, const __m128 b) noexcept
+        {
+            return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+                              _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+
+        // A * B#
+        __IE__TARGET_SSE41 inline __m128 Mat2MulAdjF32SSE41(const __m128 a, const __m128 b) noexcept
+        {
+            return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+                              _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        // Returns the determinants of the 2x2 blocks as (|A|, |B|, |C|, |D|)
+        __IE__TARGET_SSE41 inline __m128 Mat4BlockDeterminantsF32SSE41(const __m128 row0, const __m128 row1, const __m128 row2, const __m128 row3) noexcept
+        {
+            return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 1, 3, 1))),
+                              _mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 0, 2, 0))));
+        }
+
+        __IE__TARGET_SSE41 inline void Mat4InverseF32SSE41(__m128& row0, __m128& row1, __m128& row2, __m128& row3) noexcept
+        {
+            const __m128 A = _mm_movelh_ps(row0, row1), B = _mm_movehl_ps(row1, row0);
+            const __m128 C = _mm_movelh_ps(row2, row3), D = _mm_movehl_ps(row3, row2);
+
+            const __m128 detSub = ::IE::Internal::Mat4BlockDeterminantsF32SSE41(row0, row1, row2, row3);
+            const __m128 detA = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(0, 0, 0, 0));
+            const __m128 detB = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(1, 1, 1, 1));
+            const __m128 detC = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(2, 2, 2, 2));
+            const __m128 detD = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+            const __m128 D_C = ::IE::Internal::Mat2AdjMulF32SSE41(D, C);
+            const __m128 A_B = ::IE::Internal::Mat2AdjMulF32SSE41(A, B);
+
+            // The inverse is | X Y | / |M| where X# = |D|A - B(D#C), Y# = |B|C - D(A#B)#,
+            //                | Z W |             Z# = |C|B - A(D#C)#, W# = |A|D - C(A#B)
+            const __m128 X_ = _mm_sub_ps(_mm_mul_ps(detD, A), ::IE::Internal::Mat2MulF32SSE41(B, D_C));
+            const __m128 W_ = _mm_sub_ps(_mm_mul_ps(detA, D), ::IE::Internal::Mat2MulF32SSE41(C, A_B));
+            const __m128 Y_ = _mm_sub_ps(_mm_mul_ps(detB, C), ::IE::Internal::Mat2MulAdjF32SSE41(D, A_B));
+            const __m128 Z_ = _mm_sub_ps(_mm_mul_ps(detC, B), ::IE::Internal::Mat2MulAdjF32SSE41(A, D_C));
+
+            // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+            __m128 trace = _mm_mul_ps(A_B, _mm_shuffle_ps(D_C, D_C, _MM_SHUFFLE(3, 1, 2, 0)));
+            trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(2, 3, 0, 1)));
+            trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 0, 3, 2)));
+
+            const __m128 detM  = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+            const __m128 rDetM = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), detM);
+
+            const __m128 X = _mm_mul_ps(X_, rDetM), Y = _mm_mul_ps(Y_, rDetM);
+            const __m128 Z = _mm_mul_ps(Z_, rDetM), W = _mm_mul_ps(W_, rDetM);
+
+            // Taking the adjugates back & storing the blocks as rows in a single step
+            row0 = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3));
+            row1 = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2));
+            row2 = _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3));
+            row3 = _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2));
+        }
+
+        // "row3" holds the translation and the rows are replaced by the ones of the inverse
+        __IE__TARGET_SSE41 inline void Mat4AffineInverseF32SSE41(__m128& row0, __m128& row1, __m128& row2, __m128& row3) noexcept
+        {
+            const __m128 maskXYZ = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+            const __m128 r0 = _mm_and_ps(row0, maskXYZ), r1 = _mm_and_ps(row1, maskXYZ), r2 = _mm_and_ps(row2, maskXYZ);
+
+            // Transposing the upper 3x3 part, the last row of which is zero
+            const __m128 t01Lo = _mm_unpacklo_ps(r0, r1), t01Hi = _mm_unpackhi_ps(r0, r1);
+            const __m128 t2Lo  = _mm_unpacklo_ps(r2, _mm_setzero_ps()), t2Hi = _mm_unpackhi_ps(r2, _mm_setzero_ps());
+
+            __m128 col0 = _mm_castpd_ps(_mm_unpacklo_pd(_mm_castps_pd(t01Lo), _mm_castps_pd(t2Lo)));
+            __m128 col1 = _mm_castpd_ps(_mm_unpackhi_pd(_mm_castps_pd(t01Lo), _mm_castps_pd(t2Lo)));
+            __m128 col2 = _mm_castpd_ps(_mm_unpacklo_pd(_mm_castps_pd(t01Hi), _mm_castps_pd(t2Hi)));
+
+            // (1 / |row0|², 1 / |row1|², 1 / |row2|², 0)
+            const __m128 lengthsSq  = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, col0), _mm_mul_ps(col1, col1)), _mm_mul_ps(col2, col2));
+            const __m128 rLengthsSq = _mm_and_ps(_mm_div_ps(_mm_set1_ps(1.f), lengthsSq), maskXYZ);
+
+            col0 = _mm_mul_ps(col0, rLengthsSq);
+            col1 = _mm_mul_ps(col1, rLengthsSq);
+            col2 = _mm_mul_ps(col2, rLengthsSq);
+
+            __m128 translation =                        _mm_mul_ps(_mm_shuffle_ps(row3, row3, _MM_SHUFFLE(0, 0, 0, 0)), col0);
+            translation = _mm_add_ps(translation, _mm_mul_ps(_mm_shuffle_ps(row3, row3, _MM_SHUFFLE(1, 1, 1, 1)), col1));
+            translation = _mm_add_ps(translation, _mm_mul_ps(_mm_shuffle_ps(row3, row3, _MM_SHUFFLE(2, 2, 2, 2)), col2));
+
+            row0 = col0;
+            row1 = col1;
+            row2 = col2;
+            row3 = _mm_sub_ps(_mm_setr_ps(0.f, 0.f, 0.f, 1.f), translation);
+        }
+
+        __IE__TARGET_SSE41 inline float MatrixDeterminantF32SSE41(const float* mat) noexcept
+        {
+            const __m128 row0 = _mm_loadu_ps(mat + 0u), row1 = _mm_loadu_ps(mat + 4u);
+            const __m128 row2 = _mm_loadu_ps(mat + 8u), row3 = _mm_loadu_ps(mat + 12u);
+
+            const __m128 A = _mm_movelh_ps(row0, row1), B = _mm_movehl_ps(row1, row0);
+            const __m128 C = _mm_movelh_ps(row2, row3), D = _mm_movehl_ps(row3, row2);
+
+            const __m128 detSub = ::IE::Internal::Mat4BlockDeterminantsF32SSE41(row0, row1, row2, row3);
+            const __m128 D_C    = ::IE::Internal::Mat2AdjMulF32SSE41(D, C);
+            const __m128 A_B    = ::IE::Internal::Mat2AdjMulF32SSE41(A, B);
+
+            // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+            __m128 trace = _mm_mul_ps(A_B, _mm_shuffle_ps(D_C, D_C, _MM_SHUFFLE(3, 1, 2, 0)));
+            trace = _mm_add_ps(trace, _mm_movehl_ps(trace, trace));
+            trace = _mm_add_ss(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 1, 1, 1)));
+
+            const __m128 detAB = _mm_mul_ps(detSub, _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(0, 1, 2, 3))); // (|A||D|, |B||C|, ...)
+
+            return _mm_cvtss_f32(_mm_sub_ss(_mm_add_ss(detAB, _mm_shuffle_ps(detAB, detAB, _MM_SHUFFLE(1, 1, 1, 1))), trace));
+        }
+
+        __IE__TARGET_SSE41 inline void MatrixInverseF32SSE41(const float* in, float* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++) {
+                __m128 row0 = _mm_loadu_ps(in + i * 16u + 0u), row1 = _mm_loadu_ps(in + i * 16u + 4u);
+                __m128 row2 = _mm_loadu_ps(in + i * 16u + 8u), row3 = _mm_loadu_ps(in + i * 16u + 12u);
+
+                ::IE::Internal::Mat4InverseF32SSE41(row0, row1, row2, row3);
+
+                _mm_storeu_ps(out + i * 16u + 0u, row0); _mm_storeu_ps(out + i * 16u + 4u,  row1);
+                _mm_storeu_ps(out + i * 16u + 8u, row2); _mm_storeu_ps(out + i * 16u + 12u, row3);
+            }
+        }
+
+        __IE__TARGET_SSE41 inline void MatrixAffineInverseF32SSE41(const float* in, float* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++) {
+                __m128 row0 = _mm_loadu_ps(in + i * 16u + 0u), row1 = _mm_loadu_ps(in + i * 16u + 4u);
+                __m128 row2 = _mm_loadu_ps(in + i * 16u + 8u), row3 = _mm_loadu_ps(in + i * 16u + 12u);
+
+                ::IE::Internal::Mat4AffineInverseF32SSE41(row0, row1, row2, row3);
+
+                _mm_storeu_ps(out + i * 16u + 0u, row0); _mm_storeu_ps(out + i * 16u + 4u,  row1);
+                _mm_storeu_ps(out + i * 16u + 8u, row2); _mm_storeu_ps(out + i * 16u + 12u, row3);
+            }
+        }
+
+        // Same steps as the SSE4.1 versions, with the matrices "in" & "in + 16" in the low & high lanes
+
+        __IE__TARGET_AVX2 inline __m256 Mat2MulF32AVX2(const __m256 a, const __m256 b) noexcept
+        {
+            return _mm256_fmadd_ps(a, _mm256_permute_ps(b, _MM_SHUFFLE(3, 0, 3, 0)),
+                                   _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1)), _mm256_permute_ps(b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        __IE__TARGET_AVX2 inline __m256 Mat2AdjMulF32AVX2(const __m256 a, const __m256 b) noexcept
+        {
+            return _mm256_fmsub_ps(_mm256_permute_ps(a, _MM_SHUFFLE(0, 0, 3, 3)), b,
+                                   _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(2, 2, 1, 1)), _mm256_permute_ps(b, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+
+        __IE__TARGET_AVX2 inline __m256 Mat2MulAdjF32AVX2(const __m256 a, const __m256 b) noexcept
+        {
+            return _mm256_fmsub_ps(a, _mm256_permute_ps(b, _MM_SHUFFLE(0, 3, 0, 3)),
+                                   _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1)), _mm256_permute_ps(b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        // Loads the rows of two matrices as (row r of "mat" | row r of "mat + 16")
+        __IE__TARGET_AVX2 inline void Mat4x2LoadF32AVX2(const float* mat, __m256& row0, __m256& row1, __m256& row2, __m256& row3) noexcept
+        {
+            const __m256 a01 = _mm256_loadu_ps(mat + 0u),  a23 = _mm256_loadu_ps(mat + 8u);
+            const __m256 b01 = _mm256_loadu_ps(mat + 16u), b23 = _mm256_loadu_ps(mat + 24u);
+
+            row0 = _mm256_permute2f128_ps(a01, b01, 0x20); row1 = _mm256_permute2f128_ps(a01, b01, 0x31);
+            row2 = _mm256_permute2f128_ps(a23, b23, 0x20); row3 = _mm256_permute2f128_ps(a23, b23, 0x31);
+        }
+
+        __IE__TARGET_AVX2 inline void Mat4x2StoreF32AVX2(float* mat, const __m256 row0, const __m256 row1, const __m256 row2, const __m256 row3) noexcept
+        {
+            _mm256_storeu_ps(mat + 0u,  _mm256_permute2f128_ps(row0, row1, 0x20));
+            _mm256_storeu_ps(mat + 8u,  _mm256_permute2f128_ps(row2, row3, 0x20));
+            _mm256_storeu_ps(mat + 16u, _mm256_permute2f128_ps(row0, row1, 0x31));
+            _mm256_storeu_ps(mat + 24u, _mm256_permute2f128_ps(row2, row3, 0x31));
+        }
+
+        __IE__TARGET_AVX2 inline void MatrixInverseF32AVX2(const float* in, float* out, const size_t count) noexcept
+        {
+            size_t i = 0u;
+            for (; i + 2u <= count; i += 2u) {
+                __m256 row0, row1, row2, row3;
+                ::IE::Internal::Mat4x2LoadF32AVX2(in + i * 16u, row0, row1, row2, row3);
+
+                const __m256 A = _mm256_shuffle_ps(row0, row1, _MM_SHUFFLE(1, 0, 1, 0)), B = _mm256_shuffle_ps(row0, row1, _MM_SHUFFLE(3, 2, 3, 2));
+                const __m256 C = _mm256_shuffle_ps(row2, row3, _MM_SHUFFLE(1, 0, 1, 0)), D = _mm256_shuffle_ps(row2, row3, _MM_SHUFFLE(3, 2, 3, 2));
+
+                const __m256 detSub = _mm256_fmsub_ps(_mm256_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm256_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 1, 3, 1)),
+                                                      _mm256_mul_ps(_mm256_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm256_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 0, 2, 0))));
+                const __m256 detA = _mm256_permute_ps(detSub, _MM_SHUFFLE(0, 0, 0, 0));
+                const __m256 detB = _mm256_permute_ps(detSub, _MM_SHUFFLE(1, 1, 1, 1));
+                const __m256 detC = _mm256_permute_ps(detSub, _MM_SHUFFLE(2, 2, 2, 2));
+                const __m256 detD = _mm256_permute_ps(detSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+                const __m256 D_C = ::IE::Internal::Mat2AdjMulF32AVX2(D, C);
+                const __m256 A_B = ::IE::Internal::Mat2AdjMulF32AVX2(A, B);
+
+                const __m256 X_ = _mm256_fmsub_ps(detD, A, ::IE::Internal::Mat2MulF32AVX2(B, D_C));
+                const __m256 W_ = _mm256_fmsub_ps(detA, D, ::IE::Internal::Mat2MulF32AVX2(C, A_B));
+                const __m256 Y_ = _mm256_fmsub_ps(detB, C, ::IE::Internal::Mat2MulAdjF32AVX2(D, A_B));
+                const __m256 Z_ = _mm256_fmsub_ps(detC, B, ::IE::Internal::Mat2MulAdjF32AVX2(A, D_C));
+
+                __m256 trace = _mm256_mul_ps(A_B, _mm256_permute_ps(D_C, _MM_SHUFFLE(3, 1, 2, 0)));
+                trace = _mm256_add_ps(trace, _mm256_permute_ps(trace, _MM_SHUFFLE(2, 3, 0, 1)));
+                trace = _mm256_add_ps(trace, _mm256_permute_ps(trace, _MM_SHUFFLE(1, 0, 3, 2)));
+
+                const __m256 detM  = _mm256_sub_ps(_mm256_fmadd_ps(detA, detD, _mm256_mul_ps(detB, detC)), trace);
+                const __m256 rDetM = _mm256_div_ps(_mm256_setr_ps(1.f, -1.f, -1.f, 1.f, 1.f, -1.f, -1.f, 1.f), detM);
+
+                const __m256 X = _mm256_mul_ps(X_, rDetM), Y = _mm256_mul_ps(Y_, rDetM);
+                const __m256 Z = _mm256_mul_ps(Z_, rDetM), W = _mm256_mul_ps(W_, rDetM);
+
+                ::IE::Internal::Mat4x2StoreF32AVX2(out + i * 16u,
+                    _mm256_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3)), _mm256_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2)),
+                    _mm256_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3)), _mm256_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2)));
+            }
+
+            if (i < count)
+                ::IE::Internal::MatrixInverseF32SSE41(in + i * 16u, out + i * 16u, count - i);
+        }
+
+        __IE__TARGET_AVX2 inline void MatrixAffineInverseF32AVX2(const float* in, float* out, const size_t count) noexcept
+        {
+            const __m256 maskXYZ = _mm256_castsi256_ps(_mm256_setr_epi32(-1, -1, -1, 0, -1, -1, -1, 0));
+
+            size_t i = 0u;
+            for (; i + 2u <= count; i += 2u) {
+                __m256 row0, row1, row2, row3;
+                ::IE::Internal::Mat4x2LoadF32AVX2(in + i * 16u, row0, row1, row2, row3);
+
+                row0 = _mm256_and_ps(row0, maskXYZ); row1 = _mm256_and_ps(row1, maskXYZ); row2 = _mm256_and_ps(row2, maskXYZ);
+
+                const __m256 t01Lo = _mm256_unpacklo_ps(row0, row1), t01Hi = _mm256_unpackhi_ps(row0, row1);
+                const __m256 t2Lo  = _mm256_unpacklo_ps(row2, _mm256_setzero_ps()), t2Hi = _mm256_unpackhi_ps(row2, _mm256_setzero_ps());
+
+                __m256 col0 = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(t01Lo), _mm256_castps_pd(t2Lo)));
+                __m256 col1 = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(t01Lo), _mm256_castps_pd(t2Lo)));
+                __m256 col2 = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(t01Hi), _mm256_castps_pd(t2Hi)));
+
+                const __m256 lengthsSq  = _mm256_fmadd_ps(col2, col2, _mm256_fmadd_ps(col1, col1, _mm256_mul_ps(col0, col0)));
+                const __m256 rLengthsSq = _mm256_and_ps(_mm256_div_ps(_mm256_set1_ps(1.f), lengthsSq), maskXYZ);
+
+                col0 = _mm256_mul_ps(col0, rLengthsSq);
+                col1 = _mm256_mul_ps(col1, rLengthsSq);
+                col2 = _mm256_mul_ps(col2, rLengthsSq);
+
+                __m256 translation = _mm256_mul_ps(_mm256_permute_ps(row3, _MM_SHUFFLE(0, 0, 0, 0)), col0);
+                translation = _mm256_fmadd_ps(_mm256_permute_ps(row3, _MM_SHUFFLE(1, 1, 1, 1)), col1, translation);
+                translation = _mm256_fmadd_ps(_mm256_permute_ps(row3, _MM_SHUFFLE(2, 2, 2, 2)), col2, translation);
+
+                ::IE::Internal::Mat4x2StoreF32AVX2(out + i * 16u, col0, col1, col2,
+                    _mm256_sub_ps(_mm256_setr_ps(0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f), translation));
+            }
+
+            if (i < count)
+                ::IE::Internal::MatrixAffineInverseF32SSE41(in + i * 16u, out + i * 16u, count - i);
+        }
+
+        // Same steps again with 4 matrices per 512 bit register
+
+        __IE__TARGET_AVX512 inline __m512 Mat2MulF32AVX512(const __m512 a, const __m512 b) noexcept
+        {
+            return _mm512_fmadd_ps(a, _mm512_permute_ps(b, _MM_SHUFFLE(3, 0, 3, 0)),
+                                   _mm512_mul_ps(_mm512_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1)), _mm512_permute_ps(b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        __IE__TARGET_AVX512 inline __m512 Mat2AdjMulF32AVX512(const __m512 a, const __m512 b) noexcept
+        {
+            return _mm512_fmsub_ps(_mm512_permute_ps(a, _MM_SHUFFLE(0, 0, 3, 3)), b,
+                                   _mm512_mul_ps(_mm512_permute_ps(a, _MM_SHUFFLE(2, 2, 1, 1)), _mm512_permute_ps(b, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+
+        __IE__TARGET_AVX512 inline __m512 Mat2MulAdjF32AVX512(const __m512 a, const __m512 b) noexcept
+        {
+            return _mm512_fmsub_ps(a, _mm512_permute_ps(b, _MM_SHUFFLE(0, 3, 0, 3)),
+                                   _mm512_mul_ps(_mm512_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1)), _mm512_permute_ps(b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        // Transposes the 4x4 grid of 128 bit lanes, which turns 4 matrices into their 4 rows & back
+        __IE__TARGET_AVX512 inline void Mat4x4TransposeLanesF32AVX512(__m512& a, __m512& b, __m512& c, __m512& d) noexcept
+        {
+            const __m512 t0 = _mm512_shuffle_f32x4(a, b, _MM_SHUFFLE(1, 0, 1, 0)), t1 = _mm512_shuffle_f32x4(c, d, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m512 t2 = _mm512_shuffle_f32x4(a, b, _MM_SHUFFLE(3, 2, 3, 2)), t3 = _mm512_shuffle_f32x4(c, d, _MM_SHUFFLE(3, 2, 3, 2));
+
+            a = _mm512_shuffle_f32x4(t0, t1, _MM_SHUFFLE(2, 0, 2, 0)); b = _mm512_shuffle_f32x4(t0, t1, _MM_SHUFFLE(3, 1, 3, 1));
+            c = _mm512_shuffle_f32x4(t2, t3, _MM_SHUFFLE(2, 0, 2, 0)); d = _mm512_shuffle_f32x4(t2, t3, _MM_SHUFFLE(3, 1, 3, 1));
+        }
+
+        __IE__TARGET_AVX512 inline void MatrixInverseF32AVX512(const float* in, float* out, const size_t count) noexcept
+        {
+            const __m512 adjSigns = _mm512_broadcast_f32x4(_mm_setr_ps(1.f, -1.f, -1.f, 1.f));
+
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u) {
+                __m512 row0 = _mm512_loadu_ps(in + i * 16u + 0u),  row1 = _mm512_loadu_ps(in + i * 16u + 16u);
+                __m512 row2 = _mm512_loadu_ps(in + i * 16u + 32u), row3 = _mm512_loadu_ps(in + i * 16u + 48u);
+                ::IE::Internal::Mat4x4TransposeLanesF32AVX512(row0, row1, row2, row3);
+
+                const __m512 A = _mm512_shuffle_ps(row0, row1, _MM_SHUFFLE(1, 0, 1, 0)), B = _mm512_shuffle_ps(row0, row1, _MM_SHUFFLE(3, 2, 3, 2));
+                const __m512 C = _mm512_shuffle_ps(row2, row3, _MM_SHUFFLE(1, 0, 1, 0)), D = _mm512_shuffle_ps(row2, row3, _MM_SHUFFLE(3, 2, 3, 2));
+
+                const __m512 detSub = _mm512_fmsub_ps(_mm512_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm512_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 1, 3, 1)),
+                                                      _mm512_mul_ps(_mm512_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm512_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 0, 2, 0))));
+                const __m512 detA = _mm512_permute_ps(detSub, _MM_SHUFFLE(0, 0, 0, 0));
+                const __m512 detB = _mm512_permute_ps(detSub, _MM_SHUFFLE(1, 1, 1, 1));
+                const __m512 detC = _mm512_permute_ps(detSub, _MM_SHUFFLE(2, 2, 2, 2));
+                const __m512 detD = _mm512_permute_ps(detSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+                const __m512 D_C = ::IE::Internal::Mat2AdjMulF32AVX512(D, C);
+                const __m512 A_B = ::IE::Internal::Mat2AdjMulF32AVX512(A, B);
+
+                const __m512 X_ = _mm512_fmsub_ps(detD, A, ::IE::Internal::Mat2MulF32AVX512(B, D_C));
+                const __m512 W_ = _mm512_fmsub_ps(detA, D, ::IE::Internal::Mat2MulF32AVX512(C, A_B));
+                const __m512 Y_ = _mm512_fmsub_ps(detB, C, ::IE::Internal::Mat2MulAdjF32AVX512(D, A_B));
+                const __m512 Z_ = _mm512_fmsub_ps(detC, B, ::IE::Internal::Mat2MulAdjF32AVX512(A, D_C));
+
+                __m512 trace = _mm512_mul_ps(A_B, _mm512_permute_ps(D_C, _MM_SHUFFLE(3, 1, 2, 0)));
+                trace = _mm512_add_ps(trace, _mm512_permute_ps(trace, _MM_SHUFFLE(2, 3, 0, 1)));
+                trace = _mm512_add_ps(trace, _mm512_permute_ps(trace, _MM_SHUFFLE(1, 0, 3, 2)));
+
+                const __m512 detM  = _mm512_sub_ps(_mm512_fmadd_ps(detA, detD, _mm512_mul_ps(detB, detC)), trace);
+                const __m512 rDetM = _mm512_div_ps(adjSigns, detM);
+
+                const __m512 X = _mm512_mul_ps(X_, rDetM), Y = _mm512_mul_ps(Y_, rDetM);
+                const __m512 Z = _mm512_mul_ps(Z_, rDetM), W = _mm512_mul_ps(W_, rDetM);
+
+                row0 = _mm512_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3)); row1 = _mm512_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2));
+                row2 = _mm512_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3)); row3 = _mm512_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2));
+                ::IE::Internal::Mat4x4TransposeLanesF32AVX512(row0, row1, row2, row3);
+
+                _mm512_storeu_ps(out + i * 16u + 0u,  row0); _mm512_storeu_ps(out + i * 16u + 16u, row1);
+                _mm512_storeu_ps(out + i * 16u + 32u, row2); _mm512_storeu_ps(out + i * 16u + 48u, row3);
+            }
+
+            if (i < count)
+                ::IE::Internal::MatrixInverseF32AVX2(in + i * 16u, out + i * 16u, count - i);
+        }
+
+        __IE__TARGET_AVX512 inline void MatrixAffineInverseF32AVX512(const float* in, float* out, const size_t count) noexcept
+        {
+            const __m512 identityRow3 = _mm512_broadcast_f32x4(_mm_setr_ps(0.f, 0.f, 0.f, 1.f));
+            const __mmask16 maskXYZ   = 0x7777;
+
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u) {
+                __m512 row0 = _mm512_loadu_ps(in + i * 16u + 0u),  row1 = _mm512_loadu_ps(in + i * 16u + 16u);
+                __m512 row2 = _mm512_loadu_ps(in + i * 16u + 32u), row3 = _mm512_loadu_ps(in + i * 16u + 48u);
+                ::IE::Internal::Mat4x4TransposeLanesF32AVX512(row0, row1, row2, row3);
+
+                row0 = _mm512_maskz_mov_ps(maskXYZ, row0); row1 = _mm512_maskz_mov_ps(maskXYZ, row1); row2 = _mm512_maskz_mov_ps(maskXYZ, row2);
+
+                const __m512 t01Lo = _mm512_unpacklo_ps(row0, row1), t01Hi = _mm512_unpackhi_ps(row0, row1);
+                const __m512 t2Lo  = _mm512_unpacklo_ps(row2, _mm512_setzero_ps()), t2Hi = _mm512_unpackhi_ps(row2, _mm512_setzero_ps());
+
+                __m512 col0 = _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(t01Lo), _mm512_castps_pd(t2Lo)));
+                __m512 col1 = _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(t01Lo), _mm512_castps_pd(t2Lo)));
+                __m512 col2 = _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(t01Hi), _mm512_castps_pd(t2Hi)));
+
+                const __m512 lengthsSq  = _mm512_fmadd_ps(col2, col2, _mm512_fmadd_ps(col1, col1, _mm512_mul_ps(col0, col0)));
+                const __m512 rLengthsSq = _mm512_maskz_div_ps(maskXYZ, _mm512_set1_ps(1.f), lengthsSq);
+
+                col0 = _mm512_mul_ps(col0, rLengthsSq);
+                col1 = _mm512_mul_ps(col1, rLengthsSq);
+                col2 = _mm512_mul_ps(col2, rLengthsSq);
+
+                __m512 translation = _mm512_mul_ps(_mm512_permute_ps(row3, _MM_SHUFFLE(0, 0, 0, 0)), col0);
+                translation = _mm512_fmadd_ps(_mm512_permute_ps(row3, _MM_SHUFFLE(1, 1, 1, 1)), col1, translation);
+                translation = _mm512_fmadd_ps(_mm512_permute_ps(row3, _MM_SHUFFLE(2, 2, 2, 2)), col2, translation);
+
+                row3 = _mm512_sub_ps(identityRow3, translation);
+                ::IE::Internal::Mat4x4TransposeLanesF32AVX512(col0, col1, col2, row3);
+
+                _mm512_storeu_ps(out + i * 16u + 0u,  col0); _mm512_storeu_ps(out + i * 16u + 16u, col1);
+                _mm512_storeu_ps(out + i * 16u + 32u, col2); _mm512_storeu_ps(out + i * 16u + 48u, row3);
+            }
+
+            if (i < count)
+                ::IE::Internal::MatrixAffineInverseF32AVX2(in + i * 16u, out + i * 16u, count - i);
+        }
+
+#endif // #ifdef __IE__ENABLE_SIMD
+
+    } // Internal
+
+    // +--------------+     +--------------+     +--------------+
+    // | Math Library | --> | Matrix (4x4) | --> | Operators: * |
+    // +--------------+     +--------------+     +--------------+
+
+	template <::IE::arithmetic _T, ::IE::arithmetic _T_2>
+	inline auto operator*(const ::IE::Matrix<_T>& matA, const ::IE::Matrix<_T_2>& matB) noexcept
+		-> ::IE::Matrix<decltype(matA[0] + matB[0])>
+	{
+		::IE::Matrix<decltype(matA[0] + matB[0])> matResult;
+
+		if constexpr (std::is_same_v<_T, float> && std::is_same_v<_T_2, float>) {
+			::IE::Internal::GetSIMDKernels().m_pMatrixMultiplyF32(&matA[0], &matB[0], &matResult[0]);
+		} else {
+			// Every row of the result is a sum of the rows of "matB" scaled by the components of a row of "matA"
+			for (size_t r = 0u; r < 4u; r++) {
+				matResult.SetRow(r, matB.GetRow(0u) * matA(r, 0u) + matB.GetRow(1u) * matA(r, 1u)
+				                  + matB.GetRow(2u) * matA(r, 2u) + matB.GetRow(3u) * matA(r, 3u));
+			}
+		}
+
+		return matResult;
+	}
+
+    /*
+	 * Multiplies a 1x4 vector with a 4x4 matrix like shown below :
+								    |----------------------------------------|
+								    | _T_2 m00; _T_2 m01; _T_2 m02; _T_2 m03 |
+								    | _T_2 m10; _T_2 m11; _T_2 m12; _T_2 m13 |
+	   |------------------------|   | _T_2 m20; _T_2 m21; _T_2 m22; _T_2 m23 |   |----------------------------|
+	   | _T x; _T y; _T z; _T w | * | _T_2 m30; _T_2 m31; _T_2 m32; _T_2 m33 | = | decltype(x+m00) x, y, z, w |
+	   |------------------------|   |----------------------------------------|   |----------------------------|
+	 */
+
+	template <::IE::arithmetic _T, ::IE::arithmetic _T_2>
+	inline auto operator*(const ::IE::Vector<_T>& vec, const ::IE::Matrix<_T_2>& mat) noexcept
+		-> ::IE::Vector<decltype(vec.x + mat[0])>
+	{
+		if constexpr (std::is_same_v<_T, float> && std::is_same_v<_T_2, float>) {
+			::IE::Vector<float> result;
+			::IE::Internal::GetSIMDKernels().m_pVectorMatrixMultiplyF32(&vec.x, &mat[0], &result.x);
+
+			return result;
+		} else {
+			return mat.GetRow(0u) * vec.x + mat.GetRow(1u) * vec.y + mat.GetRow(2u) * vec.z + mat.GetRow(3u) * vec.w;
+		}
+	}
+
+    // +--------------+     +--------------+     +----------+
+    // | Math Library | --> | Matrix (4x4) | --> | Printing |
+    // +--------------+     +--------------+     +----------+
+
+	template <::IE::arithmetic _T>
+	inline std::ostream& operator<<(std::ostream& stream, const ::IE::Matrix<_T>& mat) noexcept
+	{
+		constexpr const size_t MAX_DIGITS = 5u;
+
+		stream << std::setprecision(MAX_DIGITS) << '|';
+
+		for (size_t i = 0u; i < 4u * ((MAX_DIGITS + 1u) + 1u) + 1u; i++)
+			stream << '-';
+
+		stream << "|\n";
+		for (size_t r = 0u; r < 4u; r++) {
+			stream << "| ";
+
+			for (size_t c = 0u; c < 4u; c++)
+				stream << std::setw(MAX_DIGITS + 1u) << mat(r, c) << ' ';
+
+			stream << "|\n";
+		}
+
+		stream << '|';
+
+		for (size_t i = 0u; i < 4u * ((MAX_DIGITS + 1u) + 1u) + 1u; i++)
+			stream << '-';
+
+		stream << "|\n";
+
+		return stream;
+	}
+
+    // +--------------+     +--------------+     +-----------------+
+    // | Math Library | --> | Matrix (4x4) | --> | Useful Typedefs |
+    // +--------------+     +--------------+     +-----------------+
+
+	typedef ::IE::Matrix<std::enable_if_t<std::numeric_limits<float>::is_iec559, float>> Matf32;
+
+    // +--------------+     +--------------+     +--------------------+
+    // | Math Library | --> | Matrix (4x4) | --> | Batched Operations |
+    // +--------------+     +--------------+     +--------------------+
+
+    /* The batched transform kernels keep the 4 rows of the matrix in registers and transform 1 (SSE),  */
+    /* 2 (AVX2) or 4 (AVX-512) vectors per register. When the output is too large to stay in the cache, */
+    /* non-temporal stores are used so that the destination isn't read from memory before being written. */
+
+    namespace Internal {
+
+        // Outputs larger than this (in bytes) are written with non-temporal stores
+        constexpr const size_t TRANSFORM_BATCH_STREAMING_THRESHOLD = 4u << 20u;
+
+        inline void TransformBatchF32Scalar(const float* mat, const float* in, float* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++)
+                ::IE::Internal::VectorMatrixMultiplyF32Scalar(in + i * 4u, mat, out + i * 4u);
+        }
+
+#ifdef __IE__ENABLE_SIMD
+
+        template <bool _STREAM>
+        __IE__TARGET_SSE41 inline void TransformBatchF32SSE41Loop(const float* mat, const float* in, float* out, const size_t count) noexcept
+        {
+            const __m128 row0 = _mm_loadu_ps(mat + 0u), row1 = _mm_loadu_ps(mat + 4u);
+            const __m128 row2 = _mm_loadu_ps(mat + 8u), row3 = _mm_loadu_ps(mat + 12u);
+
+            for (size_t i = 0u; i < count; i++) {
+                const __m128 v = _mm_loadu_ps(in + i * 4u);
+
+                __m128 result =                   _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), row1));
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), row2));
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)), row3));
+
+                if constexpr (_STREAM)
+                    _mm_stream_ps(out + i * 4u, result);
+                else
+                    _mm_storeu_ps(out + i * 4u, result);
+            }
+        }
+
+        __IE__TARGET_SSE41 inline void TransformBatchF32SSE41(const float* mat, const float* in, float* out, const size_t count) noexcept
+        {
+            // "movntps" requires 16 byte aligned addresses
+            if (count * 16u >= TRANSFORM_BATCH_STREAMING_THRESHOLD && (reinterpret_cast<std::uintptr_t>(out) & 15u) == 0u) {
+                ::IE::Internal::TransformBatchF32SSE41Loop<true>(mat, in, out, count);
+                _mm_sfence();
+            } else {
+                ::IE::Internal::TransformBatchF32SSE41Loop<false>(mat, in, out, count);
+            }
+        }
+
+        template <bool _STREAM>
+        __IE__TARGET_AVX2 inline void TransformBatchF32AVX2Loop(const float* mat, const float* in, float* out, const size_t count) noexcept
+        {
+            const __m256 row0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(mat + 0u));
+            const __m256 row1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(mat + 4u));
+            const __m256 row2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(mat + 8u));
+            const __m256 row3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(mat + 12u));
+
+            // 4 vectors per iteration, 2 per register
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u) {
+                const __m256 v01 = _mm256_loadu_ps(in + i * 4u);
+                const __m256 v23 = _mm256_loadu_ps(in + i * 4u + 8u);
+
+                __m256 result01 = _mm256_mul_ps(_mm256_permute_ps(v01, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+                __m256 result23 = _mm256_mul_ps(_mm256_permute_ps(v23, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+                result01 = _mm256_fmadd_ps(_mm256_permute_ps(v01, _MM_SHUFFLE(1, 1, 1, 1)), row1, result01);
+                result23 = _mm256_fmadd_ps(_mm256_permute_ps(v23, _MM_SHUFFLE(1, 1, 1, 1)), row1, result23);
+                result01 = _mm256_fmadd_ps(_mm256_permute_ps(v01, _MM_SHUFFLE(2, 2, 2, 2)), row2, result01);
+                result23 = _mm256_fmadd_ps(_mm256_permute_ps(v23, _MM_SHUFFLE(2, 2, 2, 2)), row2, result23);
+                result01 = _mm256_fmadd_ps(_mm256_permute_ps(v01, _MM_SHUFFLE(3, 3, 3, 3)), row3, result01);
+                result23 = _mm256_fmadd_ps(_mm256_permute_ps(v23, _MM_SHUFFLE(3, 3, 3, 3)), row3, result23);
+
+                if constexpr (_STREAM) {
+                    _mm256_stream_ps(out + i * 4u,      result01);
+                    _mm256_stream_ps(out + i * 4u + 8u, result23);
+                } else {
+                    _mm256_storeu_ps(out + i * 4u,      result01);
+                    _mm256_storeu_ps(out + i * 4u + 8u, result23);
+                }
+            }
+
+            for (; i < count; i++)
+                ::IE::Internal::VectorMatrixMultiplyF32AVX2(in + i * 4u, mat, out + i * 4u);
+        }
+
+        __IE__TARGET_AVX2 inline void TransformBatchF32AVX2(const float* mat, const float* in, float* out, const size_t count) noexcept
+        {
+            if (count * 16u < TRANSFORM_BATCH_STREAMING_THRESHOLD || (reinterpret_cast<std::uintptr_t>(out) & 15u) != 0u)
+                return ::IE::Internal::TransformBatchF32AVX2Loop<false>(mat, in, out, count);
+
+            // Transform vectors one by one until the output is 32 byte aligned for "vmovntps"
+            size_t i = 0u;
+            for (; (reinterpret_cast<std::uintptr_t>(out + i * 4u) & 31u) != 0u; i++)
+                ::IE::Internal::VectorMatrixMultiplyF32AVX2(in + i * 4u, mat, out + i * 4u);
+
+            ::IE::Internal::TransformBatchF32AVX2Loop<true>(mat, in + i * 4u, out + i * 4u, count - i);
+            _mm_sfence();
+        }
+
+        template <bool _STREAM>
+        __IE__TARGET_AVX512 inline void TransformBatchF32AVX512Loop(const float* mat, const float* in, float* out, const size_t count) noexcept
+        {
+            const __m512 row0 = _mm512_broadcast_f32x4(_mm_loadu_ps(mat + 0u));
+            const __m512 row1 = _mm512_broadcast_f32x4(_mm_loadu_ps(mat + 4u));
+            const __m512 row2 = _mm512_broadcast_f32x4(_mm_loadu_ps(mat + 8u));
+            const __m512 row3 = _mm512_broadcast_f32x4(_mm_loadu_ps(mat + 12u));
+
+            // 8 vectors per iteration, 4 per register
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m512 vA = _mm512_loadu_ps(in + i * 4u);
+                const __m512 vB = _mm512_loadu_ps(in + i * 4u + 16u);
+
+                __m512 resultA = _mm512_mul_ps(_mm512_permute_ps(vA, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+                __m512 resultB = _mm512_mul_ps(_mm512_permute_ps(vB, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+                resultA = _mm512_fmadd_ps(_mm512_permute_ps(vA, _MM_SHUFFLE(1, 1, 1, 1)), row1, resultA);
+                resultB = _mm512_fmadd_ps(_mm512_permute_ps(vB, _MM_SHUFFLE(1, 1, 1, 1)), row1, resultB);
+                resultA = _mm512_fmadd_ps(_mm512_permute_ps(vA, _MM_SHUFFLE(2, 2, 2, 2)), row2, resultA);
+                resultB = _mm512_fmadd_ps(_mm512_permute_ps(vB, _MM_SHUFFLE(2, 2, 2, 2)), row2, resultB);
+                resultA = _mm512_fmadd_ps(_mm512_permute_ps(vA, _MM_SHUFFLE(3, 3, 3, 3)), row3, resultA);
+                resultB = _mm512_fmadd_ps(_mm512_permute_ps(vB, _MM_SHUFFLE(3, 3, 3, 3)), row3, resultB);
+
+                if constexpr (_STREAM) {
+                    _mm512_stream_ps(out + i * 4u,       resultA);
+                    _mm512_stream_ps(out + i * 4u + 16u, resultB);
+                } else {
+                    _mm512_storeu_ps(out + i * 4u,       resultA);
+                    _mm512_storeu_ps(out + i * 4u + 16u, resultB);
+                }
+            }
+
+            for (; i < count; i++)
+                ::IE::Internal::VectorMatrixMultiplyF32AVX2(in + i * 4u, mat, out + i * 4u);
+        }
+
+        __IE__TARGET_AVX512 inline void TransformBatchF32AVX512(const float* mat, const float* in, float* out, const size_t count) noexcept
+        {
+            if (count * 16u < TRANSFORM_BATCH_STREAMING_THRESHOLD || (reinterpret_cast<std::uintptr_t>(out) & 15u) != 0u)
+                return ::IE::Internal::TransformBatchF32AVX512Loop<false>(mat, in, out, count);
+
+            // Transform vectors one by one until the output is 64 byte aligned for "vmovntps"
+            size_t i = 0u;
+            for (; (reinterpret_cast<std::uintptr_t>(out + i * 4u) & 63u) != 0u; i++)
+                ::IE::Internal::VectorMatrixMultiplyF32AVX2(in + i * 4u, mat, out + i * 4u);
+
+            ::IE::Internal::TransformBatchF32AVX512Loop<true>(mat, in + i * 4u, out + i * 4u, count - i);
+            _mm_sfence();
+        }
+
+#endif // #ifdef __IE__ENABLE_SIMD
+
+    } // Internal
+
+    /* Computes "out[i] = in[i] * mat" for every vector of "in". Both spans must have the same size */
+    /* and may be the same memory.                                                                   */
+    inline void TransformBatch(const ::IE::Matf32& mat, const std::span<const ::IE::Vecf32> in, const std::span<::IE::Vecf32> out) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::GetSIMDKernels().m_pTransformBatchF32(&mat[0], reinterpret_cast<const float*>(in.data()),
+                                                               reinterpret_cast<float*>(out.data()), in.size());
+    }
+
+    // Inverts every matrix of "in" into "out" (see "Matrix<_T>::MakeInverse"). The spans may be the same memory
+    inline void InverseBatch(const std::span<const ::IE::Matf32> in, const std::span<::IE::Matf32> out) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::GetSIMDKernels().m_pMatrixInverseF32(reinterpret_cast<const float*>(in.data()),
+                                                                 reinterpret_cast<float*>(out.data()), in.size());
+    }
+
+    // Same as "InverseBatch" for affine matrices (see "Matrix<_T>::MakeAffineInverse")
+    inline void AffineInverseBatch(const std::span<const ::IE::Matf32> in, const std::span<::IE::Matf32> out) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::GetSIMDKernels().m_pMatrixAffineInverseF32(reinterpret_cast<const float*>(in.data()),
+                                                                       reinterpret_cast<float*>(out.data()), in.size());
+    }
+
+    // +--------------+     +----------------------+
+    // | Math Library | --> | Expression Templates |
+    // +--------------+     +----------------------+
+
+    /* "IE::Lazy" wraps a vector or a matrix in an expression that records the arithmetic applied to it instead of     */
+    /* computing it. The whole chain is evaluated at once when it is converted back to a "Vector" or "Matrix" (or with */
+    /* "IE::Evaluate"), so the intermediate results never leave the registers and "a * b + c" / "a * b - c" are fused  */
+    /* into multiply-adds (single rounding FMAs when "__IE__ENABLE_FMA" is defined, so the last bit may differ from    */
+    /* the eager operators). Keeping the expression in an "auto" variable keeps it unevaluated.                         */
+    /*                                                                                                                  */
+    /* Scalars are copied into the expression but vectors & matrices are referenced (copies of the unions would stay on */
+    /* the stack), so an expression must not outlive its operands. All of them must share the expression's type.       */
+
+    namespace Internal {
+
+        enum class ExpressionOperation { ADD, SUB, MUL, DIV };
+
+        // Whether the 4 components of "Vector<_T>" are exactly the lanes of its register (float, int32_t & double)
+        template <::IE::arithmetic _T>
+        constexpr const bool HAS_4_LANES_REGISTER = ::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T>()
+                                                 && sizeof(::IE::Internal::SIMDVectorRegister<_T>) == sizeof(_T) * 4u;
+
+        template <::IE::Internal::ExpressionOperation _OPERATION, ::IE::arithmetic _T>
+        inline ::IE::Vector<_T> ApplyExpressionOperation(const ::IE::Vector<_T>& a, const ::IE::Vector<_T>& b) noexcept
+        {
+            if constexpr (_OPERATION == ::IE::Internal::ExpressionOperation::ADD)
+                return ::IE::Vector<_T>(a + b);
+            else if constexpr (_OPERATION == ::IE::Internal::ExpressionOperation::SUB)
+                return ::IE::Vector<_T>(a - b);
+            else if constexpr (_OPERATION == ::IE::Internal::ExpressionOperation::MUL)
+                return ::IE::Vector<_T>(a * b);
+            else
+                return ::IE::Vector<_T>(a / b);
+        }
+
+        // +--------------+     +----------------------+     +------------------+
+        // | Math Library | --> | Expression Templates | --> | Fused Multiplies |
+        // +--------------+     +----------------------+     +------------------+
+
+        // a * b + c
+        template <::IE::arithmetic _T>
+        inline ::IE::Vector<_T> VectorMulAdd(const ::IE::Vector<_T>& a, const ::IE::Vector<_T>& b, const ::IE::Vector<_T>& c) noexcept
+        {
+            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T>()) {
+#ifdef __IE__ENABLE_SIMD
+                return ::IE::Vector<_T>(::IE::Internal::SIMDMulAdd<_T>(a.m_simdRegister, b.m_simdRegister, c.m_simdRegister));
+#endif // #ifdef __IE__ENABLE_SIMD
+            } else {
+                return ::IE::Vector<_T>(a * b + c);
+            }
+        }
+
+        // a * b - c
+        template <::IE::arithmetic _T>
+        inline ::IE::Vector<_T> VectorMulSub(const ::IE::Vector<_T>& a, const ::IE::Vector<_T>& b, const ::IE::Vector<_T>& c) noexcept
+        {
+            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T>()) {
+#ifdef __IE__ENABLE_SIMD
+                return ::IE::Vector<_T>(::IE::Internal::SIMDMulSub<_T>(a.m_simdRegister, b.m_simdRegister, c.m_simdRegister));
+#endif // #ifdef __IE__ENABLE_SIMD
+            } else {
+                return ::IE::Vector<_T>(a * b - c);
+            }
+        }
+
+        // c - a * b
+        template <::IE::arithmetic _T>
+        inline ::IE::Vector<_T> VectorNegMulAdd(const ::IE::Vector<_T>& a, const ::IE::Vector<_T>& b, const ::IE::Vector<_T>& c) noexcept
+        {
+            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T>()) {
+#ifdef __IE__ENABLE_SIMD
+                return ::IE::Vector<_T>(::IE::Internal::SIMDNegMulAdd<_T>(a.m_simdRegister, b.m_simdRegister, c.m_simdRegister));
+#endif // #ifdef __IE__ENABLE_SIMD
+            } else {
+                return ::IE::Vector<_T>(c - a * b);
+            }
+        }
+
+        // "row * mat" as a sum of the rows of "mat" scaled by the broadcasted components of "row"
+        template <::IE::arithmetic _T>
+        inline ::IE::Vector<_T> MultiplyRowByMatrix(const ::IE::Vector<_T>& row, const ::IE::Matrix<_T>& mat) noexcept
+        {
+            if constexpr (::IE::Internal::HAS_4_LANES_REGISTER<_T>) {
+#ifdef __IE__ENABLE_SIMD
+                using _VECTOR_REGISTER_TYPE = ::IE::Internal::SIMDVectorRegister<_T>;
+
+                const _VECTOR_REGISTER_TYPE& v = row.m_simdRegister;
+
+                // Two independent chains so that the multiply-adds of "xy" & "zw" overlap
+                const _VECTOR_REGISTER_TYPE xy = ::IE::Internal::SIMDMulAdd<_T>(::IE::Internal::SIMDBroadcastElement<_T, 1>(v), mat.GetRow(1u).m_simdRegister,
+                                                 ::IE::Internal::SIMDMul<_T>(::IE::Internal::SIMDBroadcastElement<_T, 0>(v), mat.GetRow(0u).m_simdRegister));
+                const _VECTOR_REGISTER_TYPE zw = ::IE::Internal::SIMDMulAdd<_T>(::IE::Internal::SIMDBroadcastElement<_T, 3>(v), mat.GetRow(3u).m_simdRegister,
+                                                 ::IE::Internal::SIMDMul<_T>(::IE::Internal::SIMDBroadcastElement<_T, 2>(v), mat.GetRow(2u).m_simdRegister));
+
+                return ::IE::Vector<_T>(::IE::Internal::SIMDAdd<_T>(xy, zw));
+#endif // #ifdef __IE__ENABLE_SIMD
+            } else {
+                return ::IE::Vector<_T>(mat.GetRow(0u) * row.x + mat.GetRow(1u) * row.y + mat.GetRow(2u) * row.z + mat.GetRow(3u) * row.w);
+            }
+        }
+
+        // +--------------+     +----------------------+     +--------------------+
+        // | Math Library | --> | Expression Templates | --> | Vector Expressions |
+        // +--------------+     +----------------------+     +--------------------+
+
+        // Base of every vector expression, "_DERIVED" implements "Evaluate()"
+        template <typename _DERIVED, ::IE::arithmetic _T>
+        struct VectorExpression {
+            using ValueType = _T;
+
+            inline const _DERIVED& GetDerived() const noexcept { return static_cast<const _DERIVED&>(*this); }
+
+            inline operator ::IE::Vector<_T>() const noexcept { return this->GetDerived().Evaluate(); }
+        };
+
+        template <typename _T>
+        concept vector_expression = requires { typename _T::ValueType; }
+                                 && std::is_base_of_v<::IE::Internal::VectorExpression<_T, typename _T::ValueType>, _T>;
+
+        template <typename _T>
+        constexpr const bool IS_VECTOR = false;
+
+        template <::IE::arithmetic _T>
+        constexpr const bool IS_VECTOR<::IE::Vector<_T>> = true;
+
+        // What can appear on either side of the "+, -, *, /" operators of the vector expressions
+        template <typename _T>
+        concept vector_operand = ::IE::Internal::vector_expression<_T> || ::IE::Internal::IS_VECTOR<_T> || ::IE::arithmetic<_T>;
+
+        template <::IE::arithmetic _T>
+        struct VectorTerminal : ::IE::Internal::VectorExpression<::IE::Internal::VectorTerminal<_T>, _T> {
+            const ::IE::Vector<_T>* m_pValue;
+
+            inline VectorTerminal(const ::IE::Vector<_T>& value) noexcept : m_pValue(&value) {  }
+
+            inline ::IE::Vector<_T> Evaluate() const noexcept { return *this->m_pValue; }
+        };
+
+        // A scalar operand, broadcasted to the 4 components
+        template <::IE::arithmetic _T>
+        struct ScalarTerminal : ::IE::Internal::VectorExpression<::IE::Internal::ScalarTerminal<_T>, _T> {
+            _T m_value;
+
+            inline ScalarTerminal(const _T value) noexcept : m_value(value) {  }
+
+            inline ::IE::Vector<_T> Evaluate() const noexcept { return ::IE::Vector<_T>(this->m_value, this->m_value, this->m_value, this->m_value); }
+        };
+
+        template <::IE::Internal::ExpressionOperation _OPERATION, typename _LEFT, typename _RIGHT>
+        struct VectorBinaryExpression;
+
+        // Whether "_T" is the product of two vector expressions (and can be fused in a multiply-add)
+        template <typename _T>
+        constexpr const bool IS_VECTOR_PRODUCT = false;
+
+        template <typename _LEFT, typename _RIGHT>
+        constexpr const bool IS_VECTOR_PRODUCT<::IE::Internal::VectorBinaryExpression<::IE::Internal::ExpressionOperation::MUL, _LEFT, _RIGHT>> = true;
+
+        template <::IE::Internal::ExpressionOperation _OPERATION, typename _LEFT, typename _RIGHT>
+        struct VectorBinaryExpression : ::IE::Internal::VectorExpression<::IE::Internal::VectorBinaryExpression<_OPERATION, _LEFT, _RIGHT>,
+                                                                         typename _LEFT::ValueType> {
+            using _T = typename _LEFT::ValueType;
+
+            static_assert(std::is_same_v<_T, typename _RIGHT::ValueType>, "The operands of a vector expression must have the same component type.");
+
+            _LEFT  m_left;
+            _RIGHT m_right;
+
+            inline VectorBinaryExpression(const _LEFT& left, const _RIGHT& right) noexcept : m_left(left), m_right(right) {  }
+
+            inline ::IE::Vector<_T> Evaluate() const noexcept
+            {
+                using enum ::IE::Internal::ExpressionOperation;
+
+                if constexpr (_OPERATION == ADD && ::IE::Internal::IS_VECTOR_PRODUCT<_LEFT>) {
+                    return ::IE::Internal::VectorMulAdd<_T>(this->m_left.m_left.Evaluate(), this->m_left.m_right.Evaluate(), this->m_right.Evaluate());
+                } else if constexpr (_OPERATION == ADD && ::IE::Internal::IS_VECTOR_PRODUCT<_RIGHT>) {
+                    return ::IE::Internal::VectorMulAdd<_T>(this->m_right.m_left.Evaluate(), this->m_right.m_right.Evaluate(), this->m_left.Evaluate());
+                } else if constexpr (_OPERATION == SUB && ::IE::Internal::IS_VECTOR_PRODUCT<_LEFT>) {
+                    return ::IE::Internal::VectorMulSub<_T>(this->m_left.m_left.Evaluate(), this->m_left.m_right.Evaluate(), this->m_right.Evaluate());
+                } else if constexpr (_OPERATION == SUB && ::IE::Internal::IS_VECTOR_PRODUCT<_RIGHT>) {
+                    return ::IE::Internal::VectorNegMulAdd<_T>(this->m_right.m_left.Evaluate(), this->m_right.m_right.Evaluate(), this->m_left.Evaluate());
+                } else {
+                    return ::IE::Internal::ApplyExpressionOperation<_OPERATION, _T>(this->m_left.Evaluate(), this->m_right.Evaluate());
+                }
+            }
+        };
+
+        // Wraps a vector or a scalar in a terminal of type "_T" (expressions are returned as is)
+        template <::IE::arithmetic _T, ::IE::Internal::vector_operand _OPERAND>
+        inline auto MakeVectorOperand(const _OPERAND& operand) noexcept
+        {
+            if constexpr (::IE::Internal::vector_expression<_OPERAND>) {
+                return operand;
+            } else if constexpr (::IE::Internal::IS_VECTOR<_OPERAND>) {
+                static_assert(std::is_same_v<_OPERAND, ::IE::Vector<_T>>, "The operands of a vector expression must have the same component type.");
+
+                return ::IE::Internal::VectorTerminal<_T>(operand);
+            } else {
+                return ::IE::Internal::ScalarTerminal<_T>(static_cast<_T>(operand));
+            }
+        }
+
+        template <::IE::Internal::ExpressionOperation _OPERATION, typename _A, typename _B>
+        inline auto MakeVectorBinaryExpression(const _A& a, const _B& b) noexcept
+        {
+            using _T = typename std::conditional_t<::IE::Internal::vector_expression<_A>, _A, _B>::ValueType;
+
+            const auto left  = ::IE::Internal::MakeVectorOperand<_T>(a);
+            const auto right = ::IE::Internal::MakeVectorOperand<_T>(b);
+
+            return ::IE::Internal::VectorBinaryExpression<_OPERATION, std::remove_const_t<decltype(left)>, std::remove_const_t<decltype(right)>>(left, right);
+        }
+
+        // At least one side has to be an expression, the operators of "Vector" handle the rest
+        template <typename _A, typename _B>
+        concept vector_expression_operands = ::IE::Internal::vector_operand<_A> && ::IE::Internal::vector_operand<_B>
+                                          && (::IE::Internal::vector_expression<_A> || ::IE::Internal::vector_expression<_B>);
+
+        template <typename _A, typename _B> requires ::IE::Internal::vector_expression_operands<_A, _B>
+        inline auto operator+(const _A& a, const _B& b) noexcept { return ::IE::Internal::MakeVectorBinaryExpression<::IE::Internal::ExpressionOperation::ADD>(a, b); }
+
+        template <typename _A, typename _B> requires ::IE::Internal::vector_expression_operands<_A, _B>
+        inline auto operator-(const _A& a, const _B& b) noexcept { return ::IE::Internal::MakeVectorBinaryExpression<::IE::Internal::ExpressionOperation::SUB>(a, b); }
+
+        template <typename _A, typename _B> requires ::IE::Internal::vector_expression_operands<_A, _B>
+        inline auto operator*(const _A& a, const _B& b) noexcept { return ::IE::Internal::MakeVectorBinaryExpression<::IE::Internal::ExpressionOperation::MUL>(a, b); }
+
+        template <typename _A, typename _B> requires ::IE::Internal::vector_expression_operands<_A, _B>
+        inline auto operator/(const _A& a, const _B& b) noexcept { return ::IE::Internal::MakeVectorBinaryExpression<::IE::Internal::ExpressionOperation::DIV>(a, b); }
+
+        // "position += Lazy(velocity) * dt" is evaluated as a single multiply-add
+        template <::IE::arithmetic _T, ::IE::Internal::vector_expression _EXPRESSION>
+        inline ::IE::Vector<_T>& operator+=(::IE::Vector<_T>& a, const _EXPRESSION& expression) noexcept
+        {
+            a = ::IE::Internal::MakeVectorBinaryExpression<::IE::Internal::ExpressionOperation::ADD>(::IE::Internal::VectorTerminal<_T>(a), expression).Evaluate();
+
+            return a;
+        }
+
+        template <::IE::arithmetic _T, ::IE::Internal::vector_expression _EXPRESSION>
+        inline ::IE::Vector<_T>& operator-=(::IE::Vector<_T>& a, const _EXPRESSION& expression) noexcept
+        {
+            a = ::IE::Internal::MakeVectorBinaryExpression<::IE::Internal::ExpressionOperation::SUB>(::IE::Internal::VectorTerminal<_T>(a), expression).Evaluate();
+
+            return a;
+        }
+
+        // +--------------+     +----------------------+     +--------------------+
+        // | Math Library | --> | Expression Templates | --> | Matrix Expressions |
+        // +--------------+     +----------------------+     +--------------------+
+
+        /* A matrix expression is evaluated one row at a time: "EvaluateRow(r)" is the row "r" of the result and */
+        /* "TransformRow(v)" is "v * expression", so a chain of products is a chain of row transforms.             */
+
+        template <typename _DERIVED, ::IE::arithmetic _T>
+        struct MatrixExpression {
+            using ValueType = _T;
+
+            inline const _DERIVED& GetDerived() const noexcept { return static_cast<const _DERIVED&>(*this); }
+
+            inline operator ::IE::Matrix<_T>() const noexcept
+            {
+                ::IE::Matrix<_T> result;
+
+                for (size_t r = 0u; r < 4u; r++)
+                    result.SetRow(r, this->GetDerived().EvaluateRow(r));
+
+                return result;
+            }
+        };
+
+        template <typename _T>
+        concept matrix_expression = requires { typename _T::ValueType; }
+                                 && std::is_base_of_v<::IE::Internal::MatrixExpression<_T, typename _T::ValueType>, _T>;
+
+        template <typename _T>
+        constexpr const bool IS_MATRIX = false;
+
+        template <::IE::arithmetic _T>
+        constexpr const bool IS_MATRIX<::IE::Matrix<_T>> = true;
+
+        template <typename _T>
+        concept matrix_operand = ::IE::Internal::matrix_expression<_T> || ::IE::Internal::IS_MATRIX<_T>;
+
+        template <::IE::arithmetic _T>
+        struct MatrixTerminal : ::IE::Internal::MatrixExpression<::IE::Internal::MatrixTerminal<_T>, _T> {
+            const ::IE::Matrix<_T>* m_pMatrix;
+
+            inline MatrixTerminal(const ::IE::Matrix<_T>& matrix) noexcept : m_pMatrix(&matrix) {  }
+
+            inline ::IE::Vector<_T> EvaluateRow(const size_t r)                    const noexcept { return this->m_pMatrix->GetRow(r);                                  }
+            inline ::IE::Vector<_T> TransformRow(const ::IE::Vector<_T>& row) const noexcept { return ::IE::Internal::MultiplyRowByMatrix<_T>(row, *this->m_pMatrix); }
+        };
+
+        template <typename _LEFT, typename _RIGHT>
+        struct MatrixProductExpression : ::IE::Internal::MatrixExpression<::IE::Internal::MatrixProductExpression<_LEFT, _RIGHT>,
+                                                                          typename _LEFT::ValueType> {
+            using _T = typename _LEFT::ValueType;
+
+            static_assert(std::is_same_v<_T, typename _RIGHT::ValueType>, "The operands of a matrix expression must have the same component type.");
+
+            _LEFT  m_left;
+            _RIGHT m_right;
+
+            inline MatrixProductExpression(const _LEFT& left, const _RIGHT& right) noexcept : m_left(left), m_right(right) {  }
+
+            inline ::IE::Vector<_T> EvaluateRow(const size_t r)                    const noexcept { return this->m_right.TransformRow(this->m_left.EvaluateRow(r));  }
+            inline ::IE::Vector<_T> TransformRow(const ::IE::Vector<_T>& row) const noexcept { return this->m_right.TransformRow(this->m_left.TransformRow(row)); }
+        };
+
+        // "v * expression", evaluated without building the matrix
+        template <typename _VECTOR, typename _MATRIX>
+        struct VectorMatrixExpression : ::IE::Internal::VectorExpression<::IE::Internal::VectorMatrixExpression<_VECTOR, _MATRIX>,
+                                                                         typename _VECTOR::ValueType> {
+            using _T = typename _VECTOR::ValueType;
+
+            static_assert(std::is_same_v<_T, typename _MATRIX::ValueType>, "The operands of a matrix expression must have the same component type.");
+
+            _VECTOR m_vector;
+            _MATRIX m_matrix;
+
+            inline VectorMatrixExpression(const _VECTOR& vector, const _MATRIX& matrix) noexcept : m_vector(vector), m_matrix(matrix) {  }
+
+            inline ::IE::Vector<_T> Evaluate() const noexcept { return this->m_matrix.TransformRow(this->m_vector.Evaluate()); }
+        };
+
+        template <::IE::Internal::matrix_operand _OPERAND>
+        inline auto MakeMatrixOperand(const _OPERAND& operand) noexcept
+        {
+            if constexpr (::IE::Internal::matrix_expression<_OPERAND>)
+                return operand;
+            else
+                return ::IE::Internal::MatrixTerminal<std::remove_cvref_t<decltype(operand[0])>>(operand);
+        }
+
+        template <::IE::Internal::matrix_operand _A, ::IE::Internal::matrix_operand _B>
+            requires (::IE::Internal::matrix_expression<_A> || ::IE::Internal::matrix_expression<_B>)
+        inline auto operator*(const _A& a, const _B& b) noexcept
+        {
+            const auto left  = ::IE::Internal::MakeMatrixOperand(a);
+            const auto right = ::IE::Internal::MakeMatrixOperand(b);
+
+            return ::IE::Internal::MatrixProductExpression<std::remove_const_t<decltype(left)>, std::remove_const_t<decltype(right)>>(left, right);
+        }
+
+        template <typename _V, ::IE::Internal::matrix_operand _M>
+            requires ((::IE::Internal::vector_expression<_V> || ::IE::Internal::IS_VECTOR<_V>)
+                   && (::IE::Internal::vector_expression<_V> || ::IE::Internal::matrix_expression<_M>))
+        inline auto operator*(const _V& v, const _M& m) noexcept
+        {
+            const auto matrix = ::IE::Internal::MakeMatrixOperand(m);
+            const auto vector = ::IE::Internal::MakeVectorOperand<typename decltype(matrix)::ValueType>(v);
+
+            return ::IE::Internal::VectorMatrixExpression<std::remove_const_t<decltype(vector)>, std::remove_const_t<decltype(matrix)>>(vector, matrix);
+        }
+
+    } // Internal
+
+    // +--------------+     +----------------------+     +------------------+
+    // | Math Library | --> | Expression Templates | --> | Public Functions |
+    // +--------------+     +----------------------+     +------------------+
+
+    // The expressions reference "vec" & "mat" (temporaries are rejected since they could be destroyed before the evaluation)
+    template <::IE::arithmetic _T>
+    inline ::IE::Internal::VectorTerminal<_T> Lazy(const ::IE::Vector<_T>& vec) noexcept { return ::IE::Internal::VectorTerminal<_T>(vec); }
+
+    template <::IE::arithmetic _T>
+    inline ::IE::Internal::MatrixTerminal<_T> Lazy(const ::IE::Matrix<_T>& mat) noexcept { return ::IE::Internal::MatrixTerminal<_T>(mat); }
+
+    template <::IE::arithmetic _T>
+    void Lazy(const ::IE::Vector<_T>&& vec) = delete;
+
+    template <::IE::arithmetic _T>
+    void Lazy(const ::IE::Matrix<_T>&& mat) = delete;
+
+    template <::IE::Internal::vector_expression _EXPRESSION>
+    inline auto Evaluate(const _EXPRESSION& expression) noexcept { return expression.Evaluate(); }
+
+    template <::IE::Internal::matrix_expression _EXPRESSION>
+    inline auto Evaluate(const _EXPRESSION& expression) noexcept { return ::IE::Matrix<typename _EXPRESSION::ValueType>(expression); }
+
+    // +--------------+     +------------+
+    // | Math Library | --> | Quaternion |
+    // +--------------+     +------------+
+
+    /* Unit quaternions represent rotations without the 3 matrix products of "Matrix<_T>::MakeRotation". They follow */
+    /* the convention of the matrices: "Quaternion::MakeRotationX(rad).ToMatrix()" is "Matrix::MakeRotationX(rad)",   */
+    /* "(a * b).ToMatrix()" is "a.ToMatrix() * b.ToMatrix()" and "q.Rotate(v)" is "v * q.ToMatrix()". The components */
+    /* share the register of a "Vector" so that the float operations are a handful of SSE instructions.              */
+
+    template <std::floating_point _T = float>
+    class Quaternion {
+        using _VECTOR_REGISTER_TYPE = ::IE::Internal::SIMDVectorRegister<_T>;
+
+    public:
+        union {
+            struct { _T x, y, z, w; };
+
+            _VECTOR_REGISTER_TYPE m_simdRegister;
+        };
+
+        // +--------------+     +------------+     +--------------+
+        // | Math Library | --> | Quaternion | --> | Constructors |
+        // +--------------+     +------------+     +--------------+
+
+        // The identity by default
+        Quaternion(const _T x = 0, const _T y = 0, const _T z = 0, const _T w = 1) noexcept
+        {
+            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T>()) {
+#ifdef __IE__ENABLE_SIMD
+                this->m_simdRegister = ::IE::Internal::SIMDSet<_T>(x, y, z, w);
+#endif // #ifdef __IE__ENABLE_SIMD
+            } else {
+                this->x = x; this->y = y; this->z = z; this->w = w;
+            }
+        }
+
+        // The components (x, y, z, w) of "xyzw"
+        explicit Quaternion(const ::IE::Vector<_T>& xyzw) noexcept
+        {
+            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T>()) {
+#ifdef __IE__ENABLE_SIMD
+                this->m_simdRegister = xyzw.m_simdRegister;
+#endif // #ifdef __IE__ENABLE_SIMD
+            } else {
+                this->x = xyzw.x; this->y = xyzw.y; this->z = xyzw.z; this->w = xyzw.w;
+            }
+        }
+
+        inline ::IE::Vector<_T> GetVector() const noexcept
+        {
+            if constexpr (::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T>()) {
+#ifdef __IE__ENABLE_SIMD
+                return ::IE::Vector<_T>(this->m_simdRegister);
+#endif // #ifdef __IE__ENABLE_SIMD
+            } else {
+                return ::IE::Vector<_T>(this->x, this->y, this->z, this->w);
+            }
+        }
+
+        // +--------------+     +------------+     +--------------------------------+
+        // | Math Library | --> | Quaternion | --> | Non Static Function Operations |
+        // +--------------+     +------------+     +--------------------------------+
+
+        inline _T GetLength() const noexcept { return std::sqrt(::IE::Quaternion<_T>::DotProduct(*this, *this)); }
+
+        inline void Normalize() noexcept { *this = ::IE::Quaternion<_T>::Normalized(*this); }
+
+        // The inverse rotation (the inverse of a unit quaternion)
+        inline ::IE::Quaternion<_T> GetConjugate() const noexcept
+        {
+            return ::IE::Quaternion<_T>(this->GetVector() * ::IE::Vector<_T>(-1, -1, -1, 1));
+        }
+
+        // "v * ToMatrix()" without building the matrix ("v.w" is kept)
+        inline ::IE::Vector<_T> Rotate(const ::IE::Vector<_T>& v) const noexcept
+        {
+            // Rotation by the conjugate (the matrix is applied to row vectors): t = 2 * (v x q), v + w * t - q x t
+            const ::IE::Vector<_T> q = this->GetVector();
+            const ::IE::Vector<_T> t = ::IE::Vector<_T>::CrossProduct3D(v, q) * static_cast<_T>(2);
+
+            return ::IE::Vector<_T>(v + t * this->w - ::IE::Vector<_T>::CrossProduct3D(q, t));
+        }
+
+        ::IE::Matrix<_T> ToMatrix() const noexcept
+        {
+            ::IE::Matrix<_T> result;
+
+            if constexpr (std::is_same_v<_T, float> && ::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T>()) {
+#ifdef __IE__ENABLE_SIMD
+                const __m128 q  = this->m_simdRegister;
+                const __m128 q2 = _mm_add_ps(q, q);
+                const __m128 squares2 = _mm_mul_ps(q, q2); // 2xx 2yy 2zz 2ww
+
+                // 1 - 2yy - 2zz, 1 - 2xx - 2zz, 1 - 2xx - 2yy, 0
+                const __m128 xyzMask  = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+                const __m128 diagonal = _mm_sub_ps(_mm_sub_ps(_mm_set_ps(0.0f, 1.0f, 1.0f, 1.0f),
+                                                              _mm_and_ps(_mm_shuffle_ps(squares2, squares2, _MM_SHUFFLE(3, 0, 0, 1)), xyzMask)),
+                                                   _mm_and_ps(_mm_shuffle_ps(squares2, squares2, _MM_SHUFFLE(3, 1, 2, 2)), xyzMask));
+
+                const __m128 products = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 0)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 2, 1, 2)));     // 2xz 2xy 2yz
+                const __m128 wTerms   = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 3, 3)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 0, 2, 1))); // 2wy 2wz 2wx
+                const __m128 sums     = _mm_and_ps(_mm_add_ps(products, wTerms), xyzMask); // 2xz + 2wy, 2xy + 2wz, 2yz + 2wx, 0
+                const __m128 diffs    = _mm_sub_ps(products, wTerms);                      // 2xz - 2wy, 2xy - 2wz, 2yz - 2wx, 0
+
+                const __m128 row0 = _mm_shuffle_ps(_mm_shuffle_ps(diagonal, diffs, _MM_SHUFFLE(1, 1, 0, 0)), sums, _MM_SHUFFLE(3, 0, 2, 0));
+                const __m128 row1 = _mm_shuffle_ps(_mm_shuffle_ps(sums, diagonal, _MM_SHUFFLE(1, 1, 1, 1)), diffs, _MM_SHUFFLE(3, 2, 2, 0));
+                const __m128 row2 = _mm_shuffle_ps(_mm_shuffle_ps(diffs, sums, _MM_SHUFFLE(2, 2, 0, 0)), diagonal, _MM_SHUFFLE(3, 2, 2, 0));
+
+                _mm_store_ps(&result[0u],  row0);
+                _mm_store_ps(&result[4u],  row1);
+                _mm_store_ps(&result[8u],  row2);
+                _mm_store_ps(&result[12u], _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
+#endif // #ifdef __IE__ENABLE_SIMD
+            } else {
+                const _T xx = this->x * this->x, yy = this->y * this->y, zz = this->z * this->z;
+                const _T xy = this->x * this->y, xz = this->x * this->z, yz = this->y * this->z;
+                const _T wx = this->w * this->x, wy = this->w * this->y, wz = this->w * this->z;
+
+                result = ::IE::Matrix<_T>(std::array<_T, 16u>{
+                    1 - 2 * (yy + zz), 2 * (xy - wz),     2 * (xz + wy),     0,
+                    2 * (xy + wz),     1 - 2 * (xx + zz), 2 * (yz - wx),     0,
+                    2 * (xz - wy),     2 * (yz + wx),     1 - 2 * (xx + yy), 0,
+                    0,                 0,                 0,                 1
+                });
+            }
+
+            return result;
+        }
+
+        // +--------------+     +------------+     +----------------------------+
+        // | Math Library | --> | Quaternion | --> | Static Function Operations |
+        // +--------------+     +------------+     +----------------------------+
+
+        static inline ::IE::Quaternion<_T> MakeIdentity() noexcept { return ::IE::Quaternion<_T>(); }
+
+        // Rotation of "rad" radians around the unit vector "axis" ("axis.w" is ignored)
+        static inline ::IE::Quaternion<_T> MakeAxisAngle(const ::IE::Vector<_T>& axis, const _T rad) noexcept
+        {
+            const _T s = std::sin(rad * static_cast<_T>(0.5));
+
+            return ::IE::Quaternion<_T>(axis.x * s, axis.y * s, axis.z * s, std::cos(rad * static_cast<_T>(0.5)));
+        }
+
+        static inline ::IE::Quaternion<_T> MakeRotationX(const _T radX = 0) noexcept { return ::IE::Quaternion<_T>(std::sin(radX * static_cast<_T>(0.5)), 0, 0, std::cos(radX * static_cast<_T>(0.5))); }
+        static inline ::IE::Quaternion<_T> MakeRotationY(const _T radY = 0) noexcept { return ::IE::Quaternion<_T>(0, std::sin(radY * static_cast<_T>(0.5)), 0, std::cos(radY * static_cast<_T>(0.5))); }
+        static inline ::IE::Quaternion<_T> MakeRotationZ(const _T radZ = 0) noexcept { return ::IE::Quaternion<_T>(0, 0, std::sin(radZ * static_cast<_T>(0.5)), std::cos(radZ * static_cast<_T>(0.5))); }
+
+        // Same rotation as "Matrix<_T>::MakeRotation(radX, radY, radZ)"
+        static inline ::IE::Quaternion<_T> MakeRotation(const _T radX = 0, const _T radY = 0, const _T radZ = 0) noexcept
+        {
+            return MakeRotationX(radX) * MakeRotationY(radY) * MakeRotationZ(radZ);
+        }
+
+        static inline ::IE::Quaternion<_T> MakeRotation(const ::IE::Vector<_T>& radians) noexcept
+        {
+            return ::IE::Quaternion<_T>::MakeRotation(radians.x, radians.y, radians.z);
+        }
+
+        static inline _T DotProduct(const ::IE::Quaternion<_T>& a, const ::IE::Quaternion<_T>& b) noexcept
+        {
+            return ::IE::Vector<_T>::DotProduct(a.GetVector(), b.GetVector());
+        }
+
+        static inline ::IE::Quaternion<_T> Normalized(const ::IE::Quaternion<_T>& q) noexcept
+        {
+            const _T length = q.GetLength();
+
+            return ::IE::Quaternion<_T>(q.GetVector() / ::IE::Vector<_T>(length, length, length, length));
+        }
+
+        /* Normalized linear interpolation along the shortest arc. It is cheaper than "Slerp" but the */
+        /* angular speed isn't constant, which is fine between the close keys of an animation.        */
+        static inline ::IE::Quaternion<_T> Nlerp(const ::IE::Quaternion<_T>& from, const ::IE::Quaternion<_T>& to, const _T t) noexcept
+        {
+            const ::IE::Vector<_T> a = from.GetVector();
+            const ::IE::Vector<_T> b = (::IE::Quaternion<_T>::DotProduct(from, to) < 0) ? ::IE::Vector<_T>(to.GetVector() * static_cast<_T>(-1)) : to.GetVector();
+
+            return ::IE::Quaternion<_T>::Normalized(::IE::Quaternion<_T>(::IE::Vector<_T>(a + (b - a) * t)));
+        }
+
+        // Spherical linear interpolation of unit quaternions along the shortest arc (see "Internal::GetSlerpWeights")
+        static inline ::IE::Quaternion<_T> Slerp(const ::IE::Quaternion<_T>& from, const ::IE::Quaternion<_T>& to, const _T t) noexcept;
+    };
+
+    // Composes the rotations: "a" then "b" when applied to row vectors (see "ToMatrix")
+    template <std::floating_point _T>
+    inline ::IE::Quaternion<_T> operator*(const ::IE::Quaternion<_T>& a, const ::IE::Quaternion<_T>& b) noexcept
+    {
+        if constexpr (std::is_same_v<_T, float> && ::IE::Internal::CAN_PERFORM_SIMD_VECTOR_OPERATIONS<_T>()) {
+#ifdef __IE__ENABLE_SIMD
+            // a.w * b + a.x * (b.w, -b.z, b.y, -b.x) + a.y * (b.z, b.w, -b.x, -b.y) + a.z * (-b.y, b.x, b.w, -b.z)
+            const __m128 va = a.m_simdRegister, vb = b.m_simdRegister;
+
+            __m128 result = _mm_mul_ps(_mm_shuffle_ps(va, va, _MM_SHUFFLE(3, 3, 3, 3)), vb);
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(va, va, _MM_SHUFFLE(0, 0, 0, 0)),
+                                                   _mm_xor_ps(_mm_shuffle_ps(vb, vb, _MM_SHUFFLE(0, 1, 2, 3)), _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f))));
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(va, va, _MM_SHUFFLE(1, 1, 1, 1)),
+                                                   _mm_xor_ps(_mm_shuffle_ps(vb, vb, _MM_SHUFFLE(1, 0, 3, 2)), _mm_set_ps(-0.0f, -0.0f, 0.0f, 0.0f))));
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(va, va, _MM_SHUFFLE(2, 2, 2, 2)),
+                                                   _mm_xor_ps(_mm_shuffle_ps(vb, vb, _MM_SHUFFLE(2, 3, 0, 1)), _mm_set_ps(-0.0f, 0.0f, 0.0f, -0.0f))));
+
+            return ::IE::Quaternion<float>(::IE::Vector<float>(result));
+#endif // #ifdef __IE__ENABLE_SIMD
+        } else {
+            return ::IE::Quaternion<_T>(a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+                                        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+                                        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+                                        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);
+        }
+    }
+
+    template <std::floating_point _T>
+	inline std::ostream& operator<<(std::ostream& stream, const ::IE::Quaternion<_T>& q) noexcept
+	{
+		stream << "(" << q.x << ", " << q.y << ", " << q.z << ", " << q.w << ")";
+
+		return stream;
+	}
+
+    typedef ::IE::Quaternion<std::enable_if_t<std::numeric_limits<float>::is_iec559, float>>   Quatf32;
+    typedef ::IE::Quaternion<std::enable_if_t<std::numeric_limits<double>::is_iec559, double>> Quatd64;
+
+    // +--------------+     +------------+     +-------+
+    // | Math Library | --> | Quaternion | --> | Slerp |
+    // +--------------+     +------------+     +-------+
+
+    /* Slerp doesn't call any trigonometric function: "sin(t * theta) / sin(theta)" is a polynomial in "t" & "cos(theta)"   */
+    /* (D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP") so that the batched kernels run 4 or 8 of them per   */
+    /* register. The arc is first split in 2 at its middle, which keeps "cos(theta)" in [sqrt(1/2), 1] where 6 terms are    */
+    /* accurate to 1e-8, and the last term is scaled to make up for the ones that are left out.                             */
+
+    namespace Internal {
+
+        constexpr const size_t SLERP_TERM_COUNT = 6u;
+
+        // "1 / (i * (2i + 1))" & "i / (2i + 1)" for i in [1, SLERP_TERM_COUNT], the last ones scaled by 1.1502
+        template <std::floating_point _T>
+        constexpr std::array<_T, ::IE::Internal::SLERP_TERM_COUNT> MakeSlerpCoefficients(const bool bNumerators) noexcept
+        {
+            std::array<_T, ::IE::Internal::SLERP_TERM_COUNT> coefficients{};
+
+            for (size_t i = 1u; i <= ::IE::Internal::SLERP_TERM_COUNT; i++) {
+                const double scale = (i == ::IE::Internal::SLERP_TERM_COUNT) ? 1.1502 : 1.0;
+
+                coefficients[i - 1u] = static_cast<_T>(scale * (bNumerators ? static_cast<double>(i) / static_cast<double>(2u * i + 1u)
+                                                                            : 1.0 / static_cast<double>(i * (2u * i + 1u))));
+            }
+
+            return coefficients;
+        }
+
+        template <std::floating_point _T>
+        constexpr const std::array<_T, ::IE::Internal::SLERP_TERM_COUNT> SLERP_U = ::IE::Internal::MakeSlerpCoefficients<_T>(false);
+
+        template <std::floating_point _T>
+        constexpr const std::array<_T, ::IE::Internal::SLERP_TERM_COUNT> SLERP_V = ::IE::Internal::MakeSlerpCoefficients<_T>(true);
+
+        // "sin(t * theta) / sin(theta)" with "cosThetaMinusOne" = cos(theta) - 1
+        template <std::floating_point _T>
+        inline _T GetSlerpWeight(const _T cosThetaMinusOne, const _T t) noexcept
+        {
+            const _T t2 = t * t;
+
+            _T weight = 1;
+            for (size_t i = ::IE::Internal::SLERP_TERM_COUNT; i-- > 0u;)
+                weight = 1 + (::IE::Internal::SLERP_U<_T>[i] * t2 - ::IE::Internal::SLERP_V<_T>[i]) * cosThetaMinusOne * weight;
+
+            return t * weight;
+        }
+
+    } // Internal
+
+    template <std::floating_point _T>
+    inline ::IE::Quaternion<_T> Quaternion<_T>::Slerp(const ::IE::Quaternion<_T>& from, const ::IE::Quaternion<_T>& to, const _T t) noexcept
+    {
+        const _T cosTheta = ::IE::Quaternion<_T>::DotProduct(from, to);
+
+        const ::IE::Vector<_T> a = from.GetVector();
+        const ::IE::Vector<_T> b = (cosTheta < 0) ? ::IE::Vector<_T>(to.GetVector() * static_cast<_T>(-1)) : to.GetVector();
+
+        // "middle" is halfway between "a" & "b", "cos(theta / 2)" = (1 + cos(theta)) / |a + b|
+        const _T onePlusCos = 1 + std::abs(cosTheta);
+        const _T rLength    = 1 / std::sqrt(onePlusCos + onePlusCos);
+
+        const ::IE::Vector<_T> middle = ::IE::Vector<_T>(a + b) * rLength;
+        const _T cosHalfMinusOne = onePlusCos * rLength - 1;
+
+        const bool bFirstHalf = t < static_cast<_T>(0.5);
+        const _T   halfT      = bFirstHalf ? t + t : t + t - 1;
+
+        return ::IE::Quaternion<_T>(::IE::Vector<_T>((bFirstHalf ? a : middle) * ::IE::Internal::GetSlerpWeight<_T>(cosHalfMinusOne, 1 - halfT)
+                                                   + (bFirstHalf ? middle : b) * ::IE::Internal::GetSlerpWeight<_T>(cosHalfMinusOne, halfT)));
+    }
+
+    // +--------------+     +------------+     +--------------------+
+    // | Math Library | --> | Quaternion | --> | Batched Operations |
+    // +--------------+     +------------+     +--------------------+
+
+    namespace Internal {
+
+        inline void SlerpF32Scalar(const float* from, const float* to, const float* t, float* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++) {
+                const ::IE::Quatf32 q = ::IE::Quatf32::Slerp(::IE::Quatf32(from[i * 4u], from[i * 4u + 1u], from[i * 4u + 2u], from[i * 4u + 3u]),
+                                                             ::IE::Quatf32(to[i * 4u],   to[i * 4u + 1u],   to[i * 4u + 2u],   to[i * 4u + 3u]), t[i]);
+
+                out[i * 4u] = q.x; out[i * 4u + 1u] = q.y; out[i * 4u + 2u] = q.z; out[i * 4u + 3u] = q.w;
+            }
+        }
+
+#ifdef __IE__ENABLE_SIMD
+
+        __IE__TARGET_SSE41 inline __m128 GetSlerpWeightsSSE41(const __m128 cosThetaMinusOne, const __m128 t) noexcept
+        {
+            const __m128 t2 = _mm_mul_ps(t, t);
+
+            __m128 weight = _mm_set1_ps(1.0f);
+            for (size_t i = ::IE::Internal::SLERP_TERM_COUNT; i-- > 0u;) {
+                const __m128 term = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(_mm_set1_ps(::IE::Internal::SLERP_U<float>[i]), t2), _mm_set1_ps(::IE::Internal::SLERP_V<float>[i])), cosThetaMinusOne);
+
+                weight = _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(term, weight));
+            }
+
+            return _mm_mul_ps(t, weight);
+        }
+
+        // 4 quaternions per iteration, transposed so that each register holds one component of all of them
+        __IE__TARGET_SSE41 inline void SlerpF32SSE41(const float* from, const float* to, const float* t, float* out, const size_t count) noexcept
+        {
+            const __m128 one = _mm_set1_ps(1.0f), signBit = _mm_set1_ps(-0.0f);
+
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u) {
+                __m128 a[4u], b[4u];
+                for (size_t k = 0u; k < 4u; k++) {
+                    a[k] = _mm_loadu_ps(from + (i + k) * 4u);
+                    b[k] = _mm_loadu_ps(to + (i + k) * 4u);
+                }
+
+                _MM_TRANSPOSE4_PS(a[0], a[1], a[2], a[3]);
+                _MM_TRANSPOSE4_PS(b[0], b[1], b[2], b[3]);
+
+                const __m128 dot  = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[0], b[0]), _mm_mul_ps(a[1], b[1])),
+                                               _mm_add_ps(_mm_mul_ps(a[2], b[2]), _mm_mul_ps(a[3], b[3])));
+                const __m128 sign = _mm_and_ps(dot, signBit);
+
+                const __m128 onePlusCos = _mm_add_ps(one, _mm_xor_ps(dot, sign));
+                const __m128 rLength    = _mm_div_ps(one, _mm_sqrt_ps(_mm_add_ps(onePlusCos, onePlusCos)));
+                const __m128 cosHalfMinusOne = _mm_sub_ps(_mm_mul_ps(onePlusCos, rLength), one);
+
+                const __m128 t4         = _mm_loadu_ps(t + i);
+                const __m128 firstHalf  = _mm_cmplt_ps(t4, _mm_set1_ps(0.5f));
+                const __m128 halfT      = _mm_sub_ps(_mm_add_ps(t4, t4), _mm_andnot_ps(firstHalf, one));
+                const __m128 weightP    = ::IE::Internal::GetSlerpWeightsSSE41(cosHalfMinusOne, _mm_sub_ps(one, halfT));
+                const __m128 weightQ    = ::IE::Internal::GetSlerpWeightsSSE41(cosHalfMinusOne, halfT);
+
+                for (size_t k = 0u; k < 4u; k++) {
+                    const __m128 bk     = _mm_xor_ps(b[k], sign);
+                    const __m128 middle = _mm_mul_ps(_mm_add_ps(a[k], bk), rLength);
+
+                    a[k] = _mm_add_ps(_mm_mul_ps(_mm_blendv_ps(middle, a[k], firstHalf), weightP),
+                                      _mm_mul_ps(_mm_blendv_ps(bk, middle, firstHalf), weightQ));
+                }
+
+                _MM_TRANSPOSE4_PS(a[0], a[1], a[2], a[3]);
+
+                for (size_t k = 0u; k < 4u; k++)
+                    _mm_storeu_ps(out + (i + k) * 4u, a[k]);
+            }
+
+            ::IE::Internal::SlerpF32Scalar(from + i * 4u, to + i * 4u, t + i, out + i * 4u, count - i);
+        }
+
+        __IE__TARGET_AVX2 inline __m256 GetSlerpWeightsAVX2(const __m256 cosThetaMinusOne, const __m256 t) noexcept
+        {
+            const __m256 t2 = _mm256_mul_ps(t, t);
+
+            __m256 weight = _mm256_set1_ps(1.0f);
+            for (size_t i = ::IE::Internal::SLERP_TERM_COUNT; i-- > 0u;) {
+                const __m256 term = _mm256_mul_ps(_mm256_fmsub_ps(_mm256_set1_ps(::IE::Internal::SLERP_U<float>[i]), t2, _mm256_set1_ps(::IE::Internal::SLERP_V<float>[i])), cosThetaMinusOne);
+
+                weight = _mm256_fmadd_ps(term, weight, _mm256_set1_ps(1.0f));
+            }
+
+            return _mm256_mul_ps(t, weight);
+        }
+
+        // Transposes the 4x4 blocks of the 2 lanes ("_MM_TRANSPOSE4_PS" on each half)
+        __IE__TARGET_AVX2 inline void TransposeLanes4x4AVX2(__m256& r0, __m256& r1, __m256& r2, __m256& r3) noexcept
+        {
+            const __m256 t0 = _mm256_unpacklo_ps(r0, r1), t1 = _mm256_unpackhi_ps(r0, r1);
+            const __m256 t2 = _mm256_unpacklo_ps(r2, r3), t3 = _mm256_unpackhi_ps(r2, r3);
+
+            r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+            r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+            r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        // 8 quaternions per iteration: the lower lanes hold the first 4 & the upper lanes the last 4, like "t"
+        __IE__TARGET_AVX2 inline void SlerpF32AVX2(const float* from, const float* to, const float* t, float* out, const size_t count) noexcept
+        {
+            const __m256 one = _mm256_set1_ps(1.0f), signBit = _mm256_set1_ps(-0.0f);
+
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                __m256 a[4u], b[4u];
+                for (size_t k = 0u; k < 4u; k++) {
+                    a[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(from + (i + k) * 4u)), _mm_loadu_ps(from + (i + k + 4u) * 4u), 1);
+                    b[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(to + (i + k) * 4u)),   _mm_loadu_ps(to + (i + k + 4u) * 4u),   1);
+                }
+
+                ::IE::Internal::TransposeLanes4x4AVX2(a[0], a[1], a[2], a[3]);
+                ::IE::Internal::TransposeLanes4x4AVX2(b[0], b[1], b[2], b[3]);
+
+                const __m256 dot  = _mm256_fmadd_ps(a[3], b[3], _mm256_fmadd_ps(a[2], b[2], _mm256_fmadd_ps(a[1], b[1], _mm256_mul_ps(a[0], b[0]))));
+                const __m256 sign = _mm256_and_ps(dot, signBit);
+
+                const __m256 onePlusCos = _mm256_add_ps(one, _mm256_xor_ps(dot, sign));
+                const __m256 rLength    = _mm256_div_ps(one, _mm256_sqrt_ps(_mm256_add_ps(onePlusCos, onePlusCos)));
+                const __m256 cosHalfMinusOne = _mm256_fmsub_ps(onePlusCos, rLength, one);
+
+                const __m256 t8         = _mm256_loadu_ps(t + i);
+                const __m256 firstHalf  = _mm256_cmp_ps(t8, _mm256_set1_ps(0.5f), _CMP_LT_OQ);
+                const __m256 halfT      = _mm256_sub_ps(_mm256_add_ps(t8, t8), _mm256_andnot_ps(firstHalf, one));
+                const __m256 weightP    = ::IE::Internal::GetSlerpWeightsAVX2(cosHalfMinusOne, _mm256_sub_ps(one, halfT));
+                const __m256 weightQ    = ::IE::Internal::GetSlerpWeightsAVX2(cosHalfMinusOne, halfT);
+
+                for (size_t k = 0u; k < 4u; k++) {
+                    const __m256 bk     = _mm256_xor_ps(b[k], sign);
+                    const __m256 middle = _mm256_mul_ps(_mm256_add_ps(a[k], bk), rLength);
+
+                    a[k] = _mm256_fmadd_ps(_mm256_blendv_ps(middle, a[k], firstHalf), weightP,
+                                           _mm256_mul_ps(_mm256_blendv_ps(bk, middle, firstHalf), weightQ));
+                }
+
+                ::IE::Internal::TransposeLanes4x4AVX2(a[0], a[1], a[2], a[3]);
+
+                for (size_t k = 0u; k < 4u; k++) {
+                    _mm_storeu_ps(out + (i + k) * 4u,      _mm256_castps256_ps128(a[k]));
+                    _mm_storeu_ps(out + (i + k + 4u) * 4u, _mm256_extractf128_ps(a[k], 1));
+                }
+            }
+
+            ::IE::Internal::SlerpF32SSE41(from + i * 4u, to + i * 4u, t + i, out + i * 4u, count - i);
+        }
+
+#endif // #ifdef __IE__ENABLE_SIMD
+
+    } // Internal
+
+    // Slerps every pair of "from" & "to" by the matching "t" into "out" (see "Quaternion<_T>::Slerp"). "out" may be "from" or "to"
+    inline void SlerpBatch(const std::span<const ::IE::Quatf32> from, const std::span<const ::IE::Quatf32> to,
+                           const std::span<const float> t, const std::span<::IE::Quatf32> out) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(from.size() == to.size() && from.size() == t.size() && from.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::GetSIMDKernels().m_pSlerpF32(reinterpret_cast<const float*>(from.data()), reinterpret_cast<const float*>(to.data()),
+                                                      t.data(), reinterpret_cast<float*>(out.data()), from.size());
+    }
+
+    // +---------------+
+    // | Window System |
+    // +---------------+
+
+    // +---------------+     +-------------+
+    // | Window System | --> | Framebuffer |
+    // +---------------+     +-------------+
+
+    /* 32 bit BGRA surface : blue is the lowest byte in memory, so a pixel reads 0xAARRGGBB as a "std::uint32_t". */
+    /* Every row starts on a 64 byte boundary and the stride is a multiple of 16 pixels, so rows can be written  */
+    /* with aligned SSE, AVX & AVX-512 stores right up to the stride. Framebuffers are owned by their window.    */
+    class Framebuffer {
+        friend class Window;
+
+    public:
+        static constexpr size_t ROW_ALIGNMENT = 64u;
+        static constexpr size_t STRIDE_ALIGNMENT = ROW_ALIGNMENT / sizeof(std::uint32_t);
+
+    private:
+        std::uint32_t* m_pPixels = nullptr;
+        size_t         m_stride  = 0u; // Distance between the start of two rows, in pixels
+
+        std::uint16_t m_width  = 0u;
+        std::uint16_t m_height = 0u;
+
+    public:
+        static inline constexpr size_t GetStrideForWidth(const std::uint16_t width) noexcept
+        {
+            return (static_cast<size_t>(width) + STRIDE_ALIGNMENT - 1u) & ~(STRIDE_ALIGNMENT - 1u);
+        }
+
+        static inline constexpr std::uint32_t PackBGRA(const std::uint8_t r, const std::uint8_t g, const std::uint8_t b, const std::uint8_t a = 0xFFu) noexcept
+        {
+            return (static_cast<std::uint32_t>(a) << 24u) | (static_cast<std::uint32_t>(r) << 16u) |
+                   (static_cast<std::uint32_t>(g) << 8u)  |  static_cast<std::uint32_t>(b);
+        }
+
+        // Empty when the window has no client area or its visual can't display BGRA pixels
+        inline bool IsValid() const noexcept { return this->m_pPixels != nullptr; }
+
+        inline std::uint16_t GetWidth()      const noexcept { return this->m_width;  }
+        inline std::uint16_t GetHeight()     const noexcept { return this->m_height; }
+        inline ::IE::Vecu16  GetDimensions() const noexcept { return ::IE::Vecu16(this->m_width, this->m_height); }
+        inline size_t        GetStride()     const noexcept { return this->m_stride; }
+
+        inline std::uint32_t*       GetPixels()       noexcept { return this->m_pPixels; }
+        inline const std::uint32_t* GetPixels() const noexcept { return this->m_pPixels; }
+
+        inline std::uint32_t* GetRow(const std::uint16_t y) noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(y < this->m_height);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            return this->m_pPixels + static_cast<size_t>(y) * this->m_stride;
+        }
+
+        inline const std::uint32_t* GetRow(const std::uint16_t y) const noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(y < this->m_height);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            return this->m_pPixels + static_cast<size_t>(y) * this->m_stride;
+        }
+
+        inline std::uint32_t& operator()(const std::uint16_t x, const std::uint16_t y) noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(x < this->m_width);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            return this->GetRow(y)[x];
+        }
+
+        inline const std::uint32_t& operator()(const std::uint16_t x, const std::uint16_t y) const noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(x < this->m_width);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            return this->GetRow(y)[x];
+        }
+
+        // Also fills the padding at the end of the rows, which keeps the stores full width
+        inline void Clear(const std::uint32_t pixel) noexcept
+        {
+            std::fill_n(this->m_pPixels, this->m_stride * this->m_height, pixel);
+        }
+    };
+
+    // +---------------+     +--------------+
+    // | Window System | --> | Input Events |
+    // +---------------+     +--------------+
+
+    enum class InputEventType : std::uint8_t { KEY_PRESS, KEY_RELEASE, BUTTON_PRESS, BUTTON_RELEASE, POINTER_MOTION, RESIZE };
+
+    // Mouse buttons are numbered like X11 does (4 & 5 are the wheel, which never reports a release)
+    enum class MouseButton : std::uint8_t { LEFT = 1, MIDDLE = 2, RIGHT = 3, WHEEL_UP = 4, WHEEL_DOWN = 5 };
+
+    /* "m_timestamp" is the time the event happened at, in milliseconds, as given by the X server (which */
+    /* uses CLOCK_MONOTONIC on linux) or by "GetMessageTime" on windows. It wraps around every 49 days.  */
+    /* Resize events carry the timestamp of the last timed event since the server doesn't provide one.   */
+    struct InputEvent {
+        std::uint32_t         m_timestamp;
+        ::IE::InputEventType m_type;
+
+        // KEY_* : key (same codes as "IsKeyDown") | BUTTON_* : "MouseButton"
+        std::uint8_t m_code;
+
+        // BUTTON_* & POINTER_MOTION : cursor position | RESIZE : client dimensions
+        std::uint16_t m_x;
+        std::uint16_t m_y;
+    };
+
+    // +---------------+     +-----------------+
+    // | Window System | --> | Display Manager |
+    // +---------------+     +-----------------+
+
+    class Window;
+
+    /* Process-wide connection to the display server, shared by every "Window" : it is opened with the     */
+    /* first window and closed with the last one. Events are read from that single connection and handed  */
+    /* to the window they target (looked up by its id), so one pump drives any number of windows. Like    */
+    /* Xlib, the manager & the windows must only be used from one thread.                                  */
+    class DisplayManager {
+        friend class Window;
+
+    public:
+#if defined(__IE__OS_WINDOWS)
+        using NativeWindowHandle = ::HWND;
+#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
+        using NativeWindowHandle = ::Window;
+#endif // end of #elif defined(__IE__OS_LINUX)
+
+    private:
+#if defined(__IE__OS_LINUX)
+        ::Display* m_pDisplayHandle = nullptr;
+
+        ::Atom m_deleteMessage = None;
+#endif // #if defined(__IE__OS_LINUX)
+
+        std::unordered_map<NativeWindowHandle, ::IE::Window*> m_windows;
+
+        DisplayManager() noexcept = default;
+
+        // Opens the connection if it isn't already
+        bool Open() noexcept
+        {
+#if defined(__IE__OS_LINUX)
+            if (this->m_pDisplayHandle != nullptr)
+                return true;
+
+            this->m_pDisplayHandle = ::XOpenDisplay(0);
+
+            if (this->m_pDisplayHandle == nullptr)
+                return false;
+
+            this->m_deleteMessage = ::XInternAtom(this->m_pDisplayHandle, "WM_DELETE_WINDOW", False);
+
+            // Held keys send repeated presses instead of release & press pairs
+            ::XkbSetDetectableAutoRepeat(this->m_pDisplayHandle, True, nullptr);
+#endif // #if defined(__IE__OS_LINUX)
+
+            return true;
+        }
+
+        void Close() noexcept
+        {
+#if defined(__IE__OS_LINUX)
+            if (this->m_pDisplayHandle != nullptr)
+                ::XCloseDisplay(this->m_pDisplayHandle);
+
+            this->m_pDisplayHandle = nullptr;
+#endif // #if defined(__IE__OS_LINUX)
+        }
+
+        inline void RegisterWindow(const NativeWindowHandle handle, ::IE::Window& window) { this->m_windows[handle] = &window; }
+
+        void UnregisterWindow(const NativeWindowHandle handle) noexcept
+        {
+            this->m_windows.erase(handle);
+
+            if (this->m_windows.empty())
+                this->Close();
+        }
+
+    public:
+        DisplayManager(const DisplayManager&) = delete;
+        DisplayManager& operator=(const DisplayManager&) = delete;
+
+        static DisplayManager& GetInstance() noexcept
+        {
+            static DisplayManager instance;
+
+            return instance;
+        }
+
+#if defined(__IE__OS_LINUX)
+        inline ::Display* GetDisplayHandle() const noexcept { return this->m_pDisplayHandle; }
+#endif // #if defined(__IE__OS_LINUX)
+
+        inline size_t GetWindowCount() const noexcept { return this->m_windows.size(); }
+
+        // Returns nullptr if the handle isn't one of a running "Window"
+        inline ::IE::Window* LookupWindow(const NativeWindowHandle handle) const noexcept
+        {
+            const auto it = this->m_windows.find(handle);
+
+            return (it == this->m_windows.end()) ? nullptr : it->second;
+        }
+
+        /* Blocks until events are waiting to be processed (true) or until "timeout" nanoseconds elapsed    */
+        /* (false). A negative timeout waits forever. Pending requests (e.g. "Present") are flushed first,  */
+        /* since the server could otherwise be waiting on them to send anything back.                       */
+        bool WaitForEvents(const std::int64_t timeout = -1) noexcept
+        {
+#if defined(__IE__OS_WINDOWS)
+            ::MSG msg;
+            if (::PeekMessageA(&msg, NULL, 0, 0, PM_NOREMOVE))
+                return true;
+
+            const ::DWORD milliseconds = (timeout < 0) ? INFINITE : static_cast<::DWORD>((timeout + 999'999) / 1'000'000);
+
+            return ::MsgWaitForMultipleObjects(0, nullptr, FALSE, milliseconds, QS_ALLINPUT) == WAIT_OBJECT_0;
+#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
+            if (this->m_pDisplayHandle == nullptr)
+                return false;
+
+            // Also moves whatever already arrived on the socket to the event queue
+            if (XEventsQueued(this->m_pDisplayHandle, QueuedAfterFlush) > 0)
+                return true;
+
+            ::pollfd connection{ ConnectionNumber(this->m_pDisplayHandle), POLLIN, 0 };
+
+            const std::int64_t deadline = ::IE::GetMonotonicTime() + timeout;
+
+            for (;;) {
+                ::timespec remainingTime;
+                ::timespec* pRemainingTime = nullptr;
+
+                if (timeout >= 0) {
+                    const std::int64_t remaining = std::max<std::int64_t>(deadline - ::IE::GetMonotonicTime(), 0);
+
+                    remainingTime  = { static_cast<::time_t>(remaining / 1'000'000'000), static_cast<long>(remaining % 1'000'000'000) };
+                    pRemainingTime = &remainingTime;
+                }
+
+                const int result = ::ppoll(&connection, 1u, pRemainingTime, nullptr);
+
+                if (result == 0 || (result < 0 && errno != EINTR))
+                    return false;
+
+                // The data read could have been replies or errors only, keep waiting for an event then
+                if (result > 0 && XEventsQueued(this->m_pDisplayHandle, QueuedAfterReading) > 0)
+                    return true;
+
+                if (connection.revents & (POLLERR | POLLHUP))
+                    return false;
+            }
+#endif // end of #elif defined(__IE__OS_LINUX)
+        }
+
+        /* Dispatches every pending event to its window. Returns true if at least one of them wasn't */
+        /* a completed presentation, i.e. if something happened that could require a redraw.        */
+        bool PumpEvents() noexcept;
+
+        /* Pumps the events and then updates every window, as if "Window::Update" had been called */
+        /* on each of them. Returns true if any window processed events.                          */
+        bool Update() noexcept;
+
+        ~DisplayManager() noexcept
+        {
+            this->Close();
+        }
+
+    }; // DisplayManager
+
+#if defined(__IE__OS_WINDOWS)
+
+    static ::LRESULT CALLBACK WindowsWindowWindowProc(::HWND hwnd, ::UINT msg, ::WPARAM wParam, ::LPARAM lParam);
+
+#endif // #if defined(__IE__OS_WINDOWS)
+
+    enum class WindowBackend : std::uint8_t {
+        NATIVE,    // X11 / Win32, the window isn't running if it couldn't be created
+        HEADLESS,  // Offscreen : memory framebuffers, input is only injected & "Present" returns immediately
+        AUTOMATIC  // NATIVE, falling back to HEADLESS when there is no display server (e.g. on build servers)
+    };
+
+    class Window {
+        friend class DisplayManager;
+
+#if defined(__IE__OS_WINDOWS)
+        friend static ::LRESULT CALLBACK ::IE::WindowsWindowWindowProc(::HWND hwnd, ::UINT msg, ::WPARAM wParam, ::LPARAM lParam);
+#endif // #if defined(__IE__OS_WINDOWS)
+    private:
+#if defined(__IE__OS_WINDOWS)
+        ::HWND m_windowHandle = NULL;
+#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
+        // Shared with the other windows, see "DisplayManager"
+        ::Display* m_pDisplayHandle = nullptr;
+        ::Window   m_windowHandle;
+
+        ::Atom m_deleteMessage;
+#endif // end of #if defined(__IE__OS_LINUX)
+
+        ::IE::Vecu16 m_clientDimensions{ 0, 0 };
+
+        /* Double buffering : the user draws into the back buffer while the front buffer is being presented.  */
+        /* On linux the buffers are System V shared memory segments which the X server reads from directly.   */
+        /* "XShmPutImage" returns before the server is done reading, so a buffer stays "in flight" until its  */
+        /* "ShmCompletion" event arrives. Without MIT-SHM (remote displays), "XPutImage" copies the pixels.   */
+        struct PresentBuffer {
+            ::IE::Framebuffer m_framebuffer;
+
+#if defined(__IE__OS_LINUX)
+            ::XImage*         m_pImage = nullptr;
+            ::XShmSegmentInfo m_shmSegmentInfo{ 0u, -1, nullptr, False };
+
+            bool m_bInFlight = false;
+#endif // #if defined(__IE__OS_LINUX)
+        };
+
+        std::array<PresentBuffer, 2u> m_presentBuffers;
+        size_t m_backBufferIndex = 0u;
+
+#if defined(__IE__OS_LINUX)
+        // Set once the first framebuffer is requested, MIT-SHM isn't used after it failed once
+        bool m_bPresentInitialized = false;
+        bool m_bUseSharedMemory    = false;
+        int  m_shmCompletionEventType = -1;
+#endif // #if defined(__IE__OS_LINUX)
+
+        struct KeyboardData {
+            // Holds wether or not a key is down
+            std::array<bool, 0x100> m_keyStates = { false };
+        } m_keyboardData;
+
+        struct MousePointerData {
+            bool m_bLeftButtonDown  = false;
+            bool m_bRightButtonDown = false;
+
+            ::IE::Vecu16 m_relativeCursorPosition{ 0u, 0u };
+        } m_mousePointerData;
+
+        /* What happened between two "Update"s. Events are accumulated in "m_pendingFrameInput" whenever */
+        /* they are pumped (possibly by another window's "Update" since the connection is shared) and     */
+        /* "Update" publishes them to "m_frameInput".                                                     */
+        struct FrameInput {
+            // Keys that went down / up (both when they were tapped)
+            std::bitset<0x100> m_pressedKeys;
+            std::bitset<0x100> m_releasedKeys;
+
+            // Indexed by "MouseButton", same as the keys
+            std::bitset<8u> m_pressedButtons;
+            std::bitset<8u> m_releasedButtons;
+
+            bool m_bReceivedEvents = false;
+        };
+
+        FrameInput m_frameInput;
+        FrameInput m_pendingFrameInput;
+
+        bool m_bIsRunning = false;
+        bool m_bHeadless  = false;
+
+    public:
+        static constexpr size_t INPUT_EVENT_CAPACITY = 1024u;
+
+    private:
+        /* Every input event is also queued, so that none is lost between two frames. "Update" is the   */
+        /* producer, the consumer can be another thread (a simulation thread for instance). Events that  */
+        /* don't fit in the queue (the consumer being behind) are dropped and counted.                   */
+        ::IE::SPSCRingBuffer<::IE::InputEvent, INPUT_EVENT_CAPACITY> m_inputEvents;
+        std::atomic<std::uint64_t> m_droppedInputEventCount{ 0u };
+
+        std::uint32_t m_lastEventTimestamp = 0u;
+
+        void PushInputEvent(const ::IE::InputEventType type, const std::uint32_t timestamp, const std::uint8_t code, const std::uint16_t x, const std::uint16_t y) noexcept
+        {
+            this->m_lastEventTimestamp = timestamp;
+
+            if (!this->m_inputEvents.TryPush(::IE::InputEvent{ timestamp, type, code, x, y }))
+                this->m_droppedInputEventCount.fetch_add(1u, std::memory_order_relaxed);
+        }
+
+        void OnKey(const std::uint8_t key, const bool bDown, const std::uint32_t timestamp) noexcept
+        {
+            KeyboardData& keyboard = this->m_keyboardData;
+
+            // Auto-repeated presses are queued but aren't new presses
+            if (bDown && !keyboard.m_keyStates[key])
+                this->m_pendingFrameInput.m_pressedKeys.set(key);
+            else if (!bDown && keyboard.m_keyStates[key])
+                this->m_pendingFrameInput.m_releasedKeys.set(key);
+
+            keyboard.m_keyStates[key] = bDown;
+
+            this->PushInputEvent(bDown ? ::IE::InputEventType::KEY_PRESS : ::IE::InputEventType::KEY_RELEASE, timestamp, key,
+                                 this->m_mousePointerData.m_relativeCursorPosition.x, this->m_mousePointerData.m_relativeCursorPosition.y);
+        }
+
+        void OnButton(const std::uint8_t button, const bool bDown, const std::uint16_t x, const std::uint16_t y, const std::uint32_t timestamp) noexcept
+        {
+            MousePointerData& mouse = this->m_mousePointerData;
+
+            FrameInput& frameInput = this->m_pendingFrameInput;
+
+            if (button < frameInput.m_pressedButtons.size())
+                (bDown ? frameInput.m_pressedButtons : frameInput.m_releasedButtons).set(button);
+
+            if (button == static_cast<std::uint8_t>(::IE::MouseButton::LEFT))  mouse.m_bLeftButtonDown  = bDown;
+            if (button == static_cast<std::uint8_t>(::IE::MouseButton::RIGHT)) mouse.m_bRightButtonDown = bDown;
+
+            mouse.m_relativeCursorPosition = { x, y };
+
+            this->PushInputEvent(bDown ? ::IE::InputEventType::BUTTON_PRESS : ::IE::InputEventType::BUTTON_RELEASE, timestamp, button, x, y);
+        }
+
+        void OnPointerMotion(const std::uint16_t x, const std::uint16_t y, const std::uint32_t timestamp) noexcept
+        {
+            this->m_mousePointerData.m_relativeCursorPosition = { x, y };
+
+            this->PushInputEvent(::IE::InputEventType::POINTER_MOTION, timestamp, 0u, x, y);
+        }
+
+        void OnResize(const std::uint16_t width, const std::uint16_t height) noexcept
+        {
+            // Moving the window also sends "ConfigureNotify"
+            if (this->m_clientDimensions.x == width && this->m_clientDimensions.y == height)
+                return;
+
+            this->m_clientDimensions = { width, height };
+
+            this->PushInputEvent(::IE::InputEventType::RESIZE, this->m_lastEventTimestamp, 0u, width, height);
+        }
+
+#if defined(__IE__OS_LINUX)
+        // Called by "DisplayManager::PumpEvents", returns false for completed presentations
+        bool HandleEvent(::XEvent& xEvent) noexcept
+        {
+            if (xEvent.type == this->m_shmCompletionEventType) {
+                this->OnPresentCompleted(reinterpret_cast<const ::XShmCompletionEvent&>(xEvent));
+                return false;
+            }
+
+            this->m_pendingFrameInput.m_bReceivedEvents = true;
+
+            switch (xEvent.type) {
+            // Window Events
+            case ConfigureNotify:
+                this->OnResize(static_cast<std::uint16_t>(xEvent.xconfigure.width),
+                               static_cast<std::uint16_t>(xEvent.xconfigure.height));
+
+                break;
+            case DestroyNotify:
+                this->Close();
+
+                break;
+            case ClientMessage:
+                if ((::Atom)xEvent.xclient.data.l[0] == this->m_deleteMessage)
+                    this->Close();
+
+                break;
+            // Mouse Events
+            case MotionNotify:
+                this->OnPointerMotion(static_cast<std::uint16_t>(xEvent.xmotion.x),
+                                      static_cast<std::uint16_t>(xEvent.xmotion.y),
+                                      static_cast<std::uint32_t>(xEvent.xmotion.time));
+
+                break;
+            case ButtonPress:
+            case ButtonRelease:
+                this->OnButton(static_cast<std::uint8_t>(xEvent.xbutton.button), xEvent.type == ButtonPress,
+                               static_cast<std::uint16_t>(xEvent.xbutton.x),
+                               static_cast<std::uint16_t>(xEvent.xbutton.y),
+                               static_cast<std::uint32_t>(xEvent.xbutton.time));
+
+                break;
+            // Keyboard Events
+            case KeyPress:
+            case KeyRelease:
+                if (const std::uint8_t key = TranslateKeySym(XLookupKeysym(&xEvent.xkey, 0)); key != 0u)
+                    this->OnKey(key, xEvent.type == KeyPress, static_cast<std::uint32_t>(xEvent.xkey.time));
+
+                break;
+            }
+
+            return true;
+        }
+#endif // #if defined(__IE__OS_LINUX)
+
+        // Makes the input accumulated since the last call visible, returns wether any events were received
+        bool PublishFrameInput() noexcept
+        {
+            this->m_frameInput = this->m_pendingFrameInput;
+            this->m_pendingFrameInput = FrameInput{ };
+
+            return this->m_frameInput.m_bReceivedEvents;
+        }
+
+#if defined(__IE__OS_LINUX)
+        /* Maps X key symbols to the codes windows uses for its virtual keys : letters & digits are their */
+        /* upper case ascii code. Returns 0 for keys that aren't tracked.                                */
+        static std::uint8_t TranslateKeySym(const ::KeySym keySym) noexcept
+        {
+            if (keySym < 0x80u)
+                return static_cast<std::uint8_t>(std::toupper(static_cast<int>(keySym)));
+
+            switch (keySym) {
+            case XK_BackSpace: return 0x08u;
+            case XK_Tab:       return 0x09u;
+            case XK_Return:    return 0x0Du;
+            case XK_Escape:    return 0x1Bu;
+            case XK_Shift_L:   case XK_Shift_R:   return 0x10u;
+            case XK_Control_L: case XK_Control_R: return 0x11u;
+            case XK_Alt_L:     case XK_Alt_R:     return 0x12u;
+            case XK_Left:      return 0x25u;
+            case XK_Up:        return 0x26u;
+            case XK_Right:     return 0x27u;
+            case XK_Down:      return 0x28u;
+            case XK_Delete:    return 0x2Eu;
+            default:           return 0u;
+            }
+        }
+#endif // #if defined(__IE__OS_LINUX)
+
+        // Leaves the window untouched when it fails
+        bool CreateNativeWindow(const std::uint16_t width, const std::uint16_t height, const char* title) noexcept
+        {
+#if defined(__IE__OS_WINDOWS)
+            const ::HINSTANCE hInstance = GetModuleHandle(NULL);
+            
+            // Step 1 : Register Window Class
+            ::WNDCLASSA wc = { };
+            {
+                wc.lpfnWndProc   = ::IE::WindowsWindowWindowProc;
+                wc.hInstance     = hInstance;
+                wc.lpszClassName = "IE's Windows Window Class";
+                
+                ::RegisterClassA(&wc);
+            }
+
+            // Step 2 : Create Window
+            {
+                // Get The Desired Window Rect From The desired Client Rect
+                ::RECT rect{ 0u, 0u, width, height };
+                if (::AdjustWindowRect(&rect, WS_OVERLAPPEDWINDOW, false) == 0)
+                    return false;
+
+                // Create Window
+                this->m_windowHandle = ::CreateWindowExA(NULL, wc.lpszClassName, title, WS_OVERLAPPEDWINDOW,
+                                                         CW_USEDEFAULT, CW_USEDEFAULT, rect.right - rect.left, rect.bottom - rect.top,
+                                                         NULL, NULL, hInstance, NULL);
+
+                if (this->m_windowHandle == NULL) return false;
+            }
+
+            // Step 4 : Set Window Pointer To "this"
+            {
+#if defined(__IE__PLATFORM_X64)
+                SetWindowLongPtrA(this->m_windowHandle, GWLP_USERDATA, (LONG_PTR)this);
+#else // end of #if defined(__IE__PLATFORM_X64)
+                SetWindowLongA(this->m_windowHandle, GWLP_USERDATA, (LONG)this);
+#endif// end of else
+            }
+#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
+
+            // Fetch Display
+            ::IE::DisplayManager& displayManager = ::IE::DisplayManager::GetInstance();
+
+            if (!displayManager.Open()) return false;
+
+            this->m_pDisplayHandle = displayManager.GetDisplayHandle();
+
+            // Create Window
+            this->m_windowHandle = ::XCreateSimpleWindow(this->m_pDisplayHandle, DefaultRootWindow(this->m_pDisplayHandle),
+                                                         0, 0, width, height, 0,
+                                                         BlackPixel(this->m_pDisplayHandle, 0), WhitePixel(this->m_pDisplayHandle, 0));
+
+            // Receive WM_DELETE_WINDOW messages
+            this->m_deleteMessage = displayManager.m_deleteMessage;
+            ::XSetWMProtocols(this->m_pDisplayHandle, this->m_windowHandle, &this->m_deleteMessage, 1);
+
+            // Set Title
+            ::XSetStandardProperties(this->m_pDisplayHandle, this->m_windowHandle, title, title, None, NULL, 0, NULL);
+
+            // Select Input Masks
+            constexpr const long xEventMasks = ExposureMask | StructureNotifyMask | // Window
+                                               PointerMotionMask | ButtonPressMask | ButtonReleaseMask | // Mouse
+                                               KeyPressMask | KeyReleaseMask; // Keyboard
+
+            ::XSelectInput(this->m_pDisplayHandle, this->m_windowHandle, xEventMasks);
+#endif // end of #if defined(__IE__OS_LINUX)
+
+            ::IE::DisplayManager::GetInstance().RegisterWindow(this->m_windowHandle, *this);
+
+            return true;
+        }
+
+    public:
+        Window(const std::uint16_t width, const std::uint16_t height, const char* title, const ::IE::WindowBackend backend = ::IE::WindowBackend::NATIVE) noexcept
+            : m_clientDimensions(width, height)
+        {
+            if (backend != ::IE::WindowBackend::HEADLESS && this->CreateNativeWindow(width, height, title))
+                this->Show();
+            else if (backend == ::IE::WindowBackend::NATIVE)
+                return;
+            else
+                this->m_bHeadless = true;
+
+            this->m_bIsRunning = true;
+        }
+
+        bool Show() const noexcept
+        {
+            if (this->m_bHeadless) return true;
+
+#if defined(__IE__OS_WINDOWS)
+            return ::ShowWindow(this->m_windowHandle, SW_SHOW);
+#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
+            ::XMapWindow(this->m_pDisplayHandle, this->m_windowHandle);
+            ::XFlush(this->m_pDisplayHandle);
+
+            return true;
+#endif // end of #if defined(__IE__OS_LINUX)
+        }
+        
+        bool Minimize() const noexcept
+        {
+            if (this->m_bHeadless) return true;
+
+#if defined(__IE__OS_WINDOWS)
+            return ::ShowWindow(this->m_windowHandle, SW_MINIMIZE);
+#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
+            ::XUnmapWindow(this->m_pDisplayHandle, this->m_windowHandle);
+            ::XFlush(this->m_pDisplayHandle);
+
+            return true;
+#endif // end of #if defined(__IE__OS_LINUX)       
+       }
+
+    private:
+#if defined(__IE__OS_LINUX)
+        // Must be called with a free buffer. Leaves the buffer empty when it couldn't be allocated
+        bool AllocateSharedPresentBuffer(PresentBuffer& buffer, ::Visual* pVisual, const int depth, const size_t stride, const std::uint16_t height) noexcept
+        {
+            ::XShmSegmentInfo& segmentInfo = buffer.m_shmSegmentInfo;
+
+            buffer.m_pImage = ::XShmCreateImage(this->m_pDisplayHandle, pVisual, static_cast<unsigned int>(depth), ZPixmap, nullptr,
+                                                &segmentInfo, static_cast<unsigned int>(stride), height);
+
+            if (buffer.m_pImage == nullptr) return false;
+
+            // The server reads the segment as is, so its pixel layout must already be BGRA
+            if (buffer.m_pImage->bits_per_pixel != 32 || buffer.m_pImage->byte_order != LSBFirst ||
+                static_cast<size_t>(buffer.m_pImage->bytes_per_line) != stride * sizeof(std::uint32_t)) {
+                XDestroyImage(buffer.m_pImage);
+                buffer.m_pImage = nullptr;
+                return false;
+            }
+
+            segmentInfo.shmid = ::shmget(IPC_PRIVATE, stride * sizeof(std::uint32_t) * height, IPC_CREAT | 0600);
+
+            if (segmentInfo.shmid >= 0) {
+                void* const pSegment = ::shmat(segmentInfo.shmid, nullptr, 0);
+
+                if (pSegment != reinterpret_cast<void*>(-1)) {
+                    segmentInfo.shmaddr  = static_cast<char*>(pSegment);
+                    segmentInfo.readOnly = False;
+
+                    // "XShmAttach" fails asynchronously (e.g. when the server runs on another machine)
+                    static bool bAttachFailed;
+                    bAttachFailed = false;
+
+                    ::XSync(this->m_pDisplayHandle, False);
+                    const auto previousErrorHandler = ::XSetErrorHandler([](::Display*, ::XErrorEvent*) -> int { bAttachFailed = true; return 0; });
+                    const Bool bAttached = ::XShmAttach(this->m_pDisplayHandle, &segmentInfo);
+                    ::XSync(this->m_pDisplayHandle, False);
+                    ::XSetErrorHandler(previousErrorHandler);
+
+                    if (bAttached && !bAttachFailed) {
+                        // The segment is destroyed as soon as both the server and this process have detached from it
+                        ::shmctl(segmentInfo.shmid, IPC_RMID, nullptr);
+
+                        buffer.m_pImage->data = segmentInfo.shmaddr;
+                        buffer.m_framebuffer.m_pPixels = reinterpret_cast<std::uint32_t*>(segmentInfo.shmaddr);
+
+                        return true;
+                    }
+
+                    ::shmdt(pSegment);
+                    segmentInfo.shmaddr = nullptr;
+                }
+
+                ::shmctl(segmentInfo.shmid, IPC_RMID, nullptr);
+                segmentInfo.shmid = -1;
+            }
+
+            XDestroyImage(buffer.m_pImage);
+            buffer.m_pImage = nullptr;
+
+            return false;
+        }
+#endif // #if defined(__IE__OS_LINUX)
+
+#if defined(__IE__OS_LINUX)
+        // XImages wrapping either shared memory segments or (without MIT-SHM) memory buffers
+        bool AllocateImagePresentBuffers(const size_t stride, const std::uint16_t height) noexcept
+        {
+            ::Visual* const pVisual = DefaultVisual(this->m_pDisplayHandle, DefaultScreen(this->m_pDisplayHandle));
+            const int       depth   = DefaultDepth(this->m_pDisplayHandle, DefaultScreen(this->m_pDisplayHandle));
+
+            // The pixels are handed to the server untouched, which only works for 8 bits per channel visuals
+            if ((depth != 24 && depth != 32) || pVisual->red_mask != 0xFF0000u || pVisual->green_mask != 0x00FF00u || pVisual->blue_mask != 0x0000FFu)
+                return false;
+
+            if (this->m_bUseSharedMemory) {
+                for (PresentBuffer& buffer : this->m_presentBuffers) {
+                    if (!this->AllocateSharedPresentBuffer(buffer, pVisual, depth, stride, height)) {
+                        this->ReleasePresentBuffers();
+                        this->m_bUseSharedMemory = false;
+                        break;
+                    }
+                }
+            }
+
+            if (!this->m_bUseSharedMemory) {
+                if (!this->AllocateMemoryPresentBuffers(stride, height))
+                    return false;
+
+                for (PresentBuffer& buffer : this->m_presentBuffers) {
+                    buffer.m_pImage = ::XCreateImage(this->m_pDisplayHandle, pVisual, static_cast<unsigned int>(depth), ZPixmap, 0, reinterpret_cast<char*>(buffer.m_framebuffer.m_pPixels),
+                                                     static_cast<unsigned int>(stride), height, 32, static_cast<int>(stride * sizeof(std::uint32_t)));
+
+                    if (buffer.m_pImage == nullptr) {
+                        this->ReleasePresentBuffers();
+                        return false;
+                    }
+
+                    // Xlib converts the pixels to the server's byte order if needed
+                    buffer.m_pImage->byte_order = LSBFirst;
+                }
+            }
+
+            return true;
+        }
+#endif // #if defined(__IE__OS_LINUX)
+
+        // Plain memory buffers, released with "ReleasePresentBuffers" like the others
+        bool AllocateMemoryPresentBuffers(const size_t stride, const std::uint16_t height) noexcept
+        {
+            for (PresentBuffer& buffer : this->m_presentBuffers) {
+                void* const pPixels = ::operator new(stride * sizeof(std::uint32_t) * height, std::align_val_t{ ::IE::Framebuffer::ROW_ALIGNMENT }, std::nothrow);
+
+                if (pPixels == nullptr) {
+                    this->ReleasePresentBuffers();
+                    return false;
+                }
+
+                buffer.m_framebuffer.m_pPixels = static_cast<std::uint32_t*>(pPixels);
+            }
+
+            return true;
+        }
+
+        void AllocatePresentBuffers(const std::uint16_t width, const std::uint16_t height) noexcept
+        {
+            if (width == 0u || height == 0u) return;
+
+            const size_t stride = ::IE::Framebuffer::GetStrideForWidth(width);
+
+#if defined(__IE__OS_LINUX)
+            const bool bAllocated = this->m_bHeadless ? this->AllocateMemoryPresentBuffers(stride, height)
+                                                      : this->AllocateImagePresentBuffers(stride, height);
+#else // end of #if defined(__IE__OS_LINUX)
+            const bool bAllocated = this->AllocateMemoryPresentBuffers(stride, height);
+#endif // end of #else
+
+            if (!bAllocated) return;
+
+            for (PresentBuffer& buffer : this->m_presentBuffers) {
+                buffer.m_framebuffer.m_stride = stride;
+                buffer.m_framebuffer.m_width  = width;
+                buffer.m_framebuffer.m_height = height;
+            }
+        }
+
+        void ReleasePresentBuffers() noexcept
+        {
+            if (this->m_presentBuffers[0].m_framebuffer.m_pPixels == nullptr && this->m_presentBuffers[1].m_framebuffer.m_pPixels == nullptr)
+                return;
+
+#if defined(__IE__OS_LINUX)
+            // Once the server answers, it has processed every put request and thus no longer reads any buffer
+            if (!this->m_bHeadless)
+                ::XSync(this->m_pDisplayHandle, False);
+#endif // #if defined(__IE__OS_LINUX)
+
+            for (PresentBuffer& buffer : this->m_presentBuffers) {
+#if defined(__IE__OS_LINUX)
+                if (buffer.m_pImage != nullptr) {
+                    // "XDestroyImage" would "free" the pixels
+                    buffer.m_pImage->data = nullptr;
+                    XDestroyImage(buffer.m_pImage);
+                    buffer.m_pImage = nullptr;
+                }
+
+                if (buffer.m_shmSegmentInfo.shmaddr != nullptr) {
+                    ::XShmDetach(this->m_pDisplayHandle, &buffer.m_shmSegmentInfo);
+                    ::shmdt(buffer.m_shmSegmentInfo.shmaddr);
+
+                    buffer.m_shmSegmentInfo = ::XShmSegmentInfo{ 0u, -1, nullptr, False };
+                } else if (buffer.m_framebuffer.m_pPixels != nullptr) {
+                    ::operator delete(buffer.m_framebuffer.m_pPixels, std::align_val_t{ ::IE::Framebuffer::ROW_ALIGNMENT });
+                }
+
+                buffer.m_bInFlight = false;
+#else // end of #if defined(__IE__OS_LINUX)
+                if (buffer.m_framebuffer.m_pPixels != nullptr)
+                    ::operator delete(buffer.m_framebuffer.m_pPixels, std::align_val_t{ ::IE::Framebuffer::ROW_ALIGNMENT });
+#endif // end of #else
+
+                buffer.m_framebuffer = ::IE::Framebuffer{};
+            }
+        }
+
+#if defined(__IE__OS_LINUX)
+        void WaitForPresentCompletion(PresentBuffer& buffer) noexcept
+        {
+            struct CompletionFilter {
+                int      m_eventType;
+                ::ShmSeg m_segment;
+            } filter{ this->m_shmCompletionEventType, buffer.m_shmSegmentInfo.shmseg };
+
+            // Only removes the buffer's completion event from the queue, the others are left for "Update"
+            ::XEvent xEvent;
+            ::XIfEvent(this->m_pDisplayHandle, &xEvent, [](::Display*, ::XEvent* pEvent, ::XPointer pFilter) -> Bool {
+                const CompletionFilter& filter = *reinterpret_cast<const CompletionFilter*>(pFilter);
+
+                return pEvent->type == filter.m_eventType &&
+                       reinterpret_cast<const ::XShmCompletionEvent*>(pEvent)->shmseg == filter.m_segment;
+            }, reinterpret_cast<::XPointer>(&filter));
+
+            buffer.m_bInFlight = false;
+        }
+
+        void OnPresentCompleted(const ::XShmCompletionEvent& completionEvent) noexcept
+        {
+            for (PresentBuffer& buffer : this->m_presentBuffers)
+                if (buffer.m_shmSegmentInfo.shmseg == completionEvent.shmseg)
+                    buffer.m_bInFlight = false;
+        }
+#endif // #if defined(__IE__OS_LINUX)
+
+    public:
+        /* Returns the back buffer, sized to the client area. The buffers are reallocated when the window   */
+        /* has been resized since the last call, which discards their content. The returned framebuffer is  */
+        /* only valid until the next call to "Present".                                                     */
+        ::IE::Framebuffer& GetFramebuffer() noexcept
+        {
+            // The buffers are released (and thus empty) once the window is closed
+            if (!this->m_bIsRunning)
+                return this->m_presentBuffers[this->m_backBufferIndex].m_framebuffer;
+
+#if defined(__IE__OS_LINUX)
+            if (!this->m_bHeadless && !this->m_bPresentInitialized) {
+                int majorVersion, minorVersion;
+                Bool bSharedPixmaps;
+
+                this->m_bUseSharedMemory = ::XShmQueryVersion(this->m_pDisplayHandle, &majorVersion, &minorVersion, &bSharedPixmaps);
+
+                if (this->m_bUseSharedMemory)
+                    this->m_shmCompletionEventType = ::XShmGetEventBase(this->m_pDisplayHandle) + ShmCompletion;
+
+                this->m_bPresentInitialized = true;
+            }
+#endif // #if defined(__IE__OS_LINUX)
+
+            const ::IE::Framebuffer& current = this->m_presentBuffers[this->m_backBufferIndex].m_framebuffer;
+
+            if (current.m_width != this->m_clientDimensions.x || current.m_height != this->m_clientDimensions.y) {
+                this->ReleasePresentBuffers();
+                this->AllocatePresentBuffers(this->m_clientDimensions.x, this->m_clientDimensions.y);
+            }
+
+            PresentBuffer& backBuffer = this->m_presentBuffers[this->m_backBufferIndex];
+
+#if defined(__IE__OS_LINUX)
+            if (backBuffer.m_bInFlight)
+                this->WaitForPresentCompletion(backBuffer);
+#endif // #if defined(__IE__OS_LINUX)
+
+            return backBuffer.m_framebuffer;
+        }
+
+        // Shows the back buffer (as returned by "GetFramebuffer") and swaps the buffers
+        void Present() noexcept
+        {
+            PresentBuffer& backBuffer = this->m_presentBuffers[this->m_backBufferIndex];
+            const ::IE::Framebuffer& framebuffer = backBuffer.m_framebuffer;
+
+            if (!framebuffer.IsValid()) return;
+
+            // Nothing to show or wait for, see "GetPresentedFramebuffer"
+            if (this->m_bHeadless) {
+                this->m_backBufferIndex ^= 1u;
+                return;
+            }
+
+#if defined(__IE__OS_WINDOWS)
+            ::BITMAPINFO bitmapInfo = { };
+            bitmapInfo.bmiHeader.biSize        = sizeof(::BITMAPINFOHEADER);
+            bitmapInfo.bmiHeader.biWidth       = static_cast<::LONG>(framebuffer.m_stride);
+            bitmapInfo.bmiHeader.biHeight      = -static_cast<::LONG>(framebuffer.m_height); // Top-Down
+            bitmapInfo.bmiHeader.biPlanes      = 1;
+            bitmapInfo.bmiHeader.biBitCount    = 32;
+            bitmapInfo.bmiHeader.biCompression = BI_RGB;
+
+            const ::HDC deviceContext = ::GetDC(this->m_windowHandle);
+            ::SetDIBitsToDevice(deviceContext, 0, 0, framebuffer.m_width, framebuffer.m_height, 0, 0, 0, framebuffer.m_height,
+                                framebuffer.m_pPixels, &bitmapInfo, DIB_RGB_COLORS);
+            ::ReleaseDC(this->m_windowHandle, deviceContext);
+#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
+            const ::GC graphicsContext = DefaultGC(this->m_pDisplayHandle, DefaultScreen(this->m_pDisplayHandle));
+
+            if (this->m_bUseSharedMemory) {
+                ::XShmPutImage(this->m_pDisplayHandle, this->m_windowHandle, graphicsContext, backBuffer.m_pImage,
+                               0, 0, 0, 0, framebuffer.m_width, framebuffer.m_height, True);
+
+                backBuffer.m_bInFlight = true;
+            } else {
+                ::XPutImage(this->m_pDisplayHandle, this->m_windowHandle, graphicsContext, backBuffer.m_pImage,
+                            0, 0, 0, 0, framebuffer.m_width, framebuffer.m_height);
+            }
+
+            ::XFlush(this->m_pDisplayHandle);
+#endif // end of #elif defined(__IE__OS_LINUX)
+
+            this->m_backBufferIndex ^= 1u;
+        }
+
+        /* The framebuffer shown by the last "Present" (empty before the first one), e.g. to read back what  */
+        /* a headless window rendered. Native windows may still be sending it to the display server.       */
+        inline const ::IE::Framebuffer& GetPresentedFramebuffer() const noexcept { return this->m_presentBuffers[this->m_backBufferIndex ^ 1u].m_framebuffer; }
+
+        // Wether or not the framebuffers are shared with the X server (always false on other platforms)
+        inline bool IsFramebufferShared() const noexcept
+        {
+#if defined(__IE__OS_LINUX)
+            return this->m_bUseSharedMemory && this->m_presentBuffers[0].m_pImage != nullptr;
+#else // end of #if defined(__IE__OS_LINUX)
+            return false;
+#endif // end of #else
+        }
+
+        inline bool IsRunning()  const noexcept { return this->m_bIsRunning; }
+        inline bool IsHeadless() const noexcept { return this->m_bHeadless;  }
+
+        // Keyboard
+        inline bool IsKeyUp  (const std::uint8_t key) const noexcept { return !this->m_keyboardData.m_keyStates[key]; }
+        inline bool IsKeyDown(const std::uint8_t key) const noexcept { return this->m_keyboardData.m_keyStates[key];  }
+
+        // Mouse
+        inline bool IsLeftButtonUp()    const noexcept { return !this->m_mousePointerData.m_bLeftButtonDown;  }
+        inline bool IsLeftButtonDown()  const noexcept { return this->m_mousePointerData.m_bLeftButtonDown;   }
+        inline bool IsRightButtonUp()   const noexcept { return !this->m_mousePointerData.m_bRightButtonDown; }
+        inline bool IsRightButtonDown() const noexcept { return this->m_mousePointerData.m_bRightButtonDown;  }
+
+        inline ::IE::Vecu16 GetRelativeCursorPosition() const noexcept { return this->m_mousePointerData.m_relativeCursorPosition; }
+
+        // Window Dimensions
+        inline ::IE::Vecu16  GetClientDimensions() const noexcept { return this->m_clientDimensions;   }
+        inline std::uint16_t GetClientWidth()      const noexcept { return this->m_clientDimensions.x; }
+        inline std::uint16_t GetClientHeight()     const noexcept { return this->m_clientDimensions.y; }
+
+        // Pressed / released during the last "Update"
+        inline bool WasKeyPressed (const std::uint8_t key) const noexcept { return this->m_frameInput.m_pressedKeys.test(key);  }
+        inline bool WasKeyReleased(const std::uint8_t key) const noexcept { return this->m_frameInput.m_releasedKeys.test(key); }
+
+        inline bool WasButtonPressed (const ::IE::MouseButton button) const noexcept { return this->m_frameInput.m_pressedButtons.test(static_cast<size_t>(button));  }
+        inline bool WasButtonReleased(const ::IE::MouseButton button) const noexcept { return this->m_frameInput.m_releasedButtons.test(static_cast<size_t>(button)); }
+
+        /* Consumer side of the input event queue, may be called from any one thread other than the one   */
+        /* calling "Update" without locking. Returns false when there are no more events.                  */
+        inline bool PollInputEvent(::IE::InputEvent& event) noexcept { return this->m_inputEvents.TryPop(event); }
+
+        inline size_t PollInputEvents(const std::span<::IE::InputEvent> events) noexcept { return this->m_inputEvents.TryPopBulk(events); }
+
+        inline std::uint64_t GetDroppedInputEventCount() const noexcept { return this->m_droppedInputEventCount.load(std::memory_order_relaxed); }
+
+        /* Waits for events on the connection shared by every window, see "DisplayManager::WaitForEvents".  */
+        /* Headless windows only receive injected events, which can't arrive while waiting : they return    */
+        /* immediately when no timeout is given and sleep for the timeout otherwise.                         */
+        bool WaitForEvents(const std::int64_t timeout = -1) noexcept
+        {
+            if (!this->m_bIsRunning)
+                return false;
+
+            if (this->m_bHeadless) {
+                if (this->m_pendingFrameInput.m_bReceivedEvents)
+                    return true;
+
+                if (timeout > 0)
+                    ::IE::SleepUntil(::IE::GetMonotonicTime() + timeout);
+
+                return false;
+            }
+
+            return ::IE::DisplayManager::GetInstance().WaitForEvents(timeout);
+        }
+
+        /* Pumps the pending events (those of the other windows are dispatched to them too) and publishes */
+        /* what happened since the last call. Returns true if the window processed events other than     */
+        /* completed presentations, i.e. if something happened that could require a redraw.               */
+        bool Update() noexcept
+        {
+            if (!this->m_bHeadless)
+                ::IE::DisplayManager::GetInstance().PumpEvents();
+
+            return this->PublishFrameInput();
+        }
+
+        // Timestamp of events injected now, on the same clock as the X server's
+        static inline std::uint32_t GetCurrentEventTime() noexcept { return static_cast<std::uint32_t>(::IE::GetMonotonicTime() / 1'000'000); }
+
+        /* Synthetic input, handled like the events of the display server : queued & visible in the per- */
+        /* frame state after the next "Update". Injecting a resize into a native window only changes the */
+        /* size of its framebuffers, not the one of the window itself.                                    */
+        void InjectKey(const std::uint8_t key, const bool bDown, const std::uint32_t timestamp = GetCurrentEventTime()) noexcept
+        {
+            this->m_pendingFrameInput.m_bReceivedEvents = true;
+            this->OnKey(key, bDown, timestamp);
+        }
+
+        void InjectButton(const ::IE::MouseButton button, const bool bDown, const std::uint16_t x, const std::uint16_t y, const std::uint32_t timestamp = GetCurrentEventTime()) noexcept
+        {
+            this->m_pendingFrameInput.m_bReceivedEvents = true;
+            this->OnButton(static_cast<std::uint8_t>(button), bDown, x, y, timestamp);
+        }
+
+        void InjectPointerMotion(const std::uint16_t x, const std::uint16_t y, const std::uint32_t timestamp = GetCurrentEventTime()) noexcept
+        {
+            this->m_pendingFrameInput.m_bReceivedEvents = true;
+            this->OnPointerMotion(x, y, timestamp);
+        }
+
+        void InjectResize(const std::uint16_t width, const std::uint16_t height) noexcept
+        {
+            this->m_pendingFrameInput.m_bReceivedEvents = true;
+            this->OnResize(width, height);
+        }
+
+        void Close()
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(this->m_bIsRunning);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            this->ReleasePresentBuffers();
+
+            if (this->m_bHeadless) {
+                this->m_bIsRunning = false;
+                return;
+            }
+
+#if defined(__IE__OS_WINDOWS)
+            ::CloseWindow(this->m_windowHandle);
+#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
+            // Destroy Window (the display is closed along with the last window)
+            ::XDestroyWindow(this->m_pDisplayHandle, this->m_windowHandle);
+            ::XFlush(this->m_pDisplayHandle);
+
+            this->m_pDisplayHandle = nullptr;
+#endif // end of #elif defined(__IE__OS_LINUX)
+
+            ::IE::DisplayManager::GetInstance().UnregisterWindow(this->m_windowHandle);
+
+            this->m_bIsRunning = false;
+        }
+
+        ~Window() noexcept
+        {
+            if (this->m_bIsRunning)
+                this->Close();
+        }
+
+    }; // Window
+
+#if defined(__IE__OS_WINDOWS)
+
+    static ::LRESULT CALLBACK WindowsWindowWindowProc(::HWND hwnd, ::UINT msg, ::WPARAM wParam, ::LPARAM lParam)
+    {
+#ifdef __IE__PLATFORM_X64
+        Window* pWindow = reinterpret_cast<::IE::Window*>(::GetWindowLongPtrA(hwnd, GWLP_USERDATA));
+#else // end of #ifdef __IE__PLATFORM_X64
+        Window* pWindow = reinterpret_cast<::IE::Window*>(::GetWindowLongA(hwnd, GWLP_USERDATA));
+#endif // end of #else
+
+        if (pWindow != nullptr) {
+            Window& window = *pWindow;
+
+            window.m_pendingFrameInput.m_bReceivedEvents = true;
+
+            const std::uint32_t timestamp = static_cast<std::uint32_t>(::GetMessageTime());
+            const std::uint16_t x = static_cast<std::uint16_t>(GET_X_LPARAM(lParam));
+            const std::uint16_t y = static_cast<std::uint16_t>(GET_Y_LPARAM(lParam));
+
+            switch (msg) {
+            // Window Events
+            case WM_SIZE:
+                window.m_lastEventTimestamp = timestamp;
+                window.OnResize(x, y);
+
+                return 0;
+            case WM_DESTROY:
+                window.Close();
+
+                return 0;
+            // Mouse Events
+            case WM_MOUSEMOVE:
+                window.OnPointerMotion(x, y, timestamp);
+
+                return 0;
+            case WM_LBUTTONDOWN:
+            case WM_LBUTTONUP:
+                window.OnButton(static_cast<std::uint8_t>(::IE::MouseButton::LEFT), msg == WM_LBUTTONDOWN, x, y, timestamp);
+
+                return 0;
+            case WM_MBUTTONDOWN:
+            case WM_MBUTTONUP:
+                window.OnButton(static_cast<std::uint8_t>(::IE::MouseButton::MIDDLE), msg == WM_MBUTTONDOWN, x, y, timestamp);
+
+                return 0;
+            case WM_RBUTTONDOWN:
+            case WM_RBUTTONUP:
+                window.OnButton(static_cast<std::uint8_t>(::IE::MouseButton::RIGHT), msg == WM_RBUTTONDOWN, x, y, timestamp);
+
+                return 0;
+            // Keyboard Events
+            case WM_KEYDOWN:
+            case WM_KEYUP:
+                window.OnKey(static_cast<std::uint8_t>(wParam), msg == WM_KEYDOWN, timestamp);
+
+                return 0;
+            }
+        }
+
+        return ::DefWindowProcA(hwnd, msg, wParam, lParam);
+    }
+
+#endif // #if defined(__IE__OS_WINDOWS)
+
+    // Defined once "Window" is complete
+    inline bool DisplayManager::PumpEvents() noexcept
+    {
+        bool bProcessedEvents = false;
+
+#if defined(__IE__OS_WINDOWS)
+        ::MSG msg = { };
+        while (::PeekMessageA(&msg, NULL, 0, 0, PM_REMOVE) > 0) {
+            ::TranslateMessage(&msg);
+            ::DispatchMessageA(&msg);
+
+            bProcessedEvents = true;
+        }
+#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
+        // The connection is closed along with the last window, which an event can close
+        ::XEvent xEvent;
+        while (this->m_pDisplayHandle != nullptr && XPending(this->m_pDisplayHandle)) {
+            XNextEvent(this->m_pDisplayHandle, &xEvent);
+
+            // Events of windows that were already closed (e.g. their "DestroyNotify") are dropped
+            if (::IE::Window* const pWindow = this->LookupWindow(xEvent.xany.window); pWindow != nullptr)
+                bProcessedEvents |= pWindow->HandleEvent(xEvent);
+        }
+#endif // end of #elif defined(__IE__OS_LINUX)
+
+        return bProcessedEvents;
+    }
+
+    inline bool DisplayManager::Update() noexcept
+    {
+        this->PumpEvents();
+
+        bool bProcessedEvents = false;
+
+        for (const auto& [handle, pWindow] : this->m_windows)
+            bProcessedEvents |= pWindow->PublishFrameInput();
+
+        return bProcessedEvents;
+    }
+
+    // +---------------+     +----------+
+    // | Window System | --> | Run Loop |
+    // +---------------+     +----------+
+
+    /* Drives a window without spinning : the thread sleeps on the window's connection until an event    */
+    /* arrives or until the next fixed update is due. "Run(fixedUpdate, frame)" calls "fixedUpdate()"     */
+    /* once per elapsed time step (none when the time step is 0) and then "frame()" if events were        */
+    /* processed or the simulation advanced. A frame rate limit, if any, is applied after each frame.     */
+    /* With no time step, an idle window doesn't wake up at all.                                          */
+    class RunLoop {
+    public:
+        // Beyond this many late updates, the simulation is slowed down instead of catching up
+        static constexpr std::uint32_t MAX_CATCH_UP_UPDATES = 8u;
+
+    private:
+        ::IE::Window& m_window;
+
+        std::int64_t       m_fixedTimeStep; // Nanoseconds
+        ::IE::FrameLimiter m_frameLimiter;
+
+    public:
+        explicit RunLoop(::IE::Window& window, const std::int64_t fixedTimeStep = 0) noexcept
+            : m_window(window), m_fixedTimeStep((fixedTimeStep < 0) ? 0 : fixedTimeStep)
+        {  }
+
+        inline std::int64_t GetFixedTimeStep() const noexcept { return this->m_fixedTimeStep; }
+
+        inline void SetFixedTimeStep(const std::int64_t fixedTimeStep) noexcept { this->m_fixedTimeStep = (fixedTimeStep < 0) ? 0 : fixedTimeStep; }
+
+        // 0 : unlimited
+        inline void SetFrameRateLimit(const std::uint32_t framesPerSecond) noexcept { this->m_frameLimiter = ::IE::FrameLimiter(framesPerSecond); }
+
+        template <typename _FixedUpdateFn, typename _FrameFn>
+        void Run(_FixedUpdateFn&& fixedUpdate, _FrameFn&& frame)
+        {
+            std::int64_t nextUpdateTime = ::IE::GetMonotonicTime() + this->m_fixedTimeStep;
+
+            this->m_frameLimiter.Reset();
+
+            // The first frame is drawn before any event comes in
+            bool bRedraw = true;
+
+            while (this->m_window.IsRunning()) {
+                if (!bRedraw) {
+                    const std::int64_t timeout = (this->m_fixedTimeStep == 0) ? -1 : std::max<std::int64_t>(nextUpdateTime - ::IE::GetMonotonicTime(), 0);
+
+                    this->m_window.WaitForEvents(timeout);
+                }
+
+                bRedraw |= this->m_window.Update();
+
+                if (!this->m_window.IsRunning())
+                    break;
+
+                if (this->m_fixedTimeStep != 0) {
+                    const std::int64_t now = ::IE::GetMonotonicTime();
+
+                    for (std::uint32_t updateCount = 0u; now >= nextUpdateTime; ++updateCount) {
+                        if (updateCount == MAX_CATCH_UP_UPDATES) {
+                            nextUpdateTime = now + this->m_fixedTimeStep;
+                            break;
+                        }
+
+                        fixedUpdate();
+
+                        nextUpdateTime += this->m_fixedTimeStep;
+                        bRedraw = true;
+                    }
+                }
+
+                if (bRedraw && this->m_window.IsRunning()) {
+                    frame();
+
+                    this->m_frameLimiter.Wait();
+                    bRedraw = false;
+                }
+            }
+        }
+
+    }; // RunLoop
+
+    // +------------+
+    // | Rasterizer |
+    // +------------+
+
+    /* Color (BGRA, see "Framebuffer") & depth buffers drawn to by the "Rasterizer". Rows are 64 byte  */
+    /* aligned and both buffers are padded to whole 8x8 pixel blocks, so the rasterization kernels can */
+    /* always process full blocks. "IsValid" is false when the buffers couldn't be allocated.           */
+    class RenderTarget {
+    public:
+        static constexpr size_t BLOCK_SIZE = 8u;
+
+    private:
+        std::uint32_t* m_pColors = nullptr;
+        float*         m_pDepths = nullptr;
+        size_t         m_stride  = 0u; // Distance between the start of two rows, in pixels
+
+        std::uint16_t m_width  = 0u;
+        std::uint16_t m_height = 0u;
+
+        inline size_t GetPaddedHeight() const noexcept { return (static_cast<size_t>(this->m_height) + BLOCK_SIZE - 1u) & ~(BLOCK_SIZE - 1u); }
+
+    public:
+        RenderTarget(const std::uint16_t width, const std::uint16_t height) noexcept
+        {
+            if (width == 0u || height == 0u) return;
+
+            this->m_width  = width;
+            this->m_height = height;
+            this->m_stride = ::IE::Framebuffer::GetStrideForWidth(width);
+
+            const size_t pixelCount = this->m_stride * this->GetPaddedHeight();
+
+            // Both buffers share one allocation, the depths start on a row boundary
+            void* const pMemory = ::operator new(pixelCount * (sizeof(std::uint32_t) + sizeof(float)), std::align_val_t{ ::IE::Framebuffer::ROW_ALIGNMENT }, std::nothrow);
+
+            if (pMemory == nullptr) {
+                this->m_width  = 0u;
+                this->m_height = 0u;
+                this->m_stride = 0u;
+
+                return;
+            }
+
+            this->m_pColors = static_cast<std::uint32_t*>(pMemory);
+            this->m_pDepths = reinterpret_cast<float*>(this->m_pColors + pixelCount);
+
+            this->Clear(0xFF000000u);
+        }
+
+        RenderTarget(const ::IE::RenderTarget&) = delete;
+        ::IE::RenderTarget& operator=(const ::IE::RenderTarget&) = delete;
+
+        ~RenderTarget() noexcept
+        {
+            if (this->m_pColors != nullptr)
+                ::operator delete(this->m_pColors, std::align_val_t{ ::IE::Framebuffer::ROW_ALIGNMENT });
+        }
+
+        inline bool IsValid() const noexcept { return this->m_pColors != nullptr; }
+
+        inline std::uint16_t GetWidth()      const noexcept { return this->m_width;  }
+        inline std::uint16_t GetHeight()     const noexcept { return this->m_height; }
+        inline ::IE::Vecu16  GetDimensions() const noexcept { return ::IE::Vecu16(this->m_width, this->m_height); }
+        inline size_t        GetStride()     const noexcept { return this->m_stride; }
+
+        inline std::uint32_t*       GetColors()       noexcept { return this->m_pColors; }
+        inline const std::uint32_t* GetColors() const noexcept { return this->m_pColors; }
+        inline float*               GetDepths()       noexcept { return this->m_pDepths; }
+        inline const float*         GetDepths() const noexcept { return this->m_pDepths; }
+
+        inline const std::uint32_t* GetColorRow(const std::uint16_t y) const noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(y < this->m_height);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            return this->m_pColors + static_cast<size_t>(y) * this->m_stride;
+        }
+
+        inline const float* GetDepthRow(const std::uint16_t y) const noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(y < this->m_height);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            return this->m_pDepths + static_cast<size_t>(y) * this->m_stride;
+        }
+
+        // The depth buffer holds "z / w" (0 on the near plane, 1 on the far plane)
+        void Clear(const std::uint32_t color, const float depth = 1.0f) noexcept
+        {
+            const size_t pixelCount = this->m_stride * this->GetPaddedHeight();
+
+            std::fill_n(this->m_pColors, pixelCount, color);
+            std::fill_n(this->m_pDepths, pixelCount, depth);
+        }
+
+        // Copies the colors of the area both surfaces have in common (to present them in a window)
+        void CopyTo(::IE::Framebuffer& framebuffer) const noexcept
+        {
+            if (!framebuffer.IsValid()) return;
+
+            const std::uint16_t width  = std::min(this->m_width,  framebuffer.GetWidth());
+            const std::uint16_t height = std::min(this->m_height, framebuffer.GetHeight());
+
+            for (std::uint16_t y = 0u; y < height; y++)
+                std::memcpy(framebuffer.GetRow(y), this->GetColorRow(y), width * sizeof(std::uint32_t));
+        }
+    };
+
+    // Which triangles are discarded, from their winding as seen on the screen
+    enum class CullMode : std::uint8_t { NONE, CLOCKWISE, COUNTER_CLOCKWISE };
+
+    struct RasterizerState {
+        ::IE::CullMode m_cullMode = ::IE::CullMode::NONE;
+
+        // Pixels are only drawn when they are closer than the depth buffer, which is then updated
+        bool m_bDepthTest = true;
+    };
+
+    namespace Internal {
+
+        // "a * x + b * y + c", where (x, y) is the center of a pixel
+        struct RasterPlane {
+            float m_a, m_b, m_c;
+        };
+
+        // Planes of a "RasterTriangle", in the order the kernels evaluate them
+        enum RasterPlaneIndex : size_t {
+            RASTER_PLANE_EDGE_0, RASTER_PLANE_EDGE_1, RASTER_PLANE_EDGE_2,
+            RASTER_PLANE_DEPTH,       // z / w
+            RASTER_PLANE_INVERSE_W,   // 1 / w
+            RASTER_PLANE_ATTRIBUTE_0, // Color (RGBA) / w
+            RASTER_PLANE_ATTRIBUTE_1,
+            RASTER_PLANE_ATTRIBUTE_2,
+            RASTER_PLANE_ATTRIBUTE_3,
+            RASTER_PLANE_COUNT
+        };
+
+        /* Screen space setup of a triangle. The edge functions are positive inside of the triangle and a   */
+        /* pixel exactly on an edge only belongs to the triangle that has the edge on its top or left side, */
+        /* so the pixels along an edge shared by two triangles are drawn exactly once. The edge functions of */
+        /* a shared edge are exact opposites, which makes this hold despite rounding. The attributes are     */
+        /* interpolated divided by "w" and multiplied back by the interpolated "w" per pixel (perspective   */
+        /* correction).                                                                                     */
+        struct RasterTriangle {
+            RasterPlane   m_planes[RASTER_PLANE_COUNT];
+            std::uint32_t m_topLeftMasks[3]; // All bits set when the pixels exactly on the edge are covered
+
+            std::int32_t m_minX, m_minY, m_maxX, m_maxY; // Inclusive pixel bounds, clipped to the render target
+        };
+
+        // Area of a render target drawn to by a single thread (inclusive pixel bounds, aligned to 8x8 blocks)
+        struct RasterTile {
+            std::uint32_t* m_pColors;
+            float*         m_pDepths;
+            size_t         m_stride;
+
+            std::int32_t m_minX, m_minY, m_maxX, m_maxY;
+
+            bool m_bDepthTest;
+        };
+
+        inline constexpr std::int32_t RASTER_BLOCK_SIZE = 8;
+
+        inline float EvaluateRasterPlane(const ::IE::Internal::RasterPlane& plane, const float x, const float y) noexcept
+        {
+            return plane.m_a * x + (plane.m_b * y + plane.m_c);
+        }
+
+        // Whether or not the square of "size" pixels starting at pixel (x, y) is entirely outside of one of the triangle's edges
+        inline bool IsRasterRectOutside(const ::IE::Internal::RasterTriangle& triangle, const std::int32_t x, const std::int32_t y, const std::int32_t size) noexcept
+        {
+            const float farOffset = static_cast<float>(size) - 0.5f;
+
+            for (size_t e = RASTER_PLANE_EDGE_0; e <= RASTER_PLANE_EDGE_2; e++) {
+                const ::IE::Internal::RasterPlane& edge = triangle.m_planes[e];
+
+                // Center of the corner pixel where the edge function is the highest
+                const float cornerX = static_cast<float>(x) + ((edge.m_a > 0.0f) ? farOffset : 0.5f);
+                const float cornerY = static_cast<float>(y) + ((edge.m_b > 0.0f) ? farOffset : 0.5f);
+
+                // Rounding must never make the pixel kernels find a covered pixel in a rejected area
+                const float margin = (std::abs(edge.m_a * cornerX) + std::abs(edge.m_b * cornerY) + std::abs(edge.m_c)) * (1.0f / 1048576.0f);
+
+                if (::IE::Internal::EvaluateRasterPlane(edge, cornerX, cornerY) < -margin)
+                    return true;
+            }
+
+            return false;
+        }
+
+        inline std::uint32_t PackRasterColor(const float r, const float g, const float b, const float a) noexcept
+        {
+            // Rounds to nearest like the SIMD conversions
+            const auto toUnorm8 = [](const float value) noexcept {
+                return static_cast<std::uint8_t>(std::lrint(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+            };
+
+            return ::IE::Framebuffer::PackBGRA(toUnorm8(r), toUnorm8(g), toUnorm8(b), toUnorm8(a));
+        }
+
+        inline void RasterizeTriangleScalar(const ::IE::Internal::RasterTriangle& triangle, const ::IE::Internal::RasterTile& tile) noexcept
+        {
+            const std::int32_t minX = std::max(triangle.m_minX, tile.m_minX) & ~(RASTER_BLOCK_SIZE - 1);
+            const std::int32_t minY = std::max(triangle.m_minY, tile.m_minY) & ~(RASTER_BLOCK_SIZE - 1);
+            const std::int32_t maxX = std::min(triangle.m_maxX, tile.m_maxX);
+            const std::int32_t maxY = std::min(triangle.m_maxY, tile.m_maxY);
+
+            const ::IE::Internal::RasterPlane* const planes = triangle.m_planes;
+
+            for (std::int32_t blockY = minY; blockY <= maxY; blockY += RASTER_BLOCK_SIZE) {
+                for (std::int32_t blockX = minX; blockX <= maxX; blockX += RASTER_BLOCK_SIZE) {
+                    if (::IE::Internal::IsRasterRectOutside(triangle, blockX, blockY, RASTER_BLOCK_SIZE))
+                        continue;
+
+                    for (std::int32_t y = blockY; y < blockY + RASTER_BLOCK_SIZE; y++) {
+                        std::uint32_t* const pColors = tile.m_pColors + static_cast<size_t>(y) * tile.m_stride;
+                        float*         const pDepths = tile.m_pDepths + static_cast<size_t>(y) * tile.m_stride;
+
+                        const float pixelY = static_cast<float>(y) + 0.5f;
+
+                        for (std::int32_t x = blockX; x < blockX + RASTER_BLOCK_SIZE; x++) {
+                            const float pixelX = static_cast<float>(x) + 0.5f;
+
+                            bool bCovered = true;
+                            for (size_t e = 0u; e < 3u; e++) {
+                                const float edgeValue = ::IE::Internal::EvaluateRasterPlane(planes[RASTER_PLANE_EDGE_0 + e], pixelX, pixelY);
+
+                                bCovered &= (edgeValue > 0.0f) || (edgeValue == 0.0f && triangle.m_topLeftMasks[e] != 0u);
+                            }
+
+                            if (!bCovered) continue;
+
+                            if (tile.m_bDepthTest) {
+                                const float depth = ::IE::Internal::EvaluateRasterPlane(planes[RASTER_PLANE_DEPTH], pixelX, pixelY);
+
+                                if (!(depth < pDepths[x])) continue;
+
+                                pDepths[x] = depth;
+                            }
+
+                            const float w = 1.0f / ::IE::Internal::EvaluateRasterPlane(planes[RASTER_PLANE_INVERSE_W], pixelX, pixelY);
+
+                            pColors[x] = ::IE::Internal::PackRasterColor(::IE::Internal::EvaluateRasterPlane(planes[RASTER_PLANE_ATTRIBUTE_0], pixelX, pixelY) * w,
+                                                                         ::IE::Internal::EvaluateRasterPlane(planes[RASTER_PLANE_ATTRIBUTE_1], pixelX, pixelY) * w,
+                                                                         ::IE::Internal::EvaluateRasterPlane(planes[RASTER_PLANE_ATTRIBUTE_2], pixelX, pixelY) * w,
+                                                                         ::IE::Internal::EvaluateRasterPlane(planes[RASTER_PLANE_ATTRIBUTE_3], pixelX, pixelY) * w);
+                        }
+                    }
+                }
+            }
+        }
+
+#ifdef __IE__ENABLE_SIMD
+        /* The SIMD kernels keep the plane coefficients in registers (stores to the target could alias the */
+        /* triangle otherwise, forcing reloads). Each block evaluates the planes on its first row & then    */
+        /* steps them down by "b" per row, which is exact enough and keeps shared edges exact opposites.     */
+        /* SSE & AVX2 process a row of 8 pixels at a time, AVX-512 2 rows at a time.                        */
+
+        __IE__TARGET_SSE41 inline __m128i RasterUnorm8SSE41(const __m128 value) noexcept
+        {
+            return _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f)), _mm_set1_ps(255.0f)));
+        }
+
+        __IE__TARGET_SSE41 inline __m128i PackRasterColorsSSE41(const __m128 r, const __m128 g, const __m128 b, const __m128 a) noexcept
+        {
+            return _mm_or_si128(_mm_or_si128(_mm_slli_epi32(::IE::Internal::RasterUnorm8SSE41(a), 24), _mm_slli_epi32(::IE::Internal::RasterUnorm8SSE41(r), 16)),
+                                _mm_or_si128(_mm_slli_epi32(::IE::Internal::RasterUnorm8SSE41(g), 8),  ::IE::Internal::RasterUnorm8SSE41(b)));
+        }
+
+        // Draws the covered pixels of 4 that pass the depth test, "values" being the planes evaluated at these pixels
+        __IE__TARGET_SSE41 inline void RasterizePixelsSSE41(const __m128 (&values)[RASTER_PLANE_COUNT], const __m128 (&topLeftMasks)[3],
+                                                            std::uint32_t* const pColors, float* const pDepths, const bool bDepthTest) noexcept
+        {
+            __m128 mask = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+            for (size_t e = 0u; e < 3u; e++) {
+                const __m128 edgeValue = values[RASTER_PLANE_EDGE_0 + e];
+                const __m128 onEdge    = _mm_and_ps(_mm_cmpeq_ps(edgeValue, _mm_setzero_ps()), topLeftMasks[e]);
+
+                mask = _mm_and_ps(mask, _mm_or_ps(_mm_cmpgt_ps(edgeValue, _mm_setzero_ps()), onEdge));
+            }
+
+            if (_mm_movemask_ps(mask) == 0) return;
+
+            if (bDepthTest) {
+                const __m128 oldDepth = _mm_load_ps(pDepths);
+
+                mask = _mm_and_ps(mask, _mm_cmplt_ps(values[RASTER_PLANE_DEPTH], oldDepth));
+
+                if (_mm_movemask_ps(mask) == 0) return;
+
+                _mm_store_ps(pDepths, _mm_blendv_ps(oldDepth, values[RASTER_PLANE_DEPTH], mask));
+            }
+
+            const __m128 w = _mm_div_ps(_mm_set1_ps(1.0f), values[RASTER_PLANE_INVERSE_W]);
+
+            const __m128i colors = ::IE::Internal::PackRasterColorsSSE41(_mm_mul_ps(values[RASTER_PLANE_ATTRIBUTE_0], w), _mm_mul_ps(values[RASTER_PLANE_ATTRIBUTE_1], w),
+                                                                         _mm_mul_ps(values[RASTER_PLANE_ATTRIBUTE_2], w), _mm_mul_ps(values[RASTER_PLANE_ATTRIBUTE_3], w));
+
+            __m128i* const pColorRegister = reinterpret_cast<__m128i*>(pColors);
+            _mm_store_si128(pColorRegister, _mm_blendv_epi8(_mm_load_si128(pColorRegister), colors, _mm_castps_si128(mask)));
+        }
+
+        __IE__TARGET_SSE41 inline void RasterizeTriangleSSE41(const ::IE::Internal::RasterTriangle& triangle, const ::IE::Internal::RasterTile& tile) noexcept
+        {
+            const std::int32_t minX = std::max(triangle.m_minX, tile.m_minX) & ~(RASTER_BLOCK_SIZE - 1);
+            const std::int32_t minY = std::max(triangle.m_minY, tile.m_minY) & ~(RASTER_BLOCK_SIZE - 1);
+            const std::int32_t maxX = std::min(triangle.m_maxX, tile.m_maxX);
+            const std::int32_t maxY = std::min(triangle.m_maxY, tile.m_maxY);
+
+            __m128 a[RASTER_PLANE_COUNT], b[RASTER_PLANE_COUNT], c[RASTER_PLANE_COUNT];
+            for (size_t p = 0u; p < RASTER_PLANE_COUNT; p++) {
+                a[p] = _mm_set1_ps(triangle.m_planes[p].m_a);
+                b[p] = _mm_set1_ps(triangle.m_planes[p].m_b);
+                c[p] = _mm_set1_ps(triangle.m_planes[p].m_c);
+            }
+
+            __m128 topLeftMasks[3];
+            for (size_t e = 0u; e < 3u; e++)
+                topLeftMasks[e] = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(triangle.m_topLeftMasks[e])));
+
+            for (std::int32_t blockY = minY; blockY <= maxY; blockY += RASTER_BLOCK_SIZE) {
+                const __m128 pixelY = _mm_set1_ps(static_cast<float>(blockY) + 0.5f);
+
+                for (std::int32_t blockX = minX; blockX <= maxX; blockX += RASTER_BLOCK_SIZE) {
+                    if (::IE::Internal::IsRasterRectOutside(triangle, blockX, blockY, RASTER_BLOCK_SIZE))
+                        continue;
+
+                    const __m128 pixelX0 = _mm_add_ps(_mm_set1_ps(static_cast<float>(blockX)), _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f));
+                    const __m128 pixelX1 = _mm_add_ps(pixelX0, _mm_set1_ps(4.0f));
+
+                    __m128 values0[RASTER_PLANE_COUNT], values1[RASTER_PLANE_COUNT];
+                    for (size_t p = 0u; p < RASTER_PLANE_COUNT; p++) {
+                        const __m128 rowValue = _mm_add_ps(_mm_mul_ps(b[p], pixelY), c[p]);
+
+                        values0[p] = _mm_add_ps(_mm_mul_ps(a[p], pixelX0), rowValue);
+                        values1[p] = _mm_add_ps(_mm_mul_ps(a[p], pixelX1), rowValue);
+                    }
+
+                    for (std::int32_t y = blockY; y < blockY + RASTER_BLOCK_SIZE; y++) {
+                        const size_t offset = static_cast<size_t>(y) * tile.m_stride + static_cast<size_t>(blockX);
+
+                        ::IE::Internal::RasterizePixelsSSE41(values0, topLeftMasks, tile.m_pColors + offset,      tile.m_pDepths + offset,      tile.m_bDepthTest);
+                        ::IE::Internal::RasterizePixelsSSE41(values1, topLeftMasks, tile.m_pColors + offset + 4u, tile.m_pDepths + offset + 4u, tile.m_bDepthTest);
+
+                        for (size_t p = 0u; p < RASTER_PLANE_COUNT; p++) {
+                            values0[p] = _mm_add_ps(values0[p], b[p]);
+                            values1[p] = _mm_add_ps(values1[p], b[p]);
+                        }
+                    }
+                }
+            }
+        }
+
+        __IE__TARGET_AVX2 inline __m256i RasterUnorm8AVX2(const __m256 value) noexcept
+        {
+            return _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(value, _mm256_setzero_ps()), _mm256_set1_ps(1.0f)), _mm256_set1_ps(255.0f)));
+        }
+
+        __IE__TARGET_AVX2 inline __m256i PackRasterColorsAVX2(const __m256 r, const __m256 g, const __m256 b, const __m256 a) noexcept
+        {
+            return _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(::IE::Internal::RasterUnorm8AVX2(a), 24), _mm256_slli_epi32(::IE::Internal::RasterUnorm8AVX2(r), 16)),
+                                   _mm256_or_si256(_mm256_slli_epi32(::IE::Internal::RasterUnorm8AVX2(g), 8),  ::IE::Internal::RasterUnorm8AVX2(b)));
+        }
+
+        __IE__TARGET_AVX2 inline void RasterizeTriangleAVX2(const ::IE::Internal::RasterTriangle& triangle, const ::IE::Internal::RasterTile& tile) noexcept
+        {
+            const std::int32_t minX = std::max(triangle.m_minX, tile.m_minX) & ~(RASTER_BLOCK_SIZE - 1);
+            const std::int32_t minY = std::max(triangle.m_minY, tile.m_minY) & ~(RASTER_BLOCK_SIZE - 1);
+            const std::int32_t maxX = std::min(triangle.m_maxX, tile.m_maxX);
+            const std::int32_t maxY = std::min(triangle.m_maxY, tile.m_maxY);
+
+            __m256 a[RASTER_PLANE_COUNT], b[RASTER_PLANE_COUNT], c[RASTER_PLANE_COUNT];
+            for (size_t p = 0u; p < RASTER_PLANE_COUNT; p++) {
+                a[p] = _mm256_set1_ps(triangle.m_planes[p].m_a);
+                b[p] = _mm256_set1_ps(triangle.m_planes[p].m_b);
+                c[p] = _mm256_set1_ps(triangle.m_planes[p].m_c);
+            }
+
+            __m256 topLeftMasks[3];
+            for (size_t e = 0u; e < 3u; e++)
+                topLeftMasks[e] = _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(triangle.m_topLeftMasks[e])));
+
+            for (std::int32_t blockY = minY; blockY <= maxY; blockY += RASTER_BLOCK_SIZE) {
+                const __m256 pixelY = _mm256_set1_ps(static_cast<float>(blockY) + 0.5f);
+
+                for (std::int32_t blockX = minX; blockX <= maxX; blockX += RASTER_BLOCK_SIZE) {
+                    if (::IE::Internal::IsRasterRectOutside(triangle, blockX, blockY, RASTER_BLOCK_SIZE))
+                        continue;
+
+                    const __m256 pixelX = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(blockX)), _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f));
+
+                    __m256 values[RASTER_PLANE_COUNT];
+                    for (size_t p = 0u; p < RASTER_PLANE_COUNT; p++)
+                        values[p] = _mm256_fmadd_ps(a[p], pixelX, _mm256_fmadd_ps(b[p], pixelY, c[p]));
+
+                    for (std::int32_t y = blockY; y < blockY + RASTER_BLOCK_SIZE; y++) {
+                        __m256 mask = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+                        for (size_t e = 0u; e < 3u; e++) {
+                            const __m256 edgeValue = values[RASTER_PLANE_EDGE_0 + e];
+                            const __m256 onEdge    = _mm256_and_ps(_mm256_cmp_ps(edgeValue, _mm256_setzero_ps(), _CMP_EQ_OQ), topLeftMasks[e]);
+
+                            mask = _mm256_and_ps(mask, _mm256_or_ps(_mm256_cmp_ps(edgeValue, _mm256_setzero_ps(), _CMP_GT_OQ), onEdge));
+                        }
+
+                        const size_t offset = static_cast<size_t>(y) * tile.m_stride + static_cast<size_t>(blockX);
+
+                        if (_mm256_movemask_ps(mask) != 0 && tile.m_bDepthTest) {
+                            const __m256 oldDepth = _mm256_load_ps(tile.m_pDepths + offset);
+
+                            mask = _mm256_and_ps(mask, _mm256_cmp_ps(values[RASTER_PLANE_DEPTH], oldDepth, _CMP_LT_OQ));
+
+                            _mm256_store_ps(tile.m_pDepths + offset, _mm256_blendv_ps(oldDepth, values[RASTER_PLANE_DEPTH], mask));
+                        }
+
+                        if (_mm256_movemask_ps(mask) != 0) {
+                            const __m256 w = _mm256_div_ps(_mm256_set1_ps(1.0f), values[RASTER_PLANE_INVERSE_W]);
+
+                            const __m256i colors = ::IE::Internal::PackRasterColorsAVX2(_mm256_mul_ps(values[RASTER_PLANE_ATTRIBUTE_0], w), _mm256_mul_ps(values[RASTER_PLANE_ATTRIBUTE_1], w),
+                                                                                        _mm256_mul_ps(values[RASTER_PLANE_ATTRIBUTE_2], w), _mm256_mul_ps(values[RASTER_PLANE_ATTRIBUTE_3], w));
+
+                            __m256i* const pColors = reinterpret_cast<__m256i*>(tile.m_pColors + offset);
+                            _mm256_store_si256(pColors, _mm256_blendv_epi8(_mm256_load_si256(pColors), colors, _mm256_castps_si256(mask)));
+                        }
+
+                        for (size_t p = 0u; p < RASTER_PLANE_COUNT; p++)
+                            values[p] = _mm256_add_ps(values[p], b[p]);
+                    }
+                }
+            }
+        }
+
+        __IE__TARGET_AVX512 inline __m512i RasterUnorm8AVX512(const __m512 value) noexcept
+        {
+            return _mm512_cvtps_epi32(_mm512_mul_ps(_mm512_min_ps(_mm512_max_ps(value, _mm512_setzero_ps()), _mm512_set1_ps(1.0f)), _mm512_set1_ps(255.0f)));
+        }
+
+        __IE__TARGET_AVX512 inline __m512i PackRasterColorsAVX512(const __m512 r, const __m512 g, const __m512 b, const __m512 a) noexcept
+        {
+            return _mm512_or_si512(_mm512_or_si512(_mm512_slli_epi32(::IE::Internal::RasterUnorm8AVX512(a), 24), _mm512_slli_epi32(::IE::Internal::RasterUnorm8AVX512(r), 16)),
+                                   _mm512_or_si512(_mm512_slli_epi32(::IE::Internal::RasterUnorm8AVX512(g), 8),  ::IE::Internal::RasterUnorm8AVX512(b)));
+        }
+
+        __IE__TARGET_AVX512 inline void RasterizeTriangleAVX512(const ::IE::Internal::RasterTriangle& triangle, const ::IE::Internal::RasterTile& tile) noexcept
+        {
+            const std::int32_t minX = std::max(triangle.m_minX, tile.m_minX) & ~(RASTER_BLOCK_SIZE - 1);
+            const std::int32_t minY = std::max(triangle.m_minY, tile.m_minY) & ~(RASTER_BLOCK_SIZE - 1);
+            const std::int32_t maxX = std::min(triangle.m_maxX, tile.m_maxX);
+            const std::int32_t maxY = std::min(triangle.m_maxY, tile.m_maxY);
+
+            __m512 a[RASTER_PLANE_COUNT], b[RASTER_PLANE_COUNT], c[RASTER_PLANE_COUNT];
+            for (size_t p = 0u; p < RASTER_PLANE_COUNT; p++) {
+                a[p] = _mm512_set1_ps(triangle.m_planes[p].m_a);
+                b[p] = _mm512_set1_ps(triangle.m_planes[p].m_b);
+                c[p] = _mm512_set1_ps(triangle.m_planes[p].m_c);
+            }
+
+            // 2 rows of 8 pixels per register
+            const __m512 laneOffsetsX = _mm512_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f, 0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+            const __m512 laneOffsetsY = _mm512_setr_ps(0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 1.5f, 1.5f, 1.5f, 1.5f, 1.5f, 1.5f, 1.5f, 1.5f);
+
+            for (std::int32_t blockY = minY; blockY <= maxY; blockY += RASTER_BLOCK_SIZE) {
+                const __m512 pixelY = _mm512_add_ps(_mm512_set1_ps(static_cast<float>(blockY)), laneOffsetsY);
+
+                for (std::int32_t blockX = minX; blockX <= maxX; blockX += RASTER_BLOCK_SIZE) {
+                    if (::IE::Internal::IsRasterRectOutside(triangle, blockX, blockY, RASTER_BLOCK_SIZE))
+                        continue;
+
+                    const __m512 pixelX = _mm512_add_ps(_mm512_set1_ps(static_cast<float>(blockX)), laneOffsetsX);
+
+                    __m512 values[RASTER_PLANE_COUNT];
+                    for (size_t p = 0u; p < RASTER_PLANE_COUNT; p++)
+                        values[p] = _mm512_fmadd_ps(a[p], pixelX, _mm512_fmadd_ps(b[p], pixelY, c[p]));
+
+                    for (std::int32_t y = blockY; y < blockY + RASTER_BLOCK_SIZE; y += 2) {
+                        __mmask16 mask = 0xFFFFu;
+
+                        for (size_t e = 0u; e < 3u; e++) {
+                            const __m512    edgeValue = values[RASTER_PLANE_EDGE_0 + e];
+                            const __mmask16 onEdge    = _mm512_cmp_ps_mask(edgeValue, _mm512_setzero_ps(), _CMP_EQ_OQ) & static_cast<__mmask16>(triangle.m_topLeftMasks[e]);
+
+                            mask &= _mm512_cmp_ps_mask(edgeValue, _mm512_setzero_ps(), _CMP_GT_OQ) | onEdge;
+                        }
+
+                        const size_t offset0 = static_cast<size_t>(y) * tile.m_stride + static_cast<size_t>(blockX);
+                        const size_t offset1 = offset0 + tile.m_stride;
+
+                        if (mask != 0u && tile.m_bDepthTest) {
+                            const __m512 depth    = values[RASTER_PLANE_DEPTH];
+                            const __m512 oldDepth = _mm512_insertf32x8(_mm512_castps256_ps512(_mm256_load_ps(tile.m_pDepths + offset0)), _mm256_load_ps(tile.m_pDepths + offset1), 1);
+
+                            mask = _mm512_mask_cmp_ps_mask(mask, depth, oldDepth, _CMP_LT_OQ);
+
+                            _mm256_mask_store_ps(tile.m_pDepths + offset0, static_cast<__mmask8>(mask),       _mm512_castps512_ps256(depth));
+                            _mm256_mask_store_ps(tile.m_pDepths + offset1, static_cast<__mmask8>(mask >> 8u), _mm512_extractf32x8_ps(depth, 1));
+                        }
+
+                        if (mask != 0u) {
+                            const __m512 w = _mm512_div_ps(_mm512_set1_ps(1.0f), values[RASTER_PLANE_INVERSE_W]);
+
+                            const __m512i colors = ::IE::Internal::PackRasterColorsAVX512(_mm512_mul_ps(values[RASTER_PLANE_ATTRIBUTE_0], w), _mm512_mul_ps(values[RASTER_PLANE_ATTRIBUTE_1], w),
+                                                                                          _mm512_mul_ps(values[RASTER_PLANE_ATTRIBUTE_2], w), _mm512_mul_ps(values[RASTER_PLANE_ATTRIBUTE_3], w));
+
+                            _mm256_mask_store_epi32(tile.m_pColors + offset0, static_cast<__mmask8>(mask),       _mm512_castsi512_si256(colors));
+                            _mm256_mask_store_epi32(tile.m_pColors + offset1, static_cast<__mmask8>(mask >> 8u), _mm512_extracti32x8_epi32(colors, 1));
+                        }
+
+                        // Down 2 rows
+                        for (size_t p = 0u; p < RASTER_PLANE_COUNT; p++)
+                            values[p] = _mm512_add_ps(values[p], _mm512_add_ps(b[p], b[p]));
+                    }
+                }
+            }
+        }
+#endif // #ifdef __IE__ENABLE_SIMD
+
+        struct RasterClipVertex {
+            ::IE::Vecf32 m_position; // Clip space
+            ::IE::Vecf32 m_color;
+        };
+
+        /* Clip space x & y are clipped to [-4w, 4w] rather than [-w, w]: triangles crossing the sides of */
+        /* the screen are cheaper to rasterize than to clip, but the screen space coordinates must stay   */
+        /* small enough for the edge functions to be precise. z is clipped to [0, w] (near & far planes). */
+        inline constexpr float  RASTER_GUARD_BAND         = 4.0f;
+        inline constexpr size_t RASTER_CLIP_PLANE_COUNT   = 6u;
+        inline constexpr size_t RASTER_MAX_CLIPPED_VERTICES = 3u + RASTER_CLIP_PLANE_COUNT;
+
+        // Signed distance to a clipping plane, negative outside
+        inline float GetRasterClipDistance(const ::IE::Vecf32& position, const size_t plane) noexcept
+        {
+            switch (plane) {
+            case 0u: return position.z;                                  // Near
+            case 1u: return position.w - position.z;                     // Far
+            case 2u: return RASTER_GUARD_BAND * position.w + position.x; // Left
+            case 3u: return RASTER_GUARD_BAND * position.w - position.x; // Right
+            case 4u: return RASTER_GUARD_BAND * position.w + position.y; // Bottom
+            default: return RASTER_GUARD_BAND * position.w - position.y; // Top
+            }
+        }
+
+        // Bit "i" is set when the position is outside of plane "i" (NaNs are outside of every plane)
+        inline std::uint32_t GetRasterOutCode(const ::IE::Vecf32& position) noexcept
+        {
+            const float guardBand = RASTER_GUARD_BAND * position.w;
+
+            return (static_cast<std::uint32_t>(!(position.z >= 0.0f))         << 0u) |
+                   (static_cast<std::uint32_t>(!(position.w >= position.z))   << 1u) |
+                   (static_cast<std::uint32_t>(!(guardBand >= -position.x))   << 2u) |
+                   (static_cast<std::uint32_t>(!(guardBand >= position.x))    << 3u) |
+                   (static_cast<std::uint32_t>(!(guardBand >= -position.y))   << 4u) |
+                   (static_cast<std::uint32_t>(!(guardBand >= position.y))    << 5u);
+        }
+
+        /* Sutherland-Hodgman clipping against the planes of "planeMask". Returns the vertex count of the   */
+        /* clipped convex polygon, or 0 when less than a triangle is left. The intersections are always    */
+        /* computed from the inside vertex, so an edge shared by 2 triangles is split at the exact same point. */
+        inline size_t ClipRasterPolygon(std::array<::IE::Internal::RasterClipVertex, RASTER_MAX_CLIPPED_VERTICES>& polygon, size_t vertexCount, const std::uint32_t planeMask) noexcept
+        {
+            std::array<::IE::Internal::RasterClipVertex, RASTER_MAX_CLIPPED_VERTICES> clipped;
+
+            for (size_t plane = 0u; plane < RASTER_CLIP_PLANE_COUNT; plane++) {
+                if ((planeMask & (1u << plane)) == 0u) continue;
+
+                size_t clippedCount = 0u;
+
+                for (size_t i = 0u; i < vertexCount; i++) {
+                    const ::IE::Internal::RasterClipVertex& current = polygon[i];
+                    const ::IE::Internal::RasterClipVertex& next    = polygon[(i + 1u) % vertexCount];
+
+                    const float currentDistance = ::IE::Internal::GetRasterClipDistance(current.m_position, plane);
+                    const float nextDistance    = ::IE::Internal::GetRasterClipDistance(next.m_position, plane);
+
+                    const bool bCurrentInside = currentDistance >= 0.0f;
+                    const bool bNextInside    = nextDistance >= 0.0f;
+
+                    if (bCurrentInside)
+                        clipped[clippedCount++] = current;
+
+                    if (bCurrentInside != bNextInside) {
+                        const ::IE::Internal::RasterClipVertex& inside  = bCurrentInside ? current : next;
+                        const ::IE::Internal::RasterClipVertex& outside = bCurrentInside ? next : current;
+
+                        const float insideDistance  = bCurrentInside ? currentDistance : nextDistance;
+                        const float outsideDistance = bCurrentInside ? nextDistance : currentDistance;
+                        const float t = insideDistance / (insideDistance - outsideDistance);
+
+                        clipped[clippedCount++] = ::IE::Internal::RasterClipVertex{
+                            inside.m_position + (outside.m_position - inside.m_position) * t,
+                            inside.m_color    + (outside.m_color    - inside.m_color)    * t
+                        };
+                    }
+                }
+
+                if (clippedCount < 3u) return 0u;
+
+                polygon     = clipped;
+                vertexCount = clippedCount;
+            }
+
+            return vertexCount;
+        }
+
+        /* Projects a clipped triangle onto a target of "width" x "height" pixels & computes its plane      */
+        /* equations. Returns false when the triangle is culled, degenerate or covers no pixel center. The */
+        /* planes are computed in double precision relative to a vertex, which keeps the interpolation of  */
+        /* small triangles far from the origin precise.                                                   */
+        inline bool SetupRasterTriangle(::IE::Internal::RasterTriangle& triangle, const ::IE::Internal::RasterClipVertex* const (&vertices)[3],
+                                        const std::int32_t width, const std::int32_t height, const ::IE::CullMode cullMode) noexcept
+        {
+            float  screenX[3], screenY[3];
+            double depths[3], inverseWs[3];
+
+            for (size_t i = 0u; i < 3u; i++) {
+                const ::IE::Vecf32& position = vertices[i]->m_position;
+
+                inverseWs[i] = 1.0 / static_cast<double>(position.w);
+                depths[i]    = static_cast<double>(position.z) * inverseWs[i];
+
+                // Y goes down on the screen
+                screenX[i] = static_cast<float>((static_cast<double>(position.x) * inverseWs[i] * 0.5 + 0.5) * width);
+                screenY[i] = static_cast<float>((0.5 - static_cast<double>(position.y) * inverseWs[i] * 0.5) * height);
+            }
+
+            // Twice the signed area, positive when the vertices are clockwise on the screen
+            double area = (static_cast<double>(screenX[1]) - screenX[0]) * (static_cast<double>(screenY[2]) - screenY[0]) -
+                          (static_cast<double>(screenY[1]) - screenY[0]) * (static_cast<double>(screenX[2]) - screenX[0]);
+
+            if (!(area != 0.0)) return false; // Degenerate (or NaN)
+
+            if ((cullMode == ::IE::CullMode::CLOCKWISE && area > 0.0) || (cullMode == ::IE::CullMode::COUNTER_CLOCKWISE && area < 0.0))
+                return false;
+
+            // Make the vertices clockwise so that the edge functions are positive inside
+            std::array<size_t, 3u> order{ 0u, 1u, 2u };
+            if (area < 0.0) {
+                std::swap(order[1], order[2]);
+                area = -area;
+            }
+
+            const float minX = std::min({ screenX[0], screenX[1], screenX[2] });
+            const float minY = std::min({ screenY[0], screenY[1], screenY[2] });
+            const float maxX = std::max({ screenX[0], screenX[1], screenX[2] });
+            const float maxY = std::max({ screenY[0], screenY[1], screenY[2] });
+
+            triangle.m_minX = std::max(static_cast<std::int32_t>(std::floor(minX)), 0);
+            triangle.m_minY = std::max(static_cast<std::int32_t>(std::floor(minY)), 0);
+            triangle.m_maxX = std::min(static_cast<std::int32_t>(std::floor(maxX)), width - 1);
+            triangle.m_maxY = std::min(static_cast<std::int32_t>(std::floor(maxY)), height - 1);
+
+            if (triangle.m_minX > triangle.m_maxX || triangle.m_minY > triangle.m_maxY)
+                return false;
+
+            for (size_t e = 0u; e < 3u; e++) {
+                const size_t i = order[e];
+                const size_t j = order[(e + 1u) % 3u];
+
+                ::IE::Internal::RasterPlane& edge = triangle.m_planes[RASTER_PLANE_EDGE_0 + e];
+
+                // "c" is rounded once from its exact value, so the reversed edge of a neighbour gets exactly "-c"
+                edge.m_a = screenY[i] - screenY[j];
+                edge.m_b = screenX[j] - screenX[i];
+                edge.m_c = static_cast<float>(static_cast<double>(screenX[i]) * screenY[j] - static_cast<double>(screenX[j]) * screenY[i]);
+
+                // Left edges have the inside on their right, top edges are horizontal with the inside below
+                triangle.m_topLeftMasks[e] = (edge.m_a > 0.0f || (edge.m_a == 0.0f && edge.m_b > 0.0f)) ? 0xFFFFFFFFu : 0u;
+            }
+
+            const double x0 = screenX[order[0]], y0 = screenY[order[0]];
+            const double x1 = screenX[order[1]], y1 = screenY[order[1]];
+            const double x2 = screenX[order[2]], y2 = screenY[order[2]];
+
+            const double inverseArea = 1.0 / area;
+
+            const auto makePlane = [&](const double (&values)[3]) noexcept {
+                const double v0 = values[order[0]];
+                const double v1 = values[order[1]];
+                const double v2 = values[order[2]];
+
+                const double a = ((v1 - v0) * (y2 - y0) - (v2 - v0) * (y1 - y0)) * inverseArea;
+                const double b = ((v2 - v0) * (x1 - x0) - (v1 - v0) * (x2 - x0)) * inverseArea;
+
+                return ::IE::Internal::RasterPlane{ static_cast<float>(a), static_cast<float>(b), static_cast<float>(v0 - a * x0 - b * y0) };
+            };
+
+            triangle.m_planes[RASTER_PLANE_DEPTH]     = makePlane(depths);
+            triangle.m_planes[RASTER_PLANE_INVERSE_W] = makePlane(inverseWs);
+
+            float colors[3][4];
+            for (size_t i = 0u; i < 3u; i++) {
+                const ::IE::Vecf32& color = vertices[i]->m_color;
+
+                colors[i][0] = color.x;
+                colors[i][1] = color.y;
+                colors[i][2] = color.z;
+                colors[i][3] = color.w;
+            }
+
+            for (size_t c = 0u; c < 4u; c++) {
+                const double attributes[3] = {
+                    static_cast<double>(colors[0][c]) * inverseWs[0],
+                    static_cast<double>(colors[1][c]) * inverseWs[1],
+                    static_cast<double>(colors[2][c]) * inverseWs[2]
+                };
+
+                triangle.m_planes[RASTER_PLANE_ATTRIBUTE_0 + c] = makePlane(attributes);
+            }
+
+            return true;
+        }
+
+    } // Internal
+
+    /* Binned, tile-based triangle rasterizer. A draw happens in 2 parallel passes :                     */
+    /*  1. Binning : chunks of triangles are clipped, set up & sorted into the 64x64 tiles they overlap. */
+    /*     Every chunk has bins of its own, so no synchronization is needed.                             */
+    /*  2. Rasterization : the tiles are rasterized independently, 8x8 pixel blocks at a time. Since a   */
+    /*     tile goes through the chunks in order, the triangles are drawn in the order they were given.  */
+    /* The per chunk storage is kept from one draw to the next, so drawing doesn't allocate once warm.   */
+    class Rasterizer {
+    public:
+        static constexpr std::int32_t TILE_SIZE = 64;
+
+        // Fewer triangles than this per chunk aren't worth setting up on another thread
+        static constexpr size_t MIN_TRIANGLES_PER_CHUNK = 1024u;
+
+    private:
+        struct Chunk {
+            std::vector<::IE::Internal::RasterTriangle> m_triangles;
+            std::vector<std::vector<std::uint32_t>>     m_tileBins; // Indices in "m_triangles" of the triangles overlapping each tile
+        };
+
+        std::vector<Chunk> m_chunks;
+        size_t             m_threadCount;
+
+        void BinTriangles(Chunk& chunk, const std::int32_t width, const std::int32_t height, const std::int32_t tileCountX,
+                          const std::span<const ::IE::Vecf32> positions, const std::span<const ::IE::Vecf32> colors,
+                          const std::span<const std::uint32_t> indices, const ::IE::RasterizerState& state) noexcept
+        {
+            chunk.m_triangles.clear();
+
+            for (std::vector<std::uint32_t>& bin : chunk.m_tileBins)
+                bin.clear();
+
+            const auto addTriangle = [&](const ::IE::Internal::RasterClipVertex* const (&vertices)[3]) noexcept {
+                ::IE::Internal::RasterTriangle triangle;
+
+                if (!::IE::Internal::SetupRasterTriangle(triangle, vertices, width, height, state.m_cullMode))
+                    return;
+
+                const std::uint32_t triangleIndex = static_cast<std::uint32_t>(chunk.m_triangles.size());
+                chunk.m_triangles.push_back(triangle);
+
+                const bool bSingleTile = (triangle.m_minX / TILE_SIZE == triangle.m_maxX / TILE_SIZE) && (triangle.m_minY / TILE_SIZE == triangle.m_maxY / TILE_SIZE);
+
+                for (std::int32_t tileY = triangle.m_minY / TILE_SIZE; tileY <= triangle.m_maxY / TILE_SIZE; tileY++) {
+                    for (std::int32_t tileX = triangle.m_minX / TILE_SIZE; tileX <= triangle.m_maxX / TILE_SIZE; tileX++) {
+                        // Long & thin triangles have a bounding box mostly made of tiles they don't touch
+                        if (!bSingleTile && ::IE::Internal::IsRasterRectOutside(triangle, tileX * TILE_SIZE, tileY * TILE_SIZE, TILE_SIZE))
+                            continue;
+
+                        chunk.m_tileBins[static_cast<size_t>(tileY * tileCountX + tileX)].push_back(triangleIndex);
+                    }
+                }
+            };
+
+            for (size_t i = 0u; i + 2u < indices.size(); i += 3u) {
+#if defined(__IE__DEBUG_MODE)
+                assert(indices[i] < positions.size() && indices[i + 1u] < positions.size() && indices[i + 2u] < positions.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+                const ::IE::Internal::RasterClipVertex triangle[3] = {
+                    { positions[indices[i]],      colors[indices[i]]      },
+                    { positions[indices[i + 1u]], colors[indices[i + 1u]] },
+                    { positions[indices[i + 2u]], colors[indices[i + 2u]] }
+                };
+
+                const std::uint32_t outCodes[3] = {
+                    ::IE::Internal::GetRasterOutCode(triangle[0].m_position),
+                    ::IE::Internal::GetRasterOutCode(triangle[1].m_position),
+                    ::IE::Internal::GetRasterOutCode(triangle[2].m_position)
+                };
+
+                // Entirely outside of one of the planes
+                if ((outCodes[0] & outCodes[1] & outCodes[2]) != 0u)
+                    continue;
+
+                const std::uint32_t crossedPlanes = outCodes[0] | outCodes[1] | outCodes[2];
+
+                if (crossedPlanes == 0u) {
+                    addTriangle({ &triangle[0], &triangle[1], &triangle[2] });
+                    continue;
+                }
+
+                std::array<::IE::Internal::RasterClipVertex, ::IE::Internal::RASTER_MAX_CLIPPED_VERTICES> polygon;
+                polygon[0] = triangle[0];
+                polygon[1] = triangle[1];
+                polygon[2] = triangle[2];
+
+                const size_t vertexCount = ::IE::Internal::ClipRasterPolygon(polygon, 3u, crossedPlanes);
+
+                // The clipped polygon is convex, so it's drawn as a fan (which keeps the winding)
+                for (size_t v = 1u; v + 1u < vertexCount; v++)
+                    addTriangle({ &polygon[0], &polygon[v], &polygon[v + 1u] });
+            }
+        }
+
+    public:
+        Rasterizer(const size_t threadCount = ::IE::GetHardwareThreadCount()) noexcept
+            : m_threadCount((threadCount == 0u) ? 1u : threadCount)
+        {  }
+
+        inline size_t GetThreadCount() const noexcept { return this->m_threadCount; }
+
+        inline void SetThreadCount(const size_t threadCount) noexcept { this->m_threadCount = (threadCount == 0u) ? 1u : threadCount; }
+
+        /* Draws the triangle list "indices" (3 per triangle). "positions" are in clip space (after the      */
+        /* projection matrix, see "TransformBatch") with z / w in [0, 1] between the near & far planes.    */
+        /* "colors" (RGBA in [0, 1]) are interpolated with perspective correction & written to the target. */
+        void DrawTriangles(::IE::RenderTarget& target, const std::span<const ::IE::Vecf32> positions, const std::span<const ::IE::Vecf32> colors,
+                           const std::span<const std::uint32_t> indices, const ::IE::RasterizerState& state = {}) noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(colors.size() >= positions.size());
+            assert(indices.size() % 3u == 0u);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            const size_t triangleCount = indices.size() / 3u;
+
+            if (!target.IsValid() || triangleCount == 0u) return;
+
+            const std::int32_t width  = target.GetWidth();
+            const std::int32_t height = target.GetHeight();
+
+            const std::int32_t tileCountX = (width  + TILE_SIZE - 1) / TILE_SIZE;
+            const std::int32_t tileCountY = (height + TILE_SIZE - 1) / TILE_SIZE;
+            const size_t       tileCount  = static_cast<size_t>(tileCountX) * static_cast<size_t>(tileCountY);
+
+            const size_t chunkCount = std::clamp<size_t>(triangleCount / MIN_TRIANGLES_PER_CHUNK, 1u, this->m_threadCount);
+            const size_t trianglesPerChunk = (triangleCount + chunkCount - 1u) / chunkCount;
+
+            if (this->m_chunks.size() < chunkCount)
+                this->m_chunks.resize(chunkCount);
+
+            for (size_t c = 0u; c < chunkCount; c++)
+                this->m_chunks[c].m_tileBins.resize(tileCount);
+
+            // Pass 1 : Binning
+            ::IE::Internal::ParallelFor(chunkCount, this->m_threadCount, [&](const size_t c) noexcept {
+                const size_t firstTriangle = c * trianglesPerChunk;
+                const size_t lastTriangle  = std::min(firstTriangle + trianglesPerChunk, triangleCount);
+
+                this->BinTriangles(this->m_chunks[c], width, height, tileCountX, positions, colors,
+                                   indices.subspan(firstTriangle * 3u, (lastTriangle - firstTriangle) * 3u), state);
+            });
+
+            // Pass 2 : Rasterization
+            const auto rasterizeTriangle = ::IE::Internal::GetSIMDKernels().m_pRasterizeTriangle;
+
+            ::IE::Internal::ParallelFor(tileCount, this->m_threadCount, [&](const size_t t) noexcept {
+                const std::int32_t tileX = static_cast<std::int32_t>(t % static_cast<size_t>(tileCountX)) * TILE_SIZE;
+                const std::int32_t tileY = static_cast<std::int32_t>(t / static_cast<size_t>(tileCountX)) * TILE_SIZE;
+
+                const ::IE::Internal::RasterTile tile{
+                    target.GetColors(), target.GetDepths(), target.GetStride(),
+                    tileX, tileY, std::min(tileX + TILE_SIZE, width) - 1, std::min(tileY + TILE_SIZE, height) - 1,
+                    state.m_bDepthTest
+                };
+
+                for (size_t c = 0u; c < chunkCount; c++) {
+                    const Chunk& chunk = this->m_chunks[c];
+
+                    for (const std::uint32_t triangleIndex : chunk.m_tileBins[t])
+                        rasterizeTriangle(chunk.m_triangles[triangleIndex], tile);
+                }
+            });
+        }
+    };
+
+    // +-------+
+    // | Image |
+    // +-------+
+
+    // How texture coordinates outside of [0, 1] are brought back onto the image
+    enum class SamplerAddress : std::uint8_t { WRAP, CLAMP };
+
+    enum class SamplerFilter : std::uint8_t { NEAREST, BILINEAR, TRILINEAR };
+
+    /* NEAREST & BILINEAR read the mip level nearest to the level of detail, TRILINEAR blends the */
+    /* bilinear samples of the two levels around it.                                             */
+    struct Sampler {
+        ::IE::SamplerFilter  m_filter   = ::IE::SamplerFilter::BILINEAR;
+        ::IE::SamplerAddress m_addressU = ::IE::SamplerAddress::WRAP;
+        ::IE::SamplerAddress m_addressV = ::IE::SamplerAddress::WRAP;
+    };
+
+    /* BOX averages 2x2 texels, KAISER is a Kaiser-windowed sinc (3 lobes) that keeps mips sharper */
+    /* at the cost of some ringing. Both work in the texels' own values (no color space conversion). */
+    enum class MipmapFilter : std::uint8_t { BOX, KAISER };
+
+    namespace Internal {
+
+        // Images are stored in 4x4 texel tiles (a cache line of "Coloru8" texels) so that bilinear footprints stay within a tile or two
+        constexpr const size_t IMAGE_TILE_SIZE = 4u;
+
+        // A mip level as seen by the sampling kernels
+        struct ImageLevelView {
+            const void*  m_pTexels;
+            std::int32_t m_width, m_height;
+            std::int32_t m_tileRowStride; // Texels between the starts of two rows of tiles
+        };
+
+        // Texels are "Coloru8" (read as packed RGBA "std::uint32_t") or "Colorf32" (4 floats)
+        struct ImageSampleBatch {
+            ::IE::Internal::ImageLevelView m_levels[2]; // The second level is only read by TRILINEAR
+            float                          m_levelBlend;
+            ::IE::SamplerFilter            m_filter;
+            ::IE::SamplerAddress           m_addressU, m_addressV;
+        };
+
+        inline size_t GetImageTexelIndex(const size_t x, const size_t y, const size_t tileRowStride) noexcept
+        {
+            return (y >> 2u) * tileRowStride + ((y & 3u) << 2u) + ((x >> 2u) << 4u) + (x & 3u);
+        }
+
+        /* Texel coordinates of normalized coordinates. The SIMD kernels mirror these operations, */
+        /* NaNs included (which land on valid texels).                                            */
+        inline std::int32_t GetNearestTexelCoordinate(float c, const std::int32_t size, const ::IE::SamplerAddress address) noexcept
+        {
+            if (address == ::IE::SamplerAddress::WRAP)
+                c -= std::floor(c);
+
+            return static_cast<std::int32_t>(std::min(static_cast<float>(size - 1), std::max(0.0f, c * static_cast<float>(size))));
+        }
+
+        inline void GetLinearTexelCoordinates(float c, const std::int32_t size, const ::IE::SamplerAddress address, std::int32_t& i0, std::int32_t& i1, float& fraction) noexcept
+        {
+            if (address == ::IE::SamplerAddress::WRAP)
+                c -= std::floor(c);
+
+            const float x  = std::min(static_cast<float>(size), std::max(-1.0f, c * static_cast<float>(size) - 0.5f));
+            const float x0 = std::floor(x);
+
+            fraction = x - x0;
+            i0 = static_cast<std::int32_t>(x0);
+            i1 = i0 + 1;
+
+            if (address == ::IE::SamplerAddress::WRAP) {
+                i0 = (i0 < 0) ? size - 1 : i0;
+                i1 = (i1 >= size) ? 0 : i1;
+            } else {
+                i0 = std::clamp(i0, 0, size - 1);
+                i1 = std::clamp(i1, 0, size - 1);
+            }
+        }
+
+        inline float LerpImage(const float a, const float b, const float t) noexcept { return a + (b - a) * t; }
+
+        template <bool _FLOAT>
+        inline void LoadImageTexelScalar(const void* pTexels, const size_t index, float (&channels)[4u]) noexcept
+        {
+            if constexpr (_FLOAT) {
+                std::memcpy(channels, static_cast<const float*>(pTexels) + 4u * index, sizeof(channels));
+            } else {
+                const std::uint32_t texel = static_cast<const std::uint32_t*>(pTexels)[index];
+
+                for (size_t c = 0u; c < 4u; c++)
+                    channels[c] = static_cast<float>((texel >> (8u * c)) & 0xFFu);
+            }
+        }
+
+        template <bool _FLOAT>
+        inline void SampleImageLevelBilinearScalar(const ::IE::Internal::ImageLevelView& level, const ::IE::Internal::ImageSampleBatch& batch,
+                                                   const float u, const float v, float (&channels)[4u]) noexcept
+        {
+            std::int32_t x0, x1, y0, y1;
+            float fx, fy;
+
+            ::IE::Internal::GetLinearTexelCoordinates(u, level.m_width,  batch.m_addressU, x0, x1, fx);
+            ::IE::Internal::GetLinearTexelCoordinates(v, level.m_height, batch.m_addressV, y0, y1, fy);
+
+            float c00[4u], c10[4u], c01[4u], c11[4u];
+            ::IE::Internal::LoadImageTexelScalar<_FLOAT>(level.m_pTexels, ::IE::Internal::GetImageTexelIndex(x0, y0, level.m_tileRowStride), c00);
+            ::IE::Internal::LoadImageTexelScalar<_FLOAT>(level.m_pTexels, ::IE::Internal::GetImageTexelIndex(x1, y0, level.m_tileRowStride), c10);
+            ::IE::Internal::LoadImageTexelScalar<_FLOAT>(level.m_pTexels, ::IE::Internal::GetImageTexelIndex(x0, y1, level.m_tileRowStride), c01);
+            ::IE::Internal::LoadImageTexelScalar<_FLOAT>(level.m_pTexels, ::IE::Internal::GetImageTexelIndex(x1, y1, level.m_tileRowStride), c11);
+
+            for (size_t c = 0u; c < 4u; c++) {
+                const float top    = ::IE::Internal::LerpImage(c00[c], c10[c], fx);
+                const float bottom = ::IE::Internal::LerpImage(c01[c], c11[c], fx);
+
+                channels[c] = ::IE::Internal::LerpImage(top, bottom, fy);
+            }
+        }
+
+        // "out" holds 4 floats per sample for "_FLOAT" images, packed RGBA8 texels otherwise
+        template <bool _FLOAT>
+        inline void SampleImageScalar(const ::IE::Internal::ImageSampleBatch& batch, const float* u, const float* v, void* out, const size_t count) noexcept
+        {
+            const ::IE::Internal::ImageLevelView& level = batch.m_levels[0];
+
+            for (size_t i = 0u; i < count; i++) {
+                float channels[4u];
+
+                if (batch.m_filter == ::IE::SamplerFilter::NEAREST) {
+                    const std::int32_t x = ::IE::Internal::GetNearestTexelCoordinate(u[i], level.m_width,  batch.m_addressU);
+                    const std::int32_t y = ::IE::Internal::GetNearestTexelCoordinate(v[i], level.m_height, batch.m_addressV);
+                    const size_t index = ::IE::Internal::GetImageTexelIndex(x, y, level.m_tileRowStride);
+
+                    if constexpr (_FLOAT)
+                        std::memcpy(static_cast<float*>(out) + 4u * i, static_cast<const float*>(level.m_pTexels) + 4u * index, 4u * sizeof(float));
+                    else
+                        static_cast<std::uint32_t*>(out)[i] = static_cast<const std::uint32_t*>(level.m_pTexels)[index];
+
+                    continue;
+                }
+
+                ::IE::Internal::SampleImageLevelBilinearScalar<_FLOAT>(level, batch, u[i], v[i], channels);
+
+                if (batch.m_filter == ::IE::SamplerFilter::TRILINEAR && batch.m_levelBlend != 0.0f) {
+                    float next[4u];
+                    ::IE::Internal::SampleImageLevelBilinearScalar<_FLOAT>(batch.m_levels[1], batch, u[i], v[i], next);
+
+                    for (size_t c = 0u; c < 4u; c++)
+                        channels[c] = ::IE::Internal::LerpImage(channels[c], next[c], batch.m_levelBlend);
+                }
+
+                if constexpr (_FLOAT) {
+                    std::memcpy(static_cast<float*>(out) + 4u * i, channels, sizeof(channels));
+                } else {
+                    std::uint32_t texel = 0u;
+
+                    // Rounds to nearest even like "_mm_cvtps_epi32"
+                    for (size_t c = 0u; c < 4u; c++)
+                        texel |= static_cast<std::uint32_t>(std::nearbyint(channels[c])) << (8u * c);
+
+                    static_cast<std::uint32_t*>(out)[i] = texel;
+                }
+            }
+        }
+
+#ifdef __IE__ENABLE_SIMD
+
+        struct ImageBilinearLanesSSE41 {
+            __m128i m_i00, m_i10, m_i01, m_i11; // Texel indices of the footprint
+            __m128  m_fx, m_fy;
+        };
+
+        __IE__TARGET_SSE41 inline __m128i GetNearestTexelCoordinatesSSE41(__m128 c, const std::int32_t size, const ::IE::SamplerAddress address) noexcept
+        {
+            if (address == ::IE::SamplerAddress::WRAP)
+                c = _mm_sub_ps(c, _mm_floor_ps(c));
+
+            // "_mm_max_ps" returns its second operand for NaNs, like "std::max(0.0f, NaN)"
+            const __m128 x = _mm_min_ps(_mm_max_ps(_mm_mul_ps(c, _mm_set1_ps(static_cast<float>(size))), _mm_setzero_ps()), _mm_set1_ps(static_cast<float>(size - 1)));
+
+            return _mm_cvttps_epi32(x);
+        }
+
+        __IE__TARGET_SSE41 inline void GetLinearTexelCoordinatesSSE41(__m128 c, const std::int32_t size, const ::IE::SamplerAddress address,
+                                                                      __m128i& i0, __m128i& i1, __m128& fraction) noexcept
+        {
+            if (address == ::IE::SamplerAddress::WRAP)
+                c = _mm_sub_ps(c, _mm_floor_ps(c));
+
+            const __m128 x  = _mm_min_ps(_mm_max_ps(_mm_sub_ps(_mm_mul_ps(c, _mm_set1_ps(static_cast<float>(size))), _mm_set1_ps(0.5f)), _mm_set1_ps(-1.0f)),
+                                         _mm_set1_ps(static_cast<float>(size)));
+            const __m128 x0 = _mm_floor_ps(x);
+
+            const __m128i sizeMinusOne = _mm_set1_epi32(size - 1);
+
+            fraction = _mm_sub_ps(x, x0);
+            i0 = _mm_cvttps_epi32(x0);
+            i1 = _mm_add_epi32(i0, _mm_set1_epi32(1));
+
+            if (address == ::IE::SamplerAddress::WRAP) {
+                i0 = _mm_blendv_epi8(i0, sizeMinusOne, _mm_cmplt_epi32(i0, _mm_setzero_si128()));
+                i1 = _mm_andnot_si128(_mm_cmpgt_epi32(i1, sizeMinusOne), i1);
+            } else {
+                i0 = _mm_min_epi32(_mm_max_epi32(i0, _mm_setzero_si128()), sizeMinusOne);
+                i1 = _mm_min_epi32(_mm_max_epi32(i1, _mm_setzero_si128()), sizeMinusOne);
+            }
+        }
+
+        __IE__TARGET_SSE41 inline __m128i GetImageTexelIndicesSSE41(const __m128i x, const __m128i y, const std::int32_t tileRowStride) noexcept
+        {
+            const __m128i rows    = _mm_add_epi32(_mm_mullo_epi32(_mm_srli_epi32(y, 2), _mm_set1_epi32(tileRowStride)), _mm_slli_epi32(_mm_and_si128(y, _mm_set1_epi32(3)), 2));
+            const __m128i columns = _mm_add_epi32(_mm_slli_epi32(_mm_srli_epi32(x, 2), 4), _mm_and_si128(x, _mm_set1_epi32(3)));
+
+            return _mm_add_epi32(rows, columns);
+        }
+
+        __IE__TARGET_SSE41 inline ::IE::Internal::ImageBilinearLanesSSE41 GetImageBilinearLanesSSE41(const ::IE::Internal::ImageLevelView& level, const ::IE::Internal::ImageSampleBatch& batch,
+                                                                                                      const __m128 u, const __m128 v) noexcept
+        {
+            __m128i x0, x1, y0, y1;
+            ::IE::Internal::ImageBilinearLanesSSE41 lanes;
+
+            ::IE::Internal::GetLinearTexelCoordinatesSSE41(u, level.m_width,  batch.m_addressU, x0, x1, lanes.m_fx);
+            ::IE::Internal::GetLinearTexelCoordinatesSSE41(v, level.m_height, batch.m_addressV, y0, y1, lanes.m_fy);
+
+            lanes.m_i00 = ::IE::Internal::GetImageTexelIndicesSSE41(x0, y0, level.m_tileRowStride);
+            lanes.m_i10 = ::IE::Internal::GetImageTexelIndicesSSE41(x1, y0, level.m_tileRowStride);
+            lanes.m_i01 = ::IE::Internal::GetImageTexelIndicesSSE41(x0, y1, level.m_tileRowStride);
+            lanes.m_i11 = ::IE::Internal::GetImageTexelIndicesSSE41(x1, y1, level.m_tileRowStride);
+
+            return lanes;
+        }
+
+        __IE__TARGET_SSE41 inline __m128i GatherImageTexelsSSE41(const std::uint32_t* pTexels, const __m128i indices) noexcept
+        {
+            return _mm_setr_epi32(static_cast<int>(pTexels[_mm_cvtsi128_si32(indices)]),      static_cast<int>(pTexels[_mm_extract_epi32(indices, 1)]),
+                                  static_cast<int>(pTexels[_mm_extract_epi32(indices, 2)]),   static_cast<int>(pTexels[_mm_extract_epi32(indices, 3)]));
+        }
+
+        // Bilinear samples of 4 coordinates in a "Coloru8" level, one channel per register
+        __IE__TARGET_SSE41 inline void SampleImageLevelU8SSE41(const ::IE::Internal::ImageLevelView& level, const ::IE::Internal::ImageSampleBatch& batch,
+                                                               const __m128 u, const __m128 v, __m128 (&channels)[4u]) noexcept
+        {
+            const ::IE::Internal::ImageBilinearLanesSSE41 lanes = ::IE::Internal::GetImageBilinearLanesSSE41(level, batch, u, v);
+            const std::uint32_t* const pTexels = static_cast<const std::uint32_t*>(level.m_pTexels);
+
+            const __m128i t00 = ::IE::Internal::GatherImageTexelsSSE41(pTexels, lanes.m_i00);
+            const __m128i t10 = ::IE::Internal::GatherImageTexelsSSE41(pTexels, lanes.m_i10);
+            const __m128i t01 = ::IE::Internal::GatherImageTexelsSSE41(pTexels, lanes.m_i01);
+            const __m128i t11 = ::IE::Internal::GatherImageTexelsSSE41(pTexels, lanes.m_i11);
+
+            const __m128i mask = _mm_set1_epi32(0xFF);
+
+            for (size_t c = 0u; c < 4u; c++) {
+                const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(8u * c));
+
+                const __m128 c00 = _mm_cvtepi32_ps(_mm_and_si128(_mm_srl_epi32(t00, shift), mask));
+                const __m128 c10 = _mm_cvtepi32_ps(_mm_and_si128(_mm_srl_epi32(t10, shift), mask));
+                const __m128 c01 = _mm_cvtepi32_ps(_mm_and_si128(_mm_srl_epi32(t01, shift), mask));
+                const __m128 c11 = _mm_cvtepi32_ps(_mm_and_si128(_mm_srl_epi32(t11, shift), mask));
+
+                const __m128 top    = _mm_add_ps(c00, _mm_mul_ps(_mm_sub_ps(c10, c00), lanes.m_fx));
+                const __m128 bottom = _mm_add_ps(c01, _mm_mul_ps(_mm_sub_ps(c11, c01), lanes.m_fx));
+
+                channels[c] = _mm_add_ps(top, _mm_mul_ps(_mm_sub_ps(bottom, top), lanes.m_fy));
+            }
+        }
+
+        __IE__TARGET_SSE41 inline void SampleImageU8SSE41(const ::IE::Internal::ImageSampleBatch& batch, const float* u, const float* v, void* out, const size_t count) noexcept
+        {
+            const ::IE::Internal::ImageLevelView& level = batch.m_levels[0];
+            std::uint32_t* const pOut = static_cast<std::uint32_t*>(out);
+
+            const bool bTrilinear = batch.m_filter == ::IE::SamplerFilter::TRILINEAR && batch.m_levelBlend != 0.0f;
+
+            size_t i = 0u;
+
+            for (; i + 4u <= count; i += 4u) {
+                const __m128 uu = _mm_loadu_ps(u + i);
+                const __m128 vv = _mm_loadu_ps(v + i);
+
+                if (batch.m_filter == ::IE::SamplerFilter::NEAREST) {
+                    const __m128i x = ::IE::Internal::GetNearestTexelCoordinatesSSE41(uu, level.m_width,  batch.m_addressU);
+                    const __m128i y = ::IE::Internal::GetNearestTexelCoordinatesSSE41(vv, level.m_height, batch.m_addressV);
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(pOut + i),
+                                     ::IE::Internal::GatherImageTexelsSSE41(static_cast<const std::uint32_t*>(level.m_pTexels), ::IE::Internal::GetImageTexelIndicesSSE41(x, y, level.m_tileRowStride)));
+                    continue;
+                }
+
+                __m128 channels[4u];
+                ::IE::Internal::SampleImageLevelU8SSE41(level, batch, uu, vv, channels);
+
+                if (bTrilinear) {
+                    __m128 next[4u];
+                    ::IE::Internal::SampleImageLevelU8SSE41(batch.m_levels[1], batch, uu, vv, next);
+
+                    for (size_t c = 0u; c < 4u; c++)
+                        channels[c] = _mm_add_ps(channels[c], _mm_mul_ps(_mm_sub_ps(next[c], channels[c]), _mm_set1_ps(batch.m_levelBlend)));
+                }
+
+                const __m128i texels = _mm_or_si128(_mm_or_si128(_mm_cvtps_epi32(channels[0]), _mm_slli_epi32(_mm_cvtps_epi32(channels[1]), 8)),
+                                                    _mm_or_si128(_mm_slli_epi32(_mm_cvtps_epi32(channels[2]), 16), _mm_slli_epi32(_mm_cvtps_epi32(channels[3]), 24)));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pOut + i), texels);
+            }
+
+            ::IE::Internal::SampleImageScalar<false>(batch, u + i, v + i, pOut + i, count - i);
+        }
+
+        // Bilinear samples of a "Colorf32" level whose footprints were computed 4 at a time
+        __IE__TARGET_SSE41 inline void SampleImageLevelF32SSE41(const ::IE::Internal::ImageLevelView& level, const ::IE::Internal::ImageBilinearLanesSSE41& lanes,
+                                                                __m128 (&texels)[4u]) noexcept
+        {
+            alignas(16) std::int32_t i00[4u], i10[4u], i01[4u], i11[4u];
+            alignas(16) float        fx[4u], fy[4u];
+
+            _mm_store_si128(reinterpret_cast<__m128i*>(i00), lanes.m_i00);
+            _mm_store_si128(reinterpret_cast<__m128i*>(i10), lanes.m_i10);
+            _mm_store_si128(reinterpret_cast<__m128i*>(i01), lanes.m_i01);
+            _mm_store_si128(reinterpret_cast<__m128i*>(i11), lanes.m_i11);
+            _mm_store_ps(fx, lanes.m_fx);
+            _mm_store_ps(fy, lanes.m_fy);
+
+            const float* const pTexels = static_cast<const float*>(level.m_pTexels);
+
+            for (size_t l = 0u; l < 4u; l++) {
+                const __m128 c00 = _mm_load_ps(pTexels + 4u * static_cast<size_t>(i00[l]));
+                const __m128 c10 = _mm_load_ps(pTexels + 4u * static_cast<size_t>(i10[l]));
+                const __m128 c01 = _mm_load_ps(pTexels + 4u * static_cast<size_t>(i01[l]));
+                const __m128 c11 = _mm_load_ps(pTexels + 4u * static_cast<size_t>(i11[l]));
+
+                const __m128 wx = _mm_set1_ps(fx[l]);
+
+                const __m128 top    = _mm_add_ps(c00, _mm_mul_ps(_mm_sub_ps(c10, c00), wx));
+                const __m128 bottom = _mm_add_ps(c01, _mm_mul_ps(_mm_sub_ps(c11, c01), wx));
+
+                texels[l] = _mm_add_ps(top, _mm_mul_ps(_mm_sub_ps(bottom, top), _mm_set1_ps(fy[l])));
+            }
+        }
+
+        __IE__TARGET_SSE41 inline void SampleImageF32SSE41(const ::IE::Internal::ImageSampleBatch& batch, const float* u, const float* v, void* out, const size_t count) noexcept
+        {
+            const ::IE::Internal::ImageLevelView& level = batch.m_levels[0];
+            float* const pOut = static_cast<float*>(out);
+
+            const bool bTrilinear = batch.m_filter == ::IE::SamplerFilter::TRILINEAR && batch.m_levelBlend != 0.0f;
+
+            size_t i = 0u;
+
+            for (; i + 4u <= count; i += 4u) {
+                const __m128 uu = _mm_loadu_ps(u + i);
+                const __m128 vv = _mm_loadu_ps(v + i);
+
+                __m128 texels[4u];
+
+                if (batch.m_filter == ::IE::SamplerFilter::NEAREST) {
+                    const __m128i x = ::IE::Internal::GetNearestTexelCoordinatesSSE41(uu, level.m_width,  batch.m_addressU);
+                    const __m128i y = ::IE::Internal::GetNearestTexelCoordinatesSSE41(vv, level.m_height, batch.m_addressV);
+
+                    alignas(16) std::int32_t indices[4u];
+                    _mm_store_si128(reinterpret_cast<__m128i*>(indices), ::IE::Internal::GetImageTexelIndicesSSE41(x, y, level.m_tileRowStride));
+
+                    for (size_t l = 0u; l < 4u; l++)
+                        texels[l] = _mm_load_ps(static_cast<const float*>(level.m_pTexels) + 4u * static_cast<size_t>(indices[l]));
+                } else {
+                    ::IE::Internal::SampleImageLevelF32SSE41(level, ::IE::Internal::GetImageBilinearLanesSSE41(level, batch, uu, vv), texels);
+
+                    if (bTrilinear) {
+                        __m128 next[4u];
+                        ::IE::Internal::SampleImageLevelF32SSE41(batch.m_levels[1], ::IE::Internal::GetImageBilinearLanesSSE41(batch.m_levels[1], batch, uu, vv), next);
+
+                        for (size_t l = 0u; l < 4u; l++)
+                            texels[l] = _mm_add_ps(texels[l], _mm_mul_ps(_mm_sub_ps(next[l], texels[l]), _mm_set1_ps(batch.m_levelBlend)));
+                    }
+                }
+
+                for (size_t l = 0u; l < 4u; l++)
+                    _mm_storeu_ps(pOut + 4u * (i + l), texels[l]);
+            }
+
+            ::IE::Internal::SampleImageScalar<true>(batch, u + i, v + i, pOut + 4u * i, count - i);
+        }
+
+        struct ImageBilinearLanesAVX2 {
+            __m256i m_i00, m_i10, m_i01, m_i11;
+            __m256  m_fx, m_fy;
+        };
+
+        __IE__TARGET_AVX2 inline __m256i GetNearestTexelCoordinatesAVX2(__m256 c, const std::int32_t size, const ::IE::SamplerAddress address) noexcept
+        {
+            if (address == ::IE::SamplerAddress::WRAP)
+                c = _mm256_sub_ps(c, _mm256_floor_ps(c));
+
+            const __m256 x = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(c, _mm256_set1_ps(static_cast<float>(size))), _mm256_setzero_ps()), _mm256_set1_ps(static_cast<float>(size - 1)));
+
+            return _mm256_cvttps_epi32(x);
+        }
+
+        __IE__TARGET_AVX2 inline void GetLinearTexelCoordinatesAVX2(__m256 c, const std::int32_t size, const ::IE::SamplerAddress address,
+                                                                    __m256i& i0, __m256i& i1, __m256& fraction) noexcept
+        {
+            if (address == ::IE::SamplerAddress::WRAP)
+                c = _mm256_sub_ps(c, _mm256_floor_ps(c));
+
+            // No fma, the results must match the other kernels
+            const __m256 x  = _mm256_min_ps(_mm256_max_ps(_mm256_sub_ps(_mm256_mul_ps(c, _mm256_set1_ps(static_cast<float>(size))), _mm256_set1_ps(0.5f)), _mm256_set1_ps(-1.0f)),
+                                            _mm256_set1_ps(static_cast<float>(size)));
+            const __m256 x0 = _mm256_floor_ps(x);
+
+            const __m256i sizeMinusOne = _mm256_set1_epi32(size - 1);
+
+            fraction = _mm256_sub_ps(x, x0);
+            i0 = _mm256_cvttps_epi32(x0);
+            i1 = _mm256_add_epi32(i0, _mm256_set1_epi32(1));
+
+            if (address == ::IE::SamplerAddress::WRAP) {
+                i0 = _mm256_blendv_epi8(i0, sizeMinusOne, _mm256_cmpgt_epi32(_mm256_setzero_si256(), i0));
+                i1 = _mm256_andnot_si256(_mm256_cmpgt_epi32(i1, sizeMinusOne), i1);
+            } else {
+                i0 = _mm256_min_epi32(_mm256_max_epi32(i0, _mm256_setzero_si256()), sizeMinusOne);
+                i1 = _mm256_min_epi32(_mm256_max_epi32(i1, _mm256_setzero_si256()), sizeMinusOne);
+            }
+        }
+
+        __IE__TARGET_AVX2 inline __m256i GetImageTexelIndicesAVX2(const __m256i x, const __m256i y, const std::int32_t tileRowStride) noexcept
+        {
+            const __m256i rows    = _mm256_add_epi32(_mm256_mullo_epi32(_mm256_srli_epi32(y, 2), _mm256_set1_epi32(tileRowStride)), _mm256_slli_epi32(_mm256_and_si256(y, _mm256_set1_epi32(3)), 2));
+            const __m256i columns = _mm256_add_epi32(_mm256_slli_epi32(_mm256_srli_epi32(x, 2), 4), _mm256_and_si256(x, _mm256_set1_epi32(3)));
+
+            return _mm256_add_epi32(rows, columns);
+        }
+
+        __IE__TARGET_AVX2 inline ::IE::Internal::ImageBilinearLanesAVX2 GetImageBilinearLanesAVX2(const ::IE::Internal::ImageLevelView& level, const ::IE::Internal::ImageSampleBatch& batch,
+                                                                                                   const __m256 u, const __m256 v) noexcept
+        {
+            __m256i x0, x1, y0, y1;
+            ::IE::Internal::ImageBilinearLanesAVX2 lanes;
+
+            ::IE::Internal::GetLinearTexelCoordinatesAVX2(u, level.m_width,  batch.m_addressU, x0, x1, lanes.m_fx);
+            ::IE::Internal::GetLinearTexelCoordinatesAVX2(v, level.m_height, batch.m_addressV, y0, y1, lanes.m_fy);
+
+            lanes.m_i00 = ::IE::Internal::GetImageTexelIndicesAVX2(x0, y0, level.m_tileRowStride);
+            lanes.m_i10 = ::IE::Internal::GetImageTexelIndicesAVX2(x1, y0, level.m_tileRowStride);
+            lanes.m_i01 = ::IE::Internal::GetImageTexelIndicesAVX2(x0, y1, level.m_tileRowStride);
+            lanes.m_i11 = ::IE::Internal::GetImageTexelIndicesAVX2(x1, y1, level.m_tileRowStride);
+
+            return lanes;
+        }
+
+        __IE__TARGET_AVX2 inline void SampleImageLevelU8AVX2(const ::IE::Internal::ImageLevelView& level, const ::IE::Internal::ImageSampleBatch& batch,
+                                                             const __m256 u, const __m256 v, __m256 (&channels)[4u]) noexcept
+        {
+            const ::IE::Internal::ImageBilinearLanesAVX2 lanes = ::IE::Internal::GetImageBilinearLanesAVX2(level, batch, u, v);
+            const int* const pTexels = static_cast<const int*>(level.m_pTexels);
+
+            const __m256i t00 = _mm256_i32gather_epi32(pTexels, lanes.m_i00, 4);
+            const __m256i t10 = _mm256_i32gather_epi32(pTexels, lanes.m_i10, 4);
+            const __m256i t01 = _mm256_i32gather_epi32(pTexels, lanes.m_i01, 4);
+            const __m256i t11 = _mm256_i32gather_epi32(pTexels, lanes.m_i11, 4);
+
+            const __m256i mask = _mm256_set1_epi32(0xFF);
+
+            for (size_t c = 0u; c < 4u; c++) {
+                const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(8u * c));
+
+                const __m256 c00 = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srl_epi32(t00, shift), mask));
+                const __m256 c10 = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srl_epi32(t10, shift), mask));
+                const __m256 c01 = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srl_epi32(t01, shift), mask));
+                const __m256 c11 = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srl_epi32(t11, shift), mask));
+
+                const __m256 top    = _mm256_add_ps(c00, _mm256_mul_ps(_mm256_sub_ps(c10, c00), lanes.m_fx));
+                const __m256 bottom = _mm256_add_ps(c01, _mm256_mul_ps(_mm256_sub_ps(c11, c01), lanes.m_fx));
+
+                channels[c] = _mm256_add_ps(top, _mm256_mul_ps(_mm256_sub_ps(bottom, top), lanes.m_fy));
+            }
+        }
+
+        __IE__TARGET_AVX2 inline void SampleImageU8AVX2(const ::IE::Internal::ImageSampleBatch& batch, const float* u, const float* v, void* out, const size_t count) noexcept
+        {
+            const ::IE::Internal::ImageLevelView& level = batch.m_levels[0];
+            std::uint32_t* const pOut = static_cast<std::uint32_t*>(out);
+
+            const bool bTrilinear = batch.m_filter == ::IE::SamplerFilter::TRILINEAR && batch.m_levelBlend != 0.0f;
+
+            size_t i = 0u;
+
+            for (; i + 8u <= count; i += 8u) {
+                const __m256 uu = _mm256_loadu_ps(u + i);
+                const __m256 vv = _mm256_loadu_ps(v + i);
+
+                if (batch.m_filter == ::IE::SamplerFilter::NEAREST) {
+                    const __m256i x = ::IE::Internal::GetNearestTexelCoordinatesAVX2(uu, level.m_width,  batch.m_addressU);
+                    const __m256i y = ::IE::Internal::GetNearestTexelCoordinatesAVX2(vv, level.m_height, batch.m_addressV);
+
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(pOut + i),
+                                        _mm256_i32gather_epi32(static_cast<const int*>(level.m_pTexels), ::IE::Internal::GetImageTexelIndicesAVX2(x, y, level.m_tileRowStride), 4));
+                    continue;
+                }
+
+                __m256 channels[4u];
+                ::IE::Internal::SampleImageLevelU8AVX2(level, batch, uu, vv, channels);
+
+                if (bTrilinear) {
+                    __m256 next[4u];
+                    ::IE::Internal::SampleImageLevelU8AVX2(batch.m_levels[1], batch, uu, vv, next);
+
+                    for (size_t c = 0u; c < 4u; c++)
+                        channels[c] = _mm256_add_ps(channels[c], _mm256_mul_ps(_mm256_sub_ps(next[c], channels[c]), _mm256_set1_ps(batch.m_levelBlend)));
+                }
+
+                const __m256i texels = _mm256_or_si256(_mm256_or_si256(_mm256_cvtps_epi32(channels[0]), _mm256_slli_epi32(_mm256_cvtps_epi32(channels[1]), 8)),
+                                                       _mm256_or_si256(_mm256_slli_epi32(_mm256_cvtps_epi32(channels[2]), 16), _mm256_slli_epi32(_mm256_cvtps_epi32(channels[3]), 24)));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(pOut + i), texels);
+            }
+
+            ::IE::Internal::SampleImageScalar<false>(batch, u + i, v + i, pOut + i, count - i);
+        }
+
+        __IE__TARGET_AVX2 inline __m256 LoadImageTexelPairAVX2(const float* pTexels, const std::int32_t* indices) noexcept
+        {
+            return _mm256_set_m128(_mm_load_ps(pTexels + 4u * static_cast<size_t>(indices[1])), _mm_load_ps(pTexels + 4u * static_cast<size_t>(indices[0])));
+        }
+
+        // Footprints are computed 8 at a time, the texels (a whole "__m128" each) are then blended 2 at a time
+        __IE__TARGET_AVX2 inline void SampleImageLevelF32AVX2(const ::IE::Internal::ImageLevelView& level, const ::IE::Internal::ImageBilinearLanesAVX2& lanes,
+                                                              __m256 (&texelPairs)[4u]) noexcept
+        {
+            alignas(32) std::int32_t i00[8u], i10[8u], i01[8u], i11[8u];
+            alignas(32) float        fx[8u], fy[8u];
+
+            _mm256_store_si256(reinterpret_cast<__m256i*>(i00), lanes.m_i00);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(i10), lanes.m_i10);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(i01), lanes.m_i01);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(i11), lanes.m_i11);
+            _mm256_store_ps(fx, lanes.m_fx);
+            _mm256_store_ps(fy, lanes.m_fy);
+
+            const float* const pTexels = static_cast<const float*>(level.m_pTexels);
+
+            for (size_t l = 0u; l < 8u; l += 2u) {
+                const __m256 c00 = ::IE::Internal::LoadImageTexelPairAVX2(pTexels, i00 + l);
+                const __m256 c10 = ::IE::Internal::LoadImageTexelPairAVX2(pTexels, i10 + l);
+                const __m256 c01 = ::IE::Internal::LoadImageTexelPairAVX2(pTexels, i01 + l);
+                const __m256 c11 = ::IE::Internal::LoadImageTexelPairAVX2(pTexels, i11 + l);
+
+                const __m256 wx = _mm256_set_m128(_mm_set1_ps(fx[l + 1u]), _mm_set1_ps(fx[l]));
+                const __m256 wy = _mm256_set_m128(_mm_set1_ps(fy[l + 1u]), _mm_set1_ps(fy[l]));
+
+                const __m256 top    = _mm256_add_ps(c00, _mm256_mul_ps(_mm256_sub_ps(c10, c00), wx));
+                const __m256 bottom = _mm256_add_ps(c01, _mm256_mul_ps(_mm256_sub_ps(c11, c01), wx));
+
+                texelPairs[l / 2u] = _mm256_add_ps(top, _mm256_mul_ps(_mm256_sub_ps(bottom, top), wy));
+            }
+        }
+
+        __IE__TARGET_AVX2 inline void SampleImageF32AVX2(const ::IE::Internal::ImageSampleBatch& batch, const float* u, const float* v, void* out, const size_t count) noexcept
+        {
+            const ::IE::Internal::ImageLevelView& level = batch.m_levels[0];
+            float* const pOut = static_cast<float*>(out);
+
+            const bool bTrilinear = batch.m_filter == ::IE::SamplerFilter::TRILINEAR && batch.m_levelBlend != 0.0f;
+
+            size_t i = 0u;
+
+            for (; i + 8u <= count; i += 8u) {
+                const __m256 uu = _mm256_loadu_ps(u + i);
+                const __m256 vv = _mm256_loadu_ps(v + i);
+
+                if (batch.m_filter == ::IE::SamplerFilter::NEAREST) {
+                    const __m256i x = ::IE::Internal::GetNearestTexelCoordinatesAVX2(uu, level.m_width,  batch.m_addressU);
+                    const __m256i y = ::IE::Internal::GetNearestTexelCoordinatesAVX2(vv, level.m_height, batch.m_addressV);
+
+                    alignas(32) std::int32_t indices[8u];
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(indices), ::IE::Internal::GetImageTexelIndicesAVX2(x, y, level.m_tileRowStride));
+
+                    for (size_t l = 0u; l < 8u; l++)
+                        _mm_storeu_ps(pOut + 4u * (i + l), _mm_load_ps(static_cast<const float*>(level.m_pTexels) + 4u * static_cast<size_t>(indices[l])));
+
+                    continue;
+                }
+
+                __m256 texelPairs[4u];
+                ::IE::Internal::SampleImageLevelF32AVX2(level, ::IE::Internal::GetImageBilinearLanesAVX2(level, batch, uu, vv), texelPairs);
+
+                if (bTrilinear) {
+                    __m256 next[4u];
+                    ::IE::Internal::SampleImageLevelF32AVX2(batch.m_levels[1], ::IE::Internal::GetImageBilinearLanesAVX2(batch.m_levels[1], batch, uu, vv), next);
+
+                    for (size_t p = 0u; p < 4u; p++)
+                        texelPairs[p] = _mm256_add_ps(texelPairs[p], _mm256_mul_ps(_mm256_sub_ps(next[p], texelPairs[p]), _mm256_set1_ps(batch.m_levelBlend)));
+                }
+
+                for (size_t p = 0u; p < 4u; p++)
+                    _mm256_storeu_ps(pOut + 4u * (i + 2u * p), texelPairs[p]);
+            }
+
+            ::IE::Internal::SampleImageScalar<true>(batch, u + i, v + i, pOut + 4u * i, count - i);
+        }
+
+#endif // #ifdef __IE__ENABLE_SIMD
+
+        // Modified Bessel function of the first kind (order 0), for the Kaiser window
+        inline double BesselI0(const double x) noexcept
+        {
+            double sum = 1.0, term = 1.0;
+
+            for (int k = 1; term > sum * 1e-12; k++) {
+                term *= (x * 0.5 / k) * (x * 0.5 / k);
+                sum  += term;
+            }
+
+            return sum;
+        }
+
+        // Weight of a source texel "t" destination texels away from the destination texel's center
+        inline float GetKaiserMipmapWeight(const double t) noexcept
+        {
+            constexpr const double RADIUS = 3.0, ALPHA = 4.0;
+
+            if (std::abs(t) >= RADIUS)
+                return 0.0f;
+
+            const double ratio  = t / RADIUS;
+            const double sinc   = (t == 0.0) ? 1.0 : std::sin(std::numbers::pi * t) / (std::numbers::pi * t);
+            const double window = ::IE::Internal::BesselI0(ALPHA * std::sqrt(1.0 - ratio * ratio)) / ::IE::Internal::BesselI0(ALPHA);
+
+            return static_cast<float>(sinc * window);
+        }
+
+        // Normalized weights of the source texels of every destination texel along an axis ("first" texel, then "count" weights)
+        struct MipmapAxisWeights {
+            std::vector<std::int32_t> m_first;
+            std::vector<float>        m_weights;
+            size_t                    m_tapCount;
+
+            MipmapAxisWeights(const size_t sourceSize, const size_t destinationSize) noexcept
+            {
+                const double scale = static_cast<double>(sourceSize) / static_cast<double>(destinationSize);
+
+                this->m_tapCount = static_cast<size_t>(std::ceil(6.0 * scale)) + 1u;
+                this->m_first.resize(destinationSize);
+                this->m_weights.assign(destinationSize * this->m_tapCount, 0.0f);
+
+                for (size_t d = 0u; d < destinationSize; d++) {
+                    const double center = (static_cast<double>(d) + 0.5) * scale;
+                    const std::int32_t first = static_cast<std::int32_t>(std::floor(center - 3.0 * scale));
+
+                    float* const weights = this->m_weights.data() + d * this->m_tapCount;
+                    float        sum     = 0.0f;
+
+                    for (size_t t = 0u; t < this->m_tapCount; t++) {
+                        weights[t] = ::IE::Internal::GetKaiserMipmapWeight((static_cast<double>(first + static_cast<std::int32_t>(t)) + 0.5 - center) / scale);
+                        sum += weights[t];
+                    }
+
+                    for (size_t t = 0u; t < this->m_tapCount; t++)
+                        weights[t] /= sum;
+
+                    this->m_first[d] = first;
+                }
+            }
+        };
+
+    } // Internal
+
+    /* Image of "Coloru8" or "Colorf32" texels with an optional chain of mip levels, stored in 4x4   */
+    /* texel tiles so that the texels read by a bilinear sample are close in memory. "Sample" takes  */
+    /* arrays of normalized coordinates and samples them 4 (SSE4.1) or 8 (AVX2) at a time, with one  */
+    /* level of detail for the whole batch (as GPUs share it over a 2x2 quad, see "GetLevelOfDetail"). */
+    /* "Coloru8" images are usually filled straight from "PNGDecoder" (RGBA8):                       */
+    /*     image.SetTexels(reinterpret_cast<const IE::Coloru8*>(pixels.data()), header.m_width);    */
+    template <typename _COLOR>
+    class Image {
+        static_assert(std::is_same_v<_COLOR, ::IE::Coloru8> || std::is_same_v<_COLOR, ::IE::Colorf32>, "Images hold \"Coloru8\" or \"Colorf32\" texels");
+
+    public:
+        static constexpr size_t TILE_SIZE = ::IE::Internal::IMAGE_TILE_SIZE;
+
+        // Every level of the chain down to 1x1 (a 65535 texels wide image has 16 levels)
+        static constexpr size_t MAX_LEVEL_COUNT = 16u;
+
+    private:
+        static constexpr bool IS_FLOAT = std::is_same_v<_COLOR, ::IE::Colorf32>;
+
+        struct Level {
+            size_t        m_offset        = 0u; // In texels, from the first texel of the first level
+            size_t        m_tileRowStride = 0u;
+            std::uint16_t m_width         = 0u;
+            std::uint16_t m_height        = 0u;
+        };
+
+        _COLOR* m_pTexels    = nullptr;
+        size_t  m_texelCount = 0u;
+
+        std::array<Level, MAX_LEVEL_COUNT> m_levels;
+        size_t                             m_levelCount = 0u;
+
+        inline size_t GetTexelIndex(const size_t x, const size_t y, const size_t level) const noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(level < this->m_levelCount && x < this->m_levels[level].m_width && y < this->m_levels[level].m_height);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            return this->m_levels[level].m_offset + ::IE::Internal::GetImageTexelIndex(x, y, this->m_levels[level].m_tileRowStride);
+        }
+
+        inline ::IE::Internal::ImageLevelView GetLevelView(const size_t level) const noexcept
+        {
+            return {
+                this->m_pTexels + this->m_levels[level].m_offset, this->m_levels[level].m_width, this->m_levels[level].m_height,
+                static_cast<std::int32_t>(this->m_levels[level].m_tileRowStride)
+            };
+        }
+
+        static inline void LoadTexel(const _COLOR& texel, float (&channels)[4u]) noexcept
+        {
+            channels[0] = static_cast<float>(texel.x); channels[1] = static_cast<float>(texel.y);
+            channels[2] = static_cast<float>(texel.z); channels[3] = static_cast<float>(texel.w);
+        }
+
+        static inline _COLOR StoreTexel(const float (&channels)[4u]) noexcept
+        {
+            if constexpr (IS_FLOAT) {
+                return _COLOR(channels[0], channels[1], channels[2], channels[3]);
+            } else {
+                const auto toUnorm8 = [](const float value) noexcept { return static_cast<std::uint8_t>(std::lrint(std::clamp(value, 0.0f, 255.0f))); };
+
+                return _COLOR(toUnorm8(channels[0]), toUnorm8(channels[1]), toUnorm8(channels[2]), toUnorm8(channels[3]));
+            }
+        }
+
+        ::IE::Internal::ImageSampleBatch GetSampleBatch(const ::IE::Sampler& sampler, float lod) const noexcept
+        {
+            ::IE::Internal::ImageSampleBatch batch;
+            batch.m_filter     = sampler.m_filter;
+            batch.m_addressU   = sampler.m_addressU;
+            batch.m_addressV   = sampler.m_addressV;
+            batch.m_levelBlend = 0.0f;
+
+            // NaNs select the first level
+            lod = std::min(static_cast<float>(this->m_levelCount - 1u), std::max(0.0f, lod));
+
+            const size_t level = static_cast<size_t>((sampler.m_filter == ::IE::SamplerFilter::TRILINEAR) ? std::floor(lod) : lod + 0.5f);
+
+            batch.m_levels[0] = this->GetLevelView(std::min(level, this->m_levelCount - 1u));
+            batch.m_levels[1] = batch.m_levels[0];
+
+            if (sampler.m_filter == ::IE::SamplerFilter::TRILINEAR && level + 1u < this->m_levelCount) {
+                batch.m_levels[1]  = this->GetLevelView(level + 1u);
+                batch.m_levelBlend = lod - static_cast<float>(level);
+            }
+
+            return batch;
+        }
+
+        void GenerateBoxLevel(const Level& source, const Level& destination, const size_t threadCount) noexcept
+        {
+            ::IE::Internal::ParallelFor(destination.m_height, threadCount, [&](const size_t y) noexcept {
+                const size_t y0 = std::min<size_t>(2u * y, source.m_height - 1u), y1 = std::min<size_t>(2u * y + 1u, source.m_height - 1u);
+
+                for (size_t x = 0u; x < destination.m_width; x++) {
+                    const size_t x0 = std::min<size_t>(2u * x, source.m_width - 1u), x1 = std::min<size_t>(2u * x + 1u, source.m_width - 1u);
+
+                    float c00[4u], c10[4u], c01[4u], c11[4u], sum[4u];
+                    Image::LoadTexel(this->m_pTexels[source.m_offset + ::IE::Internal::GetImageTexelIndex(x0, y0, source.m_tileRowStride)], c00);
+                    Image::LoadTexel(this->m_pTexels[source.m_offset + ::IE::Internal::GetImageTexelIndex(x1, y0, source.m_tileRowStride)], c10);
+                    Image::LoadTexel(this->m_pTexels[source.m_offset + ::IE::Internal::GetImageTexelIndex(x0, y1, source.m_tileRowStride)], c01);
+                    Image::LoadTexel(this->m_pTexels[source.m_offset + ::IE::Internal::GetImageTexelIndex(x1, y1, source.m_tileRowStride)], c11);
+
+                    for (size_t c = 0u; c < 4u; c++)
+                        sum[c] = (c00[c] + c10[c] + c01[c] + c11[c]) * 0.25f;
+
+                    this->m_pTexels[destination.m_offset + ::IE::Internal::GetImageTexelIndex(x, y, destination.m_tileRowStride)] = Image::StoreTexel(sum);
+                }
+            });
+        }
+
+        // Separable : the rows are filtered into a temporary image (destination width x source height), then the columns
+        void GenerateKaiserLevel(const Level& source, const Level& destination, const size_t threadCount) noexcept
+        {
+            const ::IE::Internal::MipmapAxisWeights weightsX(source.m_width,  destination.m_width);
+            const ::IE::Internal::MipmapAxisWeights weightsY(source.m_height, destination.m_height);
+
+            ::IE::ScratchArray<float> rows(static_cast<size_t>(destination.m_width) * source.m_height * 4u);
+
+            if (!rows.IsValid()) // Out of memory, the level is left as is
+                return;
+
+            std::fill_n(rows.GetData(), rows.GetSize(), 0.0f);
+
+            ::IE::Internal::ParallelFor(source.m_height, threadCount, [&](const size_t y) noexcept {
+                for (size_t x = 0u; x < destination.m_width; x++) {
+                    const float* const weights = weightsX.m_weights.data() + x * weightsX.m_tapCount;
+                    float* const       sum     = rows.GetData() + 4u * (y * destination.m_width + x);
+
+                    for (size_t t = 0u; t < weightsX.m_tapCount; t++) {
+                        const size_t sx = static_cast<size_t>(std::clamp<std::int32_t>(weightsX.m_first[x] + static_cast<std::int32_t>(t), 0, source.m_width - 1));
+
+                        float channels[4u];
+                        Image::LoadTexel(this->m_pTexels[source.m_offset + ::IE::Internal::GetImageTexelIndex(sx, y, source.m_tileRowStride)], channels);
+
+                        for (size_t c = 0u; c < 4u; c++)
+                            sum[c] += channels[c] * weights[t];
+                    }
+                }
+            });
+
+            ::IE::Internal::ParallelFor(destination.m_height, threadCount, [&](const size_t y) noexcept {
+                const float* const weights = weightsY.m_weights.data() + y * weightsY.m_tapCount;
+
+                for (size_t x = 0u; x < destination.m_width; x++) {
+                    float sum[4u] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+                    for (size_t t = 0u; t < weightsY.m_tapCount; t++) {
+                        const size_t sy = static_cast<size_t>(std::clamp<std::int32_t>(weightsY.m_first[y] + static_cast<std::int32_t>(t), 0, source.m_height - 1));
+                        const float* const channels = rows.GetData() + 4u * (sy * destination.m_width + x);
+
+                        for (size_t c = 0u; c < 4u; c++)
+                            sum[c] += channels[c] * weights[t];
+                    }
+
+                    this->m_pTexels[destination.m_offset + ::IE::Internal::GetImageTexelIndex(x, y, destination.m_tileRowStride)] = Image::StoreTexel(sum);
+                }
+            });
+        }
+
+    public:
+        Image() noexcept = default;
+
+        // Every texel is 0, "IsValid" is false when the texels couldn't be allocated
+        Image(const std::uint16_t width, const std::uint16_t height, const bool bMipmapped = false) noexcept
+        {
+            if (width == 0u || height == 0u) return;
+
+            size_t offset = 0u;
+
+            for (std::uint16_t w = width, h = height; ; w = static_cast<std::uint16_t>(std::max(w / 2, 1)), h = static_cast<std::uint16_t>(std::max(h / 2, 1))) {
+                Level& level = this->m_levels[this->m_levelCount++];
+
+                const size_t tilesX = (static_cast<size_t>(w) + TILE_SIZE - 1u) / TILE_SIZE;
+                const size_t tilesY = (static_cast<size_t>(h) + TILE_SIZE - 1u) / TILE_SIZE;
+
+                level.m_offset        = offset;
+                level.m_tileRowStride = tilesX * TILE_SIZE * TILE_SIZE;
+                level.m_width         = w;
+                level.m_height        = h;
+
+                offset += level.m_tileRowStride * tilesY;
+
+                if (!bMipmapped || (w == 1u && h == 1u))
+                    break;
+            }
+
+            // The kernels index texels with 32 bit integers
+            void* const pMemory = (offset <= (size_t(1) << 28u)) ? ::operator new(offset * sizeof(_COLOR), std::align_val_t{ ::IE::Framebuffer::ROW_ALIGNMENT }, std::nothrow) : nullptr;
+
+            if (pMemory == nullptr) {
+                this->m_levelCount = 0u;
+
+                return;
+            }
+
+            this->m_pTexels    = static_cast<_COLOR*>(pMemory);
+            this->m_texelCount = offset;
+
+            std::uninitialized_value_construct_n(this->m_pTexels, offset);
+        }
+
+        Image(const Image&) = delete;
+        Image& operator=(const Image&) = delete;
+
+        Image(Image&& other) noexcept { *this = std::move(other); }
+
+        Image& operator=(Image&& other) noexcept
+        {
+            std::swap(this->m_pTexels,    other.m_pTexels);
+            std::swap(this->m_texelCount, other.m_texelCount);
+            std::swap(this->m_levels,     other.m_levels);
+            std::swap(this->m_levelCount, other.m_levelCount);
+
+            return *this;
+        }
+
+        ~Image() noexcept
+        {
+            if (this->m_pTexels != nullptr)
+                ::operator delete(this->m_pTexels, std::align_val_t{ ::IE::Framebuffer::ROW_ALIGNMENT });
+        }
+
+        inline bool IsValid() const noexcept { return this->m_pTexels != nullptr; }
+
+        inline size_t        GetLevelCount()                      const noexcept { return this->m_levelCount; }
+        inline std::uint16_t GetWidth(const size_t level = 0u)  const noexcept { return this->m_levels[level].m_width;  }
+        inline std::uint16_t GetHeight(const size_t level = 0u) const noexcept { return this->m_levels[level].m_height; }
+
+        inline const _COLOR& GetTexel(const size_t x, const size_t y, const size_t level = 0u) const noexcept { return this->m_pTexels[this->GetTexelIndex(x, y, level)]; }
+        inline void          SetTexel(const size_t x, const size_t y, const _COLOR& color, const size_t level = 0u) noexcept { this->m_pTexels[this->GetTexelIndex(x, y, level)] = color; }
+
+        // Copies rows of texels ("stride" texels apart) into a level, tiling them
+        void SetTexels(const _COLOR* pTexels, const size_t stride, const size_t level = 0u) noexcept
+        {
+            for (size_t y = 0u; y < this->m_levels[level].m_height; y++)
+                for (size_t x = 0u; x < this->m_levels[level].m_width; x++)
+                    this->m_pTexels[this->GetTexelIndex(x, y, level)] = pTexels[y * stride + x];
+        }
+
+        // Copies a level into rows of texels ("stride" texels apart)
+        void GetTexels(_COLOR* pTexels, const size_t stride, const size_t level = 0u) const noexcept
+        {
+            for (size_t y = 0u; y < this->m_levels[level].m_height; y++)
+                for (size_t x = 0u; x < this->m_levels[level].m_width; x++)
+                    pTexels[y * stride + x] = this->m_pTexels[this->GetTexelIndex(x, y, level)];
+        }
+
+        // Fills every level from the previous one, on "threadCount" threads (all the hardware threads for 0)
+        void GenerateMipmaps(const ::IE::MipmapFilter filter = ::IE::MipmapFilter::BOX, size_t threadCount = 0u) noexcept
+        {
+            if (threadCount == 0u)
+                threadCount = ::IE::GetHardwareThreadCount();
+
+            for (size_t level = 1u; level < this->m_levelCount; level++) {
+                if (filter == ::IE::MipmapFilter::BOX)
+                    this->GenerateBoxLevel(this->m_levels[level - 1u], this->m_levels[level], threadCount);
+                else
+                    this->GenerateKaiserLevel(this->m_levels[level - 1u], this->m_levels[level], threadCount);
+            }
+        }
+
+        // Level of detail of a footprint given the derivatives of the normalized coordinates along the screen's x & y
+        inline float GetLevelOfDetail(const float dudx, const float dvdx, const float dudy, const float dvdy) const noexcept
+        {
+            const float width  = this->m_levels[0].m_width;
+            const float height = this->m_levels[0].m_height;
+
+            const float lengthX = (dudx * width) * (dudx * width) + (dvdx * height) * (dvdx * height);
+            const float lengthY = (dudy * width) * (dudy * width) + (dvdy * height) * (dvdy * height);
+
+            return 0.5f * std::log2(std::max(lengthX, lengthY));
+        }
+
+        // Samples "min(u.size(), v.size(), out.size())" coordinates at the level of detail "lod"
+        void Sample(const ::IE::Sampler& sampler, const std::span<const float> u, const std::span<const float> v, const float lod, const std::span<_COLOR> out) const noexcept
+        {
+            const size_t count = std::min({ u.size(), v.size(), out.size() });
+
+            if (count == 0u || !this->IsValid())
+                return;
+
+            const ::IE::Internal::ImageSampleBatch batch = this->GetSampleBatch(sampler, lod);
+
+            if constexpr (IS_FLOAT)
+                ::IE::Internal::GetSIMDKernels().m_pSampleImageF32(batch, u.data(), v.data(), out.data(), count);
+            else
+                ::IE::Internal::GetSIMDKernels().m_pSampleImageU8(batch, u.data(), v.data(), out.data(), count);
+        }
+
+        // Single sample (scalar)
+        inline _COLOR Sample(const ::IE::Sampler& sampler, const float u, const float v, const float lod = 0.0f) const noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(this->IsValid());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            _COLOR texel;
+            ::IE::Internal::SampleImageScalar<IS_FLOAT>(this->GetSampleBatch(sampler, lod), &u, &v, &texel, 1u);
+
+            return texel;
+        }
+    };
+
+    typedef ::IE::Image<::IE::Coloru8>  Imageu8;
+    typedef ::IE::Image<::IE::Colorf32> Imagef32;
+
+    // +------------------+
+    // | Color Conversion |
+    // +------------------+
+
+    /* Bulk conversions between float colors ("Colorf32", nominally in [0, 1]), 8 bit colors ("Coloru8") */
+    /* and the packed pixel layouts windows display. Every conversion rounds to nearest (ties to even)    */
+    /* and clamps its input first, NaNs becoming 0 (1 once an infinity went through a tone map).         */
+
+    enum class ColorSpace : std::uint8_t { LINEAR, SRGB };
+
+    // Compresses the red, green & blue channels (once scaled by the exposure) into [0, 1], ACES is Narkowicz' fit of the ACES filmic curve
+    enum class ToneMapOperator : std::uint8_t { NONE, REINHARD, ACES };
+
+    /* RGBA8 is the layout of "Coloru8", BGRA8 the one of "Framebuffer" pixels (0xAARRGGBB as a "std::uint32_t") */
+    /* and RGB565 the one of 16 bit X11 visuals (red in the 5 highest bits of a "std::uint16_t", no alpha).      */
+    enum class PixelLayout : std::uint8_t { RGBA8, BGRA8, RGB565 };
+
+    // How float colors are encoded. Alpha is always stored linearly and is never tone mapped.
+    struct ColorEncoding {
+        ::IE::ColorSpace      m_space    = ::IE::ColorSpace::LINEAR;
+        ::IE::ToneMapOperator m_toneMap  = ::IE::ToneMapOperator::NONE;
+        float                 m_exposure = 1.0f;
+    };
+
+    namespace Internal {
+
+        struct ColorEncodeParameters {
+            ::IE::PixelLayout     m_layout;
+            ::IE::ToneMapOperator m_toneMap;
+            bool                  m_bSRGB;
+            float                 m_exposure;
+        };
+
+        /* Exact sRGB encoding without evaluating the transfer function. "m_thresholds[k]" is the smallest float */
+        /* encoded to k + 1, and the floats from 2^-13 to 1 are split in buckets of 2^15 consecutive encodings  */
+        /* (256 per power of 2). The thresholds are far enough apart for each bucket to hold at most one, so a  */
+        /* float encodes to the number of thresholds below its bucket, plus one if it reaches the next one.     */
+        struct SRGBTables {
+            static constexpr std::uint32_t BUCKET_BASE  = 0x39000000u; // 2^-13, every float below it encodes to 0
+            static constexpr std::uint32_t BUCKET_SHIFT = 15u;
+            static constexpr size_t        BUCKET_COUNT = ((0x3F800000u - BUCKET_BASE) >> BUCKET_SHIFT) + 1u;
+
+            float         m_toLinear[256u];
+            float         m_thresholds[256u];           // The last one is never reached
+            std::uint16_t m_buckets[BUCKET_COUNT + 1u]; // Padded so that 32 bit gathers stay in bounds
+        };
+
+        inline double DecodeSRGB(const double value) noexcept
+        {
+            return (value <= 0.04045) ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4);
+        }
+
+        inline const ::IE::Internal::SRGBTables& GetSRGBTables() noexcept
+        {
+            static const ::IE::Internal::SRGBTables tables = []() noexcept {
+                using ::IE::Internal::SRGBTables;
+
+                SRGBTables result{};
+
+                for (size_t k = 0u; k < 256u; k++)
+                    result.m_toLinear[k] = static_cast<float>(::IE::Internal::DecodeSRGB(static_cast<double>(k) / 255.0));
+
+                // Rounded up so that "x >= threshold" holds exactly for the floats past the real threshold
+                for (size_t k = 0u; k < 255u; k++) {
+                    const double threshold = ::IE::Internal::DecodeSRGB((static_cast<double>(k) + 0.5) / 255.0);
+                    float rounded = static_cast<float>(threshold);
+
+                    if (static_cast<double>(rounded) < threshold)
+                        rounded = std::nextafter(rounded, 2.0f);
+
+                    result.m_thresholds[k] = rounded;
+                }
+
+                result.m_thresholds[255u] = 2.0f;
+
+                for (size_t bucket = 0u, k = 0u; bucket < SRGBTables::BUCKET_COUNT; bucket++) {
+                    const float start = std::bit_cast<float>(SRGBTables::BUCKET_BASE + static_cast<std::uint32_t>(bucket << SRGBTables::BUCKET_SHIFT));
+
+                    while (k < 255u && result.m_thresholds[k] <= start)
+                        k++;
+
+                    result.m_buckets[bucket] = static_cast<std::uint16_t>(k);
+                }
+
+                return result;
+            }();
+
+            return tables;
+        }
+
+        // "value" must be in [0, 1]
+        inline std::uint32_t EncodeSRGBScalar(const float value, const ::IE::Internal::SRGBTables& tables) noexcept
+        {
+            using ::IE::Internal::SRGBTables;
+
+            const std::int32_t  bits   = std::max(std::bit_cast<std::int32_t>(value), static_cast<std::int32_t>(SRGBTables::BUCKET_BASE));
+            const std::uint32_t bucket = tables.m_buckets[static_cast<std::uint32_t>(bits - SRGBTables::BUCKET_BASE) >> SRGBTables::BUCKET_SHIFT];
+
+            return bucket + ((value >= tables.m_thresholds[bucket]) ? 1u : 0u);
+        }
+
+        // Scales, tone maps & clamps a red, green or blue channel to [0, 1] (the SIMD kernels mirror these operations, NaNs included)
+        inline float ToneMapScalar(float value, const ::IE::Internal::ColorEncodeParameters& params) noexcept
+        {
+            value = std::max(0.0f, value * params.m_exposure);
+
+            if (params.m_toneMap == ::IE::ToneMapOperator::REINHARD)
+                value = value / (1.0f + value);
+            else if (params.m_toneMap == ::IE::ToneMapOperator::ACES)
+                value = (value * (2.51f * value + 0.03f)) / (value * (2.43f * value + 0.59f) + 0.14f);
+
+            return std::min(1.0f, value);
+        }
+
+        inline std::uint32_t QuantizeUnorm8Scalar(const float value) noexcept
+        {
+            return static_cast<std::uint32_t>(std::nearbyint(value * 255.0f));
+        }
+
+        // Exactly "round(channel * 31 / 255)" & "round(channel * 63 / 255)" for every 8 bit channel
+        inline constexpr std::uint16_t PackRGB565(const std::uint32_t r, const std::uint32_t g, const std::uint32_t b) noexcept
+        {
+            return static_cast<std::uint16_t>((((r * 249u + 1014u) >> 11u) << 11u) | (((g * 253u + 505u) >> 10u) << 5u) | ((b * 249u + 1014u) >> 11u));
+        }
+
+        inline void* GetPixelAddress(void* pixels, const size_t index, const ::IE::PixelLayout layout) noexcept
+        {
+            return static_cast<std::uint8_t*>(pixels) + index * ((layout == ::IE::PixelLayout::RGB565) ? sizeof(std::uint16_t) : sizeof(std::uint32_t));
+        }
+
+        inline void StorePixelScalar(const std::uint32_t r, const std::uint32_t g, const std::uint32_t b, const std::uint32_t a,
+                                     const ::IE::PixelLayout layout, void* out, const size_t index) noexcept
+        {
+            switch (layout) {
+            case ::IE::PixelLayout::RGBA8:  static_cast<std::uint32_t*>(out)[index] = r | (g << 8u) | (b << 16u) | (a << 24u); break;
+            case ::IE::PixelLayout::BGRA8:  static_cast<std::uint32_t*>(out)[index] = b | (g << 8u) | (r << 16u) | (a << 24u); break;
+            case ::IE::PixelLayout::RGB565: static_cast<std::uint16_t*>(out)[index] = ::IE::Internal::PackRGB565(r, g, b);      break;
+            }
+        }
+
+        // "in" holds 4 floats per color
+        inline void EncodeColorsScalar(const float* in, void* out, const size_t count, const ::IE::Internal::ColorEncodeParameters& params) noexcept
+        {
+            const ::IE::Internal::SRGBTables& tables = ::IE::Internal::GetSRGBTables();
+
+            for (size_t i = 0u; i < count; i++) {
+                std::uint32_t channels[4u];
+
+                for (size_t c = 0u; c < 3u; c++) {
+                    const float value = ::IE::Internal::ToneMapScalar(in[4u * i + c], params);
+
+                    channels[c] = params.m_bSRGB ? ::IE::Internal::EncodeSRGBScalar(value, tables) : ::IE::Internal::QuantizeUnorm8Scalar(value);
+                }
+
+                channels[3u] = ::IE::Internal::QuantizeUnorm8Scalar(std::min(1.0f, std::max(0.0f, in[4u * i + 3u])));
+
+                ::IE::Internal::StorePixelScalar(channels[0u], channels[1u], channels[2u], channels[3u], params.m_layout, out, i);
+            }
+        }
+
+        // "in" holds packed RGBA8 colors, "out" 4 floats per color in [0, 1]
+        inline void DecodeColorsScalar(const std::uint32_t* in, float* out, const size_t count, const bool bSRGB) noexcept
+        {
+            const ::IE::Internal::SRGBTables& tables = ::IE::Internal::GetSRGBTables();
+
+            for (size_t i = 0u; i < count; i++) {
+                for (size_t c = 0u; c < 4u; c++) {
+                    const std::uint32_t value = (in[i] >> (8u * c)) & 0xFFu;
+
+                    out[4u * i + c] = (bSRGB && c < 3u) ? tables.m_toLinear[value] : static_cast<float>(value) / 255.0f;
+                }
+            }
+        }
+
+        inline void SwizzleRGBA8ToBGRA8Scalar(const std::uint32_t* in, std::uint32_t* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++)
+                out[i] = (in[i] & 0xFF00FF00u) | ((in[i] & 0xFFu) << 16u) | ((in[i] >> 16u) & 0xFFu);
+        }
+
+        inline void PackRGBA8ToRGB565Scalar(const std::uint32_t* in, std::uint16_t* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++)
+                out[i] = ::IE::Internal::PackRGB565(in[i] & 0xFFu, (in[i] >> 8u) & 0xFFu, (in[i] >> 16u) & 0xFFu);
+        }
+
+        template <typename _UNORM>
+        inline void FloatToUnormScalar(const float* in, _UNORM* out, const size_t count) noexcept
+        {
+            constexpr float MAX = static_cast<float>(std::numeric_limits<_UNORM>::max());
+
+            for (size_t i = 0u; i < count; i++)
+                out[i] = static_cast<_UNORM>(std::nearbyint(std::min(1.0f, std::max(0.0f, in[i])) * MAX));
+        }
+
+        template <typename _UNORM>
+        inline void UnormToFloatScalar(const _UNORM* in, float* out, const size_t count) noexcept
+        {
+            constexpr float MAX = static_cast<float>(std::numeric_limits<_UNORM>::max());
+
+            for (size_t i = 0u; i < count; i++)
+                out[i] = static_cast<float>(in[i]) / MAX;
+        }
+
+#ifdef __IE__ENABLE_SIMD
+
+        __IE__TARGET_SSE41 inline __m128 ToneMapSSE41(__m128 value, const ::IE::Internal::ColorEncodeParameters& params) noexcept
+        {
+            const __m128 one = _mm_set1_ps(1.0f);
+
+            value = _mm_max_ps(_mm_mul_ps(value, _mm_set1_ps(params.m_exposure)), _mm_setzero_ps());
+
+            if (params.m_toneMap == ::IE::ToneMapOperator::REINHARD) {
+                value = _mm_div_ps(value, _mm_add_ps(one, value));
+            } else if (params.m_toneMap == ::IE::ToneMapOperator::ACES) {
+                const __m128 numerator   = _mm_mul_ps(value, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.51f), value), _mm_set1_ps(0.03f)));
+                const __m128 denominator = _mm_add_ps(_mm_mul_ps(value, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.43f), value), _mm_set1_ps(0.59f))), _mm_set1_ps(0.14f));
+
+                value = _mm_div_ps(numerator, denominator);
+            }
+
+            return _mm_min_ps(value, one);
+        }
+
+        // No gathers before AVX2, the 4 lanes are looked up one by one
+        __IE__TARGET_SSE41 inline __m128i EncodeSRGBSSE41(const __m128 value, const ::IE::Internal::SRGBTables& tables) noexcept
+        {
+            using ::IE::Internal::SRGBTables;
+
+            const __m128i base = _mm_set1_epi32(static_cast<std::int32_t>(SRGBTables::BUCKET_BASE));
+
+            alignas(16) std::int32_t indices[4u];
+            _mm_store_si128(reinterpret_cast<__m128i*>(indices), _mm_srli_epi32(_mm_sub_epi32(_mm_max_epi32(_mm_castps_si128(value), base), base), SRGBTables::BUCKET_SHIFT));
+
+            const std::uint16_t b0 = tables.m_buckets[indices[0u]], b1 = tables.m_buckets[indices[1u]];
+            const std::uint16_t b2 = tables.m_buckets[indices[2u]], b3 = tables.m_buckets[indices[3u]];
+
+            const __m128 thresholds = _mm_setr_ps(tables.m_thresholds[b0], tables.m_thresholds[b1], tables.m_thresholds[b2], tables.m_thresholds[b3]);
+
+            return _mm_sub_epi32(_mm_setr_epi32(b0, b1, b2, b3), _mm_castps_si128(_mm_cmpge_ps(value, thresholds)));
+        }
+
+        // The 8 bit channels sit in the low 16 bits of each lane, so the products fit 16 bit multiplications
+        __IE__TARGET_SSE41 inline __m128i PackRGB565SSE41(const __m128i r, const __m128i g, const __m128i b) noexcept
+        {
+            const __m128i r5 = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi32(249)), _mm_set1_epi32(1014)), 11);
+            const __m128i g6 = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(g, _mm_set1_epi32(253)), _mm_set1_epi32(505)),  10);
+            const __m128i b5 = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(b, _mm_set1_epi32(249)), _mm_set1_epi32(1014)), 11);
+
+            return _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r5, 11), _mm_slli_epi32(g6, 5)), b5);
+        }
+
+        __IE__TARGET_SSE41 inline void StorePixelsSSE41(const __m128i r, const __m128i g, const __m128i b, const __m128i a,
+                                                        const ::IE::PixelLayout layout, void* out, const size_t index) noexcept
+        {
+            if (layout == ::IE::PixelLayout::RGB565) {
+                const __m128i pixels = ::IE::Internal::PackRGB565SSE41(r, g, b);
+
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(static_cast<std::uint16_t*>(out) + index), _mm_packus_epi32(pixels, pixels));
+                return;
+            }
+
+            const __m128i ga = _mm_or_si128(_mm_slli_epi32(g, 8), _mm_slli_epi32(a, 24));
+            const __m128i pixels = (layout == ::IE::PixelLayout::BGRA8) ? _mm_or_si128(ga, _mm_or_si128(b, _mm_slli_epi32(r, 16)))
+                                                                        : _mm_or_si128(ga, _mm_or_si128(r, _mm_slli_epi32(b, 16)));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(static_cast<std::uint32_t*>(out) + index), pixels);
+        }
+
+        __IE__TARGET_SSE41 inline void EncodeColorsSSE41(const float* in, void* out, const size_t count, const ::IE::Internal::ColorEncodeParameters& params) noexcept
+        {
+            const ::IE::Internal::SRGBTables& tables = ::IE::Internal::GetSRGBTables();
+
+            const __m128 zero  = _mm_setzero_ps();
+            const __m128 one   = _mm_set1_ps(1.0f);
+            const __m128 scale = _mm_set1_ps(255.0f);
+
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u) {
+                __m128 r = _mm_loadu_ps(in + 4u * i);
+                __m128 g = _mm_loadu_ps(in + 4u * i + 4u);
+                __m128 b = _mm_loadu_ps(in + 4u * i + 8u);
+                __m128 a = _mm_loadu_ps(in + 4u * i + 12u);
+                _MM_TRANSPOSE4_PS(r, g, b, a);
+
+                r = ::IE::Internal::ToneMapSSE41(r, params);
+                g = ::IE::Internal::ToneMapSSE41(g, params);
+                b = ::IE::Internal::ToneMapSSE41(b, params);
+
+                const __m128i encodedA = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(a, zero), one), scale));
+
+                if (params.m_bSRGB) {
+                    ::IE::Internal::StorePixelsSSE41(::IE::Internal::EncodeSRGBSSE41(r, tables), ::IE::Internal::EncodeSRGBSSE41(g, tables),
+                                                     ::IE::Internal::EncodeSRGBSSE41(b, tables), encodedA, params.m_layout, out, i);
+                } else {
+                    ::IE::Internal::StorePixelsSSE41(_mm_cvtps_epi32(_mm_mul_ps(r, scale)), _mm_cvtps_epi32(_mm_mul_ps(g, scale)),
+                                                     _mm_cvtps_epi32(_mm_mul_ps(b, scale)), encodedA, params.m_layout, out, i);
+                }
+            }
+
+            ::IE::Internal::EncodeColorsScalar(in + 4u * i, ::IE::Internal::GetPixelAddress(out, i, params.m_layout), count - i, params);
+        }
+
+        __IE__TARGET_SSE41 inline void StoreDecodedColorSSE41(const __m128i channels, const std::uint32_t color, float* out,
+                                                              const bool bSRGB, const ::IE::Internal::SRGBTables& tables) noexcept
+        {
+            __m128 decoded = _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(channels)), _mm_set1_ps(255.0f));
+
+            if (bSRGB) {
+                const __m128 linear = _mm_setr_ps(tables.m_toLinear[color & 0xFFu], tables.m_toLinear[(color >> 8u) & 0xFFu], tables.m_toLinear[(color >> 16u) & 0xFFu], 0.0f);
+
+                decoded = _mm_blend_ps(linear, decoded, 0x8);
+            }
+
+            _mm_storeu_ps(out, decoded);
+        }
+
+        __IE__TARGET_SSE41 inline void DecodeColorsSSE41(const std::uint32_t* in, float* out, const size_t count, const bool bSRGB) noexcept
+        {
+            const ::IE::Internal::SRGBTables& tables = ::IE::Internal::GetSRGBTables();
+
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u) {
+                const __m128i colors = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+
+                ::IE::Internal::StoreDecodedColorSSE41(colors,                     in[i],      out + 4u * i,        bSRGB, tables);
+                ::IE::Internal::StoreDecodedColorSSE41(_mm_srli_si128(colors, 4),  in[i + 1u], out + 4u * i + 4u,   bSRGB, tables);
+                ::IE::Internal::StoreDecodedColorSSE41(_mm_srli_si128(colors, 8),  in[i + 2u], out + 4u * i + 8u,   bSRGB, tables);
+                ::IE::Internal::StoreDecodedColorSSE41(_mm_srli_si128(colors, 12), in[i + 3u], out + 4u * i + 12u,  bSRGB, tables);
+            }
+
+            ::IE::Internal::DecodeColorsScalar(in + i, out + 4u * i, count - i, bSRGB);
+        }
+
+        __IE__TARGET_SSE41 inline void SwizzleRGBA8ToBGRA8SSE41(const std::uint32_t* in, std::uint32_t* out, const size_t count) noexcept
+        {
+            const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u)
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)), shuffle));
+
+            ::IE::Internal::SwizzleRGBA8ToBGRA8Scalar(in + i, out + i, count - i);
+        }
+
+        __IE__TARGET_SSE41 inline void PackRGBA8ToRGB565SSE41(const std::uint32_t* in, std::uint16_t* out, const size_t count) noexcept
+        {
+            const __m128i mask = _mm_set1_epi32(0xFF);
+
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m128i colors0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                const __m128i colors1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 4u));
+
+                const __m128i pixels0 = ::IE::Internal::PackRGB565SSE41(_mm_and_si128(colors0, mask), _mm_and_si128(_mm_srli_epi32(colors0, 8), mask), _mm_and_si128(_mm_srli_epi32(colors0, 16), mask));
+                const __m128i pixels1 = ::IE::Internal::PackRGB565SSE41(_mm_and_si128(colors1, mask), _mm_and_si128(_mm_srli_epi32(colors1, 8), mask), _mm_and_si128(_mm_srli_epi32(colors1, 16), mask));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi32(pixels0, pixels1));
+            }
+
+            ::IE::Internal::PackRGBA8ToRGB565Scalar(in + i, out + i, count - i);
+        }
+
+        // Clamps to [0, 1] (NaNs become 0) and scales to the unorm's range
+        __IE__TARGET_SSE41 inline __m128i QuantizeUnormSSE41(const float* in, const __m128 scale) noexcept
+        {
+            return _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(in), _mm_setzero_ps()), _mm_set1_ps(1.0f)), scale));
+        }
+
+        template <typename _UNORM>
+        __IE__TARGET_SSE41 inline void FloatToUnormSSE41(const float* in, _UNORM* out, const size_t count) noexcept
+        {
+            const __m128 scale = _mm_set1_ps(static_cast<float>(std::numeric_limits<_UNORM>::max()));
+
+            constexpr size_t STEP = 16u / sizeof(_UNORM);
+
+            size_t i = 0u;
+            for (; i + STEP <= count; i += STEP) {
+                const __m128i values01 = _mm_packus_epi32(::IE::Internal::QuantizeUnormSSE41(in + i, scale), ::IE::Internal::QuantizeUnormSSE41(in + i + 4u, scale));
+
+                if constexpr (sizeof(_UNORM) == 1u) {
+                    const __m128i values23 = _mm_packus_epi32(::IE::Internal::QuantizeUnormSSE41(in + i + 8u, scale), ::IE::Internal::QuantizeUnormSSE41(in + i + 12u, scale));
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(values01, values23));
+                } else {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), values01);
+                }
+            }
+
+            ::IE::Internal::FloatToUnormScalar<_UNORM>(in + i, out + i, count - i);
+        }
+
+        template <typename _UNORM>
+        __IE__TARGET_SSE41 inline void UnormToFloatSSE41(const _UNORM* in, float* out, const size_t count) noexcept
+        {
+            const __m128 scale = _mm_set1_ps(static_cast<float>(std::numeric_limits<_UNORM>::max()));
+
+            constexpr size_t STEP = 16u / sizeof(_UNORM);
+
+            size_t i = 0u;
+            for (; i + STEP <= count; i += STEP) {
+                const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+
+                if constexpr (sizeof(_UNORM) == 1u) {
+                    _mm_storeu_ps(out + i,       _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(values)),                     scale));
+                    _mm_storeu_ps(out + i + 4u,  _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(values, 4))),  scale));
+                    _mm_storeu_ps(out + i + 8u,  _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(values, 8))),  scale));
+                    _mm_storeu_ps(out + i + 12u, _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(values, 12))), scale));
+                } else {
+                    _mm_storeu_ps(out + i,      _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu16_epi32(values)),                    scale));
+                    _mm_storeu_ps(out + i + 4u, _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_srli_si128(values, 8))), scale));
+                }
+            }
+
+            ::IE::Internal::UnormToFloatScalar<_UNORM>(in + i, out + i, count - i);
+        }
+
+        __IE__TARGET_AVX2 inline __m256 ToneMapAVX2(__m256 value, const ::IE::Internal::ColorEncodeParameters& params) noexcept
+        {
+            const __m256 one = _mm256_set1_ps(1.0f);
+
+            value = _mm256_max_ps(_mm256_mul_ps(value, _mm256_set1_ps(params.m_exposure)), _mm256_setzero_ps());
+
+            if (params.m_toneMap == ::IE::ToneMapOperator::REINHARD) {
+                value = _mm256_div_ps(value, _mm256_add_ps(one, value));
+            } else if (params.m_toneMap == ::IE::ToneMapOperator::ACES) {
+                const __m256 numerator   = _mm256_mul_ps(value, _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(2.51f), value), _mm256_set1_ps(0.03f)));
+                const __m256 denominator = _mm256_add_ps(_mm256_mul_ps(value, _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(2.43f), value), _mm256_set1_ps(0.59f))), _mm256_set1_ps(0.14f));
+
+                value = _mm256_div_ps(numerator, denominator);
+            }
+
+            return _mm256_min_ps(value, one);
+        }
+
+        // The buckets are gathered as 32 bit values (2 buckets) and masked, hence the padding of the table
+        __IE__TARGET_AVX2 inline __m256i EncodeSRGBAVX2(const __m256 value, const ::IE::Internal::SRGBTables& tables) noexcept
+        {
+            using ::IE::Internal::SRGBTables;
+
+            const __m256i base    = _mm256_set1_epi32(static_cast<std::int32_t>(SRGBTables::BUCKET_BASE));
+            const __m256i indices = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_max_epi32(_mm256_castps_si256(value), base), base), SRGBTables::BUCKET_SHIFT);
+
+            const __m256i buckets    = _mm256_and_si256(_mm256_i32gather_epi32(reinterpret_cast<const int*>(tables.m_buckets), indices, 2), _mm256_set1_epi32(0xFFFF));
+            const __m256  thresholds = _mm256_i32gather_ps(tables.m_thresholds, buckets, 4);
+
+            return _mm256_sub_epi32(buckets, _mm256_castps_si256(_mm256_cmp_ps(value, thresholds, _CMP_GE_OQ)));
+        }
+
+        __IE__TARGET_AVX2 inline __m256i PackRGB565AVX2(const __m256i r, const __m256i g, const __m256i b) noexcept
+        {
+            const __m256i r5 = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(r, _mm256_set1_epi32(249)), _mm256_set1_epi32(1014)), 11);
+            const __m256i g6 = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(g, _mm256_set1_epi32(253)), _mm256_set1_epi32(505)),  10);
+            const __m256i b5 = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(b, _mm256_set1_epi32(249)), _mm256_set1_epi32(1014)), 11);
+
+            return _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(r5, 11), _mm256_slli_epi32(g6, 5)), b5);
+        }
+
+        // 8 RGB565 pixels (one per 32 bit lane) to 8 consecutive "std::uint16_t"
+        __IE__TARGET_AVX2 inline __m128i NarrowRGB565AVX2(const __m256i pixels) noexcept
+        {
+            return _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi32(pixels, pixels), _MM_SHUFFLE(3, 1, 2, 0)));
+        }
+
+        __IE__TARGET_AVX2 inline void StorePixelsAVX2(const __m256i r, const __m256i g, const __m256i b, const __m256i a,
+                                                      const ::IE::PixelLayout layout, void* out, const size_t index) noexcept
+        {
+            if (layout == ::IE::PixelLayout::RGB565) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(static_cast<std::uint16_t*>(out) + index), ::IE::Internal::NarrowRGB565AVX2(::IE::Internal::PackRGB565AVX2(r, g, b)));
+                return;
+            }
+
+            const __m256i ga = _mm256_or_si256(_mm256_slli_epi32(g, 8), _mm256_slli_epi32(a, 24));
+            const __m256i pixels = (layout == ::IE::PixelLayout::BGRA8) ? _mm256_or_si256(ga, _mm256_or_si256(b, _mm256_slli_epi32(r, 16)))
+                                                                        : _mm256_or_si256(ga, _mm256_or_si256(r, _mm256_slli_epi32(b, 16)));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(static_cast<std::uint32_t*>(out) + index), pixels);
+        }
+
+        // Colors "i" & "i + 4" in the two lanes of one register
+        __IE__TARGET_AVX2 inline __m256 LoadColorPairAVX2(const float* in) noexcept
+        {
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in)), _mm_loadu_ps(in + 16u), 1);
+        }
+
+        __IE__TARGET_AVX2 inline void EncodeColorsAVX2(const float* in, void* out, const size_t count, const ::IE::Internal::ColorEncodeParameters& params) noexcept
+        {
+            const ::IE::Internal::SRGBTables& tables = ::IE::Internal::GetSRGBTables();
+
+            const __m256 zero  = _mm256_setzero_ps();
+            const __m256 one   = _mm256_set1_ps(1.0f);
+            const __m256 scale = _mm256_set1_ps(255.0f);
+
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m256 c04 = ::IE::Internal::LoadColorPairAVX2(in + 4u * i);
+                const __m256 c15 = ::IE::Internal::LoadColorPairAVX2(in + 4u * i + 4u);
+                const __m256 c26 = ::IE::Internal::LoadColorPairAVX2(in + 4u * i + 8u);
+                const __m256 c37 = ::IE::Internal::LoadColorPairAVX2(in + 4u * i + 12u);
+
+                // "_MM_TRANSPOSE4_PS" within each lane
+                const __m256 rg01 = _mm256_unpacklo_ps(c04, c15), ba01 = _mm256_unpackhi_ps(c04, c15);
+                const __m256 rg23 = _mm256_unpacklo_ps(c26, c37), ba23 = _mm256_unpackhi_ps(c26, c37);
+
+                const __m256 r = ::IE::Internal::ToneMapAVX2(_mm256_shuffle_ps(rg01, rg23, _MM_SHUFFLE(1, 0, 1, 0)), params);
+                const __m256 g = ::IE::Internal::ToneMapAVX2(_mm256_shuffle_ps(rg01, rg23, _MM_SHUFFLE(3, 2, 3, 2)), params);
+                const __m256 b = ::IE::Internal::ToneMapAVX2(_mm256_shuffle_ps(ba01, ba23, _MM_SHUFFLE(1, 0, 1, 0)), params);
+                const __m256 a = _mm256_shuffle_ps(ba01, ba23, _MM_SHUFFLE(3, 2, 3, 2));
+
+                const __m256i encodedA = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(a, zero), one), scale));
+
+                if (params.m_bSRGB) {
+                    ::IE::Internal::StorePixelsAVX2(::IE::Internal::EncodeSRGBAVX2(r, tables), ::IE::Internal::EncodeSRGBAVX2(g, tables),
+                                                    ::IE::Internal::EncodeSRGBAVX2(b, tables), encodedA, params.m_layout, out, i);
+                } else {
+                    ::IE::Internal::StorePixelsAVX2(_mm256_cvtps_epi32(_mm256_mul_ps(r, scale)), _mm256_cvtps_epi32(_mm256_mul_ps(g, scale)),
+                                                    _mm256_cvtps_epi32(_mm256_mul_ps(b, scale)), encodedA, params.m_layout, out, i);
+                }
+            }
+
+            ::IE::Internal::EncodeColorsSSE41(in + 4u * i, ::IE::Internal::GetPixelAddress(out, i, params.m_layout), count - i, params);
+        }
+
+        // Decodes 2 colors (the low 8 bytes of "colors")
+        __IE__TARGET_AVX2 inline void StoreDecodedColorPairAVX2(const __m128i colors, float* out, const bool bSRGB, const ::IE::Internal::SRGBTables& tables) noexcept
+        {
+            const __m256i channels = _mm256_cvtepu8_epi32(colors);
+
+            __m256 decoded = _mm256_div_ps(_mm256_cvtepi32_ps(channels), _mm256_set1_ps(255.0f));
+
+            if (bSRGB)
+                decoded = _mm256_blend_ps(_mm256_i32gather_ps(tables.m_toLinear, channels, 4), decoded, 0x88);
+
+            _mm256_storeu_ps(out, decoded);
+        }
+
+        __IE__TARGET_AVX2 inline void DecodeColorsAVX2(const std::uint32_t* in, float* out, const size_t count, const bool bSRGB) noexcept
+        {
+            const ::IE::Internal::SRGBTables& tables = ::IE::Internal::GetSRGBTables();
+
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m128i colors0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                const __m128i colors1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 4u));
+
+                ::IE::Internal::StoreDecodedColorPairAVX2(colors0,                    out + 4u * i,       bSRGB, tables);
+                ::IE::Internal::StoreDecodedColorPairAVX2(_mm_srli_si128(colors0, 8), out + 4u * i + 8u,  bSRGB, tables);
+                ::IE::Internal::StoreDecodedColorPairAVX2(colors1,                    out + 4u * i + 16u, bSRGB, tables);
+                ::IE::Internal::StoreDecodedColorPairAVX2(_mm_srli_si128(colors1, 8), out + 4u * i + 24u, bSRGB, tables);
+            }
+
+            ::IE::Internal::DecodeColorsSSE41(in + i, out + 4u * i, count - i, bSRGB);
+        }
+
+        __IE__TARGET_AVX2 inline void SwizzleRGBA8ToBGRA8AVX2(const std::uint32_t* in, std::uint32_t* out, const size_t count) noexcept
+        {
+            const __m256i shuffle = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                                                     2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u)
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i)), shuffle));
+
+            ::IE::Internal::SwizzleRGBA8ToBGRA8SSE41(in + i, out + i, count - i);
+        }
+
+        __IE__TARGET_AVX2 inline void PackRGBA8ToRGB565AVX2(const std::uint32_t* in, std::uint16_t* out, const size_t count) noexcept
+        {
+            const __m256i mask = _mm256_set1_epi32(0xFF);
+
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m256i colors = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+                const __m256i pixels = ::IE::Internal::PackRGB565AVX2(_mm256_and_si256(colors, mask), _mm256_and_si256(_mm256_srli_epi32(colors, 8), mask), _mm256_and_si256(_mm256_srli_epi32(colors, 16), mask));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), ::IE::Internal::NarrowRGB565AVX2(pixels));
+            }
+
+            ::IE::Internal::PackRGBA8ToRGB565SSE41(in + i, out + i, count - i);
+        }
+
+        __IE__TARGET_AVX2 inline __m256i QuantizeUnormAVX2(const float* in, const __m256 scale) noexcept
+        {
+            return _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(in), _mm256_setzero_ps()), _mm256_set1_ps(1.0f)), scale));
+        }
+
+        // The packs work within 128 bit lanes, the permutations restore the order of the values
+        template <typename _UNORM>
+        __IE__TARGET_AVX2 inline void FloatToUnormAVX2(const float* in, _UNORM* out, const size_t count) noexcept
+        {
+            const __m256 scale = _mm256_set1_ps(static_cast<float>(std::numeric_limits<_UNORM>::max()));
+
+            constexpr size_t STEP = 32u / sizeof(_UNORM);
+
+            size_t i = 0u;
+            for (; i + STEP <= count; i += STEP) {
+                const __m256i values01 = _mm256_packus_epi32(::IE::Internal::QuantizeUnormAVX2(in + i, scale), ::IE::Internal::QuantizeUnormAVX2(in + i + 8u, scale));
+
+                if constexpr (sizeof(_UNORM) == 1u) {
+                    const __m256i values23 = _mm256_packus_epi32(::IE::Internal::QuantizeUnormAVX2(in + i + 16u, scale), ::IE::Internal::QuantizeUnormAVX2(in + i + 24u, scale));
+                    const __m256i values   = _mm256_packus_epi16(values01, values23);
+
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permutevar8x32_epi32(values, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7)));
+                } else {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permute4x64_epi64(values01, _MM_SHUFFLE(3, 1, 2, 0)));
+                }
+            }
+
+            ::IE::Internal::FloatToUnormSSE41<_UNORM>(in + i, out + i, count - i);
+        }
+
+        template <typename _UNORM>
+        __IE__TARGET_AVX2 inline void UnormToFloatAVX2(const _UNORM* in, float* out, const size_t count) noexcept
+        {
+            const __m256 scale = _mm256_set1_ps(static_cast<float>(std::numeric_limits<_UNORM>::max()));
+
+            size_t i = 0u;
+            for (; i + 16u <= count; i += 16u) {
+                if constexpr (sizeof(_UNORM) == 1u) {
+                    const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+
+                    _mm256_storeu_ps(out + i,      _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(values)),                    scale));
+                    _mm256_storeu_ps(out + i + 8u, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(values, 8))), scale));
+                } else {
+                    const __m128i values0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                    const __m128i values1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 8u));
+
+                    _mm256_storeu_ps(out + i,      _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(values0)), scale));
+                    _mm256_storeu_ps(out + i + 8u, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(values1)), scale));
+                }
+            }
+
+            ::IE::Internal::UnormToFloatSSE41<_UNORM>(in + i, out + i, count - i);
+        }
+
+#endif // #ifdef __IE__ENABLE_SIMD
+
+        inline ::IE::Internal::ColorEncodeParameters GetColorEncodeParameters(const ::IE::ColorEncoding& encoding, const ::IE::PixelLayout layout) noexcept
+        {
+            return ::IE::Internal::ColorEncodeParameters{ layout, encoding.m_toneMap, encoding.m_space == ::IE::ColorSpace::SRGB, encoding.m_exposure };
+        }
+
+    } // Internal
+
+    static_assert(sizeof(::IE::Colorf32) == 4u * sizeof(float) && sizeof(::IE::Coloru8) == sizeof(std::uint32_t));
+
+    // Encodes "in" to "out" (both spans must have the same size)
+    inline void ConvertColors(const std::span<const ::IE::Colorf32> in, const std::span<::IE::Coloru8> out, const ::IE::ColorEncoding& encoding = {}) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::GetSIMDKernels().m_pEncodeColors(reinterpret_cast<const float*>(in.data()), out.data(), in.size(),
+                                                         ::IE::Internal::GetColorEncodeParameters(encoding, ::IE::PixelLayout::RGBA8));
+    }
+
+    // Decodes "in" to floats in [0, 1] (both spans must have the same size)
+    inline void ConvertColors(const std::span<const ::IE::Coloru8> in, const std::span<::IE::Colorf32> out, const ::IE::ColorSpace space = ::IE::ColorSpace::LINEAR) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::GetSIMDKernels().m_pDecodeColors(reinterpret_cast<const std::uint32_t*>(in.data()), reinterpret_cast<float*>(out.data()), in.size(),
+                                                         space == ::IE::ColorSpace::SRGB);
+    }
+
+    // Tone maps & encodes "in" straight to "Framebuffer" pixels, the last step before presenting a frame rendered in floats
+    inline void PackBGRA8(const std::span<const ::IE::Colorf32> in, const std::span<std::uint32_t> out, const ::IE::ColorEncoding& encoding = {}) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::GetSIMDKernels().m_pEncodeColors(reinterpret_cast<const float*>(in.data()), out.data(), in.size(),
+                                                         ::IE::Internal::GetColorEncodeParameters(encoding, ::IE::PixelLayout::BGRA8));
+    }
+
+    // Same as above for 16 bit visuals, the channels are rounded to 8 bits before being rounded to 5 or 6 bits
+    inline void PackRGB565(const std::span<const ::IE::Colorf32> in, const std::span<std::uint16_t> out, const ::IE::ColorEncoding& encoding = {}) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::GetSIMDKernels().m_pEncodeColors(reinterpret_cast<const float*>(in.data()), out.data(), in.size(),
+                                                         ::IE::Internal::GetColorEncodeParameters(encoding, ::IE::PixelLayout::RGB565));
+    }
+
+    inline void PackBGRA8(const std::span<const ::IE::Coloru8> in, const std::span<std::uint32_t> out) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::GetSIMDKernels().m_pSwizzleRGBA8ToBGRA8(reinterpret_cast<const std::uint32_t*>(in.data()), out.data(), in.size());
+    }
+
+    inline void PackRGB565(const std::span<const ::IE::Coloru8> in, const std::span<std::uint16_t> out) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::GetSIMDKernels().m_pPackRGBA8ToRGB565(reinterpret_cast<const std::uint32_t*>(in.data()), out.data(), in.size());
+    }
+
+    // Clamps "in" to [0, 1] and scales it to [0, 255] or [0, 65535] (both spans must have the same size)
+    inline void FloatToUnorm(const std::span<const float> in, const std::span<std::uint8_t> out) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::GetSIMDKernels().m_pFloatToUnorm8(in.data(), out.data(), in.size());
+    }
+
+    inline void FloatToUnorm(const std::span<const float> in, const std::span<std::uint16_t> out) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::GetSIMDKernels().m_pFloatToUnorm16(in.data(), out.data(), in.size());
+    }
+
+    inline void UnormToFloat(const std::span<const std::uint8_t> in, const std::span<float> out) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::GetSIMDKernels().m_pUnorm8ToFloat(in.data(), out.data(), in.size());
+    }
+
+    inline void UnormToFloat(const std::span<const std::uint16_t> in, const std::span<float> out) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::GetSIMDKernels().m_pUnorm16ToFloat(in.data(), out.data(), in.size());
+    }
+
+    // +--------------------+
+    // | Skeletal Animation |
+    // +--------------------+
+
+    /* A "Skeleton" turns the local poses of its joints into a palette of skinning matrices (one per joint) and */
+    /* "SkinVertices" deforms vertices with the matrices of up to 4 joints each (linear blend skinning). Like   */
+    /* the rest of the library the matrices apply to row vectors, so a world transform is "local * parent".    */
+
+    // Transform of a joint relative to its parent: scaled, then rotated, then translated
+    struct JointPose {
+        ::IE::Vecf32  m_translation;
+        ::IE::Quatf32 m_rotation;
+        ::IE::Vecf32  m_scale = ::IE::Vecf32(1.0f, 1.0f, 1.0f, 1.0f);
+    };
+
+    // Up to 4 joints deforming a vertex, the weights should add up to 1 (unused joints get a weight of 0)
+    struct SkinInfluences {
+        std::uint16_t m_joints[4u];
+        float         m_weights[4u];
+    };
+
+    namespace Internal {
+
+        // Vertices per task of "SkinVertices"
+        constexpr const size_t SKINNING_CHUNK_SIZE = 8192u;
+
+        // The rows of the rotation scaled by "m_scale", then the translation
+        inline ::IE::Matf32 MakeJointMatrix(const ::IE::JointPose& pose) noexcept
+        {
+            ::IE::Matf32 matrix = pose.m_rotation.ToMatrix();
+
+            matrix.SetRow(0u, matrix.GetRow(0u) * pose.m_scale.x);
+            matrix.SetRow(1u, matrix.GetRow(1u) * pose.m_scale.y);
+            matrix.SetRow(2u, matrix.GetRow(2u) * pose.m_scale.z);
+            matrix.SetRow(3u, ::IE::Vecf32(pose.m_translation.x, pose.m_translation.y, pose.m_translation.z, 1.0f));
+
+            return matrix;
+        }
+
+        // +--------------------+     +----------+
+        // | Skeletal Animation | --> | Skinning |
+        // +--------------------+     +----------+
+
+        /* Every kernel blends the 4 matrices with the weights first and then transforms the vertex once, the */
+        /* vertex being loaded before the result is stored so that "in" & "out" can be the same array.        */
+
+        inline void SkinVerticesF32Scalar(const float* palette, const float* in, const ::IE::SkinInfluences* influences, float* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++) {
+                const ::IE::SkinInfluences& influence = influences[i];
+
+                float blended[16u];
+                for (size_t e = 0u; e < 16u; e++)
+                    blended[e] = influence.m_weights[0u] * palette[influence.m_joints[0u] * 16u + e];
+
+                for (size_t k = 1u; k < 4u; k++)
+                    for (size_t e = 0u; e < 16u; e++)
+                        blended[e] += influence.m_weights[k] * palette[influence.m_joints[k] * 16u + e];
+
+                ::IE::Internal::VectorMatrixMultiplyF32Scalar(in + i * 4u, blended, out + i * 4u);
+            }
+        }
+
+#ifdef __IE__ENABLE_SIMD
+
+        __IE__TARGET_SSE41 inline void SkinVerticesF32SSE41(const float* palette, const float* in, const ::IE::SkinInfluences* influences, float* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++) {
+                const ::IE::SkinInfluences& influence = influences[i];
+
+                __m128 rows[4u];
+                for (size_t r = 0u; r < 4u; r++)
+                    rows[r] = _mm_mul_ps(_mm_set1_ps(influence.m_weights[0u]), _mm_loadu_ps(palette + influence.m_joints[0u] * 16u + r * 4u));
+
+                for (size_t k = 1u; k < 4u; k++) {
+                    const __m128 weight = _mm_set1_ps(influence.m_weights[k]);
+                    const float* matrix = palette + influence.m_joints[k] * 16u;
+
+                    for (size_t r = 0u; r < 4u; r++)
+                        rows[r] = _mm_add_ps(rows[r], _mm_mul_ps(weight, _mm_loadu_ps(matrix + r * 4u)));
+                }
+
+                const __m128 v = _mm_loadu_ps(in + i * 4u);
+
+                __m128 result =                   _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)), rows[0u]);
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), rows[1u]));
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), rows[2u]));
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)), rows[3u]));
+
+                _mm_storeu_ps(out + i * 4u, result);
+            }
+        }
+
+        // Rows 0 & 1 of a matrix fill one register & rows 2 & 3 another, so blending a matrix takes 2 FMAs
+        __IE__TARGET_AVX2 inline void SkinVerticesF32AVX2(const float* palette, const float* in, const ::IE::SkinInfluences* influences, float* out, const size_t count) noexcept
+        {
+            const __m256i xyIndices = _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1);
+            const __m256i zwIndices = _mm256_setr_epi32(2, 2, 2, 2, 3, 3, 3, 3);
+
+            for (size_t i = 0u; i < count; i++) {
+                const ::IE::SkinInfluences& influence = influences[i];
+
+                const float* matrix0 = palette + influence.m_joints[0u] * 16u;
+                const __m256 weight0 = _mm256_broadcast_ss(&influence.m_weights[0u]);
+
+                __m256 rows01 = _mm256_mul_ps(weight0, _mm256_loadu_ps(matrix0));
+                __m256 rows23 = _mm256_mul_ps(weight0, _mm256_loadu_ps(matrix0 + 8u));
+
+                for (size_t k = 1u; k < 4u; k++) {
+                    const float* matrix = palette + influence.m_joints[k] * 16u;
+                    const __m256 weight = _mm256_broadcast_ss(&influence.m_weights[k]);
+
+                    rows01 = _mm256_fmadd_ps(weight, _mm256_loadu_ps(matrix),      rows01);
+                    rows23 = _mm256_fmadd_ps(weight, _mm256_loadu_ps(matrix + 8u), rows23);
+                }
+
+                // (x * row0 + z * row2) in the lower lane & (y * row1 + w * row3) in the upper one
+                const __m256 v      = _mm256_castps128_ps256(_mm_loadu_ps(in + i * 4u));
+                const __m256 halves = _mm256_fmadd_ps(_mm256_permutevar8x32_ps(v, zwIndices), rows23,
+                                                      _mm256_mul_ps(_mm256_permutevar8x32_ps(v, xyIndices), rows01));
+
+                _mm_storeu_ps(out + i * 4u, _mm_add_ps(_mm256_castps256_ps128(halves), _mm256_extractf128_ps(halves, 1)));
+            }
+        }
+
+#endif // #ifdef __IE__ENABLE_SIMD
+
+    } // Internal
+
+    // +--------------------+     +-----------------+
+    // | Skeletal Animation | --> | Pose Evaluation |
+    // +--------------------+     +-----------------+
+
+    class Skeleton {
+    public:
+        static constexpr const std::int32_t NO_PARENT = -1;
+
+    private:
+        ::IE::Matf32* m_pInverseBindPoses = nullptr;
+        std::int32_t* m_pParents          = nullptr; // Stored right after the inverse bind poses
+        size_t        m_jointCount        = 0u;
+
+    public:
+        Skeleton() noexcept = default;
+
+        /* "parents[j]" is the index of the parent of the joint "j" (or "NO_PARENT"), which has to come before it. The */
+        /* skeleton is left invalid otherwise. "inverseBindPoses[j]" takes a bind pose vertex into the space of "j".   */
+        Skeleton(const std::span<const std::int32_t> parents, const std::span<const ::IE::Matf32> inverseBindPoses) noexcept
+        {
+            if (parents.empty() || parents.size() != inverseBindPoses.size())
+                return;
+
+            for (size_t j = 0u; j < parents.size(); j++)
+                if (parents[j] != NO_PARENT && (parents[j] < 0 || static_cast<size_t>(parents[j]) >= j))
+                    return;
+
+            void* const pMemory = ::operator new(parents.size() * (sizeof(::IE::Matf32) + sizeof(std::int32_t)), std::align_val_t{ alignof(::IE::Matf32) }, std::nothrow);
+
+            if (pMemory == nullptr)
+                return;
+
+            this->m_pInverseBindPoses = static_cast<::IE::Matf32*>(pMemory);
+            this->m_pParents          = reinterpret_cast<std::int32_t*>(this->m_pInverseBindPoses + parents.size());
+            this->m_jointCount        = parents.size();
+
+            std::uninitialized_copy(inverseBindPoses.begin(), inverseBindPoses.end(), this->m_pInverseBindPoses);
+            std::memcpy(this->m_pParents, parents.data(), parents.size() * sizeof(std::int32_t));
+        }
+
+        Skeleton(const Skeleton&) = delete;
+        Skeleton& operator=(const Skeleton&) = delete;
+
+        Skeleton(Skeleton&& other) noexcept { *this = std::move(other); }
+
+        Skeleton& operator=(Skeleton&& other) noexcept
+        {
+            std::swap(this->m_pInverseBindPoses, other.m_pInverseBindPoses);
+            std::swap(this->m_pParents,          other.m_pParents);
+            std::swap(this->m_jointCount,        other.m_jointCount);
+
+            return *this;
+        }
+
+        ~Skeleton() noexcept
+        {
+            if (this->m_pInverseBindPoses != nullptr)
+                ::operator delete(this->m_pInverseBindPoses, std::align_val_t{ alignof(::IE::Matf32) });
+        }
+
+        inline bool IsValid() const noexcept { return this->m_pInverseBindPoses != nullptr; }
+
+        inline size_t              GetJointCount()                       const noexcept { return this->m_jointCount;               }
+        inline std::int32_t        GetParent(const size_t joint)          const noexcept { return this->m_pParents[joint];          }
+        inline const ::IE::Matf32& GetInverseBindPose(const size_t joint) const noexcept { return this->m_pInverseBindPoses[joint]; }
+
+        /* Fills "palette" with the skinning matrix of every joint of "pose" (one "JointPose" per joint): the inverse */
+        /* bind pose followed by the world transform of the joint, each matrix being built from a single quaternion.  */
+        void EvaluatePose(const std::span<const ::IE::JointPose> pose, const std::span<::IE::Matf32> palette) const noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(pose.size() == this->m_jointCount && palette.size() == this->m_jointCount);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            // The world transforms are built in "palette" first, parents being computed before their children
+            for (size_t j = 0u; j < this->m_jointCount; j++) {
+                const ::IE::Matf32 local  = ::IE::Internal::MakeJointMatrix(pose[j]);
+                const std::int32_t parent = this->m_pParents[j];
+
+                palette[j] = (parent == NO_PARENT) ? local : ::IE::Matf32(::IE::Lazy(local) * palette[parent]);
+            }
+
+            for (size_t j = 0u; j < this->m_jointCount; j++)
+                palette[j] = ::IE::Lazy(this->m_pInverseBindPoses[j]) * palette[j];
+        }
+
+        /* "EvaluatePose" for every instance of the skeleton on "threadCount" threads (all the hardware threads */
+        /* for 0), "poses" & "palettes" holding "GetJointCount()" elements per instance.                        */
+        void EvaluatePoses(const std::span<const ::IE::JointPose> poses, const std::span<::IE::Matf32> palettes, size_t threadCount = 0u) const noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(this->IsValid() && poses.size() % this->m_jointCount == 0u && poses.size() == palettes.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            if (threadCount == 0u)
+                threadCount = ::IE::GetHardwareThreadCount();
+
+            const size_t jointCount = this->m_jointCount;
+
+            ::IE::Internal::ParallelFor(poses.size() / jointCount, threadCount, [&](const size_t instance) noexcept {
+                this->EvaluatePose(poses.subspan(instance * jointCount, jointCount), palettes.subspan(instance * jointCount, jointCount));
+            });
+        }
+    };
+
+    /* Deforms "positions" (w = 1, or w = 0 for directions like normals) by the matrices of "palette" (see "Skeleton::  */
+    /* EvaluatePose") blended with the weights of "influences", on "threadCount" threads (all the hardware threads for */
+    /* 0). "out" may be "positions".                                                                                  */
+    inline void SkinVertices(const std::span<const ::IE::Matf32> palette, const std::span<const ::IE::Vecf32> positions,
+                             const std::span<const ::IE::SkinInfluences> influences, const std::span<::IE::Vecf32> out, size_t threadCount = 0u) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(positions.size() == influences.size() && positions.size() == out.size());
+
+        for (const ::IE::SkinInfluences& influence : influences)
+            for (const std::uint16_t joint : influence.m_joints)
+                assert(joint < palette.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        if (threadCount == 0u)
+            threadCount = ::IE::GetHardwareThreadCount();
+
+        const size_t chunkCount = (positions.size() + ::IE::Internal::SKINNING_CHUNK_SIZE - 1u) / ::IE::Internal::SKINNING_CHUNK_SIZE;
+
+        ::IE::Internal::ParallelFor(chunkCount, threadCount, [&](const size_t c) noexcept {
+            const size_t first = c * ::IE::Internal::SKINNING_CHUNK_SIZE;
+            const size_t count = std::min(::IE::Internal::SKINNING_CHUNK_SIZE, positions.size() - first);
+
+            ::IE::Internal::GetSIMDKernels().m_pSkinVerticesF32(reinterpret_cast<const float*>(palette.data()), reinterpret_cast<const float*>(positions.data() + first),
+                                                                 influences.data() + first, reinterpret_cast<float*>(out.data() + first), count);
+        });
+    }
+
+    // +-----------------+
+    // | Frustum Culling |
+    // +-----------------+
+
+    /* The 6 planes of a view frustum, each stored as (nx, ny, nz, d) with a unit normal pointing inside: a point "p" */
+    /* is inside a plane when "nx * p.x + ny * p.y + nz * p.z + d >= 0". The tests are conservative, a volume near a  */
+    /* corner of the frustum may be reported visible while being outside of it, but never the other way around.      */
+    enum class FrustumPlane : std::uint8_t { LEFT, RIGHT, BOTTOM, TOP, Z_NEAR, Z_FAR };
+
+    class Frustum {
+    public:
+        static constexpr const size_t PLANE_COUNT = 6u;
+
+    private:
+        ::IE::Vecf32 m_planes[PLANE_COUNT]; // In the order of "FrustumPlane"
+
+    public:
+        Frustum() noexcept = default;
+
+        /* Extracts the planes of the clip volume (-w <= x, y <= w & 0 <= z <= w) of "viewProjection" (see "MakePerspective"), */
+        /* in the space that the matrix transforms from: a "view * projection" matrix gives world space planes.               */
+        explicit Frustum(const ::IE::Matf32& viewProjection) noexcept
+        {
+            // "p * M" makes every clip space coordinate the dot product of "p" with a column of "M"
+            const ::IE::Vecf32 x(viewProjection(0u, 0u), viewProjection(1u, 0u), viewProjection(2u, 0u), viewProjection(3u, 0u));
+            const ::IE::Vecf32 y(viewProjection(0u, 1u), viewProjection(1u, 1u), viewProjection(2u, 1u), viewProjection(3u, 1u));
+            const ::IE::Vecf32 z(viewProjection(0u, 2u), viewProjection(1u, 2u), viewProjection(2u, 2u), viewProjection(3u, 2u));
+            const ::IE::Vecf32 w(viewProjection(0u, 3u), viewProjection(1u, 3u), viewProjection(2u, 3u), viewProjection(3u, 3u));
+
+            this->m_planes[static_cast<size_t>(::IE::FrustumPlane::LEFT)]   = w + x;
+            this->m_planes[static_cast<size_t>(::IE::FrustumPlane::RIGHT)]  = w - x;
+            this->m_planes[static_cast<size_t>(::IE::FrustumPlane::BOTTOM)] = w + y;
+            this->m_planes[static_cast<size_t>(::IE::FrustumPlane::TOP)]    = w - y;
+            this->m_planes[static_cast<size_t>(::IE::FrustumPlane::Z_NEAR)] = z;
+            this->m_planes[static_cast<size_t>(::IE::FrustumPlane::Z_FAR)]  = w - z;
+
+            for (::IE::Vecf32& plane : this->m_planes) {
+                const float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+
+                if (length > 0.0f)
+                    plane = plane * (1.0f / length);
+            }
+        }
+
+        inline const ::IE::Vecf32& GetPlane(const ::IE::FrustumPlane plane) const noexcept { return this->m_planes[static_cast<size_t>(plane)]; }
+
+        // The planes as "PLANE_COUNT" * 4 floats, for the culling kernels
+        inline const float* GetPlaneData() const noexcept { return &this->m_planes[0u].x; }
+
+        // "sphere" is (center x, center y, center z, radius)
+        inline bool IntersectsSphere(const ::IE::Vecf32& sphere) const noexcept
+        {
+            for (const ::IE::Vecf32& plane : this->m_planes)
+                if (plane.x * sphere.x + plane.y * sphere.y + plane.z * sphere.z + plane.w < -sphere.w)
+                    return false;
+
+            return true;
+        }
+
+        // An axis aligned box given by its center & its half sizes ("w" is ignored for both)
+        inline bool IntersectsBox(const ::IE::Vecf32& center, const ::IE::Vecf32& extents) const noexcept
+        {
+            for (const ::IE::Vecf32& plane : this->m_planes) {
+                const float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+                const float radius   = std::fabs(plane.x) * extents.x + std::fabs(plane.y) * extents.y + std::fabs(plane.z) * extents.z;
+
+                if (distance < -radius)
+                    return false;
+            }
+
+            return true;
+        }
+    };
+
+    namespace Internal {
+
+        // Volumes per task of "CullSpheres" & "CullBoxes"
+        constexpr const size_t CULLING_CHUNK_SIZE = 16384u;
+
+        /* The kernels below test "count" volumes of a chunk starting at the volume "first" & write the indices of */
+        /* the visible ones to "visible" (which has room for "count" indices), returning how many there are.       */
+        /* "planes" are the 24 floats of "Frustum::GetPlaneData".                                                    */
+
+        inline size_t CullSpheresF32Scalar(const float* planes, const ::IE::Internal::SoAStream<const float>& spheres, const size_t count,
+                                           const std::uint32_t first, std::uint32_t* visible) noexcept
+        {
+            size_t visibleCount = 0u;
+
+            for (size_t i = 0u; i < count; i++) {
+                bool bVisible = true;
+
+                for (size_t p = 0u; p < ::IE::Frustum::PLANE_COUNT; p++) {
+                    const float* plane = planes + p * 4u;
+
+                    bVisible &= (plane[0u] * spheres.m_pX[i] + plane[1u] * spheres.m_pY[i] + plane[2u] * spheres.m_pZ[i] + plane[3u] >= -spheres.m_pW[i]);
+                }
+
+                visible[visibleCount] = first + static_cast<std::uint32_t>(i);
+                visibleCount += bVisible;
+            }
+
+            return visibleCount;
+        }
+
+        inline size_t CullBoxesF32Scalar(const float* planes, const ::IE::Internal::SoAStream<const float>& centers, const ::IE::Internal::SoAStream<const float>& extents,
+                                         const size_t count, const std::uint32_t first, std::uint32_t* visible) noexcept
+        {
+            size_t visibleCount = 0u;
+
+            for (size_t i = 0u; i < count; i++) {
+                bool bVisible = true;
+
+                for (size_t p = 0u; p < ::IE::Frustum::PLANE_COUNT; p++) {
+                    const float* plane = planes + p * 4u;
+
+                    const float distance = plane[0u] * centers.m_pX[i] + plane[1u] * centers.m_pY[i] + plane[2u] * centers.m_pZ[i] + plane[3u];
+                    const float radius   = std::fabs(plane[0u]) * extents.m_pX[i] + std::fabs(plane[1u]) * extents.m_pY[i] + std::fabs(plane[2u]) * extents.m_pZ[i];
+
+                    bVisible &= (distance >= -radius);
+                }
+
+                visible[visibleCount] = first + static_cast<std::uint32_t>(i);
+                visibleCount += bVisible;
+            }
+
+            return visibleCount;
+        }
+
+#ifdef __IE__ENABLE_SIMD
+
+        // Writes "first + i" for every bit "i" of "mask"
+        inline size_t WriteVisibleIndices(std::uint32_t mask, const std::uint32_t first, std::uint32_t* visible) noexcept
+        {
+            size_t visibleCount = 0u;
+
+            for (; mask != 0u; mask &= mask - 1u)
+                visible[visibleCount++] = first + static_cast<std::uint32_t>(std::countr_zero(mask));
+
+            return visibleCount;
+        }
+
+        __IE__TARGET_SSE41 inline size_t CullSpheresF32SSE41(const float* planes, const ::IE::Internal::SoAStream<const float>& spheres, const size_t count,
+                                                             const std::uint32_t first, std::uint32_t* visible) noexcept
+        {
+            size_t visibleCount = 0u;
+
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u) {
+                const __m128 x = _mm_loadu_ps(spheres.m_pX + i);
+                const __m128 y = _mm_loadu_ps(spheres.m_pY + i);
+                const __m128 z = _mm_loadu_ps(spheres.m_pZ + i);
+                const __m128 r = _mm_loadu_ps(spheres.m_pW + i);
+
+                // The smallest "distance + radius" over the planes, negative when the sphere is outside of one of them
+                __m128 minimum = _mm_set1_ps(std::numeric_limits<float>::max());
+
+                for (size_t p = 0u; p < ::IE::Frustum::PLANE_COUNT; p++) {
+                    const float* plane = planes + p * 4u;
+
+                    __m128 distance = _mm_add_ps(_mm_set1_ps(plane[3u]), r);
+                    distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane[0u]), x));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane[1u]), y));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane[2u]), z));
+
+                    minimum = _mm_min_ps(minimum, distance);
+                }
+
+                const std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_ps(_mm_cmpge_ps(minimum, _mm_setzero_ps())));
+
+                visibleCount += ::IE::Internal::WriteVisibleIndices(mask, first + static_cast<std::uint32_t>(i), visible + visibleCount);
+            }
+
+            return visibleCount + ::IE::Internal::CullSpheresF32Scalar(planes, ::IE::Internal::OffsetSoAStream(spheres, i), count - i,
+                                                                       first + static_cast<std::uint32_t>(i), visible + visibleCount);
+        }
+
+        __IE__TARGET_SSE41 inline size_t CullBoxesF32SSE41(const float* planes, const ::IE::Internal::SoAStream<const float>& centers, const ::IE::Internal::SoAStream<const float>& extents,
+                                                           const size_t count, const std::uint32_t first, std::uint32_t* visible) noexcept
+        {
+            const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+            size_t visibleCount = 0u;
+
+            size_t i = 0u;
+            for (; i + 4u <= count; i += 4u) {
+                const __m128 cx = _mm_loadu_ps(centers.m_pX + i);
+                const __m128 cy = _mm_loadu_ps(centers.m_pY + i);
+                const __m128 cz = _mm_loadu_ps(centers.m_pZ + i);
+                const __m128 ex = _mm_loadu_ps(extents.m_pX + i);
+                const __m128 ey = _mm_loadu_ps(extents.m_pY + i);
+                const __m128 ez = _mm_loadu_ps(extents.m_pZ + i);
+
+                __m128 minimum = _mm_set1_ps(std::numeric_limits<float>::max());
+
+                for (size_t p = 0u; p < ::IE::Frustum::PLANE_COUNT; p++) {
+                    const __m128 plane = _mm_loadu_ps(planes + p * 4u);
+                    const __m128 extent = _mm_and_ps(plane, absMask);
+
+                    const __m128 nx = _mm_shuffle_ps(plane, plane, _MM_SHUFFLE(0, 0, 0, 0)), ax = _mm_shuffle_ps(extent, extent, _MM_SHUFFLE(0, 0, 0, 0));
+                    const __m128 ny = _mm_shuffle_ps(plane, plane, _MM_SHUFFLE(1, 1, 1, 1)), ay = _mm_shuffle_ps(extent, extent, _MM_SHUFFLE(1, 1, 1, 1));
+                    const __m128 nz = _mm_shuffle_ps(plane, plane, _MM_SHUFFLE(2, 2, 2, 2)), az = _mm_shuffle_ps(extent, extent, _MM_SHUFFLE(2, 2, 2, 2));
+
+                    // "distance + radius", with the radius of the box along the normal being "|n| . extents"
+                    __m128 distance = _mm_shuffle_ps(plane, plane, _MM_SHUFFLE(3, 3, 3, 3));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(nx, cx));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(ny, cy));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(nz, cz));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(ax, ex));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(ay, ey));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(az, ez));
+
+                    minimum = _mm_min_ps(minimum, distance);
+                }
+
+                const std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_ps(_mm_cmpge_ps(minimum, _mm_setzero_ps())));
+
+                visibleCount += ::IE::Internal::WriteVisibleIndices(mask, first + static_cast<std::uint32_t>(i), visible + visibleCount);
+            }
+
+            return visibleCount + ::IE::Internal::CullBoxesF32Scalar(planes, ::IE::Internal::OffsetSoAStream(centers, i), ::IE::Internal::OffsetSoAStream(extents, i),
+                                                                     count - i, first + static_cast<std::uint32_t>(i), visible + visibleCount);
+        }
+
+        // For every 8 bit mask, the positions of its set bits packed in nibbles (lowest first)
+        constexpr std::array<std::uint32_t, 256u> MakeCompactionTable() noexcept
+        {
+            std::array<std::uint32_t, 256u> table{};
+
+            for (std::uint32_t mask = 0u; mask < 256u; mask++) {
+                std::uint32_t shift = 0u;
+
+                for (std::uint32_t bit = 0u; bit < 8u; bit++) {
+                    if ((mask >> bit) & 1u) {
+                        table[mask] |= bit << shift;
+                        shift += 4u;
+                    }
+                }
+            }
+
+            return table;
+        }
+
+        inline constexpr std::array<std::uint32_t, 256u> COMPACTION_TABLE = ::IE::Internal::MakeCompactionTable();
+
+        /* Stores the indices of the 8 volumes of "mask" in one go: the set bits are moved to the first lanes, the */
+        /* others are garbage overwritten by the next store. "visible" needs room for 8 indices.                   */
+        __IE__TARGET_AVX2 inline size_t WriteVisibleIndicesAVX2(const std::uint32_t mask, const std::uint32_t first, std::uint32_t* visible) noexcept
+        {
+            const __m256i shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+
+            const __m256i lanes = _mm256_and_si256(_mm256_srlv_epi32(_mm256_set1_epi32(static_cast<int>(::IE::Internal::COMPACTION_TABLE[mask])), shifts), _mm256_set1_epi32(0xF));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(visible), _mm256_add_epi32(lanes, _mm256_set1_epi32(static_cast<int>(first))));
+
+            return static_cast<size_t>(std::popcount(mask));
+        }
+
+        // The visible count never exceeds "i", so the 8 indices written for the volumes "i" to "i + 7" stay within "count"
+        __IE__TARGET_AVX2 inline size_t CullSpheresF32AVX2(const float* planes, const ::IE::Internal::SoAStream<const float>& spheres, const size_t count,
+                                                           const std::uint32_t first, std::uint32_t* visible) noexcept
+        {
+            size_t visibleCount = 0u;
+
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m256 x = _mm256_loadu_ps(spheres.m_pX + i);
+                const __m256 y = _mm256_loadu_ps(spheres.m_pY + i);
+                const __m256 z = _mm256_loadu_ps(spheres.m_pZ + i);
+                const __m256 r = _mm256_loadu_ps(spheres.m_pW + i);
+
+                __m256 minimum = _mm256_set1_ps(std::numeric_limits<float>::max());
+
+                for (size_t p = 0u; p < ::IE::Frustum::PLANE_COUNT; p++) {
+                    const float* plane = planes + p * 4u;
+
+                    __m256 distance = _mm256_add_ps(_mm256_broadcast_ss(plane + 3u), r);
+                    distance = _mm256_fmadd_ps(_mm256_broadcast_ss(plane + 0u), x, distance);
+                    distance = _mm256_fmadd_ps(_mm256_broadcast_ss(plane + 1u), y, distance);
+                    distance = _mm256_fmadd_ps(_mm256_broadcast_ss(plane + 2u), z, distance);
+
+                    minimum = _mm256_min_ps(minimum, distance);
+                }
+
+                const std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(minimum, _mm256_setzero_ps(), _CMP_GE_OQ)));
+
+                visibleCount += ::IE::Internal::WriteVisibleIndicesAVX2(mask, first + static_cast<std::uint32_t>(i), visible + visibleCount);
+            }
+
+            return visibleCount + ::IE::Internal::CullSpheresF32SSE41(planes, ::IE::Internal::OffsetSoAStream(spheres, i), count - i,
+                                                                      first + static_cast<std::uint32_t>(i), visible + visibleCount);
+        }
+
+        __IE__TARGET_AVX2 inline size_t CullBoxesF32AVX2(const float* planes, const ::IE::Internal::SoAStream<const float>& centers, const ::IE::Internal::SoAStream<const float>& extents,
+                                                         const size_t count, const std::uint32_t first, std::uint32_t* visible) noexcept
+        {
+            // The absolute values of the normals, computed once per chunk
+            float absPlanes[::IE::Frustum::PLANE_COUNT * 4u];
+
+            for (size_t e = 0u; e < ::IE::Frustum::PLANE_COUNT * 4u; e++)
+                absPlanes[e] = std::fabs(planes[e]);
+
+            size_t visibleCount = 0u;
+
+            size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m256 cx = _mm256_loadu_ps(centers.m_pX + i);
+                const __m256 cy = _mm256_loadu_ps(centers.m_pY + i);
+                const __m256 cz = _mm256_loadu_ps(centers.m_pZ + i);
+                const __m256 ex = _mm256_loadu_ps(extents.m_pX + i);
+                const __m256 ey = _mm256_loadu_ps(extents.m_pY + i);
+                const __m256 ez = _mm256_loadu_ps(extents.m_pZ + i);
+
+                __m256 minimum = _mm256_set1_ps(std::numeric_limits<float>::max());
+
+                for (size_t p = 0u; p < ::IE::Frustum::PLANE_COUNT; p++) {
+                    const float* plane    = planes    + p * 4u;
+                    const float* absPlane = absPlanes + p * 4u;
+
+                    __m256 distance = _mm256_broadcast_ss(plane + 3u);
+                    distance = _mm256_fmadd_ps(_mm256_broadcast_ss(plane + 0u),    cx, distance);
+                    distance = _mm256_fmadd_ps(_mm256_broadcast_ss(plane + 1u),    cy, distance);
+                    distance = _mm256_fmadd_ps(_mm256_broadcast_ss(plane + 2u),    cz, distance);
+                    distance = _mm256_fmadd_ps(_mm256_broadcast_ss(absPlane + 0u), ex, distance);
+                    distance = _mm256_fmadd_ps(_mm256_broadcast_ss(absPlane + 1u), ey, distance);
+                    distance = _mm256_fmadd_ps(_mm256_broadcast_ss(absPlane + 2u), ez, distance);
+
+                    minimum = _mm256_min_ps(minimum, distance);
+                }
+
+                const std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(minimum, _mm256_setzero_ps(), _CMP_GE_OQ)));
+
+                visibleCount += ::IE::Internal::WriteVisibleIndicesAVX2(mask, first + static_cast<std::uint32_t>(i), visible + visibleCount);
+            }
+
+            return visibleCount + ::IE::Internal::CullBoxesF32SSE41(planes, ::IE::Internal::OffsetSoAStream(centers, i), ::IE::Internal::OffsetSoAStream(extents, i),
+                                                                    count - i, first + static_cast<std::uint32_t>(i), visible + visibleCount);
+        }
+
+#endif // #ifdef __IE__ENABLE_SIMD
+
+        /* Runs "cull(first, count, visible)" on chunks of "volumeCount" volumes, each chunk writing its indices at its */
+        /* own offset of "visible", then packs the lists of the chunks together. Returns the number of visible volumes. */
+        template <typename _F>
+        inline size_t CullChunks(const size_t volumeCount, const std::span<std::uint32_t> visible, size_t threadCount, const _F& cull) noexcept
+        {
+#if defined(__IE__DEBUG_MODE)
+            assert(visible.size() >= volumeCount && volumeCount <= std::numeric_limits<std::uint32_t>::max());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+            if (threadCount == 0u)
+                threadCount = ::IE::GetHardwareThreadCount();
+
+            const size_t chunkCount = (volumeCount + ::IE::Internal::CULLING_CHUNK_SIZE - 1u) / ::IE::Internal::CULLING_CHUNK_SIZE;
+
+            ::IE::ScratchArray<size_t> visibleCounts(chunkCount);
+
+            if (!visibleCounts.IsValid())
+                return cull(0u, volumeCount, visible.data());
+
+            ::IE::Internal::ParallelFor(chunkCount, threadCount, [&](const size_t c) noexcept {
+                const size_t first = c * ::IE::Internal::CULLING_CHUNK_SIZE;
+
+                visibleCounts[c] = cull(first, std::min(::IE::Internal::CULLING_CHUNK_SIZE, volumeCount - first), visible.data() + first);
+            });
+
+            size_t visibleCount = (chunkCount > 0u) ? visibleCounts[0u] : 0u;
+
+            for (size_t c = 1u; c < chunkCount; c++) {
+                std::memmove(visible.data() + visibleCount, visible.data() + c * ::IE::Internal::CULLING_CHUNK_SIZE, visibleCounts[c] * sizeof(std::uint32_t));
+                visibleCount += visibleCounts[c];
+            }
+
+            return visibleCount;
+        }
+
+    } // Internal
+
+    /* Writes the indices of the "spheres" ((center x, center y, center z, radius) per vector) intersecting "frustum" */
+    /* to the start of "visible" in increasing order & returns their count. "visible" needs room for every sphere.   */
+    /* Chunks of spheres are tested on "threadCount" threads (all the hardware threads for 0).                      */
+    inline size_t CullSpheres(const ::IE::Frustum& frustum, const ::IE::VectorArray<float>& spheres, const std::span<std::uint32_t> visible, const size_t threadCount = 0u) noexcept
+    {
+        const ::IE::Internal::SoAStream<const float> stream{ spheres.GetX(), spheres.GetY(), spheres.GetZ(), spheres.GetW() };
+
+        const float* planes = frustum.GetPlaneData();
+
+        return ::IE::Internal::CullChunks(spheres.GetSize(), visible, threadCount, [&](const size_t first, const size_t count, std::uint32_t* chunkVisible) noexcept {
+            return ::IE::Internal::GetSIMDKernels().m_pCullSpheresF32(planes, ::IE::Internal::OffsetSoAStream(stream, first), count, static_cast<std::uint32_t>(first), chunkVisible);
+        });
+    }
+
+    /* "CullSpheres" for axis aligned boxes given by their "centers" & half sizes ("extents"), "w" being ignored */
+    inline size_t CullBoxes(const ::IE::Frustum& frustum, const ::IE::VectorArray<float>& centers, const ::IE::VectorArray<float>& extents,
+                            const std::span<std::uint32_t> visible, const size_t threadCount = 0u) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(centers.GetSize() == extents.GetSize());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        const ::IE::Internal::SoAStream<const float> centerStream{ centers.GetX(), centers.GetY(), centers.GetZ(), centers.GetW() };
+        const ::IE::Internal::SoAStream<const float> extentStream{ extents.GetX(), extents.GetY(), extents.GetZ(), extents.GetW() };
+
+        const float* planes = frustum.GetPlaneData();
+
+        return ::IE::Internal::CullChunks(centers.GetSize(), visible, threadCount, [&](const size_t first, const size_t count, std::uint32_t* chunkVisible) noexcept {
+            return ::IE::Internal::GetSIMDKernels().m_pCullBoxesF32(planes, ::IE::Internal::OffsetSoAStream(centerStream, first), ::IE::Internal::OffsetSoAStream(extentStream, first),
+                                                                    count, static_cast<std::uint32_t>(first), chunkVisible);
+        });
+    }
+
+    // +--------------+
+    // | File Mapping |
+    // +--------------+
+
+    /* Read-only view of a whole file. The os pages it in on demand straight from its file cache, */
+    /* so large files can be processed (by several threads) without being copied into a buffer.  */
+    /* "IsValid" is false when the file couldn't be opened or mapped. Empty files are valid and  */
+    /* have no data.                                                                             */
+    class MappedFile {
+    private:
+        const std::uint8_t* m_pData = nullptr;
+        std::uint64_t       m_size  = 0u;
+
+        bool m_bIsValid = false;
+
+#if defined(__IE__OS_WINDOWS)
+        ::HANDLE m_fileHandle    = INVALID_HANDLE_VALUE;
+        ::HANDLE m_mappingHandle = NULL;
+#endif // #if defined(__IE__OS_WINDOWS)
+
+    public:
+        MappedFile(const char* path) noexcept
+        {
+#if defined(__IE__OS_WINDOWS)
+            this->m_fileHandle = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+            if (this->m_fileHandle == INVALID_HANDLE_VALUE) return;
+
+            ::LARGE_INTEGER fileSize;
+            if (::GetFileSizeEx(this->m_fileHandle, &fileSize) == 0) return;
+
+            if (fileSize.QuadPart > 0) {
+                this->m_mappingHandle = ::CreateFileMappingA(this->m_fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+                if (this->m_mappingHandle == NULL) return;
+
+                this->m_pData = static_cast<const std::uint8_t*>(::MapViewOfFile(this->m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+
+                if (this->m_pData == nullptr) return;
+            }
+
+            this->m_size = static_cast<std::uint64_t>(fileSize.QuadPart);
+#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
+            const int fileDescriptor = ::open(path, O_RDONLY);
+
+            if (fileDescriptor < 0) return;
+
+            struct ::stat fileStatus;
+            if (::fstat(fileDescriptor, &fileStatus) != 0) {
+                ::close(fileDescriptor);
+                return;
+            }
+
+            if (fileStatus.st_size > 0) {
+                void* const pMapping = ::mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+                // The mapping holds its own reference to the file
+                ::close(fileDescriptor);
+
+                if (pMapping == MAP_FAILED) return;
+
+                // Every reader goes through its part of the file from front to back
+                ::madvise(pMapping, static_cast<size_t>(fileStatus.st_size), MADV_SEQUENTIAL);
+
+                this->m_pData = static_cast<const std::uint8_t*>(pMapping);
+            } else {
+                ::close(fileDescriptor);
+            }
+
+            this->m_size = static_cast<std::uint64_t>(fileStatus.st_size);
+#endif // end of #if defined(__IE__OS_LINUX)
+
+            this->m_bIsValid = true;
+        }
+
+        MappedFile(const ::IE::MappedFile&) = delete;
+        ::IE::MappedFile& operator=(const ::IE::MappedFile&) = delete;
+
+        ~MappedFile() noexcept
+        {
+#if defined(__IE__OS_WINDOWS)
+            if (this->m_pData != nullptr)                   ::UnmapViewOfFile(this->m_pData);
+            if (this->m_mappingHandle != NULL)              ::CloseHandle(this->m_mappingHandle);
+            if (this->m_fileHandle != INVALID_HANDLE_VALUE) ::CloseHandle(this->m_fileHandle);
+#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
+            if (this->m_pData != nullptr)
+                ::munmap(const_cast<std::uint8_t*>(this->m_pData), static_cast<size_t>(this->m_size));
+#endif // end of #if defined(__IE__OS_LINUX)
+        }
+
+        inline bool IsValid() const noexcept { return this->m_bIsValid; }
+
+        inline const std::uint8_t* GetData() const noexcept { return this->m_pData; }
+        inline std::uint64_t       GetSize() const noexcept { return this->m_size;  }
+
+        inline std::span<const std::uint8_t> GetSpan() const noexcept { return std::span<const std::uint8_t>(this->m_pData, static_cast<size_t>(this->m_size)); }
+    };
+
+    // +----------------------+
+    // | Error Checking Codes |
+    // +----------------------+
+
+    namespace Internal {
+
+        /* Slices smaller than this aren't worth a thread. There are up to 4 slices per thread so  */
+        /* that a thread that gets descheduled doesn't hold up the others for too long.             */
+        constexpr const std::uint64_t PARALLEL_CHECKSUM_MIN_SLICE        = 1u << 20u;
+        constexpr const std::uint64_t PARALLEL_CHECKSUM_SLICES_PER_THREAD = 4u;
+
+        /* Checksums the slices of the buffer independently ("checksumSlice(data, len)") and merges */
+        /* the results in order into "value" ("combine(value, sliceChecksum, sliceLen)").          */
+        template <typename _T, typename _SLICE, typename _COMBINE>
+        inline _T ParallelChecksum(_T value, const std::uint8_t* data, const std::uint64_t len, size_t threadCount,
+                                   const _SLICE& checksumSlice, const _COMBINE& combine) noexcept
+        {
+            if (threadCount == 0u)
+                threadCount = ::IE::GetHardwareThreadCount();
+
+            const std::uint64_t maxSliceCount = (threadCount == 1u) ? 1u : threadCount * PARALLEL_CHECKSUM_SLICES_PER_THREAD;
+            const std::uint64_t sliceCount    = std::clamp<std::uint64_t>(len / PARALLEL_CHECKSUM_MIN_SLICE, 1u, maxSliceCount);
+            const std::uint64_t sliceLen      = (len + sliceCount - 1u) / sliceCount;
+
+            ::IE::ScratchArray<_T> sliceChecksums(static_cast<size_t>(sliceCount));
+
+            if (!sliceChecksums.IsValid())
+                return combine(value, checksumSlice(data, len), len);
+
+            ::IE::Internal::ParallelFor(static_cast<size_t>(sliceCount), threadCount, [&](const size_t i) noexcept {
+                const std::uint64_t begin = i * sliceLen;
+
+                sliceChecksums[i] = checksumSlice(data + begin, std::min(sliceLen, len - begin));
+            });
+
+            for (size_t i = 0u; i < sliceCount; i++)
+                value = combine(value, sliceChecksums[i], std::min(sliceLen, len - i * sliceLen));
+
+            return value;
+        }
+
+    } // Internal
+
+    // +----------------------+     +-----+
+    // | Error Checking Codes | --> | CRC |
+    // +----------------------+     +-----+
+
+    namespace Internal {
+
+        /* Slicing tables of a reflected crc: "[k][b]" is the crc of the byte "b" followed by "k" zero */
+        /* bytes. This lets 8 or 16 bytes be folded into the crc with independent lookups instead of   */
+        /* a chain of one lookup per byte.                                                              */
+        template <typename _T, std::uint64_t _POLY>
+        class CRCTables {
+        private:
+            std::array<std::array<_T, 256u>, 16u> m_tables;
+
+        public:
+            constexpr CRCTables() noexcept : m_tables{}
+            {
+                // Calculate Remainder With The Generator Polynomial
+                for (size_t dividend = 0u; dividend < 256u; dividend++) {
+                    _T remainder = static_cast<_T>(dividend);
+
+                    for (size_t bit = 0u; bit < 8u; bit++)
+                        remainder = (remainder & 1u) ? static_cast<_T>(_POLY ^ (remainder >> 1u)) : static_cast<_T>(remainder >> 1u);
+
+                    this->m_tables[0][dividend] = remainder;
+                }
+
+                // Appending a zero byte to the crc of "b"
+                for (size_t k = 1u; k < 16u; k++)
+                    for (size_t b = 0u; b < 256u; b++)
+                        this->m_tables[k][b] = static_cast<_T>(this->m_tables[k - 1u][b] >> 8u) ^ this->m_tables[0][this->m_tables[k - 1u][b] & 0xFFu];
+            }
+
+            constexpr inline const std::array<_T, 256u>& operator[](const size_t k) const noexcept { return this->m_tables[k]; }
+        };
+
+        /* The tables are generated at compile-time, once per template parameter pair and only for */
+        /* the crcs that are actually used.                                                        */
+        template <typename _T, std::uint64_t _POLY>
+        inline constexpr ::IE::Internal::CRCTables<_T, _POLY> CRC_TABLES;
+
+        // Byte "_I" of the block once the crc register has been xored into its first bytes (little endian order)
+        template <typename _T, size_t _I>
+        inline std::uint8_t CRCSliceByte(const _T crc, const std::uint8_t* data) noexcept
+        {
+            if constexpr (_I < sizeof(_T))
+                return data[_I] ^ static_cast<std::uint8_t>(crc >> (8u * _I));
+            else
+                return data[_I];
+        }
+
+        template <typename _T, std::uint64_t _POLY, size_t... _I>
+        inline _T CRCSlice(const _T crc, const std::uint8_t* data, std::index_sequence<_I...>) noexcept
+        {
+            constexpr const ::IE::Internal::CRCTables<_T, _POLY>& tables = ::IE::Internal::CRC_TABLES<_T, _POLY>;
+
+            return static_cast<_T>((tables[sizeof...(_I) - 1u - _I][::IE::Internal::CRCSliceByte<_T, _I>(crc, data)] ^ ...));
+        }
+
+        // Slice-by-16, then slice-by-8 & byte by byte for the remainder
+        template <typename _T, std::uint64_t _POLY>
+        inline _T CRCUpdateSliced(_T crc, const std::uint8_t* data, size_t len) noexcept
+        {
+            for (; len >= 16u; len -= 16u, data += 16u)
+                crc = ::IE::Internal::CRCSlice<_T, _POLY>(crc, data, std::make_index_sequence<16u>{});
+
+            if (len >= 8u) {
+                crc = ::IE::Internal::CRCSlice<_T, _POLY>(crc, data, std::make_index_sequence<8u>{});
+                len -= 8u; data += 8u;
+            }
+
+            for (; len > 0u; len--, data++)
+                crc = static_cast<_T>(::IE::Internal::CRC_TABLES<_T, _POLY>[0][(crc ^ *data) & 0xFFu] ^ (crc >> 8u));
+
+            return crc;
+        }
+
+        inline std::uint32_t CRC32UpdateScalar(const std::uint32_t crc, const std::uint8_t* data, const size_t len) noexcept
+        {
+            return ::IE::Internal::CRCUpdateSliced<std::uint32_t, 0xEDB88320u>(crc, data, len);
+        }
+
+#ifdef __IE__ENABLE_SIMD
+
+        /* Folds 4 blocks of 16 bytes at a time with carry-less multiplications, then reduces them */
+        /* to a 32 bit crc with a Barrett reduction (see Intel's "Fast CRC Computation for Generic  */
+        /* Polynomials Using PCLMULQDQ Instruction"). The constants are powers of x modulo the      */
+        /* bit-reflected polynomial for folding by 512 & 128 bits, 64 bits, and the Barrett step.    */
+        __IE__TARGET_PCLMUL inline std::uint32_t CRC32UpdatePCLMUL(std::uint32_t crc, const std::uint8_t* data, size_t len) noexcept
+        {
+            if (len < 64u)
+                return ::IE::Internal::CRC32UpdateScalar(crc, data, len);
+
+            const __m128i fold512 = _mm_set_epi64x(0x01C6E41596, 0x0154442BD4);
+            const __m128i fold128 = _mm_set_epi64x(0x00CCAA009E, 0x01751997D0);
+            const __m128i fold64  = _mm_set_epi64x(0x0000000000, 0x0163CD6124);
+            const __m128i barrett = _mm_set_epi64x(0x01F7011641, 0x01DB710641);
+            const __m128i mask32  = _mm_setr_epi32(-1, 0, -1, 0);
+
+            const std::uint8_t* const end = data + (len & ~size_t(15u));
+
+            __m128i x0 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), _mm_cvtsi32_si128(static_cast<int>(crc)));
+            __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16u));
+            __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32u));
+            __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48u));
+
+            for (data += 64u; data + 64u <= end; data += 64u) {
+                x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold512, 0x00), _mm_clmulepi64_si128(x0, fold512, 0x11)),
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+                x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, fold512, 0x00), _mm_clmulepi64_si128(x1, fold512, 0x11)),
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16u)));
+                x2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x2, fold512, 0x00), _mm_clmulepi64_si128(x2, fold512, 0x11)),
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32u)));
+                x3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x3, fold512, 0x00), _mm_clmulepi64_si128(x3, fold512, 0x11)),
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48u)));
+            }
+
+            // Folding the 4 accumulators into one, then the remaining blocks of 16 bytes
+            x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold128, 0x00), _mm_clmulepi64_si128(x0, fold128, 0x11)), x1);
+            x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold128, 0x00), _mm_clmulepi64_si128(x0, fold128, 0x11)), x2);
+            x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold128, 0x00), _mm_clmulepi64_si128(x0, fold128, 0x11)), x3);
+
+            for (; data < end; data += 16u) {
+                x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold128, 0x00), _mm_clmulepi64_si128(x0, fold128, 0x11)),
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+            }
+
+            // 128 bits --> 64 bits
+            x0 = _mm_xor_si128(_mm_srli_si128(x0, 8), _mm_clmulepi64_si128(x0, fold128, 0x10));
+            x0 = _mm_xor_si128(_mm_srli_si128(x0, 4), _mm_clmulepi64_si128(_mm_and_si128(x0, mask32), fold64, 0x00));
+
+            // 64 bits --> 32 bits
+            __m128i reduced = _mm_and_si128(_mm_clmulepi64_si128(_mm_and_si128(x0, mask32), barrett, 0x10), mask32);
+            reduced = _mm_xor_si128(x0, _mm_clmulepi64_si128(reduced, barrett, 0x00));
+
+            crc = static_cast<std::uint32_t>(_mm_extract_epi32(reduced, 1));
+
+            return ::IE::Internal::CRC32UpdateScalar(crc, end, len & 15u);
+        }
+
+#endif // #ifdef __IE__ENABLE_SIMD
+
+    } // Internal
+
+    /* Reflected crc whose register is "_T" and whose generator polynomial is "_POLY". Streams are */
+    /* checksummed in pieces with the crc register:                                              */
+    /*     _T crc = CRC32::Init();                                                                */
+    /*     crc = CRC32::Update(crc, pChunk, chunkLength); // as many times as needed              */
+    /*     const _T result = CRC32::Finalize(crc);        // same value as zlib, png, gzip...     */
+    /* "Calculate" returns the register of a whole buffer without the final xor, as it always has. */
+    template <::IE::arithmetic _T, std::uint64_t _POLY>
+    struct CRC {
+        static constexpr inline _T Init()                   noexcept { return std::numeric_limits<_T>::max(); }
+        static constexpr inline _T Finalize(const _T crc)   noexcept { return static_cast<_T>(crc ^ std::numeric_limits<_T>::max()); }
+
+        static inline _T Update(const _T crc, const std::uint8_t* data, const std::uint64_t len) noexcept
+        {
+            if constexpr (std::is_same_v<_T, std::uint32_t> && _POLY == 0xEDB88320u)
+                return ::IE::Internal::GetSIMDKernels().m_pCRC32Update(crc, data, static_cast<size_t>(len));
+            else
+                return ::IE::Internal::CRCUpdateSliced<_T, _POLY>(crc, data, static_cast<size_t>(len));
+        }
+
+        static _T Calculate(const std::uint8_t* data, const std::uint64_t len) noexcept
+        {
+            return CRC<_T, _POLY>::Update(CRC<_T, _POLY>::Init(), data, len);
+        }
+
+        /* Same as "Update" with the buffer checksummed by "threadCount" threads (all the hardware  */
+        /* threads for 0). Meant for very large buffers & mapped files (see "MappedFile").           */
+        static _T UpdateParallel(const _T crc, const std::uint8_t* data, const std::uint64_t len, const size_t threadCount = 0u) noexcept
+        {
+            // "Combine" works on finalized crcs and finalizing is its own inverse
+            const _T result = ::IE::Internal::ParallelChecksum<_T>(CRC<_T, _POLY>::Finalize(crc), data, len, threadCount,
+                [](const std::uint8_t* sliceData, const std::uint64_t sliceLen) noexcept {
+                    return CRC<_T, _POLY>::Finalize(CRC<_T, _POLY>::Update(CRC<_T, _POLY>::Init(), sliceData, sliceLen));
+                },
+                &CRC<_T, _POLY>::Combine);
+
+            return CRC<_T, _POLY>::Finalize(result);
+        }
+
+        /* Returns the finalized crc of the concatenation of two buffers given their finalized crcs */
+        /* and the length of the second one, in O(log(lenB)) time.                                  */
+        static constexpr _T Combine(const _T crcA, const _T crcB, const std::uint64_t lenB) noexcept
+        {
+            return static_cast<_T>(CRC<_T, _POLY>::MultiplyModP(CRC<_T, _POLY>::ShiftModP(lenB), crcA) ^ crcB);
+        }
+
+    private:
+        // In the reflected representation, the coefficient of x^0 is the most significant bit
+        static constexpr _T X_POW_0 = static_cast<_T>(_T(1) << (sizeof(_T) * 8u - 1u));
+
+        // a * b modulo the generator polynomial
+        static constexpr _T MultiplyModP(const _T a, _T b) noexcept
+        {
+            _T product = 0;
+
+            for (_T m = X_POW_0; m != 0u; m >>= 1u) {
+                if (a & m)
+                    product ^= b;
+
+                b = (b & 1u) ? static_cast<_T>((b >> 1u) ^ _POLY) : static_cast<_T>(b >> 1u);
+            }
+
+            return product;
+        }
+
+        // x^(8 * len) modulo the generator polynomial, by squaring x^8
+        static constexpr _T ShiftModP(std::uint64_t len) noexcept
+        {
+            _T power = static_cast<_T>(X_POW_0 >> 1u); // x^1
+
+            for (size_t i = 0u; i < 3u; i++)
+                power = CRC<_T, _POLY>::MultiplyModP(power, power);
+
+            _T result = X_POW_0;
+            for (; len != 0u; len >>= 1u) {
+                if (len & 1u)
+                    result = CRC<_T, _POLY>::MultiplyModP(result, power);
+
+                power = CRC<_T, _POLY>::MultiplyModP(power, power);
+            }
+
+            return result;
+        }
+    };
+
+    typedef ::IE::CRC<std::uint32_t, 0xEDB88320L> CRC32;
+
+    // +----------------------+     +----------+
+    // | Error Checking Codes | --> | ALDER-32 |
+    // +----------------------+     +----------+
+
+    namespace Internal {
+
+        constexpr const std::uint32_t ALDER32_MODULO = 65521u;
+
+        /* Largest number of bytes that can be summed before "high" may overflow 32 bits (assuming */
+        /* both sums start just below the modulo), so the modulo is only needed every NMAX bytes.  */
+        constexpr const size_t ALDER32_NMAX = 5552u;
+
+        inline std::uint32_t ALDER32UpdateScalar(const std::uint32_t alder, const std::uint8_t* data, size_t len) noexcept
+        {
+            std::uint32_t low = alder & 0xFFFFu, high = alder >> 16u;
+
+            while (len > 0u) {
+                size_t blockLen = (len < ALDER32_NMAX) ? len : ALDER32_NMAX;
+                len -= blockLen;
+
+                for (; blockLen >= 8u; blockLen -= 8u, data += 8u) {
+                    low += data[0]; high += low; low += data[1]; high += low;
+                    low += data[2]; high += low; low += data[3]; high += low;
+                    low += data[4]; high += low; low += data[5]; high += low;
+                    low += data[6]; high += low; low += data[7]; high += low;
+                }
+
+                for (; blockLen > 0u; blockLen--, data++) {
+                    low  += *data;
+                    high += low;
+                }
+
+                low  %= ALDER32_MODULO;
+                high %= ALDER32_MODULO;
+            }
+
+            return (high << 16u) | low;
+        }
+
+#ifdef __IE__ENABLE_SIMD
+
+        /* Within a block of 32 bytes, "low" grows by the sum of the bytes ("psadbw" against zero) and */
+        /* "high" by the bytes weighted 32, 31, ..., 1 ("pmaddubsw" then "pmaddwd" to widen the sums). */
+        /* Each block also adds 32 times the "low" of the previous blocks to "high", which is summed   */
+        /* in "prevLowSums" and multiplied once per NMAX bytes.                                          */
+
+        __IE__TARGET_SSE41 inline std::uint32_t ALDER32UpdateSSE41(const std::uint32_t alder, const std::uint8_t* data, const size_t len) noexcept
+        {
+            const __m128i weightsLo = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+            const __m128i weightsHi = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+            const __m128i ones      = _mm_set1_epi16(1);
+
+            std::uint32_t low = alder & 0xFFFFu, high = alder >> 16u;
+
+            size_t blockCount = len / 32u;
+            while (blockCount > 0u) {
+                const size_t n = (blockCount < ALDER32_NMAX / 32u) ? blockCount : ALDER32_NMAX / 32u;
+                blockCount -= n;
+
+                __m128i prevLowSums = _mm_cvtsi32_si128(static_cast<int>(low * n));
+                __m128i highSums    = _mm_cvtsi32_si128(static_cast<int>(high));
+                __m128i lowSums     = _mm_setzero_si128();
+
+                for (size_t i = 0u; i < n; i++, data += 32u) {
+                    const __m128i bytesLo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+                    const __m128i bytesHi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16u));
+
+                    prevLowSums = _mm_add_epi32(prevLowSums, lowSums);
+
+                    lowSums  = _mm_add_epi32(lowSums, _mm_add_epi32(_mm_sad_epu8(bytesLo, _mm_setzero_si128()), _mm_sad_epu8(bytesHi, _mm_setzero_si128())));
+                    highSums = _mm_add_epi32(highSums, _mm_madd_epi16(_mm_maddubs_epi16(bytesLo, weightsLo), ones));
+                    highSums = _mm_add_epi32(highSums, _mm_madd_epi16(_mm_maddubs_epi16(bytesHi, weightsHi), ones));
+                }
+
+                highSums = _mm_add_epi32(highSums, _mm_slli_epi32(prevLowSums, 5));
+
+                lowSums  = _mm_add_epi32(lowSums,  _mm_shuffle_epi32(lowSums,  _MM_SHUFFLE(1, 0, 3, 2)));
+                highSums = _mm_add_epi32(highSums, _mm_shuffle_epi32(highSums, _MM_SHUFFLE(1, 0, 3, 2)));
+                highSums = _mm_add_epi32(highSums, _mm_shuffle_epi32(highSums, _MM_SHUFFLE(2, 3, 0, 1)));
+
+                low  = (low + static_cast<std::uint32_t>(_mm_cvtsi128_si32(lowSums))) % ALDER32_MODULO;
+                high = static_cast<std::uint32_t>(_mm_cvtsi128_si32(highSums)) % ALDER32_MODULO;
+            }
+
+            return ::IE::Internal::ALDER32UpdateScalar((high << 16u) | low, data, len & 31u);
+        }
+
+        __IE__TARGET_AVX2 inline std::uint32_t ALDER32UpdateAVX2(const std::uint32_t alder, const std::uint8_t* data, const size_t len) noexcept
+        {
+            const __m256i weights = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                                                     16, 15, 14, 13, 12, 11, 10, 9,  8,  7,  6,  5,  4,  3,  2,  1);
+            const __m256i ones    = _mm256_set1_epi16(1);
+
+            std::uint32_t low = alder & 0xFFFFu, high = alder >> 16u;
+
+            size_t blockCount = len / 32u;
+            while (blockCount > 0u) {
+                const size_t n = (blockCount < ALDER32_NMAX / 32u) ? blockCount : ALDER32_NMAX / 32u;
+                blockCount -= n;
+
+                __m256i prevLowSums = _mm256_zextsi128_si256(_mm_cvtsi32_si128(static_cast<int>(low * n)));
+                __m256i highSums    = _mm256_zextsi128_si256(_mm_cvtsi32_si128(static_cast<int>(high)));
+                __m256i lowSums     = _mm256_setzero_si256();
+
+                for (size_t i = 0u; i < n; i++, data += 32u) {
+                    const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+
+                    prevLowSums = _mm256_add_epi32(prevLowSums, lowSums);
+
+                    lowSums  = _mm256_add_epi32(lowSums, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+                    highSums = _mm256_add_epi32(highSums, _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, weights), ones));
+                }
+
+                highSums = _mm256_add_epi32(highSums, _mm256_slli_epi32(prevLowSums, 5));
+
+                __m128i lowSum  = _mm_add_epi32(_mm256_castsi256_si128(lowSums),  _mm256_extracti128_si256(lowSums, 1));
+                __m128i highSum = _mm_add_epi32(_mm256_castsi256_si128(highSums), _mm256_extracti128_si256(highSums, 1));
+
+                lowSum  = _mm_add_epi32(lowSum,  _mm_shuffle_epi32(lowSum,  _MM_SHUFFLE(1, 0, 3, 2)));
+                highSum = _mm_add_epi32(highSum, _mm_shuffle_epi32(highSum, _MM_SHUFFLE(1, 0, 3, 2)));
+                highSum = _mm_add_epi32(highSum, _mm_shuffle_epi32(highSum, _MM_SHUFFLE(2, 3, 0, 1)));
+
+                low  = (low + static_cast<std::uint32_t>(_mm_cvtsi128_si32(lowSum))) % ALDER32_MODULO;
+                high = static_cast<std::uint32_t>(_mm_cvtsi128_si32(highSum)) % ALDER32_MODULO;
+            }
+
+            return ::IE::Internal::ALDER32UpdateScalar((high << 16u) | low, data, len & 31u);
+        }
+
+#endif // #ifdef __IE__ENABLE_SIMD
+
+    } // Internal
+
+    /* Streams are checksummed in pieces by passing the running value back to "Update", starting */
+    /* from "Init()". "Calculate" returns the checksum of a whole buffer.                        */
+    struct ALDER32 {
+        static constexpr inline std::uint32_t Init() noexcept { return 1u; }
+
+        static inline std::uint32_t Update(const std::uint32_t alder, const std::uint8_t* data, const std::uint64_t len) noexcept
+        {
+            return ::IE::Internal::GetSIMDKernels().m_pALDER32Update(alder, data, static_cast<size_t>(len));
+        }
+
+        static std::uint32_t Calculate(const std::uint8_t* data, const std::uint64_t len) noexcept
+        {
+            return ::IE::ALDER32::Update(::IE::ALDER32::Init(), data, len);
+        }
+
+        // Same as "Update" with the buffer checksummed by "threadCount" threads (all the hardware threads for 0)
+        static std::uint32_t UpdateParallel(const std::uint32_t alder, const std::uint8_t* data, const std::uint64_t len, const size_t threadCount = 0u) noexcept
+        {
+            return ::IE::Internal::ParallelChecksum<std::uint32_t>(alder, data, len, threadCount,
+                [](const std::uint8_t* sliceData, const std::uint64_t sliceLen) noexcept {
+                    return ::IE::ALDER32::Update(::IE::ALDER32::Init(), sliceData, sliceLen);
+                },
+                &::IE::ALDER32::Combine);
+        }
+
+        // Returns the checksum of the concatenation of two buffers given their checksums and the length of the second one
+        static constexpr std::uint32_t Combine(const std::uint32_t alderA, const std::uint32_t alderB, const std::uint64_t lenB) noexcept
+        {
+            constexpr const std::uint32_t MODULO = ::IE::Internal::ALDER32_MODULO;
+
+            /* "low" is the sum of the two "low"s minus the initial 1 of the second checksum, and the */
+            /* "high" of A is increased by "lenB" times its "low" on top of the sum of the "high"s.   */
+            const std::uint32_t remainder = static_cast<std::uint32_t>(lenB % MODULO);
+
+            std::uint32_t low  = alderA & 0xFFFFu;
+            std::uint32_t high = (remainder * low) % MODULO;
+
+            low  += (alderB & 0xFFFFu) + MODULO - 1u;
+            high += (alderA >> 16u) + (alderB >> 16u) + MODULO - remainder;
+
+            if (low >= MODULO) low -= MODULO;
+            if (low >= MODULO) low -= MODULO;
+            if (high >= MODULO * 2u) high -= MODULO * 2u;
+            if (high >= MODULO) high -= MODULO;
+
+            return (high << 16u) | low;
+        }
+    };
+
+    // +-------------------+
+    // | Endian Conversion |
+    // +-------------------+
+
+    // https://stackoverflow.com/questions/105252/how-do-i-convert-between-big-endian-and-little-endian-values-in-c
+    template <typename _T>
+    inline _T SwapEndian(const _T& u) noexcept
+    {
+        union
+        {
+            _T u;
+            unsigned char u8[sizeof(_T)];
+        } source, dest;
+
+        source.u = u;
+
+        for (size_t k = 0; k < sizeof(_T); k++)
+            dest.u8[k] = source.u8[sizeof(_T) - k - 1];
+
+        return dest.u;
+    }
+
+    namespace Internal {
+
+        // "[b]" is the byte "b" with its bits in reverse order
+        inline constexpr std::array<std::uint8_t, 256u> BIT_REVERSE_TABLE = []() constexpr noexcept {
+            std::array<std::uint8_t, 256u> table{};
+
+            for (size_t b = 0u; b < 256u; b++)
+                for (size_t bit = 0u; bit < 8u; bit++)
+                    table[b] |= static_cast<std::uint8_t>(((b >> bit) & 1u) << (7u - bit));
+
+            return table;
+        }();
+
+    } // Internal
+
+    template <typename _T>
+    inline _T ReverseBits(const _T& input) noexcept {
+        using _U = std::make_unsigned_t<_T>;
+
+        // The reversed bytes are written in reverse order
+        _U output = 0u;
+        for (size_t i = 0u; i < sizeof(_T); i++)
+            output = static_cast<_U>(output << 8u) | ::IE::Internal::BIT_REVERSE_TABLE[(static_cast<_U>(input) >> (8u * i)) & 0xFFu];
+
+        return static_cast<_T>(output);
+    }
+
+    // Reverses the "bitCount" lowest bits of "input" (the other bits must be 0), such as the bits of a huffman code
+    template <typename _T>
+    inline _T ReverseBits(const _T& input, const size_t bitCount) noexcept {
+#if defined(__IE__DEBUG_MODE)
+        assert(bitCount > 0u && bitCount <= sizeof(_T) * 8u);
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        return static_cast<_T>(static_cast<std::make_unsigned_t<_T>>(::IE::ReverseBits(input)) >> (sizeof(_T) * 8u - bitCount));
+    }
+
+    template <typename _T>
+    inline _T FromBigEndian(const _T& val) noexcept {
+        if constexpr (std::endian::native == std::endian::big) {
+            return val;
+        } else if constexpr (std::endian::native == std::endian::little) {
+            return ::IE::SwapEndian(val);
+        } else {
+            static_assert(std::is_same<_T, _T>::value, "Inopine Can't Handle Your Target Platform's Endianness");
+        }
+    }
+
+    template <typename _T>
+    inline _T FromLittleEndian(const _T& val) noexcept {
+        if constexpr (std::endian::native == std::endian::big) {
+            return ::IE::SwapEndian(val);
+        } else if constexpr (std::endian::native == std::endian::little) {
+            return val;
+        } else {
+            static_assert(std::is_same<_T, _T>::value, "Inopine Can't Handle Your Target Platform's Endianness");
+        }
+    }
+
+    // +-------------------+     +------------------+
+    // | Endian Conversion | --> | Bulk Conversions |
+    // +-------------------+     +------------------+
+
+    /* The bulk kernels reverse the bytes of every "_SIZE" byte element of a buffer, and with "_REVERSE_BITS"  */
+    /* the bits of every byte too (which reverses the bits of whole elements). The simd versions do both with */
+    /* "pshufb": once with a byte permutation and once as two lookups into the reversed nibbles, which are the */
+    /* first 16 entries of "BIT_REVERSE_TABLE".                                                              */
+    /* "in" may be the same as "out".                                                                         */
+
+    namespace Internal {
+
+        template <size_t _SIZE, bool _REVERSE_BITS>
+        inline void ReverseBytesScalar(const std::uint8_t* in, std::uint8_t* out, const size_t count) noexcept
+        {
+            for (size_t i = 0u; i < count; i++) {
+                std::uint8_t element[_SIZE];
+                std::memcpy(element, in + i * _SIZE, _SIZE);
+
+                for (size_t k = 0u; k < _SIZE; k++) {
+                    if constexpr (_REVERSE_BITS)
+                        out[i * _SIZE + k] = ::IE::Internal::BIT_REVERSE_TABLE[element[_SIZE - 1u - k]];
+                    else
+                        out[i * _SIZE + k] = element[_SIZE - 1u - k];
+                }
+            }
+        }
+
+#ifdef __IE__ENABLE_SIMD
+
+        // "pshufb" indices reversing the order of the "_SIZE" byte elements of each 16 byte lane
+        template <size_t _SIZE>
+        inline constexpr std::array<std::uint8_t, 64u> REVERSE_BYTES_SHUFFLE = []() constexpr noexcept {
+            std::array<std::uint8_t, 64u> indices{};
+
+            for (size_t i = 0u; i < 64u; i++)
+                indices[i] = static_cast<std::uint8_t>(((i % 16u) / _SIZE) * _SIZE + (_SIZE - 1u - (i % _SIZE)));
+
+            return indices;
+        }();
+
+        template <size_t _SIZE, bool _REVERSE_BITS>
+        __IE__TARGET_SSE41 inline void ReverseBytesSSE41(const std::uint8_t* in, std::uint8_t* out, const size_t count) noexcept
+        {
+            const __m128i shuffle    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(::IE::Internal::REVERSE_BYTES_SHUFFLE<_SIZE>.data()));
+            const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+            const __m128i reversedLo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(::IE::Internal::BIT_REVERSE_TABLE.data()));
+            const __m128i reversedHi = _mm_and_si128(_mm_srli_epi16(reversedLo, 4), nibbleMask);
+
+            const size_t byteCount = count * _SIZE;
+
+            size_t i = 0u;
+            for (; i + 16u <= byteCount; i += 16u) {
+                __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+
+                if constexpr (_SIZE > 1u)
+                    bytes = _mm_shuffle_epi8(bytes, shuffle);
+
+                if constexpr (_REVERSE_BITS) {
+                    bytes = _mm_or_si128(_mm_shuffle_epi8(reversedLo, _mm_and_si128(bytes, nibbleMask)),
+                                         _mm_shuffle_epi8(reversedHi, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask)));
+                }
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), bytes);
+            }
+
+            ::IE::Internal::ReverseBytesScalar<_SIZE, _REVERSE_BITS>(in + i, out + i, (byteCount - i) / _SIZE);
+        }
+
+        template <size_t _SIZE, bool _REVERSE_BITS>
+        __IE__TARGET_AVX2 inline void ReverseBytesAVX2(const std::uint8_t* in, std::uint8_t* out, const size_t count) noexcept
+        {
+            const __m256i shuffle    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(::IE::Internal::REVERSE_BYTES_SHUFFLE<_SIZE>.data()));
+            const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+            const __m256i reversedLo = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(::IE::Internal::BIT_REVERSE_TABLE.data())));
+            const __m256i reversedHi = _mm256_and_si256(_mm256_srli_epi16(reversedLo, 4), nibbleMask);
+
+            const size_t byteCount = count * _SIZE;
+
+            size_t i = 0u;
+            for (; i + 32u <= byteCount; i += 32u) {
+                __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+
+                if constexpr (_SIZE > 1u)
+                    bytes = _mm256_shuffle_epi8(bytes, shuffle);
+
+                if constexpr (_REVERSE_BITS) {
+                    bytes = _mm256_or_si256(_mm256_shuffle_epi8(reversedLo, _mm256_and_si256(bytes, nibbleMask)),
+                                            _mm256_shuffle_epi8(reversedHi, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibbleMask)));
+                }
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), bytes);
+            }
+
+            ::IE::Internal::ReverseBytesSSE41<_SIZE, _REVERSE_BITS>(in + i, out + i, (byteCount - i) / _SIZE);
+        }
+
+        template <size_t _SIZE, bool _REVERSE_BITS>
+        __IE__TARGET_AVX512 inline void ReverseBytesAVX512(const std::uint8_t* in, std::uint8_t* out, const size_t count) noexcept
+        {
+            const __m512i shuffle    = _mm512_loadu_si512(::IE::Internal::REVERSE_BYTES_SHUFFLE<_SIZE>.data());
+            const __m512i nibbleMask = _mm512_set1_epi8(0x0F);
+            const __m512i reversedLo = _mm512_broadcast_i32x4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(::IE::Internal::BIT_REVERSE_TABLE.data())));
+            const __m512i reversedHi = _mm512_and_si512(_mm512_srli_epi16(reversedLo, 4), nibbleMask);
+
+            const size_t byteCount = count * _SIZE;
+
+            size_t i = 0u;
+            for (; i + 64u <= byteCount; i += 64u) {
+                __m512i bytes = _mm512_loadu_si512(in + i);
+
+                if constexpr (_SIZE > 1u)
+                    bytes = _mm512_shuffle_epi8(bytes, shuffle);
+
+                if constexpr (_REVERSE_BITS) {
+                    bytes = _mm512_or_si512(_mm512_shuffle_epi8(reversedLo, _mm512_and_si512(bytes, nibbleMask)),
+                                            _mm512_shuffle_epi8(reversedHi, _mm512_and_si512(_mm512_srli_epi16(bytes, 4), nibbleMask)));
+                }
+
+                _mm512_storeu_si512(out + i, bytes);
+            }
+
+            ::IE::Internal::ReverseBytesAVX2<_SIZE, _REVERSE_BITS>(in + i, out + i, (byteCount - i) / _SIZE);
+        }
+
+#endif // #ifdef __IE__ENABLE_SIMD
+
+        template <size_t _SIZE, bool _REVERSE_BITS>
+        inline void ReverseBytes(const void* in, void* out, const size_t count) noexcept
+        {
+            const ::IE::Internal::SIMDKernels& kernels = ::IE::Internal::GetSIMDKernels();
+
+            const std::uint8_t* const pIn  = static_cast<const std::uint8_t*>(in);
+            std::uint8_t*       const pOut = static_cast<std::uint8_t*>(out);
+
+            if constexpr (_REVERSE_BITS) {
+                if constexpr (_SIZE == 1u) kernels.m_pReverseBits8(pIn, pOut, count);
+                if constexpr (_SIZE == 2u) kernels.m_pReverseBits16(pIn, pOut, count);
+                if constexpr (_SIZE == 4u) kernels.m_pReverseBits32(pIn, pOut, count);
+                if constexpr (_SIZE == 8u) kernels.m_pReverseBits64(pIn, pOut, count);
+            } else {
+                if constexpr (_SIZE == 1u) { if (pIn != pOut) std::memmove(pOut, pIn, count); }
+                if constexpr (_SIZE == 2u) kernels.m_pSwapEndian16(pIn, pOut, count);
+                if constexpr (_SIZE == 4u) kernels.m_pSwapEndian32(pIn, pOut, count);
+                if constexpr (_SIZE == 8u) kernels.m_pSwapEndian64(pIn, pOut, count);
+            }
+        }
+
+        template <typename _T>
+        concept endian_swappable = std::is_trivially_copyable_v<_T> && (sizeof(_T) == 1u || sizeof(_T) == 2u || sizeof(_T) == 4u || sizeof(_T) == 8u);
+
+    } // Internal
+
+    // Reverses the byte order of every value of "values" (integers, floats, ...)
+    template <::IE::Internal::endian_swappable _T>
+    inline void SwapEndianInPlace(const std::span<_T> values) noexcept
+    {
+        ::IE::Internal::ReverseBytes<sizeof(_T), false>(values.data(), values.data(), values.size());
+    }
+
+    // Writes the values of "in" with their byte order reversed to "out" (both spans must have the same size)
+    template <::IE::Internal::endian_swappable _T>
+    inline void SwapEndian(const std::span<const std::type_identity_t<_T>> in, const std::span<_T> out) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::ReverseBytes<sizeof(_T), false>(in.data(), out.data(), in.size());
+    }
+
+    // Converts big endian values (from a file for instance) to the native byte order
+    template <::IE::Internal::endian_swappable _T>
+    inline void FromBigEndian(const std::span<const std::type_identity_t<_T>> in, const std::span<_T> out) noexcept {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        if constexpr (std::endian::native == std::endian::big) {
+            if (in.data() != out.data())
+                std::memmove(out.data(), in.data(), in.size_bytes());
+        } else if constexpr (std::endian::native == std::endian::little) {
+            ::IE::SwapEndian<_T>(in, out);
+        } else {
+            static_assert(std::is_same<_T, _T>::value, "Inopine Can't Handle Your Target Platform's Endianness");
+        }
+    }
+
+    // Converts little endian values to the native byte order
+    template <::IE::Internal::endian_swappable _T>
+    inline void FromLittleEndian(const std::span<const std::type_identity_t<_T>> in, const std::span<_T> out) noexcept {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        if constexpr (std::endian::native == std::endian::big) {
+            ::IE::SwapEndian<_T>(in, out);
+        } else if constexpr (std::endian::native == std::endian::little) {
+            if (in.data() != out.data())
+                std::memmove(out.data(), in.data(), in.size_bytes());
+        } else {
+            static_assert(std::is_same<_T, _T>::value, "Inopine Can't Handle Your Target Platform's Endianness");
+        }
+    }
+
+    // Reverses the bits of every value of "in" into "out" (both spans must have the same size)
+    template <std::unsigned_integral _T>
+    inline void ReverseBits(const std::span<const std::type_identity_t<_T>> in, const std::span<_T> out) noexcept
+    {
+#if defined(__IE__DEBUG_MODE)
+        assert(in.size() == out.size());
+#endif // #if defined(__IE__DEBUG_MODE)
+
+        ::IE::Internal::ReverseBytes<sizeof(_T), true>(in.data(), out.data(), in.size());
+    }
+
+    // +-------------+
+    // | Compression |
+    // +-------------+
+
+    // +-------------+     +---------+
+    // | Compression | --> | Inflate |
+    // +-------------+     +---------+
+
+    namespace Internal {
+
+        /* Entries of the huffman decoding tables, which are indexed by the next bits of the stream (deflate */
+        /* stores codes starting with their most significant bit, so the bits are the reversed code). Codes  */
+        /* longer than the table's bits continue in a subtable, at the entry's value, indexed by the bits    */
+        /* that follow.                                                                                      */
+        /*     bits  0..7  : bits to consume (the codeword's length, or the table's bits for a subtable)    */
+        /*     bits  8..11 : flags                                                                          */
+        /*     bits 12..15 : extra bits (of lengths & distances) or bits of the subtable                    */
+        /*     bits 16..31 : literal, base length, base distance, code length symbol or subtable offset     */
+        constexpr const std::uint32_t HUFFMAN_ENTRY_LITERAL      = 1u << 8u;
+        constexpr const std::uint32_t HUFFMAN_ENTRY_END_OF_BLOCK = 1u << 9u;
+        constexpr const std::uint32_t HUFFMAN_ENTRY_SUBTABLE     = 1u << 10u;
+        constexpr const std::uint32_t HUFFMAN_ENTRY_INVALID      = 1u << 11u;
+
+        constexpr std::uint32_t MakeHuffmanEntry(const std::uint32_t value, const std::uint32_t extraBits, const std::uint32_t flags) noexcept
+        {
+            return (value << 16u) | (extraBits << 12u) | flags;
+        }
+
+        constexpr const size_t INFLATE_LITLEN_TABLE_BITS   = 11u;
+        constexpr const size_t INFLATE_DISTANCE_TABLE_BITS = 8u;
+        constexpr const size_t INFLATE_PRECODE_TABLE_BITS  = 7u;
+
+        // Largest tables (with their subtables) a valid code can need, as computed by zlib's "enough" utility
+        constexpr const size_t INFLATE_LITLEN_TABLE_SIZE   = 2342u; // enough 288 11 15
+        constexpr const size_t INFLATE_DISTANCE_TABLE_SIZE = 402u;  // enough 32 8 15
+        constexpr const size_t INFLATE_PRECODE_TABLE_SIZE  = 128u;  // Codes are at most 7 bits
+
+        constexpr const size_t INFLATE_MAX_CODEWORD_LENGTH = 15u;
+
+        constexpr const std::array<std::uint16_t, 29u> INFLATE_LENGTH_BASES = {
+            3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u, 13u, 15u, 17u, 19u, 23u, 27u, 31u, 35u, 43u, 51u, 59u, 67u, 83u, 99u, 115u, 131u, 163u, 195u, 227u, 258u
+        };
+
+        constexpr const std::array<std::uint8_t, 29u> INFLATE_LENGTH_EXTRA_BITS = {
+            0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 2u, 2u, 2u, 2u, 3u, 3u, 3u, 3u, 4u, 4u, 4u, 4u, 5u, 5u, 5u, 5u, 0u
+        };
+
+        constexpr const std::array<std::uint16_t, 30u> INFLATE_DISTANCE_BASES = {
+            1u, 2u, 3u, 4u, 5u, 7u, 9u, 13u, 17u, 25u, 33u, 49u, 65u, 97u, 129u, 193u, 257u, 385u, 513u, 769u,
+            1025u, 1537u, 2049u, 3073u, 4097u, 6145u, 8193u, 12289u, 16385u, 24577u
+        };
+
+        constexpr const std::array<std::uint8_t, 30u> INFLATE_DISTANCE_EXTRA_BITS = {
+            0u, 0u, 0u, 0u, 1u, 1u, 2u, 2u, 3u, 3u, 4u, 4u, 5u, 5u, 6u, 6u, 7u, 7u, 8u, 8u, 9u, 9u, 10u, 10u, 11u, 11u, 12u, 12u, 13u, 13u
+        };
+
+        // Order in which the lengths of the code length code (the "precode") are stored
+        constexpr const std::array<std::uint8_t, 19u> INFLATE_PRECODE_ORDER = {
+            16u, 17u, 18u, 0u, 8u, 7u, 9u, 6u, 10u, 5u, 11u, 4u, 12u, 3u, 13u, 2u, 14u, 1u, 15u
+        };
+
+        // Table entry (without its length) of every symbol of each alphabet
+        inline constexpr std::array<std::uint32_t, 288u> INFLATE_LITLEN_SYMBOLS = []() constexpr noexcept {
+            std::array<std::uint32_t, 288u> symbols{};
+
+            for (std::uint32_t s = 0u; s < 256u; s++)
+                symbols[s] = ::IE::Internal::MakeHuffmanEntry(s, 0u, HUFFMAN_ENTRY_LITERAL);
+
+            symbols[256u] = ::IE::Internal::MakeHuffmanEntry(0u, 0u, HUFFMAN_ENTRY_END_OF_BLOCK);
+
+            for (std::uint32_t s = 257u; s < 286u; s++)
+                symbols[s] = ::IE::Internal::MakeHuffmanEntry(INFLATE_LENGTH_BASES[s - 257u], INFLATE_LENGTH_EXTRA_BITS[s - 257u], 0u);
+
+            // 286 & 287 take part in the fixed code but never appear in valid streams
+            symbols[286u] = symbols[287u] = ::IE::Internal::MakeHuffmanEntry(0u, 0u, HUFFMAN_ENTRY_INVALID);
+
+            return symbols;
+        }();
+
+        inline constexpr std::array<std::uint32_t, 32u> INFLATE_DISTANCE_SYMBOLS = []() constexpr noexcept {
+            std::array<std::uint32_t, 32u> symbols{};
+
+            for (std::uint32_t s = 0u; s < 30u; s++)
+                symbols[s] = ::IE::Internal::MakeHuffmanEntry(INFLATE_DISTANCE_BASES[s], INFLATE_DISTANCE_EXTRA_BITS[s], 0u);
+
+            symbols[30u] = symbols[31u] = ::IE::Internal::MakeHuffmanEntry(0u, 0u, HUFFMAN_ENTRY_INVALID);
+
+            return symbols;
+        }();
+
+        inline constexpr std::array<std::uint32_t, 19u> INFLATE_PRECODE_SYMBOLS = []() constexpr noexcept {
+            std::array<std::uint32_t, 19u> symbols{};
+
+            for (std::uint32_t s = 0u; s < 19u; s++)
+                symbols[s] = ::IE::Internal::MakeHuffmanEntry(s, 0u, 0u);
+
+            return symbols;
+        }();
+
+        /* Builds the decoding table of the canonical huffman code given by the codeword length of each */
+        /* symbol (0 : unused). Over-subscribed codes are rejected, and so are incomplete ones unless    */
+        /* "bAllowIncomplete" is set, in which case deflate only allows a single code of 1 bit, or none. */
+        /* Bits that don't lead to a code decode as "HUFFMAN_ENTRY_INVALID".                             */
+        inline bool BuildHuffmanTable(std::uint32_t* table, const size_t tableSize, const size_t tableBits, const std::uint8_t* lengths,
+                                      const std::uint32_t* symbols, const size_t symbolCount, const bool bAllowIncomplete) noexcept
+        {
+            std::array<std::uint16_t, INFLATE_MAX_CODEWORD_LENGTH + 1u> counts{};
+            for (size_t s = 0u; s < symbolCount; s++)
+                counts[lengths[s]]++;
+
+            counts[0] = 0u;
+
+            // Number of codes still available at each length, negative when over-subscribed
+            std::int32_t left = 1;
+            for (size_t length = 1u; length <= INFLATE_MAX_CODEWORD_LENGTH; length++) {
+                left = (left << 1) - static_cast<std::int32_t>(counts[length]);
+
+                if (left < 0)
+                    return false;
+            }
+
+            size_t codeCount = 0u;
+            for (size_t length = 1u; length <= INFLATE_MAX_CODEWORD_LENGTH; length++)
+                codeCount += counts[length];
+
+            if (left > 0 && !(bAllowIncomplete && (codeCount == 0u || (codeCount == 1u && counts[1] == 1u))))
+                return false;
+
+            // Symbols sorted by codeword length, then by value, which is the order of their canonical codes
+            std::array<std::uint16_t, INFLATE_MAX_CODEWORD_LENGTH + 2u> offsets{};
+            for (size_t length = 1u; length <= INFLATE_MAX_CODEWORD_LENGTH; length++)
+                offsets[length + 1u] = static_cast<std::uint16_t>(offsets[length] + counts[length]);
+
+            std::array<std::uint16_t, 288u> sortedSymbols;
+            for (size_t s = 0u; s < symbolCount; s++)
+                if (lengths[s] != 0u)
+                    sortedSymbols[offsets[lengths[s]]++] = static_cast<std::uint16_t>(s);
+
+            const size_t primarySize = size_t(1) << tableBits;
+
+            // Only incomplete codes leave entries unset
+            if (left > 0)
+                std::fill(table, table + primarySize, HUFFMAN_ENTRY_INVALID | 1u);
+
+            std::uint32_t code       = 0u;        // Canonical code, most significant bit first
+            size_t        nextOffset = primarySize; // Where the next subtable starts
+            size_t        prefix     = primarySize; // Primary index of the current subtable (none yet)
+            size_t        subtableOffset = 0u;
+            size_t        index          = 0u;
+
+            for (size_t length = 1u; length <= INFLATE_MAX_CODEWORD_LENGTH; length++) {
+                for (; counts[length] != 0u; counts[length]--, index++, code++) {
+                    const std::uint32_t symbol   = symbols[sortedSymbols[index]];
+                    const size_t        reversed = ::IE::ReverseBits(static_cast<std::uint16_t>(code), length);
+
+                    if (length <= tableBits) {
+                        const std::uint32_t entry = symbol | static_cast<std::uint32_t>(length);
+
+                        for (size_t i = reversed; i < primarySize; i += size_t(1) << length)
+                            table[i] = entry;
+
+                        continue;
+                    }
+
+                    /* The codes sharing the first "tableBits" bits are consecutive. Their subtable is as big as  */
+                    /* their longest code requires, which (like zlib) is found by filling it with the remaining   */
+                    /* codes until it is complete.                                                                 */
+                    if ((reversed & (primarySize - 1u)) != prefix) {
+                        prefix = reversed & (primarySize - 1u);
+
+                        size_t       subtableBits = length - tableBits;
+                        std::int32_t subtableLeft = std::int32_t(1) << subtableBits;
+
+                        while (subtableBits + tableBits < INFLATE_MAX_CODEWORD_LENGTH) {
+                            subtableLeft -= counts[subtableBits + tableBits];
+
+                            if (subtableLeft <= 0)
+                                break;
+
+                            subtableBits++;
+                            subtableLeft <<= 1;
+                        }
+
+                        if (nextOffset + (size_t(1) << subtableBits) > tableSize)
+                            return false;
+
+                        subtableOffset = nextOffset;
+                        nextOffset    += size_t(1) << subtableBits;
+
+                        table[prefix] = ::IE::Internal::MakeHuffmanEntry(static_cast<std::uint32_t>(subtableOffset), static_cast<std::uint32_t>(subtableBits), HUFFMAN_ENTRY_SUBTABLE)
+                                      | static_cast<std::uint32_t>(tableBits);
+                    }
+
+                    const size_t        subtableSize = size_t(1) << ((table[prefix] >> 12u) & 0xFu);
+                    const std::uint32_t entry        = symbol | static_cast<std::uint32_t>(length - tableBits);
+
+                    for (size_t i = reversed >> tableBits; i < subtableSize; i += size_t(1) << (length - tableBits))
+                        table[subtableOffset + i] = entry;
+                }
+
+                code <<= 1u;
+            }
+
+            return true;
+        }
+
+        /* Copies a back-reference of "length" bytes starting "distance" bytes back, 8 or 16 bytes at a   */
+        /* time. Up to 15 bytes past the end of the copy are overwritten. Distances shorter than 8 bytes */
+        /* repeat a pattern that overlaps the bytes being written, which is built once and then stored   */
+        /* with a step that is a multiple of its period.                                                 */
+        inline void CopyInflateMatch(std::uint8_t* dst, const size_t distance, const size_t length) noexcept
+        {
+            const std::uint8_t* src = dst - distance;
+            std::uint8_t* const end = dst + length;
+
+            if (distance >= 16u) {
+                do {
+                    std::memcpy(dst, src, 16u);
+                    dst += 16u;
+                    src += 16u;
+                } while (dst < end);
+            } else if (distance >= 8u) {
+                do {
+                    std::memcpy(dst, src, 8u);
+                    dst += 8u;
+                    src += 8u;
+                } while (dst < end);
+            } else {
+                std::uint8_t pattern[8u];
+                for (size_t i = 0u; i < 8u; i++)
+                    pattern[i] = src[i % distance];
+
+                const size_t step = 8u - 8u % distance;
+
+                do {
+                    std::memcpy(dst, pattern, 8u);
+                    dst += step;
+                } while (dst < end);
+            }
+        }
+
+    } // Internal
+
+    /* Decompresses a raw deflate stream (RFC 1951) into a buffer that holds the whole output, which is */
+    /* also where back-references are copied from. Input can be provided in pieces : without the final  */
+    /* piece, "Inflate" stops before any block header or symbol that could run past the end of what it  */
+    /* was given and returns NEEDS_INPUT, "pInput" pointing to the first byte it didn't consume. It is  */
+    /* then called again with those bytes followed by more input.                                       */
+    /* So that no bit is read with a bounds check, the input must be followed by "INPUT_PADDING"         */
+    /* readable bytes (of any value) and the output by "OUTPUT_SLACK" writable ones.                     */
+    class Inflater {
+    public:
+        enum class Result : std::uint8_t { NEEDS_INPUT, DONE, FAILED };
+
+        static constexpr size_t INPUT_PADDING = 32u;
+        static constexpr size_t OUTPUT_SLACK  = 32u;
+
+    private:
+        enum class State : std::uint8_t { BLOCK_HEADER, STORED_BLOCK, HUFFMAN_BLOCK, DONE, FAILED };
+
+        // Input that must be left to start a block header (the largest dynamic header is ~570 bytes) or a symbol
+        static constexpr size_t BLOCK_HEADER_INPUT_MARGIN = 640u;
+        static constexpr size_t SYMBOL_INPUT_MARGIN       = 16u;
+
+        static constexpr size_t LITLEN_TABLE_MASK   = (size_t(1) << ::IE::Internal::INFLATE_LITLEN_TABLE_BITS) - 1u;
+        static constexpr size_t DISTANCE_TABLE_MASK = (size_t(1) << ::IE::Internal::INFLATE_DISTANCE_TABLE_BITS) - 1u;
+
+        std::uint8_t* m_pOutput        = nullptr;
+        size_t        m_outputSize     = 0u;
+        size_t        m_outputPosition = 0u;
+
+        // Bits read ahead of the input pointer, the next one being the least significant
+        std::uint64_t m_bitBuffer = 0u;
+        size_t        m_bitCount  = 0u;
+
+        State         m_state           = State::BLOCK_HEADER;
+        bool          m_bFinalBlock     = false;
+        bool          m_bFixedTables    = false; // Wether the tables currently hold the fixed codes
+        std::uint32_t m_storedRemaining = 0u;
+
+        std::array<std::uint32_t, ::IE::Internal::INFLATE_LITLEN_TABLE_SIZE>   m_litLenTable;
+        std::array<std::uint32_t, ::IE::Internal::INFLATE_DISTANCE_TABLE_SIZE> m_distanceTable;
+
+        // Fills the bit buffer with at least 56 bits, reading 8 bytes at "p"
+        static inline void Refill(const std::uint8_t*& p, std::uint64_t& bitBuffer, size_t& bitCount) noexcept
+        {
+            std::uint64_t word;
+            std::memcpy(&word, p, sizeof(word));
+
+            bitBuffer |= ::IE::FromLittleEndian(word) << bitCount;
+            p         += (63u - bitCount) >> 3u;
+            bitCount  |= 56u;
+        }
+
+        bool BuildFixedTables() noexcept
+        {
+            std::array<std::uint8_t, 288u + 32u> lengths;
+            std::fill(lengths.begin()        , lengths.begin() + 144u, 8u);
+            std::fill(lengths.begin() + 144u , lengths.begin() + 256u, 9u);
+            std::fill(lengths.begin() + 256u , lengths.begin() + 280u, 7u);
+            std::fill(lengths.begin() + 280u , lengths.begin() + 288u, 8u);
+            std::fill(lengths.begin() + 288u , lengths.end()         , 5u);
+
+            this->m_bFixedTables =
+                ::IE::Internal::BuildHuffmanTable(this->m_litLenTable.data(), this->m_litLenTable.size(), ::IE::Internal::INFLATE_LITLEN_TABLE_BITS,
+                                                  lengths.data(), ::IE::Internal::INFLATE_LITLEN_SYMBOLS.data(), 288u, false) &&
+                ::IE::Internal::BuildHuffmanTable(this->m_distanceTable.data(), this->m_distanceTable.size(), ::IE::Internal::INFLATE_DISTANCE_TABLE_BITS,
+                                                  lengths.data() + 288u, ::IE::Internal::INFLATE_DISTANCE_SYMBOLS.data(), 32u, false);
+
+            return this->m_bFixedTables;
+        }
+
+        // Reads the codes of a dynamic block. With the final input, fails once bits past its end would be needed
+        bool ReadDynamicTables(const std::uint8_t*& p, const std::uint8_t* const pInputEnd, std::uint64_t& bitBuffer, size_t& bitCount) noexcept
+        {
+            this->m_bFixedTables = false;
+
+            ::IE::Inflater::Refill(p, bitBuffer, bitCount);
+
+            const size_t litLenCount   = static_cast<size_t>(bitBuffer & 0x1Fu) + 257u;
+            const size_t distanceCount = static_cast<size_t>((bitBuffer >> 5u) & 0x1Fu) + 1u;
+            const size_t precodeCount  = static_cast<size_t>((bitBuffer >> 10u) & 0xFu) + 4u;
+
+            bitBuffer >>= 14u;
+            bitCount   -= 14u;
+
+            if (litLenCount > 286u || distanceCount > 30u)
+                return false;
+
+            std::array<std::uint8_t, 19u> precodeLengths{};
+            for (size_t i = 0u; i < precodeCount; i++) {
+                if (bitCount < 3u)
+                    ::IE::Inflater::Refill(p, bitBuffer, bitCount);
+
+                precodeLengths[::IE::Internal::INFLATE_PRECODE_ORDER[i]] = static_cast<std::uint8_t>(bitBuffer & 0x7u);
+
+                bitBuffer >>= 3u;
+                bitCount   -= 3u;
+            }
+
+            std::array<std::uint32_t, ::IE::Internal::INFLATE_PRECODE_TABLE_SIZE> precodeTable;
+            if (!::IE::Internal::BuildHuffmanTable(precodeTable.data(), precodeTable.size(), ::IE::Internal::INFLATE_PRECODE_TABLE_BITS,
+                                                   precodeLengths.data(), ::IE::Internal::INFLATE_PRECODE_SYMBOLS.data(), 19u, false))
+                return false;
+
+            // The two codes' lengths are one sequence, repetitions can cross from one to the other
+            std::array<std::uint8_t, 286u + 30u> lengths;
+
+            const size_t lengthCount = litLenCount + distanceCount;
+            for (size_t i = 0u; i < lengthCount; ) {
+                // Each refill reads 8 bytes, stay within the padding
+                if (p > pInputEnd + 8u)
+                    return false;
+
+                ::IE::Inflater::Refill(p, bitBuffer, bitCount);
+
+                const std::uint32_t entry = precodeTable[bitBuffer & 0x7Fu];
+
+                bitBuffer >>= entry & 0xFFu;
+                bitCount   -= entry & 0xFFu;
+
+                const std::uint32_t symbol = entry >> 16u;
+
+                if (symbol < 16u) {
+                    lengths[i++] = static_cast<std::uint8_t>(symbol);
+                    continue;
+                }
+
+                std::uint8_t value = 0u;
+                size_t       repeatCount;
+
+                if (symbol == 16u) {
+                    if (i == 0u)
+                        return false;
+
+                    value       = lengths[i - 1u];
+                    repeatCount = 3u + static_cast<size_t>(bitBuffer & 0x3u);
+                    bitBuffer >>= 2u;
+                    bitCount   -= 2u;
+                } else if (symbol == 17u) {
+                    repeatCount = 3u + static_cast<size_t>(bitBuffer & 0x7u);
+                    bitBuffer >>= 3u;
+                    bitCount   -= 3u;
+                } else {
+                    repeatCount = 11u + static_cast<size_t>(bitBuffer & 0x7Fu);
+                    bitBuffer >>= 7u;
+                    bitCount   -= 7u;
+                }
+
+                if (repeatCount > lengthCount - i)
+                    return false;
+
+                std::fill(lengths.begin() + i, lengths.begin() + i + repeatCount, value);
+                i += repeatCount;
+            }
+
+            // A block without an end can't be decoded
+            if (lengths[256u] == 0u)
+                return false;
+
+            return ::IE::Internal::BuildHuffmanTable(this->m_litLenTable.data(), this->m_litLenTable.size(), ::IE::Internal::INFLATE_LITLEN_TABLE_BITS,
+                                                     lengths.data(), ::IE::Internal::INFLATE_LITLEN_SYMBOLS.data(), litLenCount, true) &&
+                   ::IE::Internal::BuildHuffmanTable(this->m_distanceTable.data(), this->m_distanceTable.size(), ::IE::Internal::INFLATE_DISTANCE_TABLE_BITS,
+                                                     lengths.data() + litLenCount, ::IE::Internal::INFLATE_DISTANCE_SYMBOLS.data(), distanceCount, true);
+        }
+
+    public:
+        Inflater() noexcept = default;
+
+        // "pOutput" must be followed by "OUTPUT_SLACK" writable bytes
+        Inflater(std::uint8_t* pOutput, const size_t outputSize) noexcept
+        {
+            this->Reset(pOutput, outputSize);
+        }
+
+        // Starts a new stream
+        void Reset(std::uint8_t* pOutput, const size_t outputSize) noexcept
+        {
+            this->m_pOutput        = pOutput;
+            this->m_outputSize     = outputSize;
+            this->m_outputPosition = 0u;
+            this->m_bitBuffer      = 0u;
+            this->m_bitCount       = 0u;
+            this->m_state          = State::BLOCK_HEADER;
+            this->m_bFinalBlock    = false;
+        }
+
+        // Bytes decompressed so far
+        inline size_t GetOutputSize() const noexcept { return this->m_outputPosition; }
+
+        /* Decompresses as much of [pInput, pInputEnd) as possible, "bFinalInput" telling wether the stream */
+        /* ends within it. Once DONE, "pInput" points right after the stream (e.g. to a zlib trailer).      */
+        Result Inflate(const std::uint8_t*& pInput, const std::uint8_t* const pInputEnd, const bool bFinalInput) noexcept
+        {
+            using namespace ::IE::Internal;
+
+            const std::uint8_t* p         = pInput;
+            std::uint64_t       bitBuffer = this->m_bitBuffer;
+            size_t              bitCount  = this->m_bitCount;
+
+            /* Whole bytes that are still buffered are handed back, the next call's input starts with */
+            /* them. Only the bits of a partially read byte are kept (the bits past "bitCount" are    */
+            /* bytes at "p", which could be different then).                                         */
+            const auto save = [&](const Result result) noexcept {
+                p        -= bitCount >> 3u;
+                bitCount &= 7u;
+
+                this->m_bitBuffer = bitBuffer & ((std::uint64_t(1) << bitCount) - 1u);
+                this->m_bitCount  = bitCount;
+                pInput = p;
+
+                return result;
+            };
+
+            const auto fail = [&]() noexcept {
+                this->m_state = State::FAILED;
+
+                return save(Result::FAILED);
+            };
+
+            for (;;) {
+                switch (this->m_state) {
+                case State::BLOCK_HEADER:
+                {
+                    if (this->m_bFinalBlock) {
+                        this->m_state = State::DONE;
+                        continue;
+                    }
+
+                    if (!bFinalInput && static_cast<size_t>(pInputEnd - p) < BLOCK_HEADER_INPUT_MARGIN)
+                        return save(Result::NEEDS_INPUT);
+
+                    if (p > pInputEnd + 8u)
+                        return fail();
+
+                    ::IE::Inflater::Refill(p, bitBuffer, bitCount);
+
+                    this->m_bFinalBlock = (bitBuffer & 1u) != 0u;
+                    const size_t blockType = static_cast<size_t>((bitBuffer >> 1u) & 0x3u);
+
+                    bitBuffer >>= 3u;
+                    bitCount   -= 3u;
+
+                    if (blockType == 0u) {
+                        // Stored blocks start on a byte boundary with their length & its complement, hand the buffered bytes back
+                        bitBuffer >>= bitCount & 7u;
+                        bitCount  &= ~size_t(7);
+
+                        p        -= bitCount >> 3u;
+                        bitBuffer = 0u;
+                        bitCount  = 0u;
+
+                        if (pInputEnd - p < 4)
+                            return fail();
+
+                        const std::uint32_t length = static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8u);
+                        const std::uint32_t check  = static_cast<std::uint32_t>(p[2]) | (static_cast<std::uint32_t>(p[3]) << 8u);
+
+                        if (length != (~check & 0xFFFFu))
+                            return fail();
+
+                        p += 4u;
+
+                        this->m_storedRemaining = length;
+                        this->m_state = State::STORED_BLOCK;
+                    } else if (blockType == 1u) {
+                        if (!this->m_bFixedTables && !this->BuildFixedTables())
+                            return fail();
+
+                        this->m_state = State::HUFFMAN_BLOCK;
+                    } else if (blockType == 2u) {
+                        if (!this->ReadDynamicTables(p, pInputEnd, bitBuffer, bitCount) || p > pInputEnd + 8u)
+                            return fail();
+
+                        this->m_state = State::HUFFMAN_BLOCK;
+                    } else {
+                        return fail();
+                    }
+
+                    continue;
+                }
+                case State::STORED_BLOCK:
+                {
+                    const size_t available = (p < pInputEnd) ? static_cast<size_t>(pInputEnd - p) : 0u;
+                    const size_t count     = std::min<size_t>(this->m_storedRemaining, available);
+
+                    if (count > this->m_outputSize - this->m_outputPosition)
+                        return fail();
+
+                    std::memcpy(this->m_pOutput + this->m_outputPosition, p, count);
+
+                    p += count;
+                    this->m_outputPosition  += count;
+                    this->m_storedRemaining -= static_cast<std::uint32_t>(count);
+
+                    if (this->m_storedRemaining != 0u)
+                        return bFinalInput ? fail() : save(Result::NEEDS_INPUT);
+
+                    this->m_state = State::BLOCK_HEADER;
+                    continue;
+                }
+                case State::HUFFMAN_BLOCK:
+                {
+                    const std::uint32_t* const litLenTable   = this->m_litLenTable.data();
+                    const std::uint32_t* const distanceTable = this->m_distanceTable.data();
+
+                    std::uint8_t* const out        = this->m_pOutput;
+                    const size_t        outputSize = this->m_outputSize;
+                    size_t              position   = this->m_outputPosition;
+
+                    for (;;) {
+                        if (pInputEnd - p < static_cast<std::ptrdiff_t>(SYMBOL_INPUT_MARGIN)) {
+                            if (!bFinalInput) {
+                                this->m_outputPosition = position;
+                                return save(Result::NEEDS_INPUT);
+                            }
+
+                            // Past the end only the padding is read, more than 8 bytes of it means that bits of it were consumed
+                            if (p > pInputEnd + 8u)
+                                return fail();
+                        }
+
+                        // Literals are written unchecked into the slack, at most 3 per iteration
+                        if (position > outputSize)
+                            return fail();
+
+                        ::IE::Inflater::Refill(p, bitBuffer, bitCount);
+
+                        std::uint32_t entry = litLenTable[bitBuffer & LITLEN_TABLE_MASK];
+
+                        // Up to 3 literals per refill (codewords are at most 15 bits)
+                        if (entry & HUFFMAN_ENTRY_LITERAL) {
+                            bitBuffer >>= entry & 0xFFu;
+                            bitCount   -= entry & 0xFFu;
+                            out[position++] = static_cast<std::uint8_t>(entry >> 16u);
+
+                            entry = litLenTable[bitBuffer & LITLEN_TABLE_MASK];
+
+                            if (entry & HUFFMAN_ENTRY_LITERAL) {
+                                bitBuffer >>= entry & 0xFFu;
+                                bitCount   -= entry & 0xFFu;
+                                out[position++] = static_cast<std::uint8_t>(entry >> 16u);
+
+                                entry = litLenTable[bitBuffer & LITLEN_TABLE_MASK];
+
+                                if (entry & HUFFMAN_ENTRY_LITERAL) {
+                                    bitBuffer >>= entry & 0xFFu;
+                                    bitCount   -= entry & 0xFFu;
+                                    out[position++] = static_cast<std::uint8_t>(entry >> 16u);
+
+                                    continue;
+                                }
+                            }
+
+                            // At least 26 bits were left, so the entry stays valid after refilling
+                            ::IE::Inflater::Refill(p, bitBuffer, bitCount);
+                        }
+
+                        // From here on at most 15 + 5 + 15 + 13 = 48 bits are consumed
+                        if (entry & HUFFMAN_ENTRY_SUBTABLE) {
+                            bitBuffer >>= INFLATE_LITLEN_TABLE_BITS;
+                            bitCount   -= INFLATE_LITLEN_TABLE_BITS;
+
+                            entry = litLenTable[(entry >> 16u) + (bitBuffer & ((std::uint64_t(1) << ((entry >> 12u) & 0xFu)) - 1u))];
+                        }
+
+                        bitBuffer >>= entry & 0xFFu;
+                        bitCount   -= entry & 0xFFu;
+
+                        if (entry & HUFFMAN_ENTRY_LITERAL) {
+                            out[position++] = static_cast<std::uint8_t>(entry >> 16u);
+                            continue;
+                        }
+
+                        if (entry & (HUFFMAN_ENTRY_END_OF_BLOCK | HUFFMAN_ENTRY_INVALID)) {
+                            if (entry & HUFFMAN_ENTRY_INVALID)
+                                return fail();
+
+                            break;
+                        }
+
+                        size_t extraBits = (entry >> 12u) & 0xFu;
+
+                        const size_t length = (entry >> 16u) + static_cast<size_t>(bitBuffer & ((std::uint64_t(1) << extraBits) - 1u));
+                        bitBuffer >>= extraBits;
+                        bitCount   -= extraBits;
+
+                        entry = distanceTable[bitBuffer & DISTANCE_TABLE_MASK];
+
+                        if (entry & HUFFMAN_ENTRY_SUBTABLE) {
+                            bitBuffer >>= INFLATE_DISTANCE_TABLE_BITS;
+                            bitCount   -= INFLATE_DISTANCE_TABLE_BITS;
+
+                            entry = distanceTable[(entry >> 16u) + (bitBuffer & ((std::uint64_t(1) << ((entry >> 12u) & 0xFu)) - 1u))];
+                        }
+
+                        if (entry & HUFFMAN_ENTRY_INVALID)
+                            return fail();
+
+                        bitBuffer >>= entry & 0xFFu;
+                        bitCount   -= entry & 0xFFu;
+                        extraBits   = (entry >> 12u) & 0xFu;
+
+                        const size_t distance = (entry >> 16u) + static_cast<size_t>(bitBuffer & ((std::uint64_t(1) << extraBits) - 1u));
+                        bitBuffer >>= extraBits;
+                        bitCount   -= extraBits;
+
+                        if (distance > position || position + length > outputSize)
+                            return fail();
+
+                        ::IE::Internal::CopyInflateMatch(out + position, distance, length);
+                        position += length;
+                    }
+
+                    if (position > outputSize)
+                        return fail();
+
+                    this->m_outputPosition = position;
+                    this->m_state = State::BLOCK_HEADER;
+                    continue;
+                }
+                case State::DONE:
+                {
+                    // The stream ends on a byte boundary
+                    bitBuffer = 0u;
+                    bitCount &= ~size_t(7);
+
+                    // The stream was truncated if its end was in the padding
+                    if (p - (bitCount >> 3u) > pInputEnd)
+                        return fail();
+
+                    return save(Result::DONE);
+                }
+                case State::FAILED:
+                    return Result::FAILED;
+                }
+            }
+        }
+    };
+
+    // +-------------+     +---------+
+    // | Compression | --> | Deflate |
+    // +-------------+     +---------+
+
+    /* Effort of the compressor, from real-time captures to archiving:                         */
+    /*     HUFFMAN_ONLY : no matches, only entropy coding (fastest)                            */
+    /*     RLE          : matches of the previous byte only (runs)                             */
+    /*     FAST         : greedy matching with short hash chains                               */
+    /*     DEFAULT      : lazy matching                                                        */
+    /*     BEST         : lazy matching with long hash chains                                  */
+    enum class DeflateLevel : std::uint8_t { HUFFMAN_ONLY, RLE, FAST, DEFAULT, BEST };
+
+    namespace Internal {
+
+        constexpr const size_t DEFLATE_WINDOW_SIZE = 32768u;
+        constexpr const size_t DEFLATE_MIN_MATCH   = 3u;
+        constexpr const size_t DEFLATE_MAX_MATCH   = 258u;
+
+        /* Inputs are compressed in chunks of this size on separate threads. Each chunk can refer to */
+        /* the window before it (which is part of the input), so compression barely suffers, and    */
+        /* ends on a byte boundary (with an empty stored block) so the chunks can be concatenated.   */
+        constexpr const size_t DEFLATE_CHUNK_SIZE = 128u << 10u;
+
+        // Tokens of a block, whose codes are fitted to them
+        constexpr const size_t DEFLATE_BLOCK_TOKENS = 32768u;
+
+        constexpr const size_t DEFLATE_HASH_BITS = 15u;
+
+        struct DeflateLevelParameters {
+            std::uint16_t m_maxChainLength;  // Candidates tried per position
+            std::uint16_t m_niceLength;      // Matches at least this long are taken right away
+            bool          m_bLazy;           // Wether a match can be deferred for a longer one at the next byte
+        };
+
+        inline ::IE::Internal::DeflateLevelParameters GetDeflateLevelParameters(const ::IE::DeflateLevel level) noexcept
+        {
+            switch (level) {
+            case ::IE::DeflateLevel::FAST: return { 4u, 32u, false };
+            case ::IE::DeflateLevel::BEST: return { 1024u, 258u, true };
+            default:                       return { 32u, 128u, true };
+            }
+        }
+
+        // Tokens : literals (< 256) or matches (flag, length - 3 in bits 16..23 and distance - 1 in bits 0..15)
+        constexpr const std::uint32_t DEFLATE_MATCH_FLAG = 1u << 31u;
+
+        // Length (3..258) to its symbol (257..285)
+        inline constexpr std::array<std::uint16_t, DEFLATE_MAX_MATCH + 1u> DEFLATE_LENGTH_SYMBOLS = []() constexpr noexcept {
+            std::array<std::uint16_t, DEFLATE_MAX_MATCH + 1u> symbols{};
+
+            for (size_t s = 0u; s < INFLATE_LENGTH_BASES.size(); s++)
+                for (size_t length = INFLATE_LENGTH_BASES[s]; length < INFLATE_LENGTH_BASES[s] + (size_t(1) << INFLATE_LENGTH_EXTRA_BITS[s]) && length <= DEFLATE_MAX_MATCH; length++)
+                    symbols[length] = static_cast<std::uint16_t>(257u + s);
+
+            // 258 has a symbol of its own, rather than being the last length of symbol 284
+            symbols[DEFLATE_MAX_MATCH] = 285u;
+
+            return symbols;
+        }();
+
+        // Distance symbols of "distance - 1" below 256, then of "(distance - 1) >> 7" (as in zlib)
+        inline constexpr std::array<std::uint8_t, 512u> DEFLATE_DISTANCE_SYMBOLS = []() constexpr noexcept {
+            std::array<std::uint8_t, 512u> symbols{};
+
+            for (size_t s = 0u; s < INFLATE_DISTANCE_BASES.size(); s++) {
+                for (size_t d = INFLATE_DISTANCE_BASES[s]; d < INFLATE_DISTANCE_BASES[s] + (size_t(1) << INFLATE_DISTANCE_EXTRA_BITS[s]); d++) {
+                    if (d - 1u < 256u)
+                        symbols[d - 1u] = static_cast<std::uint8_t>(s);
+                    else
+                        symbols[256u + ((d - 1u) >> 7u)] = static_cast<std::uint8_t>(s);
+                }
+            }
+
+            return symbols;
+        }();
+
+        inline size_t GetDeflateDistanceSymbol(const size_t distance) noexcept
+        {
+            return (distance <= 256u) ? DEFLATE_DISTANCE_SYMBOLS[distance - 1u] : DEFLATE_DISTANCE_SYMBOLS[256u + ((distance - 1u) >> 7u)];
+        }
+
+        /* Lengths of an optimal prefix code for "count" symbols given their frequencies, none longer */
+        /* than "maxLength". Moffat & Katajainen's in-place algorithm computes the unlimited lengths, */
+        /* codes that are too long are then shortened by lengthening shorter ones (as in miniz).      */
+        /* At least 2 symbols get a code so that the code is complete, as some decoders require.      */
+        inline void BuildHuffmanLengths(const std::uint32_t* frequencies, const size_t count, const size_t maxLength, std::uint8_t* lengths) noexcept
+        {
+            struct Symbol {
+                std::uint32_t m_key; // Frequency, then parent, then depth
+                std::uint16_t m_symbol;
+            };
+
+            std::array<Symbol, 288u> symbols;
+            size_t used = 0u;
+
+            std::fill(lengths, lengths + count, 0u);
+
+            for (size_t s = 0u; s < count; s++)
+                if (frequencies[s] != 0u)
+                    symbols[used++] = { frequencies[s], static_cast<std::uint16_t>(s) };
+
+            if (used < 2u) {
+                lengths[(used == 1u && symbols[0].m_symbol != 0u) ? symbols[0].m_symbol : 1u] = 1u;
+                lengths[0] = 1u;
+
+                return;
+            }
+
+            std::sort(symbols.begin(), symbols.begin() + used, [](const Symbol& a, const Symbol& b) noexcept { return a.m_key < b.m_key; });
+
+            // Moffat-Katajainen : the first pass turns the keys into parent indices
+            const std::int32_t n = static_cast<std::int32_t>(used);
+
+            symbols[0].m_key += symbols[1].m_key;
+
+            std::int32_t root = 0, leaf = 2;
+            for (std::int32_t next = 1; next < n - 1; next++) {
+                if (leaf >= n || symbols[root].m_key < symbols[leaf].m_key) {
+                    symbols[next].m_key = symbols[root].m_key;
+                    symbols[root++].m_key = static_cast<std::uint32_t>(next);
+                } else {
+                    symbols[next].m_key = symbols[leaf++].m_key;
+                }
+
+                if (leaf >= n || (root < next && symbols[root].m_key < symbols[leaf].m_key)) {
+                    symbols[next].m_key += symbols[root].m_key;
+                    symbols[root++].m_key = static_cast<std::uint32_t>(next);
+                } else {
+                    symbols[next].m_key += symbols[leaf++].m_key;
+                }
+            }
+
+            // Then into the depth of the internal nodes
+            symbols[n - 2].m_key = 0u;
+            for (std::int32_t next = n - 3; next >= 0; next--)
+                symbols[next].m_key = symbols[symbols[next].m_key].m_key + 1u;
+
+            // And finally into the depth of the leaves
+            std::int32_t available = 1, usedNodes = 0, depth = 0;
+            root = n - 2;
+
+            for (std::int32_t next = n - 1; available > 0; depth++) {
+                while (root >= 0 && static_cast<std::int32_t>(symbols[root].m_key) == depth) {
+                    usedNodes++;
+                    root--;
+                }
+
+                while (available > usedNodes) {
+                    symbols[next--].m_key = static_cast<std::uint32_t>(depth);
+                    available--;
+                }
+
+                available = 2 * usedNodes;
+                usedNodes = 0;
+            }
+
+            // Codes longer than "maxLength" are shortened, then codes are lengthened until the code is complete again
+            std::array<std::uint32_t, 33u> lengthCounts{};
+            for (size_t i = 0u; i < used; i++)
+                lengthCounts[std::min<size_t>(symbols[i].m_key, 32u)]++;
+
+            for (size_t length = maxLength + 1u; length <= 32u; length++) {
+                lengthCounts[maxLength] += lengthCounts[length];
+                lengthCounts[length] = 0u;
+            }
+
+            std::uint64_t total = 0u;
+            for (size_t length = 1u; length <= maxLength; length++)
+                total += static_cast<std::uint64_t>(lengthCounts[length]) << (maxLength - length);
+
+            for (; total != (std::uint64_t(1) << maxLength); total--) {
+                lengthCounts[maxLength]--;
+
+                for (size_t length = maxLength - 1u; length > 0u; length--) {
+                    if (lengthCounts[length] != 0u) {
+                        lengthCounts[length]--;
+                        lengthCounts[length + 1u] += 2u;
+                        break;
+                    }
+                }
+            }
+
+            // The most frequent symbols (at the end) get the shortest codes
+            size_t index = used;
+            for (size_t length = 1u; length <= maxLength; length++)
+                for (std::uint32_t i = 0u; i < lengthCounts[length]; i++)
+                    lengths[symbols[--index].m_symbol] = static_cast<std::uint8_t>(length);
+        }
+
+        // Canonical codes of the given lengths, bit-reversed since deflate writes them starting with their most significant bit
+        inline void BuildHuffmanCodes(const std::uint8_t* lengths, const size_t count, std::uint16_t* codes) noexcept
+        {
+            std::array<std::uint16_t, INFLATE_MAX_CODEWORD_LENGTH + 1u> lengthCounts{};
+            for (size_t s = 0u; s < count; s++)
+                lengthCounts[lengths[s]]++;
+
+            lengthCounts[0] = 0u;
+
+            std::array<std::uint16_t, INFLATE_MAX_CODEWORD_LENGTH + 1u> nextCodes{};
+            for (size_t length = 1u; length <= INFLATE_MAX_CODEWORD_LENGTH; length++)
+                nextCodes[length] = static_cast<std::uint16_t>((nextCodes[length - 1u] + lengthCounts[length - 1u]) << 1u);
+
+            for (size_t s = 0u; s < count; s++)
+                codes[s] = (lengths[s] != 0u) ? ::IE::ReverseBits(nextCodes[lengths[s]]++, lengths[s]) : 0u;
+        }
+
+        // Writes bits starting with the least significant ones, space must be reserved before writing
+        class DeflateBitWriter {
+        private:
+            std::vector<std::uint8_t>& m_output;
+            size_t                     m_position;
+
+            std::uint64_t m_bitBuffer = 0u;
+            size_t        m_bitCount  = 0u;
+
+        public:
+            DeflateBitWriter(std::vector<std::uint8_t>& output) noexcept
+                : m_output(output), m_position(output.size())
+            {  }
+
+            // Room for "byteCount" more bytes (and a word of slack)
+            inline void Reserve(const size_t byteCount) noexcept
+            {
+                if (this->m_output.size() < this->m_position + byteCount + 16u)
+                    this->m_output.resize(std::max(this->m_position + byteCount + 16u, this->m_output.size() * 2u));
+            }
+
+            // At most 32 bits at a time
+            inline void Write(const std::uint32_t bits, const size_t count) noexcept
+            {
+                this->m_bitBuffer |= static_cast<std::uint64_t>(bits) << this->m_bitCount;
+                this->m_bitCount  += count;
+
+                if (this->m_bitCount >= 32u) {
+                    const std::uint32_t word = ::IE::FromLittleEndian(static_cast<std::uint32_t>(this->m_bitBuffer));
+                    std::memcpy(this->m_output.data() + this->m_position, &word, sizeof(word));
+
+                    this->m_position  += 4u;
+                    this->m_bitBuffer >>= 32u;
+                    this->m_bitCount  -= 32u;
+                }
+            }
+
+            // Pads the last byte with zeros
+            inline void AlignToByte() noexcept
+            {
+                for (; this->m_bitCount > 0u; this->m_bitCount -= std::min<size_t>(this->m_bitCount, 8u)) {
+                    this->m_output[this->m_position++] = static_cast<std::uint8_t>(this->m_bitBuffer);
+                    this->m_bitBuffer >>= 8u;
+                }
+            }
+
+            // Once aligned
+            inline void WriteBytes(const std::uint8_t* data, const size_t size) noexcept
+            {
+                std::memcpy(this->m_output.data() + this->m_position, data, size);
+                this->m_position += size;
+            }
+
+            inline size_t GetBitCount() const noexcept { return this->m_bitCount; }
+
+            // Removes the slack, the output ends with the bytes written so far
+            inline void Finish() noexcept
+            {
+                this->AlignToByte();
+                this->m_output.resize(this->m_position);
+            }
+        };
+
+        // Codes of a huffman block, and of the header of dynamic ones
+        struct DeflateBlockCodes {
+            std::array<std::uint8_t,  288u> m_litLenLengths;
+            std::array<std::uint16_t, 288u> m_litLenCodes;
+            std::array<std::uint8_t,  32u>  m_distanceLengths;
+            std::array<std::uint16_t, 32u>  m_distanceCodes;
+
+            size_t m_litLenCount   = 288u;
+            size_t m_distanceCount = 32u;
+
+            // The code lengths, run-length encoded : precode symbol in the low byte, repeat count in the high one
+            std::array<std::uint16_t, 288u + 32u> m_lengthSymbols;
+            size_t                                m_lengthSymbolCount = 0u;
+
+            std::array<std::uint8_t,  19u> m_precodeLengths;
+            std::array<std::uint16_t, 19u> m_precodeCodes;
+            size_t                         m_precodeCount = 19u;
+
+            // Fixed codes when false
+            bool m_bDynamic = false;
+
+            // Bits of the header & the tokens of the block
+            std::uint64_t GetBlockBitCount(const std::uint32_t* litLenFrequencies, const std::uint32_t* distanceFrequencies) const noexcept
+            {
+                std::uint64_t bits = 3u;
+
+                if (this->m_bDynamic) {
+                    bits += 5u + 5u + 4u + 3u * this->m_precodeCount;
+
+                    for (size_t i = 0u; i < this->m_lengthSymbolCount; i++) {
+                        const size_t symbol = this->m_lengthSymbols[i] & 0xFFu;
+
+                        bits += this->m_precodeLengths[symbol] + ((symbol == 16u) ? 2u : (symbol == 17u) ? 3u : (symbol == 18u) ? 7u : 0u);
+                    }
+                }
+
+                for (size_t s = 0u; s < 286u; s++)
+                    bits += static_cast<std::uint64_t>(litLenFrequencies[s]) * (this->m_litLenLengths[s] + ((s >= 257u) ? INFLATE_LENGTH_EXTRA_BITS[s - 257u] : 0u));
+
+                for (size_t s = 0u; s < 30u; s++)
+                    bits += static_cast<std::uint64_t>(distanceFrequencies[s]) * (this->m_distanceLengths[s] + INFLATE_DISTANCE_EXTRA_BITS[s]);
+
+                return bits;
+            }
+        };
+
+        inline const ::IE::Internal::DeflateBlockCodes& GetFixedDeflateCodes() noexcept
+        {
+            static const ::IE::Internal::DeflateBlockCodes codes = []() noexcept {
+                ::IE::Internal::DeflateBlockCodes result;
+
+                std::fill(result.m_litLenLengths.begin()       , result.m_litLenLengths.begin() + 144u, 8u);
+                std::fill(result.m_litLenLengths.begin() + 144u, result.m_litLenLengths.begin() + 256u, 9u);
+                std::fill(result.m_litLenLengths.begin() + 256u, result.m_litLenLengths.begin() + 280u, 7u);
+                std::fill(result.m_litLenLengths.begin() + 280u, result.m_litLenLengths.end()         , 8u);
+                std::fill(result.m_distanceLengths.begin()     , result.m_distanceLengths.end()       , 5u);
+
+                ::IE::Internal::BuildHuffmanCodes(result.m_litLenLengths.data(), 288u, result.m_litLenCodes.data());
+                ::IE::Internal::BuildHuffmanCodes(result.m_distanceLengths.data(), 32u, result.m_distanceCodes.data());
+
+                return result;
+            }();
+
+            return codes;
+        }
+
+        inline void BuildDynamicDeflateCodes(::IE::Internal::DeflateBlockCodes& codes, const std::uint32_t* litLenFrequencies, const std::uint32_t* distanceFrequencies) noexcept
+        {
+            codes.m_bDynamic = true;
+
+            ::IE::Internal::BuildHuffmanLengths(litLenFrequencies, 286u, INFLATE_MAX_CODEWORD_LENGTH, codes.m_litLenLengths.data());
+            ::IE::Internal::BuildHuffmanLengths(distanceFrequencies, 30u, INFLATE_MAX_CODEWORD_LENGTH, codes.m_distanceLengths.data());
+            ::IE::Internal::BuildHuffmanCodes(codes.m_litLenLengths.data(), 286u, codes.m_litLenCodes.data());
+            ::IE::Internal::BuildHuffmanCodes(codes.m_distanceLengths.data(), 30u, codes.m_distanceCodes.data());
+
+            codes.m_litLenCount = 286u;
+            while (codes.m_litLenCount > 257u && codes.m_litLenLengths[codes.m_litLenCount - 1u] == 0u)
+                codes.m_litLenCount--;
+
+            codes.m_distanceCount = 30u;
+            while (codes.m_distanceCount > 1u && codes.m_distanceLengths[codes.m_distanceCount - 1u] == 0u)
+                codes.m_distanceCount--;
+
+            // Both sequences of lengths are encoded as one, with runs of zeros (17, 18) & repeats of the previous length (16)
+            std::array<std::uint8_t, 288u + 32u> lengths;
+            std::copy_n(codes.m_litLenLengths.begin(), codes.m_litLenCount, lengths.begin());
+            std::copy_n(codes.m_distanceLengths.begin(), codes.m_distanceCount, lengths.begin() + codes.m_litLenCount);
+
+            const size_t lengthCount = codes.m_litLenCount + codes.m_distanceCount;
+
+            std::array<std::uint32_t, 19u> precodeFrequencies{};
+            codes.m_lengthSymbolCount = 0u;
+
+            const auto emit = [&](const size_t symbol, const size_t extra) noexcept {
+                codes.m_lengthSymbols[codes.m_lengthSymbolCount++] = static_cast<std::uint16_t>(symbol | (extra << 8u));
+                precodeFrequencies[symbol]++;
+            };
+
+            for (size_t i = 0u; i < lengthCount; ) {
+                const std::uint8_t length = lengths[i];
+
+                size_t run = 1u;
+                while (i + run < lengthCount && lengths[i + run] == length)
+                    run++;
+
+                i += run;
+
+                if (length == 0u) {
+                    for (; run >= 11u; run -= std::min<size_t>(run, 138u))
+                        emit(18u, std::min<size_t>(run, 138u) - 11u);
+
+                    if (run >= 3u) {
+                        emit(17u, run - 3u);
+                        run = 0u;
+                    }
+                } else {
+                    emit(length, 0u);
+                    run--;
+
+                    for (; run >= 3u; run -= std::min<size_t>(run, 6u))
+                        emit(16u, std::min<size_t>(run, 6u) - 3u);
+                }
+
+                for (; run > 0u; run--)
+                    emit(length, 0u);
+            }
+
+            ::IE::Internal::BuildHuffmanLengths(precodeFrequencies.data(), 19u, 7u, codes.m_precodeLengths.data());
+            ::IE::Internal::BuildHuffmanCodes(codes.m_precodeLengths.data(), 19u, codes.m_precodeCodes.data());
+
+            codes.m_precodeCount = 19u;
+            while (codes.m_precodeCount > 4u && codes.m_precodeLengths[INFLATE_PRECODE_ORDER[codes.m_precodeCount - 1u]] == 0u)
+                codes.m_precodeCount--;
+        }
+
+        /* Compresses [start, end) of "data" (whose size is "size") as deflate blocks, with matches    */
+        /* that can reach back into the window before "start". Unless it is the final part of the     */
+        /* stream, the output ends with an empty stored block so that it ends on a byte boundary.     */
+        class DeflateCompressor {
+        private:
+            const std::uint8_t* const m_pData;
+            const size_t              m_size;
+
+            ::IE::Internal::DeflateBitWriter m_writer;
+
+            std::vector<std::uint32_t> m_tokens;
+
+            std::array<std::uint32_t, 286u> m_litLenFrequencies;
+            std::array<std::uint32_t, 30u>  m_distanceFrequencies;
+
+            ::IE::Internal::DeflateBlockCodes m_dynamicCodes;
+
+            // Bytes covered by the pending tokens start here
+            size_t m_blockStart = 0u;
+
+            // Hash chains (positions relative to the window's start, -1 ends a chain)
+            std::vector<std::int32_t> m_head;
+            std::vector<std::int32_t> m_previous;
+            size_t                    m_windowStart = 0u;
+
+            inline std::uint32_t Hash(const size_t position) const noexcept
+            {
+                std::uint32_t word;
+                std::memcpy(&word, this->m_pData + position, sizeof(word));
+
+                // The first 3 bytes, which is the shortest match
+                return ((::IE::FromLittleEndian(word) & 0xFFFFFFu) * 0x9E3779B1u) >> (32u - DEFLATE_HASH_BITS);
+            }
+
+            inline bool CanHash(const size_t position) const noexcept { return position + 4u <= this->m_size; }
+
+            inline void Insert(const size_t position) noexcept
+            {
+                const std::uint32_t hash = this->Hash(position);
+
+                this->m_previous[position - this->m_windowStart] = this->m_head[hash];
+                this->m_head[hash] = static_cast<std::int32_t>(position - this->m_windowStart);
+            }
+
+            inline size_t GetMatchLength(const std::uint8_t* a, const std::uint8_t* b, const size_t maxLength) const noexcept
+            {
+                size_t length = 0u;
+
+                for (; length + 8u <= maxLength; length += 8u) {
+                    std::uint64_t wordA, wordB;
+                    std::memcpy(&wordA, a + length, sizeof(wordA));
+                    std::memcpy(&wordB, b + length, sizeof(wordB));
+
+                    if (wordA != wordB)
+                        return length + static_cast<size_t>(std::countr_zero(::IE::FromLittleEndian(wordA ^ wordB)) >> 3);
+                }
+
+                while (length < maxLength && a[length] == b[length])
+                    length++;
+
+                return length;
+            }
+
+            // Longest match of the bytes at "position" among the hashed positions, then hashes "position"
+            std::uint32_t FindMatch(const size_t position, const size_t end, const ::IE::Internal::DeflateLevelParameters& parameters, size_t& bestLength) noexcept
+            {
+                const size_t maxLength = std::min(DEFLATE_MAX_MATCH, end - position);
+                const std::uint8_t* const current = this->m_pData + position;
+
+                std::uint32_t bestDistance = 0u;
+                bestLength = DEFLATE_MIN_MATCH - 1u;
+
+                std::int32_t candidate = this->m_head[this->Hash(position)];
+
+                for (size_t chain = parameters.m_maxChainLength; candidate >= 0 && chain > 0u; chain--) {
+                    const size_t candidatePosition = this->m_windowStart + static_cast<size_t>(candidate);
+                    const size_t distance          = position - candidatePosition;
+
+                    if (distance > DEFLATE_WINDOW_SIZE)
+                        break;
+
+                    const std::uint8_t* const match = this->m_pData + candidatePosition;
+
+                    // Only candidates that could be longer than the best one are compared
+                    if (bestLength < maxLength && match[bestLength] == current[bestLength]) {
+                        const size_t length = this->GetMatchLength(match, current, maxLength);
+
+                        if (length > bestLength) {
+                            bestLength   = length;
+                            bestDistance = static_cast<std::uint32_t>(distance);
+
+                            if (length >= parameters.m_niceLength || length == maxLength)
+                                break;
+                        }
+                    }
+
+                    candidate = this->m_previous[static_cast<size_t>(candidate)];
+                }
+
+                this->Insert(position);
+
+                // Short distant matches cost more than their literals
+                if (bestLength == DEFLATE_MIN_MATCH && bestDistance > 4096u)
+                    bestLength = 0u;
+
+                return bestDistance;
+            }
+
+            inline void AddLiteral(const std::uint8_t literal) noexcept
+            {
+                this->m_tokens.push_back(literal);
+                this->m_litLenFrequencies[literal]++;
+            }
+
+            inline void AddMatch(const size_t length, const size_t distance) noexcept
+            {
+                this->m_tokens.push_back(DEFLATE_MATCH_FLAG | static_cast<std::uint32_t>((length - DEFLATE_MIN_MATCH) << 16u) | static_cast<std::uint32_t>(distance - 1u));
+                this->m_litLenFrequencies[DEFLATE_LENGTH_SYMBOLS[length]]++;
+                this->m_distanceFrequencies[::IE::Internal::GetDeflateDistanceSymbol(distance)]++;
+            }
+
+            void WriteTokens(const ::IE::Internal::DeflateBlockCodes& codes) noexcept
+            {
+                ::IE::Internal::DeflateBitWriter& writer = this->m_writer;
+
+                for (const std::uint32_t token : this->m_tokens) {
+                    if ((token & DEFLATE_MATCH_FLAG) == 0u) {
+                        writer.Write(codes.m_litLenCodes[token], codes.m_litLenLengths[token]);
+                        continue;
+                    }
+
+                    const size_t length   = ((token >> 16u) & 0xFFu) + DEFLATE_MIN_MATCH;
+                    const size_t distance = (token & 0xFFFFu) + 1u;
+
+                    const size_t lengthSymbol   = DEFLATE_LENGTH_SYMBOLS[length];
+                    const size_t distanceSymbol = ::IE::Internal::GetDeflateDistanceSymbol(distance);
+
+                    // At most 15 + 5 bits, then 15 + 13 bits
+                    writer.Write(codes.m_litLenCodes[lengthSymbol] | static_cast<std::uint32_t>((length - INFLATE_LENGTH_BASES[lengthSymbol - 257u]) << codes.m_litLenLengths[lengthSymbol]),
+                                 codes.m_litLenLengths[lengthSymbol] + INFLATE_LENGTH_EXTRA_BITS[lengthSymbol - 257u]);
+                    writer.Write(codes.m_distanceCodes[distanceSymbol] | static_cast<std::uint32_t>((distance - INFLATE_DISTANCE_BASES[distanceSymbol]) << codes.m_distanceLengths[distanceSymbol]),
+                                 codes.m_distanceLengths[distanceSymbol] + INFLATE_DISTANCE_EXTRA_BITS[distanceSymbol]);
+                }
+
+                writer.Write(codes.m_litLenCodes[256u], codes.m_litLenLengths[256u]);
+            }
+
+            // Writes the pending tokens as the cheapest of a dynamic, fixed or stored block
+            void FlushBlock(const size_t blockEnd, const bool bFinal) noexcept
+            {
+                this->m_litLenFrequencies[256u] = 1u;
+
+                ::IE::Internal::BuildDynamicDeflateCodes(this->m_dynamicCodes, this->m_litLenFrequencies.data(), this->m_distanceFrequencies.data());
+
+                const ::IE::Internal::DeflateBlockCodes& fixedCodes = ::IE::Internal::GetFixedDeflateCodes();
+
+                const size_t        rawSize      = blockEnd - this->m_blockStart;
+                const size_t        storedCount  = std::max<size_t>(1u, (rawSize + 65534u) / 65535u);
+                const std::uint64_t dynamicBits  = this->m_dynamicCodes.GetBlockBitCount(this->m_litLenFrequencies.data(), this->m_distanceFrequencies.data());
+                const std::uint64_t fixedBits    = fixedCodes.GetBlockBitCount(this->m_litLenFrequencies.data(), this->m_distanceFrequencies.data());
+                const std::uint64_t storedBits   = storedCount * (3u + 7u + 32u) + 8u * static_cast<std::uint64_t>(rawSize);
+
+                ::IE::Internal::DeflateBitWriter& writer = this->m_writer;
+
+                // Tokens are at most 6 bytes, the dynamic header less than 400
+                writer.Reserve(std::max<size_t>(6u * this->m_tokens.size() + 512u, rawSize + 5u * storedCount));
+
+                if (storedBits < std::min(dynamicBits, fixedBits)) {
+                    for (size_t offset = 0u, i = 0u; i < storedCount; i++) {
+                        const size_t size = std::min<size_t>(rawSize - offset, 65535u);
+
+                        writer.Write((bFinal && i + 1u == storedCount) ? 1u : 0u, 3u);
+                        writer.AlignToByte();
+
+                        const std::array<std::uint8_t, 4u> header = {
+                            static_cast<std::uint8_t>(size), static_cast<std::uint8_t>(size >> 8u), static_cast<std::uint8_t>(~size), static_cast<std::uint8_t>(~size >> 8u)
+                        };
+
+                        writer.WriteBytes(header.data(), header.size());
+                        writer.WriteBytes(this->m_pData + this->m_blockStart + offset, size);
+
+                        offset += size;
+                    }
+                } else if (fixedBits <= dynamicBits) {
+                    writer.Write((bFinal ? 1u : 0u) | (1u << 1u), 3u);
+                    this->WriteTokens(fixedCodes);
+                } else {
+                    const ::IE::Internal::DeflateBlockCodes& codes = this->m_dynamicCodes;
+
+                    writer.Write((bFinal ? 1u : 0u) | (2u << 1u), 3u);
+                    writer.Write(static_cast<std::uint32_t>(codes.m_litLenCount - 257u) | static_cast<std::uint32_t>((codes.m_distanceCount - 1u) << 5u) |
+                                 static_cast<std::uint32_t>((codes.m_precodeCount - 4u) << 10u), 14u);
+
+                    for (size_t i = 0u; i < codes.m_precodeCount; i++)
+                        writer.Write(codes.m_precodeLengths[INFLATE_PRECODE_ORDER[i]], 3u);
+
+                    for (size_t i = 0u; i < codes.m_lengthSymbolCount; i++) {
+                        const size_t symbol = codes.m_lengthSymbols[i] & 0xFFu;
+                        const size_t extra  = codes.m_lengthSymbols[i] >> 8u;
+
+                        writer.Write(codes.m_precodeCodes[symbol], codes.m_precodeLengths[symbol]);
+
+                        if (symbol >= 16u)
+                            writer.Write(static_cast<std::uint32_t>(extra), (symbol == 16u) ? 2u : (symbol == 17u) ? 3u : 7u);
+                    }
+
+                    this->WriteTokens(codes);
+                }
+
+                this->m_tokens.clear();
+                this->m_litLenFrequencies.fill(0u);
+                this->m_distanceFrequencies.fill(0u);
+                this->m_blockStart = blockEnd;
+            }
+
+            // Adds a token and writes a block once enough of them are pending
+            inline void EndToken(const size_t position) noexcept
+            {
+                if (this->m_tokens.size() >= DEFLATE_BLOCK_TOKENS)
+                    this->FlushBlock(position, false);
+            }
+
+        public:
+            DeflateCompressor(const std::uint8_t* pData, const size_t size, std::vector<std::uint8_t>& output) noexcept
+                : m_pData(pData), m_size(size), m_writer(output)
+            {
+                this->m_tokens.reserve(DEFLATE_BLOCK_TOKENS);
+                this->m_litLenFrequencies.fill(0u);
+                this->m_distanceFrequencies.fill(0u);
+            }
+
+            void Compress(const size_t start, const size_t end, const ::IE::DeflateLevel level, const bool bFinal) noexcept
+            {
+                this->m_blockStart = start;
+
+                size_t position = start;
+
+                if (level == ::IE::DeflateLevel::HUFFMAN_ONLY) {
+                    for (; position < end; position++) {
+                        this->AddLiteral(this->m_pData[position]);
+                        this->EndToken(position + 1u);
+                    }
+                } else if (level == ::IE::DeflateLevel::RLE) {
+                    while (position < end) {
+                        // Runs repeat the previous byte (which can be in the window)
+                        const size_t length = (position > 0u) ? this->GetMatchLength(this->m_pData + position - 1u, this->m_pData + position, std::min(DEFLATE_MAX_MATCH, end - position)) : 0u;
+
+                        if (length >= DEFLATE_MIN_MATCH) {
+                            this->AddMatch(length, 1u);
+                            position += length;
+                        } else {
+                            this->AddLiteral(this->m_pData[position++]);
+                        }
+
+                        this->EndToken(position);
+                    }
+                } else {
+                    const ::IE::Internal::DeflateLevelParameters parameters = ::IE::Internal::GetDeflateLevelParameters(level);
+
+                    this->m_windowStart = (start > DEFLATE_WINDOW_SIZE) ? start - DEFLATE_WINDOW_SIZE : 0u;
+                    this->m_head.assign(size_t(1) << DEFLATE_HASH_BITS, -1);
+                    this->m_previous.resize(end - this->m_windowStart);
+
+                    for (size_t p = this->m_windowStart; p < start && this->CanHash(p); p++)
+                        this->Insert(p);
+
+                    size_t insertedEnd = start; // Positions before it are hashed
+
+                    while (position < end) {
+                        if (!this->CanHash(position) || end - position < DEFLATE_MIN_MATCH) {
+                            this->AddLiteral(this->m_pData[position++]);
+                            this->EndToken(position);
+                            continue;
+                        }
+
+                        size_t        length;
+                        std::uint32_t distance = this->FindMatch(position, end, parameters, length);
+                        insertedEnd = position + 1u;
+
+                        // A match is deferred when the next byte starts a longer one
+                        while (parameters.m_bLazy && length >= DEFLATE_MIN_MATCH && length < parameters.m_niceLength &&
+                               position + 1u < end && this->CanHash(position + 1u)) {
+                            size_t nextLength;
+                            const std::uint32_t nextDistance = this->FindMatch(position + 1u, end, parameters, nextLength);
+                            insertedEnd = position + 2u;
+
+                            if (nextLength <= length)
+                                break;
+
+                            this->AddLiteral(this->m_pData[position++]);
+                            this->EndToken(position);
+
+                            length   = nextLength;
+                            distance = nextDistance;
+                        }
+
+                        if (length < DEFLATE_MIN_MATCH) {
+                            this->AddLiteral(this->m_pData[position++]);
+                            this->EndToken(position);
+                            continue;
+                        }
+
+                        this->AddMatch(length, distance);
+
+                        const size_t matchEnd = position + length;
+
+                        for (size_t p = insertedEnd; p < matchEnd && this->CanHash(p); p++)
+                            this->Insert(p);
+
+                        insertedEnd = std::max(insertedEnd, matchEnd);
+                        position    = matchEnd;
+
+                        this->EndToken(position);
+                    }
+                }
+
+                if (!this->m_tokens.empty() || position == this->m_blockStart || bFinal)
+                    this->FlushBlock(end, bFinal);
+
+                // Empty stored block (what zlib calls a sync flush)
+                if (!bFinal) {
+                    this->m_writer.Reserve(8u);
+                    this->m_writer.Write(0u, 3u);
+                    this->m_writer.AlignToByte();
+
+                    const std::array<std::uint8_t, 4u> header = { 0x00u, 0x00u, 0xFFu, 0xFFu };
+                    this->m_writer.WriteBytes(header.data(), header.size());
+                }
+
+                this->m_writer.Finish();
+            }
+        };
+
+        // Independently compressed part of a stream
+        struct DeflateChunk {
+            std::vector<std::uint8_t> m_data;
+            std::uint32_t             m_crc   = 0u; // Finalized CRC32 of "m_data"
+            std::uint32_t             m_alder = 0u; // ALDER-32 of the uncompressed bytes
+        };
+
+        // Compresses "input" as chunks on "threadCount" threads (0 : all), with their checksums if asked
+        inline std::vector<::IE::Internal::DeflateChunk> DeflateParallel(const std::span<const std::uint8_t> input, const ::IE::DeflateLevel level,
+                                                                         const size_t threadCount, const bool bChecksums) noexcept
+        {
+            const size_t chunkCount = std::max<size_t>(1u, (input.size() + DEFLATE_CHUNK_SIZE - 1u) / DEFLATE_CHUNK_SIZE);
+
+            std::vector<::IE::Internal::DeflateChunk> chunks(chunkCount);
+
+            ::IE::Internal::ParallelFor(chunkCount, (threadCount == 0u) ? ::IE::GetHardwareThreadCount() : threadCount, [&](const size_t c) noexcept {
+                const size_t start = c * DEFLATE_CHUNK_SIZE;
+                const size_t end   = std::min(start + DEFLATE_CHUNK_SIZE, input.size());
+
+                ::IE::Internal::DeflateChunk& chunk = chunks[c];
+
+                ::IE::Internal::DeflateCompressor compressor(input.data(), input.size(), chunk.m_data);
+                compressor.Compress(start, end, level, c + 1u == chunkCount);
+
+                if (bChecksums) {
+                    chunk.m_crc   = ::IE::CRC32::Finalize(::IE::CRC32::Calculate(chunk.m_data.data(), chunk.m_data.size()));
+                    chunk.m_alder = ::IE::ALDER32::Calculate(input.data() + start, end - start);
+                }
+            });
+
+            return chunks;
+        }
+
+        // Header of zlib streams (RFC 1950) with a 32KiB window, hinting at the level
+        inline std::array<std::uint8_t, 2u> GetZlibHeader(const ::IE::DeflateLevel level) noexcept
+        {
+            const std::uint32_t compressionLevel = (level <= ::IE::DeflateLevel::RLE) ? 0u : static_cast<std::uint32_t>(level) - 1u;
+            const std::uint32_t header = (0x78u << 8u) | (compressionLevel << 6u);
+
+            return { 0x78u, static_cast<std::uint8_t>((header | (31u - header % 31u) % 31u) & 0xFFu) };
+        }
+
+    } // Internal
+
+    /* Appends "input" compressed as a raw deflate stream (RFC 1951) to "output". Inputs larger */
+    /* than "DEFLATE_CHUNK_SIZE" are compressed on "threadCount" threads (0 : all of them).      */
+    inline void Deflate(const std::span<const std::uint8_t> input, std::vector<std::uint8_t>& output,
+                        const ::IE::DeflateLevel level = ::IE::DeflateLevel::DEFAULT, const size_t threadCount = 0u) noexcept
+    {
+        for (const ::IE::Internal::DeflateChunk& chunk : ::IE::Internal::DeflateParallel(input, level, threadCount, false))
+            output.insert(output.end(), chunk.m_data.begin(), chunk.m_data.end());
+    }
+
+    // Same as "Deflate" with a zlib header & trailer (RFC 1950), whose ALDER-32 is combined from the chunks'
+    inline void ZlibCompress(const std::span<const std::uint8_t> input, std::vector<std::uint8_t>& output,
+                             const ::IE::DeflateLevel level = ::IE::DeflateLevel::DEFAULT, const size_t threadCount = 0u) noexcept
+    {
+        const std::vector<::IE::Internal::DeflateChunk> chunks = ::IE::Internal::DeflateParallel(input, level, threadCount, true);
+
+        const std::array<std::uint8_t, 2u> header = ::IE::Internal::GetZlibHeader(level);
+        output.insert(output.end(), header.begin(), header.end());
+
+        std::uint32_t alder = ::IE::ALDER32::Init();
+
+        for (size_t c = 0u; c < chunks.size(); c++) {
+            const size_t chunkSize = std::min(::IE::Internal::DEFLATE_CHUNK_SIZE, input.size() - c * ::IE::Internal::DEFLATE_CHUNK_SIZE);
+
+            alder = ::IE::ALDER32::Combine(alder, chunks[c].m_alder, chunkSize);
+            output.insert(output.end(), chunks[c].m_data.begin(), chunks[c].m_data.end());
+        }
+
+        const std::uint32_t trailer = ::IE::FromBigEndian(alder);
+        output.insert(output.end(), reinterpret_cast<const std::uint8_t*>(&trailer), reinterpret_cast<const std::uint8_t*>(&trailer) + sizeof(trailer));
+    }
+
+    // +-----+
+    // | PNG |
+    // +-----+
+
+    enum class PNGColorType : std::uint8_t {
+        GRAYSCALE       = 0u,
+        RGB             = 2u,
+        PALETTE         = 3u,
+        GRAYSCALE_ALPHA = 4u,
+        RGBA            = 6u
+    };
+
+    // Fields of the "IHDR" chunk
+    struct PNGHeader {
+        std::uint32_t      m_width      = 0u;
+        std::uint32_t      m_height     = 0u;
+        std::uint8_t       m_bitDepth   = 0u; // Bits per sample (per palette index for PALETTE images)
+        ::IE::PNGColorType m_colorType  = ::IE::PNGColorType::GRAYSCALE;
+        bool               m_bInterlaced = false; // Adam7
+
+        inline size_t GetChannelCount() const noexcept
+        {
+            switch (this->m_colorType) {
+            case ::IE::PNGColorType::RGB:             return 3u;
+            case ::IE::PNGColorType::GRAYSCALE_ALPHA: return 2u;
+            case ::IE::PNGColorType::RGBA:            return 4u;
+            default:                                  return 1u;
+            }
+        }
+
+        inline size_t GetBitsPerPixel() const noexcept { return this->GetChannelCount() * this->m_bitDepth; }
+
+        // Bytes of a row of "width" pixels (without its filter type byte)
+        inline size_t GetRowBytes(const size_t width) const noexcept { return (width * this->GetBitsPerPixel() + 7u) / 8u; }
+
+        // Whether the dimensions, the color type & its bit depth are allowed by the specification
+        inline bool IsValid() const noexcept
+        {
+            if (this->m_width == 0u || this->m_height == 0u || this->m_width > 0x7FFFFFFFu || this->m_height > 0x7FFFFFFFu)
+                return false;
+
+            const std::uint8_t depth = this->m_bitDepth;
+
+            switch (this->m_colorType) {
+            case ::IE::PNGColorType::GRAYSCALE:
+                return depth == 1u || depth == 2u || depth == 4u || depth == 8u || depth == 16u;
+            case ::IE::PNGColorType::PALETTE:
+                return depth == 1u || depth == 2u || depth == 4u || depth == 8u;
+            case ::IE::PNGColorType::RGB:
+            case ::IE::PNGColorType::GRAYSCALE_ALPHA:
+            case ::IE::PNGColorType::RGBA:
+                return depth == 8u || depth == 16u;
+            default:
+                return false;
+            }
+        }
+    };
+
+    // +-----+     +----------+
+    // | PNG | --> | Unfilter |
+    // +-----+     +----------+
+
+    namespace Internal {
+
+        // Bytes the unfiltering kernels may read & write past the end of a row (& read past the previous one)
+        constexpr const size_t PNG_ROW_PADDING = 16u;
+
+        enum PNGFilter : std::uint8_t { PNG_FILTER_NONE = 0u, PNG_FILTER_SUB, PNG_FILTER_UP, PNG_FILTER_AVERAGE, PNG_FILTER_PAETH };
+
+        inline std::uint8_t PaethPredictor(const std::uint8_t a, const std::uint8_t b, const std::uint8_t c) noexcept
+        {
+            const int pa = std::abs(static_cast<int>(b) - static_cast<int>(c));
+            const int pb = std::abs(static_cast<int>(a) - static_cast<int>(c));
+            const int pc = std::abs(static_cast<int>(a) + static_cast<int>(b) - 2 * static_cast<int>(c));
+
+            return (pa <= pb && pa <= pc) ? a : ((pb <= pc) ? b : c);
+        }
+
+        /* Reverses the filter of a row of "length" bytes whose pixels are "bpp" bytes apart (1 for  */
+        /* pixels smaller than a byte). "prev" is the previous unfiltered row (zeros for the first). */
+        inline void UnfilterPNGRowScalar(const std::uint8_t filter, const std::uint8_t* filtered, std::uint8_t* row, const std::uint8_t* prev,
+                                         const size_t length, const size_t bpp) noexcept
+        {
+            const size_t start = std::min(bpp, length);
+
+            switch (filter) {
+            case PNG_FILTER_NONE:
+                std::memcpy(row, filtered, length);
+                break;
+            case PNG_FILTER_SUB:
+                std::memcpy(row, filtered, start);
+
+                for (size_t i = start; i < length; i++)
+                    row[i] = static_cast<std::uint8_t>(filtered[i] + row[i - bpp]);
+
+                break;
+            case PNG_FILTER_UP:
+                for (size_t i = 0u; i < length; i++)
+                    row[i] = static_cast<std::uint8_t>(filtered[i] + prev[i]);
+
+                break;
+            case PNG_FILTER_AVERAGE:
+                for (size_t i = 0u; i < start; i++)
+                    row[i] = static_cast<std::uint8_t>(filtered[i] + (prev[i] >> 1u));
+
+                for (size_t i = start; i < length; i++)
+                    row[i] = static_cast<std::uint8_t>(filtered[i] + ((static_cast<unsigned>(row[i - bpp]) + prev[i]) >> 1u));
+
+                break;
+            case PNG_FILTER_PAETH:
+                for (size_t i = 0u; i < start; i++)
+                    row[i] = static_cast<std::uint8_t>(filtered[i] + prev[i]);
+
+                for (size_t i = start; i < length; i++)
+                    row[i] = static_cast<std::uint8_t>(filtered[i] + ::IE::Internal::PaethPredictor(row[i - bpp], prev[i], prev[i - bpp]));
+
+                break;
+            }
+        }
+
+#ifdef __IE__ENABLE_SIMD
+
+        /* Sub, Average & Paeth depend on the pixel to the left, so the bytes of a pixel are processed */
+        /* together : one pixel per iteration, loaded & stored with 8 byte moves (rows are padded).    */
+        /* Up has no such dependency and is done 16 bytes at a time.                                   */
+        __IE__TARGET_SSE41 inline void UnfilterPNGRowSSE41(const std::uint8_t filter, const std::uint8_t* filtered, std::uint8_t* row, const std::uint8_t* prev,
+                                                           const size_t length, const size_t bpp) noexcept
+        {
+            const bool bPixelSizeSupported = bpp == 3u || bpp == 4u || bpp == 6u || bpp == 8u;
+
+            if (filter == PNG_FILTER_UP) {
+                for (size_t i = 0u; i < length; i += 16u) {
+                    const __m128i sum = _mm_add_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(filtered + i)),
+                                                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(prev + i)));
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(row + i), sum);
+                }
+
+                return;
+            }
+
+            if (filter == PNG_FILTER_NONE || !bPixelSizeSupported) {
+                ::IE::Internal::UnfilterPNGRowScalar(filter, filtered, row, prev, length, bpp);
+                return;
+            }
+
+            __m128i a = _mm_setzero_si128(); // Left
+            __m128i c = _mm_setzero_si128(); // Up-Left
+
+            if (filter == PNG_FILTER_SUB) {
+                for (size_t i = 0u; i < length; i += bpp) {
+                    a = _mm_add_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(filtered + i)), a);
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(row + i), a);
+                }
+            } else if (filter == PNG_FILTER_AVERAGE) {
+                const __m128i one = _mm_set1_epi8(1);
+
+                for (size_t i = 0u; i < length; i += bpp) {
+                    const __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(prev + i));
+
+                    // "avg_epu8" rounds up, the filter rounds down
+                    const __m128i average = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+
+                    a = _mm_add_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(filtered + i)), average);
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(row + i), a);
+                }
+            } else if (filter == PNG_FILTER_PAETH) {
+                // In 16 bit lanes : a + b - 2c doesn't fit in a byte
+                for (size_t i = 0u; i < length; i += bpp) {
+                    const __m128i b = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(prev + i)));
+
+                    const __m128i bc = _mm_sub_epi16(b, c);
+                    const __m128i ac = _mm_sub_epi16(a, c);
+
+                    const __m128i pa = _mm_abs_epi16(bc);
+                    const __m128i pb = _mm_abs_epi16(ac);
+                    const __m128i pc = _mm_abs_epi16(_mm_add_epi16(ac, bc));
+
+                    // a if pa <= pb & pa <= pc, otherwise b if pb <= pc, otherwise c
+                    __m128i predictor = _mm_blendv_epi8(a, b, _mm_cmpgt_epi16(pa, pb));
+                    predictor = _mm_blendv_epi8(predictor, c, _mm_and_si128(_mm_cmpgt_epi16(pa, pc), _mm_cmpgt_epi16(pb, pc)));
+
+                    const __m128i pixel = _mm_add_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(filtered + i)), _mm_packus_epi16(predictor, predictor));
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(row + i), pixel);
+
+                    a = _mm_cvtepu8_epi16(pixel);
+                    c = b;
+                }
+            }
+        }
+
+#endif // #ifdef __IE__ENABLE_SIMD
+
+    } // Internal
+
+    // +-----+     +---------+
+    // | PNG | --> | Decoder |
+    // +-----+     +---------+
+
+    namespace Internal {
+
+        constexpr const std::array<std::uint8_t, 8u> PNG_SIGNATURE = { 0x89u, 'P', 'N', 'G', 0x0Du, 0x0Au, 0x1Au, 0x0Au };
+
+        // Chunk types as read from the file (big endian)
+        constexpr std::uint32_t MakePNGChunkType(const char (&name)[5u]) noexcept
+        {
+            return (static_cast<std::uint32_t>(name[0]) << 24u) | (static_cast<std::uint32_t>(name[1]) << 16u) |
+                   (static_cast<std::uint32_t>(name[2]) << 8u)  |  static_cast<std::uint32_t>(name[3]);
+        }
+
+        constexpr const std::uint32_t PNG_CHUNK_IHDR = ::IE::Internal::MakePNGChunkType("IHDR");
+        constexpr const std::uint32_t PNG_CHUNK_PLTE = ::IE::Internal::MakePNGChunkType("PLTE");
+        constexpr const std::uint32_t PNG_CHUNK_IDAT = ::IE::Internal::MakePNGChunkType("IDAT");
+        constexpr const std::uint32_t PNG_CHUNK_IEND = ::IE::Internal::MakePNGChunkType("IEND");
+        constexpr const std::uint32_t PNG_CHUNK_TRNS = ::IE::Internal::MakePNGChunkType("tRNS");
+
+        // The first letter of ancillary chunks is lowercase
+        constexpr const std::uint32_t PNG_CHUNK_ANCILLARY_BIT = 0x20u << 24u;
+
+        struct PNGPass {
+            std::uint8_t m_xStart, m_yStart, m_xStep, m_yStep;
+        };
+
+        constexpr const std::array<::IE::Internal::PNGPass, 7u> PNG_ADAM7_PASSES = {{
+            { 0u, 0u, 8u, 8u }, { 4u, 0u, 8u, 8u }, { 0u, 4u, 4u, 8u }, { 2u, 0u, 4u, 4u }, { 0u, 2u, 2u, 4u }, { 1u, 0u, 2u, 2u }, { 0u, 1u, 1u, 2u }
+        }};
+
+        constexpr const ::IE::Internal::PNGPass PNG_NON_INTERLACED_PASS = { 0u, 0u, 1u, 1u };
+
+        inline size_t GetPNGPassSize(const size_t size, const size_t start, const size_t step) noexcept
+        {
+            return (size > start) ? (size - start + step - 1u) / step : 0u;
+        }
+
+    } // Internal
+
+    /* Streaming PNG decoder. Bytes are "Feed"-ed in pieces of any size as they arrive (from a file, */
+    /* the network...) and rows are unfiltered as soon as they are inflated : "GetDecodedRowCount"   */
+    /* rows of "GetPixels" are final (all of them once the image is DONE for interlaced images).     */
+    /* The pixels are converted to 8 bit RGBA, or kept in the file's format ("Format::NATIVE", rows */
+    /* of "PNGHeader::GetRowBytes(width)" bytes, samples big endian).                               */
+    /* The chunk crcs & the zlib alder-32 can be left unchecked for trusted data. Ancillary chunks  */
+    /* other than "tRNS" are skipped.                                                               */
+    /*     IE::PNGDecoder::Decode(fileBytes, header, pixels); // whole files                         */
+    class PNGDecoder {
+    public:
+        enum class Format : std::uint8_t { RGBA8, NATIVE };
+
+        enum class Result : std::uint8_t { NEEDS_INPUT, DONE, FAILED };
+
+        struct Options {
+            Format m_format           = Format::RGBA8;
+            bool   m_bVerifyChecksums = true;
+            size_t m_maxImageBytes    = size_t(1) << 30u; // Images needing more memory (inflated data & pixels) are rejected
+        };
+
+    private:
+        enum class ChunkState : std::uint8_t { SIGNATURE, CHUNK_HEADER, CHUNK_DATA, CHUNK_CRC, END };
+
+        Options    m_options;
+        Result     m_result     = Result::NEEDS_INPUT;
+        ChunkState m_chunkState = ChunkState::SIGNATURE;
+
+        // Signature, chunk header & crc bytes that arrived in separate pieces
+        std::array<std::uint8_t, 8u> m_gathered;
+        size_t                       m_gatheredSize = 0u;
+
+        std::uint32_t m_chunkType      = 0u;
+        std::uint32_t m_chunkRemaining = 0u;
+        std::uint32_t m_chunkCRC       = 0u;
+        std::vector<std::uint8_t> m_chunkData; // Chunks that are parsed once complete (IHDR, PLTE, tRNS)
+
+        bool m_bHeaderReady  = false;
+        bool m_bIDATStarted  = false;
+        bool m_bIDATFinished = false; // A chunk followed the IDAT chunks, all the compressed data is known
+
+        ::IE::PNGHeader m_header;
+
+        std::array<std::array<std::uint8_t, 4u>, 256u> m_palette;
+        size_t                                         m_paletteSize = 0u;
+
+        std::array<std::uint16_t, 3u> m_transparentKey = { 0u, 0u, 0u }; // tRNS of GRAYSCALE & RGB images
+        bool                          m_bHasTransparentKey = false;
+
+        // Compressed bytes not inflated yet are [m_compressedBegin, m_compressedEnd), followed by "Inflater::INPUT_PADDING" zeros
+        std::vector<std::uint8_t> m_compressed;
+        size_t                    m_compressedBegin = 0u;
+        size_t                    m_compressedEnd   = 0u;
+
+        bool          m_bZlibHeaderRead = false;
+        bool          m_bInflateDone    = false;
+        bool          m_bTrailerRead    = false;
+        std::uint32_t m_alder           = ::IE::ALDER32::Init();
+        size_t        m_alderSize       = 0u;
+
+        ::IE::Inflater m_inflater;
+
+        // The whole inflated stream (back-references can go 32KiB back, across rows)
+        std::vector<std::uint8_t> m_filtered;
+        size_t                    m_filteredSize = 0u;
+
+        // Unfiltering progress
+        size_t m_pass           = 0u;
+        size_t m_passRow        = 0u;
+        size_t m_filteredOffset = 0u;
+        bool   m_bDirect        = false; // Rows are unfiltered straight into "m_pixels"
+
+        // Unfiltered rows of interlaced or converted images : current, previous & zeros (only zeros when direct)
+        std::vector<std::uint8_t> m_rows;
+        size_t                    m_rowStride = 0u;
+        std::uint8_t*             m_pRow      = nullptr;
+        std::uint8_t*             m_pPrevRow  = nullptr;
+
+        std::vector<std::uint8_t> m_pixels;
+        size_t                    m_rowPitch        = 0u;
+        size_t                    m_decodedRowCount = 0u;
+
+        inline Result Fail() noexcept
+        {
+            this->m_result = Result::FAILED;
+
+            return Result::FAILED;
+        }
+
+        inline const ::IE::Internal::PNGPass& GetPass(const size_t pass) const noexcept
+        {
+            return this->m_header.m_bInterlaced ? ::IE::Internal::PNG_ADAM7_PASSES[pass] : ::IE::Internal::PNG_NON_INTERLACED_PASS;
+        }
+
+        inline size_t GetPassCount() const noexcept { return this->m_header.m_bInterlaced ? ::IE::Internal::PNG_ADAM7_PASSES.size() : 1u; }
+
+        inline size_t GetPassWidth(const size_t pass) const noexcept
+        {
+            return ::IE::Internal::GetPNGPassSize(this->m_header.m_width, this->GetPass(pass).m_xStart, this->GetPass(pass).m_xStep);
+        }
+
+        inline size_t GetPassHeight(const size_t pass) const noexcept
+        {
+            return ::IE::Internal::GetPNGPassSize(this->m_header.m_height, this->GetPass(pass).m_yStart, this->GetPass(pass).m_yStep);
+        }
+
+        // Copies up to "count" bytes to "m_gathered", returns wether it holds "count" bytes
+        bool Gather(const std::uint8_t*& p, const std::uint8_t* const pEnd, const size_t count) noexcept
+        {
+            const size_t n = std::min(count - this->m_gatheredSize, static_cast<size_t>(pEnd - p));
+
+            std::memcpy(this->m_gathered.data() + this->m_gatheredSize, p, n);
+            this->m_gatheredSize += n;
+            p += n;
+
+            if (this->m_gatheredSize < count)
+                return false;
+
+            this->m_gatheredSize = 0u;
+            return true;
+        }
+
+        inline std::uint32_t ReadGatheredU32(const size_t offset) const noexcept
+        {
+            std::uint32_t value;
+            std::memcpy(&value, this->m_gathered.data() + offset, sizeof(value));
+
+            return ::IE::FromBigEndian(value);
+        }
+
+        bool ParseHeader() noexcept
+        {
+            if (this->m_chunkData.size() != 13u)
+                return false;
+
+            const std::uint8_t* const data = this->m_chunkData.data();
+
+            std::memcpy(this->m_gathered.data(), data, 8u);
+            this->m_header.m_width       = this->ReadGatheredU32(0u);
+            this->m_header.m_height      = this->ReadGatheredU32(4u);
+            this->m_header.m_bitDepth    = data[8];
+            this->m_header.m_colorType   = static_cast<::IE::PNGColorType>(data[9]);
+            this->m_header.m_bInterlaced = data[12] == 1u;
+
+            // Compression method, filter method & interlace method
+            if (!this->m_header.IsValid() || data[10] != 0u || data[11] != 0u || data[12] > 1u)
+                return false;
+
+            // Memory needed, with every product checked against the limit before it is computed
+            const size_t maxBytes = this->m_options.m_maxImageBytes;
+            const size_t width    = this->m_header.m_width;
+            const size_t height   = this->m_header.m_height;
+
+            size_t filteredSize = 0u;
+            for (size_t pass = 0u; pass < this->GetPassCount(); pass++) {
+                const size_t passWidth  = this->GetPassWidth(pass);
+                const size_t passHeight = this->GetPassHeight(pass);
+
+                if (passWidth == 0u || passHeight == 0u)
+                    continue;
+
+                const size_t rowBytes = 1u + this->m_header.GetRowBytes(passWidth);
+
+                if (rowBytes > maxBytes / passHeight)
+                    return false;
+
+                filteredSize += rowBytes * passHeight;
+            }
+
+            this->m_rowPitch = (this->m_options.m_format == Format::RGBA8) ? width * 4u : this->m_header.GetRowBytes(width);
+
+            if (this->m_rowPitch > maxBytes / height || filteredSize > maxBytes || this->m_rowPitch * height > maxBytes - filteredSize)
+                return false;
+
+            this->m_filteredSize = filteredSize;
+            this->m_filtered.resize(filteredSize + ::IE::Inflater::OUTPUT_SLACK);
+            this->m_pixels.assign(this->m_rowPitch * height + ::IE::Internal::PNG_ROW_PADDING, 0u);
+
+            this->m_inflater.Reset(this->m_filtered.data(), filteredSize);
+
+            this->m_bDirect = !this->m_header.m_bInterlaced &&
+                              (this->m_options.m_format == Format::NATIVE ||
+                               (this->m_header.m_colorType == ::IE::PNGColorType::RGBA && this->m_header.m_bitDepth == 8u));
+
+            this->m_rowStride = this->m_header.GetRowBytes(width) + ::IE::Internal::PNG_ROW_PADDING;
+
+            // Direct unfiltering only needs the zeros
+            this->m_rows.assign((this->m_bDirect ? 1u : 3u) * this->m_rowStride, 0u);
+            this->m_pRow     = this->m_rows.data();
+            this->m_pPrevRow = this->m_rows.data() + this->m_rowStride;
+
+            this->m_bHeaderReady = true;
+            return true;
+        }
+
+        bool ParsePalette() noexcept
+        {
+            const size_t size = this->m_chunkData.size();
+
+            if (this->m_paletteSize != 0u || this->m_bIDATStarted || size == 0u || size % 3u != 0u || size > 768u)
+                return false;
+
+            this->m_paletteSize = size / 3u;
+
+            for (size_t i = 0u; i < this->m_paletteSize; i++)
+                this->m_palette[i] = { this->m_chunkData[3u * i], this->m_chunkData[3u * i + 1u], this->m_chunkData[3u * i + 2u], 0xFFu };
+
+            return true;
+        }
+
+        bool ParseTransparency() noexcept
+        {
+            const size_t size = this->m_chunkData.size();
+
+            if (this->m_bIDATStarted)
+                return false;
+
+            switch (this->m_header.m_colorType) {
+            case ::IE::PNGColorType::PALETTE:
+                if (size > this->m_paletteSize)
+                    return false;
+
+                for (size_t i = 0u; i < size; i++)
+                    this->m_palette[i][3] = this->m_chunkData[i];
+
+                return true;
+            case ::IE::PNGColorType::GRAYSCALE:
+            case ::IE::PNGColorType::RGB:
+                if (size != 2u * this->m_header.GetChannelCount())
+                    return false;
+
+                for (size_t c = 0u; c < this->m_header.GetChannelCount(); c++)
+                    this->m_transparentKey[c] = static_cast<std::uint16_t>((this->m_chunkData[2u * c] << 8u) | this->m_chunkData[2u * c + 1u]);
+
+                this->m_bHasTransparentKey = true;
+                return true;
+            default:
+                // Images with an alpha channel can't have one
+                return false;
+            }
+        }
+
+        // Sample "index" of a row ("m_bitDepth" bits, big endian)
+        inline std::uint32_t GetSample(const std::uint8_t* row, const size_t index) const noexcept
+        {
+            switch (this->m_header.m_bitDepth) {
+            case 16u: return (static_cast<std::uint32_t>(row[2u * index]) << 8u) | row[2u * index + 1u];
+            case 8u:  return row[index];
+            default:
+            {
+                const size_t depth = this->m_header.m_bitDepth;
+                const size_t bit   = index * depth;
+
+                return (row[bit >> 3u] >> (8u - depth - (bit & 7u))) & ((1u << depth) - 1u);
+            }
+            }
+        }
+
+        // Writes the "count" pixels of an unfiltered row to "dst" in RGBA8, "step" pixels apart
+        void ConvertRowToRGBA8(const std::uint8_t* src, const size_t count, std::uint8_t* dst, const size_t step) const noexcept
+        {
+            const size_t depth     = this->m_header.m_bitDepth;
+            const size_t dstStride = 4u * step;
+
+            // Samples are reduced to their most significant byte
+            const std::uint32_t scale = (depth < 8u) ? 0xFFu / ((1u << depth) - 1u) : 1u;
+            const size_t        shift = (depth == 16u) ? 8u : 0u;
+
+            switch (this->m_header.m_colorType) {
+            case ::IE::PNGColorType::GRAYSCALE:
+                for (size_t i = 0u; i < count; i++, dst += dstStride) {
+                    const std::uint32_t sample = this->GetSample(src, i);
+                    const std::uint8_t  gray   = static_cast<std::uint8_t>((sample >> shift) * scale);
+
+                    dst[0] = dst[1] = dst[2] = gray;
+                    dst[3] = (this->m_bHasTransparentKey && sample == this->m_transparentKey[0]) ? 0u : 0xFFu;
+                }
+                break;
+            case ::IE::PNGColorType::RGB:
+                for (size_t i = 0u; i < count; i++, dst += dstStride) {
+                    const std::uint32_t r = this->GetSample(src, 3u * i), g = this->GetSample(src, 3u * i + 1u), b = this->GetSample(src, 3u * i + 2u);
+
+                    dst[0] = static_cast<std::uint8_t>(r >> shift);
+                    dst[1] = static_cast<std::uint8_t>(g >> shift);
+                    dst[2] = static_cast<std::uint8_t>(b >> shift);
+                    dst[3] = (this->m_bHasTransparentKey && r == this->m_transparentKey[0] && g == this->m_transparentKey[1] && b == this->m_transparentKey[2]) ? 0u : 0xFFu;
+                }
+                break;
+            case ::IE::PNGColorType::PALETTE:
+                for (size_t i = 0u; i < count; i++, dst += dstStride) {
+                    const std::uint32_t index = this->GetSample(src, i);
+
+                    // Indices outside of the palette are black
+                    if (index < this->m_paletteSize)
+                        std::memcpy(dst, this->m_palette[index].data(), 4u);
+                    else
+                        dst[0] = dst[1] = dst[2] = 0u, dst[3] = 0xFFu;
+                }
+                break;
+            case ::IE::PNGColorType::GRAYSCALE_ALPHA:
+                for (size_t i = 0u; i < count; i++, dst += dstStride) {
+                    dst[0] = dst[1] = dst[2] = static_cast<std::uint8_t>(this->GetSample(src, 2u * i) >> shift);
+                    dst[3] = static_cast<std::uint8_t>(this->GetSample(src, 2u * i + 1u) >> shift);
+                }
+                break;
+            case ::IE::PNGColorType::RGBA:
+                if (depth == 8u && step == 1u) {
+                    std::memcpy(dst, src, 4u * count);
+                    break;
+                }
+
+                for (size_t i = 0u; i < count; i++, dst += dstStride)
+                    for (size_t c = 0u; c < 4u; c++)
+                        dst[c] = static_cast<std::uint8_t>(this->GetSample(src, 4u * i + c) >> shift);
+
+                break;
+            }
+        }
+
+        // Writes an unfiltered row of pass "pass" to the pixels
+        void EmitRow(const std::uint8_t* row, const size_t pass, const size_t passRow) noexcept
+        {
+            const ::IE::Internal::PNGPass& passInfo = this->GetPass(pass);
+
+            const size_t  count = this->GetPassWidth(pass);
+            std::uint8_t* dst   = this->m_pixels.data() + (passInfo.m_yStart + passRow * passInfo.m_yStep) * this->m_rowPitch;
+
+            if (this->m_options.m_format == Format::RGBA8) {
+                this->ConvertRowToRGBA8(row, count, dst + 4u * passInfo.m_xStart, passInfo.m_xStep);
+                return;
+            }
+
+            // Native pixels of interlaced images (the others are unfiltered in place)
+            const size_t bits = this->m_header.GetBitsPerPixel();
+
+            if (bits >= 8u) {
+                const size_t bytes = bits / 8u;
+
+                for (size_t i = 0u, x = passInfo.m_xStart; i < count; i++, x += passInfo.m_xStep)
+                    std::memcpy(dst + x * bytes, row + i * bytes, bytes);
+            } else {
+                // The rows start zeroed & each pixel is written once
+                for (size_t i = 0u, x = passInfo.m_xStart; i < count; i++, x += passInfo.m_xStep) {
+                    const size_t srcBit = i * bits, dstBit = x * bits;
+                    const std::uint32_t pixel = (row[srcBit >> 3u] >> (8u - bits - (srcBit & 7u))) & ((1u << bits) - 1u);
+
+                    dst[dstBit >> 3u] |= static_cast<std::uint8_t>(pixel << (8u - bits - (dstBit & 7u)));
+                }
+            }
+        }
+
+        // Unfilters the rows that were completely inflated
+        bool UnfilterRows() noexcept
+        {
+            const ::IE::Internal::SIMDKernels& kernels = ::IE::Internal::GetSIMDKernels();
+
+            const size_t available = this->m_inflater.GetOutputSize();
+            const size_t bpp       = std::max<size_t>(1u, this->m_header.GetBitsPerPixel() / 8u);
+            const std::uint8_t* const zeros = this->m_rows.data() + (this->m_bDirect ? 0u : 2u * this->m_rowStride);
+
+            while (this->m_pass < this->GetPassCount()) {
+                const size_t passWidth  = this->GetPassWidth(this->m_pass);
+                const size_t passHeight = this->GetPassHeight(this->m_pass);
+
+                if (passWidth == 0u || this->m_passRow >= passHeight) {
+                    this->m_pass++;
+                    this->m_passRow = 0u;
+                    continue;
+                }
+
+                const size_t rowBytes = this->m_header.GetRowBytes(passWidth);
+
+                if (this->m_filteredOffset + 1u + rowBytes > available)
+                    break;
+
+                const std::uint8_t* const filtered = this->m_filtered.data() + this->m_filteredOffset;
+
+                if (filtered[0] > ::IE::Internal::PNG_FILTER_PAETH)
+                    return false;
+
+                if (this->m_bDirect) {
+                    std::uint8_t* const row = this->m_pixels.data() + this->m_passRow * this->m_rowPitch;
+
+                    // The previous row is right before, the padding read past it is the row being written (and unused)
+                    const std::uint8_t* const prev = (this->m_passRow == 0u) ? zeros : row - this->m_rowPitch;
+
+                    kernels.m_pUnfilterPNGRow(filtered[0], filtered + 1u, row, prev, rowBytes, bpp);
+                } else {
+                    const std::uint8_t* const prev = (this->m_passRow == 0u) ? zeros : this->m_pPrevRow;
+
+                    kernels.m_pUnfilterPNGRow(filtered[0], filtered + 1u, this->m_pRow, prev, rowBytes, bpp);
+                    this->EmitRow(this->m_pRow, this->m_pass, this->m_passRow);
+
+                    std::swap(this->m_pRow, this->m_pPrevRow);
+                }
+
+                this->m_filteredOffset += 1u + rowBytes;
+                this->m_passRow++;
+
+                if (!this->m_header.m_bInterlaced)
+                    this->m_decodedRowCount = this->m_passRow;
+            }
+
+            if (this->m_pass == this->GetPassCount())
+                this->m_decodedRowCount = this->m_header.m_height;
+
+            return true;
+        }
+
+        void AppendCompressed(const std::uint8_t* data, const size_t size) noexcept
+        {
+            // The consumed bytes are dropped once they are the larger part of the buffer
+            if (this->m_compressedBegin > (this->m_compressedEnd - this->m_compressedBegin)) {
+                std::memmove(this->m_compressed.data(), this->m_compressed.data() + this->m_compressedBegin, this->m_compressedEnd - this->m_compressedBegin);
 
-		static inline ::IE::Matrix<_T> MakeZeros()    noexcept { return ::IE::Matrix<_T>(); }
+                this->m_compressedEnd  -= this->m_compressedBegin;
+                this->m_compressedBegin = 0u;
+            }
 
-		static inline ::IE::Matrix<_T> MakeIdentity() noexcept {
-			return ::IE::Matrix<_T>(std::array<_T, 16u>{
-				1, 0, 0, 0,
-				0, 1, 0, 0,
-				0, 0, 1, 0,
-				0, 0, 0, 1
-			});
-		}
+            this->m_compressed.resize(this->m_compressedEnd + size + ::IE::Inflater::INPUT_PADDING);
+            std::memcpy(this->m_compressed.data() + this->m_compressedEnd, data, size);
+            std::memset(this->m_compressed.data() + this->m_compressedEnd + size, 0, ::IE::Inflater::INPUT_PADDING);
 
-		static inline ::IE::Matrix<_T> MakeRotationX(const float radX = 0) noexcept
-		{
-			const _T sinX = std::sin(radX);
-			const _T cosX = std::cos(radX);
+            this->m_compressedEnd += size;
+        }
 
-			return ::IE::Matrix<_T>(std::array<_T, 16u>{
-				1, 0,    0,     0,
-				0, cosX, -sinX, 0,
-				0, sinX, cosX,  0,
-				0, 0,    0,     1
-			});
-		}
+        // Inflates & unfilters the compressed data received so far (the zlib stream)
+        bool DecompressAvailable() noexcept
+        {
+            const bool bFinal = this->m_bIDATFinished;
 
-		static inline ::IE::Matrix<_T> MakeRotationY(const float radY = 0) noexcept
-		{
-			const _T sinY = std::sin(radY);
-			const _T cosY = std::cos(radY);
+            if (this->m_compressed.size() < ::IE::Inflater::INPUT_PADDING)
+                this->m_compressed.assign(::IE::Inflater::INPUT_PADDING, 0u);
 
-			return ::IE::Matrix<_T>(std::array<_T, 16u>{
-				cosY,  0, sinY, 0,
-				0,     1, 0,    0,
-				-sinY, 0, cosY, 0,
-				0,     0, 0,    1
-			});
-		}
+            const std::uint8_t* const data = this->m_compressed.data();
 
-		static inline ::IE::Matrix<_T> MakeRotationZ(const float radZ = 0) noexcept
-		{
-			const _T sinZ = std::sin(radZ);
-			const _T cosZ = std::cos(radZ);
+            if (!this->m_bZlibHeaderRead) {
+                if (this->m_compressedEnd - this->m_compressedBegin < 2u)
+                    return !bFinal;
 
-			return ::IE::Matrix<_T>(std::array<_T, 16u>{
-				cosZ, -sinZ, 0, 0,
-				sinZ, cosZ,  0, 0,
-				0,    0,     1, 0,
-				0,    0,     0, 1
-			});
-		}
+                const std::uint8_t cmf = data[this->m_compressedBegin], flags = data[this->m_compressedBegin + 1u];
 
-		static inline ::IE::Matrix<_T> MakeRotation(const float radX = 0, const float radY = 0, const float radZ = 0) noexcept
-		{
-			return MakeRotationX(radX) * MakeRotationY(radY) * MakeRotationZ(radZ);
-		}
+                // Deflate with a window of at most 32KiB, a valid check & no preset dictionary
+                if ((cmf & 0x0Fu) != 8u || (cmf >> 4u) > 7u || ((static_cast<std::uint32_t>(cmf) << 8u) | flags) % 31u != 0u || (flags & 0x20u) != 0u)
+                    return false;
 
-		static inline ::IE::Matrix<_T> MakeRotation(const Vector<_T>& radians) noexcept
-		{
-			return Matrix<_T>::MakeRotation(radians.x, radians.y, radians.z);
-		}
+                this->m_compressedBegin += 2u;
+                this->m_bZlibHeaderRead  = true;
+            }
 
-		static inline ::IE::Matrix<_T> MakeTranslation(const float x, const float y, const float z) noexcept
-		{
-			return Matrix<_T>(std::array<_T, 16u>{
-				1,  0,  0,  0,
-				0,  1,  0,  0,
-				0,  0,  1,  0,
-				-x, -y, -z, 1,
-			});
-		}
+            if (!this->m_bInflateDone) {
+                const std::uint8_t* p = data + this->m_compressedBegin;
+                const ::IE::Inflater::Result result = this->m_inflater.Inflate(p, data + this->m_compressedEnd, bFinal);
 
-		static inline ::IE::Matrix<_T> MakeTranslation(const Vector<_T>& translation) noexcept
-		{
-			return Matrix<_T>::MakeTranslation(translation.x, translation.y, translation.z);
-		}
+                this->m_compressedBegin = static_cast<size_t>(p - data);
 
-		static inline ::IE::Matrix<_T> MakePerspective(const float zNear, const float zFar, const float fovRad, const float aspectRatio)
-		{
-			return Matrix<_T>(std::array<_T, 16u>{
-				aspectRatio * fovRad, 0,      0,                                0,
-				0,                    fovRad, 0,                                0,
-				0,                    0,      zFar / (zFar - zNear),            1,
-				0,                    0,      (-zFar * zNear) / (zFar - zNear), 1,
-			});
-		}
+                if (result == ::IE::Inflater::Result::FAILED)
+                    return false;
 
-		static inline ::IE::Matrix<_T> MakeScaling(const float scaleX = 1.0f, const float scaleY = 1.0f, const float scaleZ = 1.0f, const float scaleW = 1.0f) noexcept
-		{
-			return Matrix<_T>(std::array<_T, 16u>{
-				scaleX, 0, 0, 0,
-				0, scaleY, 0, 0,
-				0, 0, scaleZ, 0,
-				0, 0, 0, scaleW
-			});
-		}
+                const size_t outputSize = this->m_inflater.GetOutputSize();
 
-		static inline ::IE::Matrix<_T> MakeScaling(const Vecf32& scale) noexcept
-		{
-			return Matrix<_T>::MakeScaling(scale.x, scale.y, scale.z, scale.w);
-		}
+                if (this->m_options.m_bVerifyChecksums) {
+                    this->m_alder     = ::IE::ALDER32::Update(this->m_alder, this->m_filtered.data() + this->m_alderSize, outputSize - this->m_alderSize);
+                    this->m_alderSize = outputSize;
+                }
 
-		static inline ::IE::Matrix<_T> MakeTransposed(const Matrix<_T>& mat) noexcept
-		{
-			return Matrix<_T>(std::array<_T, 16u>{
-				mat(0, 0), mat(1, 0), mat(2, 0), mat(3, 0),
-				mat(0, 1), mat(1, 1), mat(2, 1), mat(3, 1),
-				mat(0, 2), mat(1, 2), mat(2, 2), mat(3, 2),
-				mat(0, 3), mat(1, 3), mat(2, 3), mat(3, 3)
-			});
-		}
+                if (!this->UnfilterRows())
+                    return false;
 
-		// Thanks to: https://stackoverflow.com/questions/349050/calculating-a-lookat-matrix
-		static inline ::IE::Matrix<_T> MakeLookAt(const ::IE::Vector<_T>& cameraPosition, const ::IE::Vector<_T>& focalPoint, const ::IE::Vector<_T>& upDirection) noexcept
-		{
-			const ::IE::Vector<_T> zaxis = ::IE::Vector<_T>::Normalized(focalPoint - cameraPosition);
-			const ::IE::Vector<_T> xaxis = ::IE::Vector<_T>::Normalized(Vector<_T>::CrossProduct3D(upDirection, zaxis));
-			const ::IE::Vector<_T> yaxis = ::IE::Vector<_T>::CrossProduct3D(zaxis, xaxis);
+                if (result == ::IE::Inflater::Result::NEEDS_INPUT)
+                    return !bFinal;
 
-			const _T m30 = -::IE::Vector<_T>::DotProduct(xaxis, cameraPosition);
-			const _T m31 = -::IE::Vector<_T>::DotProduct(yaxis, cameraPosition);
-			const _T m32 = -::IE::Vector<_T>::DotProduct(zaxis, cameraPosition);
+                // The stream must hold the image, no less
+                if (outputSize != this->m_filteredSize)
+                    return false;
 
-			return Matrix<_T>(std::array<_T, 16u>{
-				xaxis.x, yaxis.x, zaxis.x, 0,
-				xaxis.y, yaxis.y, zaxis.y, 0,
-				xaxis.z, yaxis.z, zaxis.z, 0,
-				m30,     m31,     m32,     1
-			});
-		}
-	};
+                this->m_bInflateDone = true;
+            }
 
-    // +--------------+     +--------------+     +--------------+
-    // | Math Library | --> | Matrix (4x4) | --> | Operators: * |
-    // +--------------+     +--------------+     +--------------+
+            if (!this->m_bTrailerRead) {
+                if (this->m_compressedEnd - this->m_compressedBegin < 4u)
+                    return !bFinal;
 
-	template <::IE::arithmetic _T, ::IE::arithmetic _T_2>
-	inline auto operator*(const ::IE::Matrix<_T>& matA, const ::IE::Matrix<_T_2>& matB) noexcept
-		-> ::IE::Matrix<decltype(matA[0] + matB[0])>
-	{
-		::IE::Matrix<decltype(matA[0] + matB[0])> matResult;
+                std::uint32_t alder;
+                std::memcpy(&alder, data + this->m_compressedBegin, sizeof(alder));
 
-		for (size_t r = 0u; r < 4u; r++) {
-			for (size_t c = 0u; c < 4u; c++) {
-				const ::IE::Vector<_T>   vecA = ::IE::Vector<_T>(matA(r, 0), matA(r, 1), matA(r, 2), matA(r, 3));
-				const ::IE::Vector<_T_2> vecB = ::IE::Vector<_T_2>(matB(0, c), matB(1, c), matB(2, c), matB(3, c));
+                if (this->m_options.m_bVerifyChecksums && ::IE::FromBigEndian(alder) != this->m_alder)
+                    return false;
 
-				matResult(r, c) = ::IE::Vector<>::DotProduct(vecA, vecB);
-			}
-		}
+                this->m_bTrailerRead = true;
+            }
 
-		return matResult;
-	}
+            return true;
+        }
 
-    /*
-	 * Multiplies a 1x4 vector with a 4x4 matrix like shown below :
-								    |----------------------------------------|
-								    | _T_2 m00; _T_2 m01; _T_2 m02; _T_2 m03 |
-								    | _T_2 m10; _T_2 m11; _T_2 m12; _T_2 m13 |
-	   |------------------------|   | _T_2 m20; _T_2 m21; _T_2 m22; _T_2 m23 |   |----------------------------|
-	   | _T x; _T y; _T z; _T w | * | _T_2 m30; _T_2 m31; _T_2 m32; _T_2 m33 | = | decltype(x+m00) x, y, z, w |
-	   |------------------------|   |----------------------------------------|   |----------------------------|
-	 */
+        // Called once the crc of the current chunk was read
+        bool EndChunk() noexcept
+        {
+            switch (this->m_chunkType) {
+            case ::IE::Internal::PNG_CHUNK_IHDR: return this->ParseHeader();
+            case ::IE::Internal::PNG_CHUNK_PLTE: return this->ParsePalette();
+            case ::IE::Internal::PNG_CHUNK_TRNS: return this->ParseTransparency();
+            case ::IE::Internal::PNG_CHUNK_IEND:
+                this->m_chunkState = ChunkState::END;
+
+                return this->m_bTrailerRead;
+            default:
+                return true;
+            }
+        }
 
-	template <::IE::arithmetic _T, ::IE::arithmetic _T_2>
-	inline auto operator*(const ::IE::Vector<_T>& vec, const ::IE::Matrix<_T_2>& mat) noexcept
-		-> ::IE::Vector<decltype(vec.x + mat[0])>
-	{
-		return ::IE::Vector<decltype(vec.x + mat[0])>(
-			::IE::Vector<>::DotProduct(vec, Vector<_T_2>(mat(0, 0), mat(1, 0), mat(2, 0), mat(3, 0))),
-			::IE::Vector<>::DotProduct(vec, Vector<_T_2>(mat(0, 1), mat(1, 1), mat(2, 1), mat(3, 1))),
-			::IE::Vector<>::DotProduct(vec, Vector<_T_2>(mat(0, 2), mat(1, 2), mat(2, 2), mat(3, 2))),
-			::IE::Vector<>::DotProduct(vec, Vector<_T_2>(mat(0, 3), mat(1, 3), mat(2, 3), mat(3, 3)))
-		);
-	}
+        // Called once the type & length of a chunk were read
+        bool BeginChunk(const std::uint32_t type, const std::uint32_t length) noexcept
+        {
+            if (length > 0x7FFFFFFFu)
+                return false;
 
-    // +--------------+     +--------------+     +----------+
-    // | Math Library | --> | Matrix (4x4) | --> | Printing |
-    // +--------------+     +--------------+     +----------+
+            // IHDR comes first & only once
+            if ((type == ::IE::Internal::PNG_CHUNK_IHDR) == this->m_bHeaderReady)
+                return false;
 
-	template <::IE::arithmetic _T>
-	inline std::ostream& operator<<(std::ostream& stream, const ::IE::Matrix<_T>& mat) noexcept
-	{
-		constexpr const size_t MAX_DIGITS = 5u;
+            if (type == ::IE::Internal::PNG_CHUNK_IDAT) {
+                // The IDAT chunks are consecutive
+                if (this->m_bIDATFinished || (this->m_header.m_colorType == ::IE::PNGColorType::PALETTE && this->m_paletteSize == 0u))
+                    return false;
 
-		stream << std::setprecision(MAX_DIGITS) << '|';
+                this->m_bIDATStarted = true;
+            } else if (this->m_bIDATStarted && !this->m_bIDATFinished) {
+                this->m_bIDATFinished = true;
 
-		for (size_t i = 0u; i < 4u * ((MAX_DIGITS + 1u) + 1u) + 1u; i++)
-			stream << '-';
+                if (!this->DecompressAvailable())
+                    return false;
+            }
 
-		stream << "|\n";
-		for (size_t r = 0u; r < 4u; r++) {
-			stream << "| ";
+            if (type == ::IE::Internal::PNG_CHUNK_IEND && !this->m_bIDATStarted)
+                return false;
 
-			for (size_t c = 0u; c < 4u; c++)
-				stream << std::setw(MAX_DIGITS + 1u) << mat(r, c) << ' ';
+            const bool bKnown = type == ::IE::Internal::PNG_CHUNK_IHDR || type == ::IE::Internal::PNG_CHUNK_PLTE || type == ::IE::Internal::PNG_CHUNK_IDAT ||
+                                type == ::IE::Internal::PNG_CHUNK_IEND || type == ::IE::Internal::PNG_CHUNK_TRNS;
 
-			stream << "|\n";
-		}
+            // Images can't be decoded without their critical chunks
+            if (!bKnown && (type & ::IE::Internal::PNG_CHUNK_ANCILLARY_BIT) == 0u)
+                return false;
 
-		stream << '|';
+            // Palette entries & transparency data are at most 768 bytes
+            if ((type == ::IE::Internal::PNG_CHUNK_IHDR || type == ::IE::Internal::PNG_CHUNK_PLTE || type == ::IE::Internal::PNG_CHUNK_TRNS) && length > 768u)
+                return false;
 
-		for (size_t i = 0u; i < 4u * ((MAX_DIGITS + 1u) + 1u) + 1u; i++)
-			stream << '-';
+            this->m_chunkType      = type;
+            this->m_chunkRemaining = length;
+            this->m_chunkData.clear();
 
-		stream << "|\n";
+            return true;
+        }
 
-		return stream;
-	}
+    public:
+        PNGDecoder() noexcept = default;
 
-    // +--------------+     +--------------+     +-----------------+
-    // | Math Library | --> | Matrix (4x4) | --> | Useful Typedefs |
-    // +--------------+     +--------------+     +-----------------+
+        PNGDecoder(const Options& options) noexcept
+            : m_options(options)
+        {  }
 
-	typedef ::IE::Matrix<std::enable_if_t<std::numeric_limits<float>::is_iec559, float>> Matf32;
+        PNGDecoder(const ::IE::PNGDecoder&) = delete;
+        ::IE::PNGDecoder& operator=(const ::IE::PNGDecoder&) = delete;
 
-    // +---------------+
-    // | Window System |
-    // +---------------+
+        /* Decodes the next bytes of the file. NEEDS_INPUT until the IEND chunk is reached (bytes after */
+        /* it are ignored), FAILED for good once the file was found to be invalid or too large.         */
+        Result Feed(const std::span<const std::uint8_t> bytes) noexcept
+        {
+            if (this->m_result != Result::NEEDS_INPUT)
+                return this->m_result;
 
-#if defined(__IE__OS_WINDOWS)
+            const std::uint8_t*       p    = bytes.data();
+            const std::uint8_t* const pEnd = bytes.data() + bytes.size();
 
-    static ::LRESULT CALLBACK WindowsWindowWindowProc(::HWND hwnd, ::UINT msg, ::WPARAM wParam, ::LPARAM lParam);
+            while (p < pEnd) {
+                switch (this->m_chunkState) {
+                case ChunkState::SIGNATURE:
+                    if (!this->Gather(p, pEnd, ::IE::Internal::PNG_SIGNATURE.size()))
+                        break;
 
-#endif // #if defined(__IE__OS_WINDOWS)
+                    if (!std::equal(::IE::Internal::PNG_SIGNATURE.begin(), ::IE::Internal::PNG_SIGNATURE.end(), this->m_gathered.begin()))
+                        return this->Fail();
 
-    class Window {
-#if defined(__IE__OS_WINDOWS)
-        friend static ::LRESULT CALLBACK ::IE::WindowsWindowWindowProc(::HWND hwnd, ::UINT msg, ::WPARAM wParam, ::LPARAM lParam);
-#endif // #if defined(__IE__OS_WINDOWS)
-    private:
-#if defined(__IE__OS_WINDOWS)
-        ::HWND m_windowHandle = NULL;
-#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
-        ::Display* m_pDisplayHandle = nullptr;
-        ::Window   m_windowHandle;
+                    this->m_chunkState = ChunkState::CHUNK_HEADER;
+                    break;
+                case ChunkState::CHUNK_HEADER:
+                    if (!this->Gather(p, pEnd, 8u))
+                        break;
 
-        ::Atom m_deleteMessage;
-#endif // end of #if defined(__IE__OS_LINUX)
+                    if (!this->BeginChunk(this->ReadGatheredU32(4u), this->ReadGatheredU32(0u)))
+                        return this->Fail();
 
-        ::IE::Vecu16 m_clientDimensions{ 0, 0 };
+                    // The crc covers the type & the data
+                    this->m_chunkCRC   = ::IE::CRC32::Update(::IE::CRC32::Init(), this->m_gathered.data() + 4u, 4u);
+                    this->m_chunkState = (this->m_chunkRemaining != 0u) ? ChunkState::CHUNK_DATA : ChunkState::CHUNK_CRC;
+                    break;
+                case ChunkState::CHUNK_DATA:
+                {
+                    const size_t n = std::min<size_t>(this->m_chunkRemaining, static_cast<size_t>(pEnd - p));
 
-        struct KeyboardData {
-            // Holds wether or not a key is down
-            std::array<bool, 0xFE> m_keyStates = { false };
-        } m_keyboardData;
+                    if (this->m_options.m_bVerifyChecksums)
+                        this->m_chunkCRC = ::IE::CRC32::Update(this->m_chunkCRC, p, n);
 
-        struct MousePointerData {
-            bool m_bLeftButtonDown  = false;
-            bool m_bRightButtonDown = false;
+                    if (this->m_chunkType == ::IE::Internal::PNG_CHUNK_IDAT) {
+                        // Data following the end of the zlib stream is ignored
+                        if (!this->m_bTrailerRead) {
+                            this->AppendCompressed(p, n);
 
-            ::IE::Vecu16 m_relativeCursorPosition{ 0u, 0u };
-        } m_mousePointerData;
+                            if (!this->DecompressAvailable())
+                                return this->Fail();
+                        }
+                    } else if (this->m_chunkType == ::IE::Internal::PNG_CHUNK_IHDR || this->m_chunkType == ::IE::Internal::PNG_CHUNK_PLTE ||
+                               this->m_chunkType == ::IE::Internal::PNG_CHUNK_TRNS) {
+                        this->m_chunkData.insert(this->m_chunkData.end(), p, p + n);
+                    }
 
-        bool m_bIsRunning = false;
+                    p += n;
+                    this->m_chunkRemaining -= static_cast<std::uint32_t>(n);
 
-    public:
-        Window(const std::uint16_t width, const std::uint16_t height, const char* title) noexcept
-            : m_clientDimensions(width, height)
-        {
-#if defined(__IE__OS_WINDOWS)
-            const ::HINSTANCE hInstance = GetModuleHandle(NULL);
-            
-            // Step 1 : Register Window Class
-            ::WNDCLASSA wc = { };
-            {
-                wc.lpfnWndProc   = ::IE::WindowsWindowWindowProc;
-                wc.hInstance     = hInstance;
-                wc.lpszClassName = "IE's Windows Window Class";
-                
-                ::RegisterClassA(&wc);
-            }
+                    if (this->m_chunkRemaining == 0u)
+                        this->m_chunkState = ChunkState::CHUNK_CRC;
 
-            // Step 2 : Create Window
-            {
-                // Get The Desired Window Rect From The desired Client Rect
-                ::RECT rect{ 0u, 0u, width, height };
-                if (::AdjustWindowRect(&rect, WS_OVERLAPPEDWINDOW, false) == 0)
-                    return;
+                    break;
+                }
+                case ChunkState::CHUNK_CRC:
+                    if (!this->Gather(p, pEnd, 4u))
+                        break;
 
-                // Create Window
-                this->m_windowHandle = ::CreateWindowExA(NULL, wc.lpszClassName, title, WS_OVERLAPPEDWINDOW,
-                                                         CW_USEDEFAULT, CW_USEDEFAULT, rect.right - rect.left, rect.bottom - rect.top,
-                                                         NULL, NULL, hInstance, NULL);
+                    if (this->m_options.m_bVerifyChecksums && this->ReadGatheredU32(0u) != ::IE::CRC32::Finalize(this->m_chunkCRC))
+                        return this->Fail();
 
-                if (this->m_windowHandle == NULL) return;
-            }
+                    this->m_chunkState = ChunkState::CHUNK_HEADER;
 
-            // Step 4 : Set Window Pointer To "this"
-            {
-#if defined(__IE__PLATFORM_X64)
-                SetWindowLongPtrA(this->m_windowHandle, GWLP_USERDATA, (LONG_PTR)this);
-#else // end of #if defined(__IE__PLATFORM_X64)
-                SetWindowLongA(this->m_windowHandle, GWLP_USERDATA, (LONG)this);
-#endif// end of else
+                    if (!this->EndChunk())
+                        return this->Fail();
+
+                    break;
+                case ChunkState::END:
+                    p = pEnd;
+                    break;
+                }
             }
-#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
 
-            // Fetch Display
-            this->m_pDisplayHandle = ::XOpenDisplay(0);
+            if (this->m_chunkState == ChunkState::END)
+                this->m_result = Result::DONE;
 
-            if (this->m_pDisplayHandle == NULL) return;
+            return this->m_result;
+        }
 
-            // Create Window
-            this->m_windowHandle = ::XCreateSimpleWindow(this->m_pDisplayHandle, DefaultRootWindow(this->m_pDisplayHandle),
-                                                         0, 0, width, height, 0,
-                                                         BlackPixel(this->m_pDisplayHandle, 0), WhitePixel(this->m_pDisplayHandle, 0));
+        inline Result GetResult() const noexcept { return this->m_result; }
 
-            // Receive WM_DELETE_WINDOW messages
-            this->m_deleteMessage = ::XInternAtom(this->m_pDisplayHandle, "WM_DELETE_WINDOW", False);
-            ::XSetWMProtocols(this->m_pDisplayHandle, this->m_windowHandle, &this->m_deleteMessage, 1);
+        // The header & the size of the pixels are known once the IHDR chunk was decoded
+        inline bool                   IsHeaderReady() const noexcept { return this->m_bHeaderReady; }
+        inline const ::IE::PNGHeader& GetHeader()     const noexcept { return this->m_header; }
 
-            // Set Title
-            ::XSetStandardProperties(this->m_pDisplayHandle, this->m_windowHandle, title, title, None, NULL, 0, NULL);
+        // Bytes between the start of two rows of pixels
+        inline size_t GetRowPitch() const noexcept { return this->m_rowPitch; }
 
-            // Select Input Masks
-            constexpr const long xEventMasks = ExposureMask | StructureNotifyMask | // Window
-                                               PointerMotionMask | ButtonPressMask | ButtonReleaseMask | // Mouse
-                                               KeyPressMask | KeyReleaseMask; // Keyboard
+        // Rows at the top of the image that are final
+        inline size_t GetDecodedRowCount() const noexcept { return this->m_decodedRowCount; }
 
-            ::XSelectInput(this->m_pDisplayHandle, this->m_windowHandle, xEventMasks);
-#endif // end of #if defined(__IE__OS_LINUX)
+        inline std::span<const std::uint8_t> GetPixels() const noexcept
+        {
+            return std::span<const std::uint8_t>(this->m_pixels.data(), this->m_bHeaderReady ? this->m_rowPitch * this->m_header.m_height : 0u);
+        }
 
-            this->Show();
+        // Moves the pixels out of the decoder
+        inline std::vector<std::uint8_t> TakePixels() noexcept
+        {
+            this->m_pixels.resize(this->GetPixels().size());
 
-            this->m_bIsRunning = true;
+            return std::move(this->m_pixels);
         }
 
-        bool Show() const noexcept
+        // RGBA entries (alpha from tRNS) of PALETTE images, for NATIVE pixels
+        inline std::span<const std::array<std::uint8_t, 4u>> GetPalette() const noexcept
         {
-#if defined(__IE__OS_WINDOWS)
-            return ::ShowWindow(this->m_windowHandle, SW_SHOW);
-#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
-            ::XMapWindow(this->m_pDisplayHandle, this->m_windowHandle);
-            ::XFlush(this->m_pDisplayHandle);
-
-            return true;
-#endif // end of #if defined(__IE__OS_LINUX)
+            return std::span<const std::array<std::uint8_t, 4u>>(this->m_palette.data(), this->m_paletteSize);
         }
-        
-        bool Minimize() const noexcept
+
+        // Decodes a whole file, returns false (and leaves "pixels" empty) if it is invalid
+        static bool Decode(const std::span<const std::uint8_t> file, ::IE::PNGHeader& header, std::vector<std::uint8_t>& pixels, const Options& options) noexcept
         {
-#if defined(__IE__OS_WINDOWS)
-            return ::ShowWindow(this->m_windowHandle, SW_MINIMIZE);
-#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
-            ::XUnmapWindow(this->m_pDisplayHandle, this->m_windowHandle);
-            ::XFlush(this->m_pDisplayHandle);
+            ::IE::PNGDecoder decoder(options);
 
-            return true;
-#endif // end of #if defined(__IE__OS_LINUX)       
-       }
+            if (decoder.Feed(file) != Result::DONE) {
+                pixels.clear();
+                return false;
+            }
 
-        inline bool IsRunning() const noexcept { return this->m_bIsRunning; }
+            header = decoder.GetHeader();
+            pixels = decoder.TakePixels();
 
-        // Keyboard
-        inline bool IsKeyUp  (const std::uint8_t key) const noexcept { return !this->m_keyboardData.m_keyStates[key]; }
-        inline bool IsKeyDown(const std::uint8_t key) const noexcept { return this->m_keyboardData.m_keyStates[key];  }
+            return true;
+        }
 
-        // Mouse
-        inline bool IsLeftButtonUp()    const noexcept { return !this->m_mousePointerData.m_bLeftButtonDown;  }
-        inline bool IsLeftButtonDown()  const noexcept { return this->m_mousePointerData.m_bLeftButtonDown;   }
-        inline bool IsRightButtonUp()   const noexcept { return !this->m_mousePointerData.m_bRightButtonDown; }
-        inline bool IsRightButtonDown() const noexcept { return this->m_mousePointerData.m_bRightButtonDown;  }
+        static bool Decode(const std::span<const std::uint8_t> file, ::IE::PNGHeader& header, std::vector<std::uint8_t>& pixels) noexcept
+        {
+            return ::IE::PNGDecoder::Decode(file, header, pixels, Options());
+        }
+    };
 
-        inline ::IE::Vecu16 GetRelativeCursorPosition() const noexcept { return this->m_mousePointerData.m_relativeCursorPosition; }
+    // +-----+     +---------+
+    // | PNG | --> | Encoder |
+    // +-----+     +---------+
 
-        // Window Dimensions
-        inline ::IE::Vecu16  GetClientDimensions() const noexcept { return this->m_clientDimensions;   }
-        inline std::uint16_t GetClientWidth()      const noexcept { return this->m_clientDimensions.x; }
-        inline std::uint16_t GetClientHeight()     const noexcept { return this->m_clientDimensions.y; }
+    namespace Internal {
+
+        // Rows of the encoder are filtered in bands of this many rows on separate threads
+        constexpr const size_t PNG_FILTER_BAND_ROWS = 32u;
 
-        void Update() noexcept
+        inline void FilterPNGRow(const ::IE::Internal::PNGFilter filter, std::uint8_t* filtered, const std::uint8_t* row, const std::uint8_t* prev,
+                                 const size_t length, const size_t bpp) noexcept
         {
-#if defined(__IE__OS_WINDOWS)
-            ::MSG msg = { };
-            while (PeekMessage(&msg, this->m_windowHandle, 0, 0, PM_REMOVE) > 0) {
-                ::TranslateMessage(&msg);
-                ::DispatchMessageA(&msg);
+            switch (filter) {
+            case ::IE::Internal::PNG_FILTER_NONE:
+                std::memcpy(filtered, row, length);
+                break;
+            case ::IE::Internal::PNG_FILTER_SUB:
+                for (size_t i = 0u; i < length; i++)
+                    filtered[i] = static_cast<std::uint8_t>(row[i] - ((i >= bpp) ? row[i - bpp] : 0u));
+                break;
+            case ::IE::Internal::PNG_FILTER_UP:
+                for (size_t i = 0u; i < length; i++)
+                    filtered[i] = static_cast<std::uint8_t>(row[i] - prev[i]);
+                break;
+            case ::IE::Internal::PNG_FILTER_AVERAGE:
+                for (size_t i = 0u; i < length; i++)
+                    filtered[i] = static_cast<std::uint8_t>(row[i] - ((((i >= bpp) ? row[i - bpp] : 0u) + prev[i]) >> 1u));
+                break;
+            case ::IE::Internal::PNG_FILTER_PAETH:
+                for (size_t i = 0u; i < length; i++)
+                    filtered[i] = static_cast<std::uint8_t>(row[i] - ::IE::Internal::PaethPredictor((i >= bpp) ? row[i - bpp] : 0u, prev[i], (i >= bpp) ? prev[i - bpp] : 0u));
+                break;
             }
-#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
-            // Process Events
-            ::XEvent xEvent;
-            while (XPending(this->m_pDisplayHandle))
-            {
-                XNextEvent(this->m_pDisplayHandle, &xEvent);
+        }
 
-                switch (xEvent.type) {
-                // Window Events
-                case ConfigureNotify:
-                    this->m_clientDimensions.x = xEvent.xconfigure.width;
-                    this->m_clientDimensions.y = xEvent.xconfigure.height;
+        // Sum of the filtered bytes as signed values, the smallest one usually compresses best (libpng's heuristic)
+        inline size_t GetPNGFilterCost(const std::uint8_t* filtered, const size_t length) noexcept
+        {
+            size_t cost = 0u;
 
-                    break;
-                case DestroyNotify:
-                    this->Close();
-                    return;
+            for (size_t i = 0u; i < length; i++)
+                cost += (filtered[i] < 128u) ? filtered[i] : 256u - filtered[i];
 
-                case ClientMessage:
-                    if ((::Atom)xEvent.xclient.data.l[0] == this->m_deleteMessage) {
-                        this->Close();
-                        return;
-                    }
+            return cost;
+        }
 
-                    break;
-                // Mouse Events
-                case MotionNotify:
-                    this->m_mousePointerData.m_relativeCursorPosition = {
-                        static_cast<uint16_t>(xEvent.xmotion.x),
-                        static_cast<uint16_t>(xEvent.xmotion.y)
-                    };
+        inline void WritePNGChunkHeader(std::vector<std::uint8_t>& file, const std::uint32_t type, const size_t length) noexcept
+        {
+            const std::array<std::uint32_t, 2u> header = { ::IE::FromBigEndian(static_cast<std::uint32_t>(length)), ::IE::FromBigEndian(type) };
 
-                    break;
-                case ButtonPress:
-                    switch (xEvent.xbutton.button) {
-                    case Button1:
-                        this->m_mousePointerData.m_bLeftButtonDown = true;
-                        break;
-                    case Button3:
-                        this->m_mousePointerData.m_bRightButtonDown = true;
-                        break;
-                    }
+            file.insert(file.end(), reinterpret_cast<const std::uint8_t*>(header.data()), reinterpret_cast<const std::uint8_t*>(header.data()) + sizeof(header));
+        }
 
-                    break;
-                case ButtonRelease:
-                    switch (xEvent.xbutton.button) {
-                    case 1:
-                        this->m_mousePointerData.m_bLeftButtonDown = false;
-                        break;
-                    case 3:
-                        this->m_mousePointerData.m_bRightButtonDown = false;
-                        break;
-                    }
+        inline void WritePNGChunkCRC(std::vector<std::uint8_t>& file, const std::uint32_t crc) noexcept
+        {
+            const std::uint32_t value = ::IE::FromBigEndian(crc);
 
-                    break;
-                // Keyboard Events
-                case KeyPress:
-                    this->m_keyboardData.m_keyStates[std::toupper(XLookupKeysym(&xEvent.xkey, 0))] = true;
+            file.insert(file.end(), reinterpret_cast<const std::uint8_t*>(&value), reinterpret_cast<const std::uint8_t*>(&value) + sizeof(value));
+        }
 
-                    break;
-                case KeyRelease:
-                    this->m_keyboardData.m_keyStates[std::toupper(XLookupKeysym(&xEvent.xkey, 0))] = false;
+        inline void WritePNGChunk(std::vector<std::uint8_t>& file, const std::uint32_t type, const std::span<const std::uint8_t> data) noexcept
+        {
+            ::IE::Internal::WritePNGChunkHeader(file, type, data.size());
+            file.insert(file.end(), data.begin(), data.end());
 
-                    break;
-                }
-            }
-#endif // end of #if defined(__IE__OS_LINUX)
+            // The type is part of the crc
+            ::IE::Internal::WritePNGChunkCRC(file, ::IE::CRC32::Finalize(::IE::CRC32::Calculate(file.data() + file.size() - data.size() - 4u, data.size() + 4u)));
         }
 
-        void Close()
+    } // Internal
+
+    /* PNG encoder for screenshots & frame dumps. The rows are filtered in parallel, then deflated   */
+    /* in independent chunks on as many threads (as pigz does) whose crcs & alder-32s are merged,    */
+    /* so the file is a regular PNG that any decoder reads. The level trades size for speed:        */
+    /* "HUFFMAN_ONLY" & "RLE" with the Paeth filter keep up with real-time captures, the others     */
+    /* pick the filter of each row with libpng's heuristic. Images are written non-interlaced.      */
+    /*     IE::PNGEncoder::Encode(renderTarget, fileBytes); // screenshots, as 8 bit RGB            */
+    class PNGEncoder {
+    public:
+        struct Options {
+            ::IE::DeflateLevel m_level       = ::IE::DeflateLevel::DEFAULT;
+            size_t             m_threadCount = 0u; // All the hardware threads for 0
+
+            // Colors of PALETTE images, a tRNS chunk is written if any of them is not opaque
+            std::span<const std::array<std::uint8_t, 4u>> m_palette;
+        };
+
+    private:
+        /* Writes the image whose rows are produced by "getRow(y, row)" (in the format of "header", */
+        /* "GetRowBytes(width)" bytes) to "file".                                                  */
+        template <typename _F>
+        static bool EncodeRows(const ::IE::PNGHeader& header, const _F& getRow, std::vector<std::uint8_t>& file, const Options& options) noexcept
         {
-#if defined(__IE__DEBUG_MODE)
-            assert(this->m_bIsRunning);
-#endif // #if defined(__IE__DEBUG_MODE)
+            if (!header.IsValid() || header.m_bInterlaced)
+                return false;
 
-#if defined(__IE__OS_WINDOWS)
-            ::CloseWindow(this->m_windowHandle);
-#elif defined(__IE__OS_LINUX) // end of #if defined(__IE__OS_WINDOWS)
-            // Destroy Window & Close Display
-            ::XDestroyWindow(this->m_pDisplayHandle, this->m_windowHandle);
-            ::XCloseDisplay(this->m_pDisplayHandle);
+            const bool bPalette = header.m_colorType == ::IE::PNGColorType::PALETTE;
 
-            this->m_pDisplayHandle = nullptr;
-#endif // end of #elif defined(__IE__OS_LINUX)
+            if (bPalette && (options.m_palette.empty() || options.m_palette.size() > (size_t(1) << header.m_bitDepth)))
+                return false;
 
-            this->m_bIsRunning = false;
-        }
+            const size_t threadCount = (options.m_threadCount == 0u) ? ::IE::GetHardwareThreadCount() : options.m_threadCount;
+            const size_t width       = header.m_width;
+            const size_t height      = header.m_height;
+            const size_t rowBytes    = header.GetRowBytes(width);
+            const size_t bpp         = std::max<size_t>(1u, header.GetBitsPerPixel() / 8u);
 
-        ~Window() noexcept
-        {
-            if (this->m_bIsRunning)
-                this->Close();
-        }
+            // Filtering does not help indices & packed samples (libpng's advice), the fast levels use Paeth only
+            const bool bAdaptive = !bPalette && header.m_bitDepth >= 8u && options.m_level >= ::IE::DeflateLevel::FAST;
+            const ::IE::Internal::PNGFilter fixedFilter = (!bPalette && header.m_bitDepth >= 8u) ? ::IE::Internal::PNG_FILTER_PAETH : ::IE::Internal::PNG_FILTER_NONE;
 
-    }; // Window
+            std::vector<std::uint8_t> filtered(height * (rowBytes + 1u));
 
-#if defined(__IE__OS_WINDOWS)
+            const size_t bandCount = (height + ::IE::Internal::PNG_FILTER_BAND_ROWS - 1u) / ::IE::Internal::PNG_FILTER_BAND_ROWS;
 
-    static ::LRESULT CALLBACK WindowsWindowWindowProc(::HWND hwnd, ::UINT msg, ::WPARAM wParam, ::LPARAM lParam)
-    {
-#ifdef __IE__PLATFORM_X64
-        Window* pWindow = reinterpret_cast<::IE::Window*>(::GetWindowLongPtrA(hwnd, GWLP_USERDATA));
-#else // end of #ifdef __IE__PLATFORM_X64
-        Window* pWindow = reinterpret_cast<::IE::Window*>(::GetWindowLongA(hwnd, GWLP_USERDATA));
-#endif // end of #else
+            ::IE::Internal::ParallelFor(bandCount, threadCount, [&](const size_t band) noexcept {
+                const size_t yStart = band * ::IE::Internal::PNG_FILTER_BAND_ROWS;
+                const size_t yEnd   = std::min(yStart + ::IE::Internal::PNG_FILTER_BAND_ROWS, height);
 
-        if (pWindow != nullptr) {
-            Window& window = *pWindow;
+                std::vector<std::uint8_t> rows(2u * rowBytes + (bAdaptive ? rowBytes : 0u));
+                std::uint8_t* row   = rows.data();
+                std::uint8_t* prev  = rows.data() + rowBytes;
+                std::uint8_t* trial = rows.data() + 2u * rowBytes;
 
-            switch (msg) {
-            // Window Events
-            case WM_SIZE:
-                window.m_clientDimensions = {
-                    static_cast<uint16_t>(GET_X_LPARAM(lParam)),
-                    static_cast<uint16_t>(GET_Y_LPARAM(lParam))
-                };
+                // The first row of a band is filtered against the last row of the previous one (zeros for the first row)
+                if (yStart > 0u)
+                    getRow(yStart - 1u, prev);
 
-                return 0;
-            case WM_DESTROY:
-                window.Close();
+                for (size_t y = yStart; y < yEnd; y++) {
+                    getRow(y, row);
 
-                return 0;
-            // Mouse Events
-            case WM_MOUSEMOVE:
-                window.m_mousePointerData.m_relativeCursorPosition = {
-                    static_cast<uint16_t>(GET_X_LPARAM(lParam)),
-                    static_cast<uint16_t>(GET_Y_LPARAM(lParam))
-                };
+                    std::uint8_t* const out = filtered.data() + y * (rowBytes + 1u);
 
-                return 0;
-            case WM_LBUTTONDOWN:
-                window.m_mousePointerData.m_bLeftButtonDown = true;
+                    ::IE::Internal::PNGFilter filter = fixedFilter;
 
-                return 0;
-            case WM_LBUTTONUP:
-                window.m_mousePointerData.m_bLeftButtonDown = false;
+                    if (bAdaptive) {
+                        size_t bestCost = std::numeric_limits<size_t>::max();
 
-                return 0;
-            case WM_RBUTTONDOWN:
-                window.m_mousePointerData.m_bRightButtonDown = true;
+                        for (std::uint8_t f = ::IE::Internal::PNG_FILTER_NONE; f <= ::IE::Internal::PNG_FILTER_PAETH; f++) {
+                            ::IE::Internal::FilterPNGRow(static_cast<::IE::Internal::PNGFilter>(f), trial, row, prev, rowBytes, bpp);
 
-                return 0;
-            case WM_RBUTTONUP:
-                window.m_mousePointerData.m_bRightButtonDown = false;
+                            const size_t cost = ::IE::Internal::GetPNGFilterCost(trial, rowBytes);
+                            if (cost < bestCost) {
+                                bestCost = cost;
+                                filter   = static_cast<::IE::Internal::PNGFilter>(f);
+                            }
+                        }
+                    }
 
-                return 0;
-            // Keyboard Events
-            case WM_KEYDOWN:
-                window.m_keyboardData.m_keyStates[(std::uint8_t)wParam] = true;
+                    out[0] = filter;
+                    ::IE::Internal::FilterPNGRow(filter, out + 1u, row, prev, rowBytes, bpp);
 
-                return 0;
-            case WM_KEYUP:
-                window.m_keyboardData.m_keyStates[(std::uint8_t)wParam] = false;
+                    std::swap(row, prev);
+                }
+            });
 
-                return 0;
-            }
-        }
+            const std::vector<::IE::Internal::DeflateChunk> chunks = ::IE::Internal::DeflateParallel(filtered, options.m_level, threadCount, true);
 
-        return ::DefWindowProcA(hwnd, msg, wParam, lParam);
-    }
+            file.clear();
+            file.insert(file.end(), ::IE::Internal::PNG_SIGNATURE.begin(), ::IE::Internal::PNG_SIGNATURE.end());
 
-#endif // #if defined(__IE__OS_WINDOWS)
+            // IHDR
+            const std::array<std::uint32_t, 2u> size = { ::IE::FromBigEndian(header.m_width), ::IE::FromBigEndian(header.m_height) };
 
-    // +----------------------+
-    // | Error Checking Codes |
-    // +----------------------+
+            std::array<std::uint8_t, 13u> ihdr = {};
+            std::memcpy(ihdr.data(), size.data(), sizeof(size));
+            ihdr[8] = header.m_bitDepth;
+            ihdr[9] = static_cast<std::uint8_t>(header.m_colorType);
 
-    // +----------------------+     +-----+
-    // | Error Checking Codes | --> | CRC |
-    // +----------------------+     +-----+
+            ::IE::Internal::WritePNGChunk(file, ::IE::Internal::PNG_CHUNK_IHDR, ihdr);
 
-    template <::IE::arithmetic _T, std::uint64_t _POLY>
-    struct CRC {
-        static _T Calculate(const std::uint8_t* data, const std::uint64_t len) noexcept
-        {
-            class CRCTable {
-            private:
-                std::array<_T, 256u> m_table;
-
-            public:
-                constexpr CRCTable() noexcept {
-                    // Calculate the CRC Table
-                    for (int dividend = 0u; dividend < m_table.size(); dividend++) {
-                        // Calculate Remainder With The Generator Polynomial
-                        _T remainder = dividend;
-
-                        for (int bit = 0u; bit < 8u; bit++) {
-                            if (remainder & 1)
-                                remainder = _POLY ^ (remainder >> 1u);
-                            else
-                                remainder >>= 1u;
-                        }
+            // PLTE & tRNS (without the opaque entries at its end)
+            if (bPalette) {
+                std::vector<std::uint8_t> palette;
+                size_t                    alphaCount = 0u;
 
-                        this->m_table[dividend] = remainder;
-                    }
+                for (size_t i = 0u; i < options.m_palette.size(); i++) {
+                    palette.insert(palette.end(), options.m_palette[i].begin(), options.m_palette[i].begin() + 3u);
+
+                    if (options.m_palette[i][3] != 0xFFu)
+                        alphaCount = i + 1u;
                 }
 
-                constexpr inline const _T& operator[](const std::uint16_t n) const noexcept { return this->m_table[n]; }
+                ::IE::Internal::WritePNGChunk(file, ::IE::Internal::PNG_CHUNK_PLTE, palette);
+
+                if (alphaCount > 0u) {
+                    palette.clear();
+
+                    for (size_t i = 0u; i < alphaCount; i++)
+                        palette.push_back(options.m_palette[i][3]);
+
+                    ::IE::Internal::WritePNGChunk(file, ::IE::Internal::PNG_CHUNK_TRNS, palette);
+                }
+            }
+
+            /* IDAT : the zlib stream, whose chunks were checksummed by their threads. Streams larger  */
+            /* than the limit of a PNG chunk are split into several IDATs between deflate chunks.       */
+            const std::array<std::uint8_t, 2u> zlibHeader = ::IE::Internal::GetZlibHeader(options.m_level);
+
+            std::uint32_t alder = ::IE::ALDER32::Init();
+            for (size_t c = 0u; c < chunks.size(); c++)
+                alder = ::IE::ALDER32::Combine(alder, chunks[c].m_alder, std::min(::IE::Internal::DEFLATE_CHUNK_SIZE, filtered.size() - c * ::IE::Internal::DEFLATE_CHUNK_SIZE));
+
+            const std::uint32_t zlibTrailer = ::IE::FromBigEndian(alder);
+
+            struct Piece {
+                const std::uint8_t* m_pData;
+                size_t              m_size;
+                std::uint32_t       m_crc;
             };
 
-            // Allocate & Generate The Static CRC Table
-            static constexpr CRCTable crcTable;
+            std::vector<Piece> pieces;
+            pieces.reserve(chunks.size() + 2u);
+
+            pieces.push_back({ zlibHeader.data(), zlibHeader.size(), ::IE::CRC32::Finalize(::IE::CRC32::Calculate(zlibHeader.data(), zlibHeader.size())) });
+            for (const ::IE::Internal::DeflateChunk& chunk : chunks)
+                pieces.push_back({ chunk.m_data.data(), chunk.m_data.size(), chunk.m_crc });
+            pieces.push_back({ reinterpret_cast<const std::uint8_t*>(&zlibTrailer), sizeof(zlibTrailer),
+                               ::IE::CRC32::Finalize(::IE::CRC32::Calculate(reinterpret_cast<const std::uint8_t*>(&zlibTrailer), sizeof(zlibTrailer))) });
+
+            const std::array<std::uint8_t, 4u> idatType = { 'I', 'D', 'A', 'T' };
+            const std::uint32_t idatTypeCRC = ::IE::CRC32::Finalize(::IE::CRC32::Calculate(idatType.data(), idatType.size()));
+
+            for (size_t first = 0u; first < pieces.size(); ) {
+                size_t last = first, length = 0u;
 
-            /* The "CRCTable" class is allocated as a "static" variable so that the crc look-up table                 */
-            /* can be computed once per template paramater pair. This let's us compute the tables once                */
-            /* and only when they are needed. They are defined as "contexpr" so that they can be genrated at compile- */
-            /* to take no overhead.                                                                                   */ 
+                for (; last < pieces.size() && (last == first || length + pieces[last].m_size <= 0x7FFFFFFFu); last++)
+                    length += pieces[last].m_size;
 
-            // Calculate CRC Value
-            _T crcValue = std::numeric_limits<_T>::max();
-            for (const uint8_t* pCurrent = data; pCurrent < data + len; pCurrent++) {
-                const _T lookupValue = crcTable[(crcValue ^ *pCurrent) & std::numeric_limits<uint8_t>::max()];
+                if (length > 0x7FFFFFFFu)
+                    return false;
 
-                crcValue = lookupValue ^ (crcValue >> 8u);
+                ::IE::Internal::WritePNGChunkHeader(file, ::IE::Internal::PNG_CHUNK_IDAT, length);
+
+                std::uint32_t crc = idatTypeCRC;
+                for (; first < last; first++) {
+                    file.insert(file.end(), pieces[first].m_pData, pieces[first].m_pData + pieces[first].m_size);
+                    crc = ::IE::CRC32::Combine(crc, pieces[first].m_crc, pieces[first].m_size);
+                }
+
+                ::IE::Internal::WritePNGChunkCRC(file, crc);
             }
 
-            return crcValue;
-        }
-    };
+            ::IE::Internal::WritePNGChunk(file, ::IE::Internal::PNG_CHUNK_IEND, {});
 
-    typedef ::IE::CRC<std::uint32_t, 0xEDB88320L> CRC32;
+            return true;
+        }
 
-    // +----------------------+     +----------+
-    // | Error Checking Codes | --> | ALDER-32 |
-    // +----------------------+     +----------+
+        // Packed BGRA colors (framebuffers & render targets) to 8 bit RGB rows
+        static bool EncodeBGRA(const std::uint32_t* pColors, const size_t stride, const std::uint16_t width, const std::uint16_t height,
+                               std::vector<std::uint8_t>& file, const Options& options) noexcept
+        {
+            ::IE::PNGHeader header;
+            header.m_width     = width;
+            header.m_height    = height;
+            header.m_bitDepth  = 8u;
+            header.m_colorType = ::IE::PNGColorType::RGB;
+
+            return PNGEncoder::EncodeRows(header, [&](const size_t y, std::uint8_t* row) noexcept {
+                const std::uint32_t* const colors = pColors + y * stride;
+
+                for (size_t x = 0u; x < width; x++) {
+                    row[3u * x + 0u] = static_cast<std::uint8_t>(colors[x] >> 16u);
+                    row[3u * x + 1u] = static_cast<std::uint8_t>(colors[x] >> 8u);
+                    row[3u * x + 2u] = static_cast<std::uint8_t>(colors[x]);
+                }
+            }, file, options);
+        }
 
-    struct ALDER32 {
-        static std::uint32_t Calculate(const std::uint8_t* data, const std::uint64_t len) noexcept
+    public:
+        /* Encodes "pixels", rows of "header.GetRowBytes(width)" bytes in the file's format (samples */
+        /* big endian, as "PNGDecoder::Format::NATIVE" decodes them) to "file". Fails for invalid or */
+        /* interlaced headers, and for PALETTE images without a fitting palette.                     */
+        static bool Encode(const ::IE::PNGHeader& header, const std::span<const std::uint8_t> pixels, std::vector<std::uint8_t>& file, const Options& options) noexcept
         {
-            constexpr const std::uint64_t ALDER32Modulo = 65521u;
+            const size_t rowBytes = header.GetRowBytes(header.m_width);
 
-            std::uint32_t low = 1u, high = 0u;
+            if (pixels.size() < rowBytes * header.m_height)
+                return false;
 
-            for (const std::uint8_t* pCurrent = data; pCurrent < data + len; pCurrent++) {
-                low  = (low  + *pCurrent) % ALDER32Modulo;
-                high = (high + low)       % ALDER32Modulo;
-            }
+            return PNGEncoder::EncodeRows(header, [&](const size_t y, std::uint8_t* row) noexcept {
+                std::memcpy(row, pixels.data() + y * rowBytes, rowBytes);
+            }, file, options);
+        }
 
-            return (high << 16u) | low;
+        static bool Encode(const ::IE::PNGHeader& header, const std::span<const std::uint8_t> pixels, std::vector<std::uint8_t>& file) noexcept
+        {
+            return PNGEncoder::Encode(header, pixels, file, Options());
         }
-    };
 
-    // +-------------------+
-    // | Endian Conversion |
-    // +-------------------+
+        // Screenshots, written as 8 bit RGB (the alpha of the colors is not meaningful)
+        static bool Encode(const ::IE::Framebuffer& framebuffer, std::vector<std::uint8_t>& file, const Options& options) noexcept
+        {
+            return framebuffer.IsValid() && PNGEncoder::EncodeBGRA(framebuffer.GetPixels(), framebuffer.GetStride(), framebuffer.GetWidth(), framebuffer.GetHeight(), file, options);
+        }
 
-    // https://stackoverflow.com/questions/105252/how-do-i-convert-between-big-endian-and-little-endian-values-in-c
-    template <typename _T>
-    inline _T SwapEndian(const _T& u) noexcept
-    {
-        union
+        static bool Encode(const ::IE::Framebuffer& framebuffer, std::vector<std::uint8_t>& file) noexcept
         {
-            _T u;
-            unsigned char u8[sizeof(_T)];
-        } source, dest;
+            return PNGEncoder::Encode(framebuffer, file, Options());
+        }
 
-        source.u = u;
+        static bool Encode(const ::IE::RenderTarget& target, std::vector<std::uint8_t>& file, const Options& options) noexcept
+        {
+            return target.IsValid() && PNGEncoder::EncodeBGRA(target.GetColors(), target.GetStride(), target.GetWidth(), target.GetHeight(), file, options);
+        }
 
-        for (size_t k = 0; k < sizeof(_T); k++)
-            dest.u8[k] = source.u8[sizeof(_T) - k - 1];
+        static bool Encode(const ::IE::RenderTarget& target, std::vector<std::uint8_t>& file) noexcept
+        {
+            return PNGEncoder::Encode(target, file, Options());
+        }
+    };
 
-        return dest.u;
-    }
+    // +-----------------------------+
+    // | Runtime Dispatch Resolution |
+    // +-----------------------------+
 
-    template <typename _T>
-    inline _T ReverseBits(const _T& input) noexcept {
-        _T output;
+    /* Every kernel is known at this point, so the dispatch table can be filled. Each tier falls */
+    /* back on the kernels of the tier below it for the operations it doesn't specialize.        */
 
-        for (size_t i = 0u; i < sizeof(_T) * 8u; i++)
-            output |= ((input >> i) & 1) << (sizeof(_T) * 8u - i - 1u);
+    inline void Internal::ResolveSIMDKernels(::IE::Internal::SIMDKernels& kernels, const ::IE::SIMDLevel level) noexcept
+    {
+        kernels.m_level = level;
+
+        kernels.m_pMatrixMultiplyF32       = &::IE::Internal::MatrixMultiplyF32Scalar;
+        kernels.m_pVectorMatrixMultiplyF32 = &::IE::Internal::VectorMatrixMultiplyF32Scalar;
+        kernels.m_pTransformBatchF32       = &::IE::Internal::TransformBatchF32Scalar;
+        kernels.m_pMatrixDeterminantF32    = &::IE::Internal::MatrixDeterminantF32Scalar;
+        kernels.m_pMatrixInverseF32        = &::IE::Internal::MatrixInverseF32Scalar;
+        kernels.m_pMatrixAffineInverseF32  = &::IE::Internal::MatrixAffineInverseF32Scalar;
+
+        kernels.m_pSlerpF32 = &::IE::Internal::SlerpF32Scalar;
+
+        kernels.m_pSoAAddF32            = &::IE::Internal::SoAElementwiseF32Scalar<::IE::Internal::SoAOperation::ADD>;
+        kernels.m_pSoASubF32            = &::IE::Internal::SoAElementwiseF32Scalar<::IE::Internal::SoAOperation::SUB>;
+        kernels.m_pSoAMulF32            = &::IE::Internal::SoAElementwiseF32Scalar<::IE::Internal::SoAOperation::MUL>;
+        kernels.m_pSoADivF32            = &::IE::Internal::SoAElementwiseF32Scalar<::IE::Internal::SoAOperation::DIV>;
+        kernels.m_pSoADotProductF32     = &::IE::Internal::SoADotProductF32Scalar;
+        kernels.m_pSoALengthF32         = &::IE::Internal::SoALengthF32Scalar;
+        kernels.m_pSoANormalizeF32      = &::IE::Internal::SoANormalizeF32Scalar;
+        kernels.m_pSoACrossProduct3DF32 = &::IE::Internal::SoACrossProduct3DF32Scalar;
+        kernels.m_pSoAReflectF32        = &::IE::Internal::SoAReflectF32Scalar;
+        kernels.m_pAoSToSoAF32          = &::IE::Internal::AoSToSoAF32Scalar;
+        kernels.m_pSoAToAoSF32          = &::IE::Internal::SoAToAoSF32Scalar;
+
+        kernels.m_pRasterizeTriangle = &::IE::Internal::RasterizeTriangleScalar;
+
+        kernels.m_pSampleImageU8  = &::IE::Internal::SampleImageScalar<false>;
+        kernels.m_pSampleImageF32 = &::IE::Internal::SampleImageScalar<true>;
+
+        kernels.m_pEncodeColors        = &::IE::Internal::EncodeColorsScalar;
+        kernels.m_pDecodeColors        = &::IE::Internal::DecodeColorsScalar;
+        kernels.m_pSwizzleRGBA8ToBGRA8 = &::IE::Internal::SwizzleRGBA8ToBGRA8Scalar;
+        kernels.m_pPackRGBA8ToRGB565   = &::IE::Internal::PackRGBA8ToRGB565Scalar;
+        kernels.m_pFloatToUnorm8       = &::IE::Internal::FloatToUnormScalar<std::uint8_t>;
+        kernels.m_pFloatToUnorm16      = &::IE::Internal::FloatToUnormScalar<std::uint16_t>;
+        kernels.m_pUnorm8ToFloat       = &::IE::Internal::UnormToFloatScalar<std::uint8_t>;
+        kernels.m_pUnorm16ToFloat      = &::IE::Internal::UnormToFloatScalar<std::uint16_t>;
+
+        kernels.m_pSkinVerticesF32 = &::IE::Internal::SkinVerticesF32Scalar;
+
+        kernels.m_pCullSpheresF32 = &::IE::Internal::CullSpheresF32Scalar;
+        kernels.m_pCullBoxesF32   = &::IE::Internal::CullBoxesF32Scalar;
+
+        kernels.m_pCRC32Update   = &::IE::Internal::CRC32UpdateScalar;
+        kernels.m_pALDER32Update = &::IE::Internal::ALDER32UpdateScalar;
+
+        kernels.m_pSwapEndian16  = &::IE::Internal::ReverseBytesScalar<2u, false>;
+        kernels.m_pSwapEndian32  = &::IE::Internal::ReverseBytesScalar<4u, false>;
+        kernels.m_pSwapEndian64  = &::IE::Internal::ReverseBytesScalar<8u, false>;
+        kernels.m_pReverseBits8  = &::IE::Internal::ReverseBytesScalar<1u, true>;
+        kernels.m_pReverseBits16 = &::IE::Internal::ReverseBytesScalar<2u, true>;
+        kernels.m_pReverseBits32 = &::IE::Internal::ReverseBytesScalar<4u, true>;
+        kernels.m_pReverseBits64 = &::IE::Internal::ReverseBytesScalar<8u, true>;
+
+        kernels.m_pUnfilterPNGRow = &::IE::Internal::UnfilterPNGRowScalar;
 
-        return output;
-    }
+#ifdef __IE__ENABLE_SIMD
+        if (level >= ::IE::SIMDLevel::SSE41) {
+            kernels.m_pMatrixMultiplyF32       = &::IE::Internal::MatrixMultiplyF32SSE41;
+            kernels.m_pVectorMatrixMultiplyF32 = &::IE::Internal::VectorMatrixMultiplyF32SSE41;
+            kernels.m_pTransformBatchF32       = &::IE::Internal::TransformBatchF32SSE41;
+            kernels.m_pMatrixDeterminantF32    = &::IE::Internal::MatrixDeterminantF32SSE41;
+            kernels.m_pMatrixInverseF32        = &::IE::Internal::MatrixInverseF32SSE41;
+            kernels.m_pMatrixAffineInverseF32  = &::IE::Internal::MatrixAffineInverseF32SSE41;
+
+            kernels.m_pSlerpF32 = &::IE::Internal::SlerpF32SSE41;
+
+            kernels.m_pSoAAddF32            = &::IE::Internal::SoAElementwiseF32SSE41<::IE::Internal::SoAOperation::ADD>;
+            kernels.m_pSoASubF32            = &::IE::Internal::SoAElementwiseF32SSE41<::IE::Internal::SoAOperation::SUB>;
+            kernels.m_pSoAMulF32            = &::IE::Internal::SoAElementwiseF32SSE41<::IE::Internal::SoAOperation::MUL>;
+            kernels.m_pSoADivF32            = &::IE::Internal::SoAElementwiseF32SSE41<::IE::Internal::SoAOperation::DIV>;
+            kernels.m_pSoADotProductF32     = &::IE::Internal::SoADotProductF32SSE41;
+            kernels.m_pSoALengthF32         = &::IE::Internal::SoALengthF32SSE41;
+            kernels.m_pSoANormalizeF32      = &::IE::Internal::SoANormalizeF32SSE41;
+            kernels.m_pSoACrossProduct3DF32 = &::IE::Internal::SoACrossProduct3DF32SSE41;
+            kernels.m_pSoAReflectF32        = &::IE::Internal::SoAReflectF32SSE41;
+            kernels.m_pAoSToSoAF32          = &::IE::Internal::AoSToSoAF32SSE41;
+            kernels.m_pSoAToAoSF32          = &::IE::Internal::SoAToAoSF32SSE41;
+
+            kernels.m_pRasterizeTriangle = &::IE::Internal::RasterizeTriangleSSE41;
+
+            kernels.m_pSampleImageU8  = &::IE::Internal::SampleImageU8SSE41;
+            kernels.m_pSampleImageF32 = &::IE::Internal::SampleImageF32SSE41;
+
+            kernels.m_pEncodeColors        = &::IE::Internal::EncodeColorsSSE41;
+            kernels.m_pDecodeColors        = &::IE::Internal::DecodeColorsSSE41;
+            kernels.m_pSwizzleRGBA8ToBGRA8 = &::IE::Internal::SwizzleRGBA8ToBGRA8SSE41;
+            kernels.m_pPackRGBA8ToRGB565   = &::IE::Internal::PackRGBA8ToRGB565SSE41;
+            kernels.m_pFloatToUnorm8       = &::IE::Internal::FloatToUnormSSE41<std::uint8_t>;
+            kernels.m_pFloatToUnorm16      = &::IE::Internal::FloatToUnormSSE41<std::uint16_t>;
+            kernels.m_pUnorm8ToFloat       = &::IE::Internal::UnormToFloatSSE41<std::uint8_t>;
+            kernels.m_pUnorm16ToFloat      = &::IE::Internal::UnormToFloatSSE41<std::uint16_t>;
+
+            kernels.m_pSkinVerticesF32 = &::IE::Internal::SkinVerticesF32SSE41;
+
+            kernels.m_pCullSpheresF32 = &::IE::Internal::CullSpheresF32SSE41;
+            kernels.m_pCullBoxesF32   = &::IE::Internal::CullBoxesF32SSE41;
+
+            kernels.m_pALDER32Update = &::IE::Internal::ALDER32UpdateSSE41;
+
+            if (::IE::GetCPUFeatures().m_bPCLMULQDQ)
+                kernels.m_pCRC32Update = &::IE::Internal::CRC32UpdatePCLMUL;
+
+            kernels.m_pSwapEndian16  = &::IE::Internal::ReverseBytesSSE41<2u, false>;
+            kernels.m_pSwapEndian32  = &::IE::Internal::ReverseBytesSSE41<4u, false>;
+            kernels.m_pSwapEndian64  = &::IE::Internal::ReverseBytesSSE41<8u, false>;
+            kernels.m_pReverseBits8  = &::IE::Internal::ReverseBytesSSE41<1u, true>;
+            kernels.m_pReverseBits16 = &::IE::Internal::ReverseBytesSSE41<2u, true>;
+            kernels.m_pReverseBits32 = &::IE::Internal::ReverseBytesSSE41<4u, true>;
+            kernels.m_pReverseBits64 = &::IE::Internal::ReverseBytesSSE41<8u, true>;
+
+            kernels.m_pUnfilterPNGRow = &::IE::Internal::UnfilterPNGRowSSE41;
+        }
 
-    template <typename _T>
-    inline _T FromBigEndian(const _T& val) noexcept {
-        if constexpr (std::endian::native == std::endian::big) {
-            return val;
-        } else if constexpr (std::endian::native == std::endian::little) {
-            return WS::SwapEndian(val);
-        } else {
-            static_assert(std::is_same<_T, _T>::value, "Inopine Can't Handle Your Target Platform's Endianness");
+        if (level >= ::IE::SIMDLevel::AVX2) {
+            kernels.m_pMatrixMultiplyF32       = &::IE::Internal::MatrixMultiplyF32AVX2;
+            kernels.m_pVectorMatrixMultiplyF32 = &::IE::Internal::VectorMatrixMultiplyF32AVX2;
+            kernels.m_pTransformBatchF32       = &::IE::Internal::TransformBatchF32AVX2;
+            kernels.m_pMatrixInverseF32        = &::IE::Internal::MatrixInverseF32AVX2;
+            kernels.m_pMatrixAffineInverseF32  = &::IE::Internal::MatrixAffineInverseF32AVX2;
+
+            kernels.m_pSlerpF32 = &::IE::Internal::SlerpF32AVX2;
+
+            kernels.m_pSoAAddF32            = &::IE::Internal::SoAElementwiseF32AVX2<::IE::Internal::SoAOperation::ADD>;
+            kernels.m_pSoASubF32            = &::IE::Internal::SoAElementwiseF32AVX2<::IE::Internal::SoAOperation::SUB>;
+            kernels.m_pSoAMulF32            = &::IE::Internal::SoAElementwiseF32AVX2<::IE::Internal::SoAOperation::MUL>;
+            kernels.m_pSoADivF32            = &::IE::Internal::SoAElementwiseF32AVX2<::IE::Internal::SoAOperation::DIV>;
+            kernels.m_pSoADotProductF32     = &::IE::Internal::SoADotProductF32AVX2;
+            kernels.m_pSoALengthF32         = &::IE::Internal::SoALengthF32AVX2;
+            kernels.m_pSoANormalizeF32      = &::IE::Internal::SoANormalizeF32AVX2;
+            kernels.m_pSoACrossProduct3DF32 = &::IE::Internal::SoACrossProduct3DF32AVX2;
+            kernels.m_pSoAReflectF32        = &::IE::Internal::SoAReflectF32AVX2;
+            kernels.m_pAoSToSoAF32          = &::IE::Internal::AoSToSoAF32AVX2;
+            kernels.m_pSoAToAoSF32          = &::IE::Internal::SoAToAoSF32AVX2;
+
+            kernels.m_pRasterizeTriangle = &::IE::Internal::RasterizeTriangleAVX2;
+
+            kernels.m_pSampleImageU8  = &::IE::Internal::SampleImageU8AVX2;
+            kernels.m_pSampleImageF32 = &::IE::Internal::SampleImageF32AVX2;
+
+            kernels.m_pEncodeColors        = &::IE::Internal::EncodeColorsAVX2;
+            kernels.m_pDecodeColors        = &::IE::Internal::DecodeColorsAVX2;
+            kernels.m_pSwizzleRGBA8ToBGRA8 = &::IE::Internal::SwizzleRGBA8ToBGRA8AVX2;
+            kernels.m_pPackRGBA8ToRGB565   = &::IE::Internal::PackRGBA8ToRGB565AVX2;
+            kernels.m_pFloatToUnorm8       = &::IE::Internal::FloatToUnormAVX2<std::uint8_t>;
+            kernels.m_pFloatToUnorm16      = &::IE::Internal::FloatToUnormAVX2<std::uint16_t>;
+            kernels.m_pUnorm8ToFloat       = &::IE::Internal::UnormToFloatAVX2<std::uint8_t>;
+            kernels.m_pUnorm16ToFloat      = &::IE::Internal::UnormToFloatAVX2<std::uint16_t>;
+
+            kernels.m_pSkinVerticesF32 = &::IE::Internal::SkinVerticesF32AVX2;
+
+            kernels.m_pCullSpheresF32 = &::IE::Internal::CullSpheresF32AVX2;
+            kernels.m_pCullBoxesF32   = &::IE::Internal::CullBoxesF32AVX2;
+
+            kernels.m_pALDER32Update = &::IE::Internal::ALDER32UpdateAVX2;
+
+            kernels.m_pSwapEndian16  = &::IE::Internal::ReverseBytesAVX2<2u, false>;
+            kernels.m_pSwapEndian32  = &::IE::Internal::ReverseBytesAVX2<4u, false>;
+            kernels.m_pSwapEndian64  = &::IE::Internal::ReverseBytesAVX2<8u, false>;
+            kernels.m_pReverseBits8  = &::IE::Internal::ReverseBytesAVX2<1u, true>;
+            kernels.m_pReverseBits16 = &::IE::Internal::ReverseBytesAVX2<2u, true>;
+            kernels.m_pReverseBits32 = &::IE::Internal::ReverseBytesAVX2<4u, true>;
+            kernels.m_pReverseBits64 = &::IE::Internal::ReverseBytesAVX2<8u, true>;
         }
-    }
 
-    template <typename _T>
-    inline _T FromLittleEndian(const _T& val) noexcept {
-        if constexpr (std::endian::native == std::endian::big) {
-            return WS::SwapEndian(val);
-        } else if constexpr (std::endian::native == std::endian::little) {
-            return val;
-        } else {
-            static_assert(std::is_same<_T, _T>::value, "Inopine Can't Handle Your Target Platform's Endianness");
+        if (level >= ::IE::SIMDLevel::AVX512) {
+            kernels.m_pMatrixMultiplyF32       = &::IE::Internal::MatrixMultiplyF32AVX512;
+            kernels.m_pTransformBatchF32       = &::IE::Internal::TransformBatchF32AVX512;
+            kernels.m_pMatrixInverseF32        = &::IE::Internal::MatrixInverseF32AVX512;
+            kernels.m_pMatrixAffineInverseF32  = &::IE::Internal::MatrixAffineInverseF32AVX512;
+
+            kernels.m_pSoAAddF32            = &::IE::Internal::SoAElementwiseF32AVX512<::IE::Internal::SoAOperation::ADD>;
+            kernels.m_pSoASubF32            = &::IE::Internal::SoAElementwiseF32AVX512<::IE::Internal::SoAOperation::SUB>;
+            kernels.m_pSoAMulF32            = &::IE::Internal::SoAElementwiseF32AVX512<::IE::Internal::SoAOperation::MUL>;
+            kernels.m_pSoADivF32            = &::IE::Internal::SoAElementwiseF32AVX512<::IE::Internal::SoAOperation::DIV>;
+            kernels.m_pSoADotProductF32     = &::IE::Internal::SoADotProductF32AVX512;
+            kernels.m_pSoALengthF32         = &::IE::Internal::SoALengthF32AVX512;
+            kernels.m_pSoANormalizeF32      = &::IE::Internal::SoANormalizeF32AVX512;
+            kernels.m_pSoACrossProduct3DF32 = &::IE::Internal::SoACrossProduct3DF32AVX512;
+            kernels.m_pSoAReflectF32        = &::IE::Internal::SoAReflectF32AVX512;
+            kernels.m_pAoSToSoAF32          = &::IE::Internal::AoSToSoAF32AVX512;
+            kernels.m_pSoAToAoSF32          = &::IE::Internal::SoAToAoSF32AVX512;
+
+            kernels.m_pRasterizeTriangle = &::IE::Internal::RasterizeTriangleAVX512;
+
+            kernels.m_pSwapEndian16  = &::IE::Internal::ReverseBytesAVX512<2u, false>;
+            kernels.m_pSwapEndian32  = &::IE::Internal::ReverseBytesAVX512<4u, false>;
+            kernels.m_pSwapEndian64  = &::IE::Internal::ReverseBytesAVX512<8u, false>;
+            kernels.m_pReverseBits8  = &::IE::Internal::ReverseBytesAVX512<1u, true>;
+            kernels.m_pReverseBits16 = &::IE::Internal::ReverseBytesAVX512<2u, true>;
+            kernels.m_pReverseBits32 = &::IE::Internal::ReverseBytesAVX512<4u, true>;
+            kernels.m_pReverseBits64 = &::IE::Internal::ReverseBytesAVX512<8u, true>;
         }
+#endif // #ifdef __IE__ENABLE_SIMD
     }
 
 } // IE
\ No newline at end of file
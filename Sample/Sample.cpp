@@ -1,18 +1,20 @@
 #include <Inopine/Inopine.hpp>
 #include <numbers>
-#include <chrono>
-#include <thread>
 
 int main(int argc, char** argv) {
     //std::cout << IE::Matf32::MakeRotationX(std::numbers::pi) << '\n';
+    std::cout << "SIMD Level: " << IE::GetSIMDLevelName(IE::GetSIMDLevel()) << '\n';
     
     ::IE::Window window(500, 500, "Inopine Test Window");
 
     auto s = window.GetClientDimensions();
     bool prev = false;
-    while (window.IsRunning()) {
-        window.Update();
+    std::uint32_t frameIndex = 0;
 
+    // Scroll the gradient 60 times per second, only waking up for updates and input
+    ::IE::RunLoop runLoop(window, 1'000'000'000 / 60);
+
+    runLoop.Run([&]() noexcept { ++frameIndex; }, [&]() {
         if (s != window.GetClientDimensions())
         {
             s = window.GetClientDimensions();
@@ -40,8 +42,18 @@ int main(int argc, char** argv) {
 
         std::cout << window.GetRelativeCursorPosition() << '\n';
 
-        std::this_thread::sleep_for(std::chrono::microseconds(16));
-    }
+        // Draw A Scrolling Gradient
+        ::IE::Framebuffer& framebuffer = window.GetFramebuffer();
+
+        for (std::uint16_t y = 0; y < framebuffer.GetHeight(); ++y) {
+            std::uint32_t* const pRow = framebuffer.GetRow(y);
+
+            for (std::uint16_t x = 0; x < framebuffer.GetWidth(); ++x)
+                pRow[x] = ::IE::Framebuffer::PackBGRA(static_cast<std::uint8_t>(x + frameIndex), static_cast<std::uint8_t>(y), 0x80u);
+        }
+
+        window.Present();
+    });
 
     return 0;
 }
\ No newline at end of file